@@ -49,7 +49,7 @@ typedef unsigned int GLenum;
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 153
+#define ANGLE_SH_VERSION 156
 
 typedef enum {
     SH_GLES2_SPEC,
@@ -222,6 +222,13 @@ typedef enum {
     // varying variables and built-in GLSL variables. This compiler
     // option is enabled automatically when needed.
     SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL = 0x1000000,
+
+    // Keep the parsed and validated AST of the last compiled source in the compiler. Compiling
+    // the same source again with this flag set only reruns the transformations that depend on
+    // the compile options and the output stage, skipping preprocessing, parsing and validation.
+    // The cached AST is only reused if the options that affect validation also match. Has no
+    // effect together with SH_REGENERATE_STRUCT_NAMES, which modifies shared struct types.
+    SH_CACHE_VALIDATED_TREE = 0x2000000,
 } ShCompileOptions;
 
 // Defines alternate strategies for implementing array index clamping.
@@ -462,6 +469,87 @@ COMPILER_EXPORT bool ShCompile(
     size_t numStrings,
     int compileOptions);
 
+// Variables of a shader as returned by ShReflect.
+struct COMPILER_EXPORT ShReflection
+{
+    ShReflection();
+    ~ShReflection();
+
+    bool success;
+    int shaderVersion;
+    std::string infoLog;
+
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::Varying> varyings;
+    std::vector<sh::Attribute> attributes;
+    std::vector<sh::OutputVariable> outputVariables;
+    std::vector<sh::InterfaceBlock> interfaceBlocks;
+
+    // For each entry of interfaceBlocks, the std140 layout of its fields keyed by field name and
+    // the block's data size in bytes. Both are empty for blocks that don't use the std140 layout,
+    // since the layout of packed and shared blocks is only known to the driver.
+    std::vector<std::map<std::string, sh::BlockMemberInfo>> interfaceBlockLayouts;
+    std::vector<size_t> interfaceBlockDataSizes;
+};
+
+//
+// Parses and validates the given shader source and collects its variables, without running
+// the transformations and the translation of ShCompile. This is much cheaper than ShCompile for
+// users that only need to know the interface of the shader.
+// If the function succeeds, the return value is true, else false.
+// Parameters:
+// handle: Specifies the handle of compiler to be used.
+// shaderStrings, numStrings: Specify the shader source, as for ShCompile.
+// compileOptions: As for ShCompile. SH_OBJECT_CODE and the options that select
+//                 transformations have no effect.
+// reflectionOut: Receives the variables and the info log of the shader.
+//
+COMPILER_EXPORT bool ShReflect(const ShHandle handle,
+                               const char *const shaderStrings[],
+                               size_t numStrings,
+                               int compileOptions,
+                               ShReflection *reflectionOut);
+
+//
+// Reflects a batch of shaders with the same compiler. Each shader is given by a single
+// null-terminated source string. reflectionsOut receives one entry per shader, in order.
+// Returns true if all the shaders were reflected successfully.
+//
+COMPILER_EXPORT bool ShReflectShaders(const ShHandle handle,
+                                      const char *const shaderSources[],
+                                      size_t numShaders,
+                                      int compileOptions,
+                                      std::vector<ShReflection> *reflectionsOut);
+
+// Results of compiling a single shader with ShCompileShaders.
+struct COMPILER_EXPORT ShCompileResult : public ShReflection
+{
+    ShCompileResult();
+    ~ShCompileResult();
+
+    std::string objectCode;
+};
+
+//
+// Compiles a batch of shaders of the type, spec and output of the given compiler, avoiding the
+// cost of constructing a compiler per shader. Each shader is given by a single null-terminated
+// source string. resultsOut receives one entry per shader, in order.
+// Returns true if all the shaders were compiled successfully.
+// Parameters:
+// handle: Specifies the handle of compiler to be used.
+// shaderSources, numShaders: Specify the sources of the shaders to compile.
+// compileOptions: As for ShCompile.
+// numThreads: If greater than one, the shaders are compiled on this many threads, each with its
+//             own compiler. The additional compilers are clones of the given compiler, which are
+//             created on first use and kept for later batches until the handle is destroyed.
+//
+COMPILER_EXPORT bool ShCompileShaders(const ShHandle handle,
+                                      const char *const shaderSources[],
+                                      size_t numShaders,
+                                      int compileOptions,
+                                      size_t numThreads,
+                                      std::vector<ShCompileResult> *resultsOut);
+
 // Clears the results from the previous compilation.
 COMPILER_EXPORT void ShClearResults(const ShHandle handle);
 
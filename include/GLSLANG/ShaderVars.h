@@ -193,6 +193,29 @@ struct COMPILER_EXPORT Varying : public ShaderVariable
     bool isInvariant;
 };
 
+// Location of an interface block field in the block's buffer, as computed by a block encoder.
+struct COMPILER_EXPORT BlockMemberInfo
+{
+    BlockMemberInfo() : offset(-1), arrayStride(-1), matrixStride(-1), isRowMajorMatrix(false) {}
+
+    BlockMemberInfo(int offset, int arrayStride, int matrixStride, bool isRowMajorMatrix)
+        : offset(offset),
+          arrayStride(arrayStride),
+          matrixStride(matrixStride),
+          isRowMajorMatrix(isRowMajorMatrix)
+    {}
+
+    static BlockMemberInfo getDefaultBlockInfo()
+    {
+        return BlockMemberInfo(-1, -1, -1, false);
+    }
+
+    int offset;
+    int arrayStride;
+    int matrixStride;
+    bool isRowMajorMatrix;
+};
+
 struct COMPILER_EXPORT InterfaceBlock
 {
     InterfaceBlock();
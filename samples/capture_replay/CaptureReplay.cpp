@@ -0,0 +1,1072 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CaptureReplay.cpp: Plays back a GL API trace recorded by the capture layer of libGLESv2, see
+// libGLESv2/capture_gles.h, and reports how long each frame took.
+//
+// Usage: capture_replay <trace file> [--renderer=d3d9|d3d11|gl|gles|default] [--null] [--finish]
+//   --null    Uses the null device of the D3D11 renderer, only the CPU overhead of ANGLE is
+//             measured.
+//   --finish  Calls glFinish at the end of each frame so the GPU time is included.
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "EGLWindow.h"
+#include "OSWindow.h"
+#include "Timer.h"
+#include "libGLESv2/capture_format.h"
+
+namespace
+{
+
+const size_t kDefaultWindowWidth  = 1280;
+const size_t kDefaultWindowHeight = 720;
+
+class TraceReader
+{
+  public:
+    TraceReader(const uint8_t *data, size_t size)
+        : mData(data), mSize(size), mOffset(0), mError(false)
+    {
+    }
+
+    uint32_t readUint() { return read<uint32_t>(); }
+    GLint readInt() { return read<int32_t>(); }
+    GLfloat readFloat() { return read<float>(); }
+    GLboolean readBoolean() { return static_cast<GLboolean>(read<uint32_t>()); }
+    int64_t readInt64() { return read<int64_t>(); }
+
+    std::string readString()
+    {
+        const uint32_t length = readUint();
+        const char *chars = reinterpret_cast<const char *>(readBytes(length));
+        return chars ? std::string(chars, length) : std::string();
+    }
+
+    // Returns client memory in place, or the offset into the bound buffer as a pointer.
+    const void *readMemory()
+    {
+        const gl::CaptureMemoryKind kind = static_cast<gl::CaptureMemoryKind>(read<uint32_t>());
+        switch (kind)
+        {
+            case gl::CaptureMemoryKind::Null:
+                return nullptr;
+
+            case gl::CaptureMemoryKind::Client:
+            {
+                const uint64_t size = read<uint64_t>();
+                return readBytes(static_cast<size_t>(size));
+            }
+
+            case gl::CaptureMemoryKind::BufferOffset:
+                return reinterpret_cast<const void *>(static_cast<uintptr_t>(read<uint64_t>()));
+
+            default:
+                mError = true;
+                return nullptr;
+        }
+    }
+
+    bool endOfTrace() const { return mOffset == mSize; }
+    bool error() const { return mError; }
+    void setError() { mError = true; }
+
+  private:
+    template <typename T>
+    T read()
+    {
+        T value = T();
+        const uint8_t *bytes = readBytes(sizeof(T));
+        if (bytes)
+        {
+            memcpy(&value, bytes, sizeof(T));
+        }
+        return value;
+    }
+
+    // Strings and client memory are padded, the values read after them stay aligned.
+    const uint8_t *readBytes(size_t size)
+    {
+        const size_t paddedSize = (size + gl::kCaptureAlignment - 1) & ~(gl::kCaptureAlignment - 1);
+        if (mError || size > mSize - mOffset || paddedSize > mSize - mOffset)
+        {
+            mError = true;
+            return nullptr;
+        }
+
+        const uint8_t *bytes = mData + mOffset;
+        mOffset += paddedSize;
+        return bytes;
+    }
+
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mOffset;
+    bool mError;
+};
+
+// The objects created during the replay can get different names than they had when captured.
+class ObjectMap
+{
+  public:
+    void add(GLuint captured, GLuint replayed) { mNames[captured] = replayed; }
+    void remove(GLuint captured) { mNames.erase(captured); }
+
+    GLuint get(GLuint captured) const
+    {
+        auto iter = mNames.find(captured);
+        return iter != mNames.end() ? iter->second : captured;
+    }
+
+  private:
+    std::unordered_map<GLuint, GLuint> mNames;
+};
+
+class CaptureReplay
+{
+  public:
+    CaptureReplay(const std::vector<uint8_t> &trace)
+        : mReader(trace.data(), trace.size()), mCurrentProgram(0)
+    {
+    }
+
+    bool readHeader(size_t *widthOut, size_t *heightOut);
+
+    // Returns false once the trace is over.
+    bool replayFrame();
+
+    bool error() const { return mReader.error(); }
+
+  private:
+    void replayCall(gl::CaptureCall call);
+
+    template <typename GenFunction>
+    void replayGen(GenFunction gen, ObjectMap *objects);
+
+    template <typename DeleteFunction>
+    void replayDelete(DeleteFunction deleteObjects, ObjectMap *objects);
+
+    GLint getUniformLocation(GLint capturedLocation) const;
+
+    TraceReader mReader;
+
+    ObjectMap mBuffers;
+    ObjectMap mFramebuffers;
+    ObjectMap mRenderbuffers;
+    ObjectMap mTextures;
+
+    // Shaders and programs share their names.
+    ObjectMap mShaderPrograms;
+
+    GLuint mCurrentProgram;
+    std::map<std::pair<GLuint, GLint>, GLint> mUniformLocations;
+};
+
+bool CaptureReplay::readHeader(size_t *widthOut, size_t *heightOut)
+{
+    if (mReader.readUint() != gl::kCaptureMagic)
+    {
+        printf("Not a trace file.\n");
+        return false;
+    }
+
+    const uint32_t version = mReader.readUint();
+    if (version != gl::kCaptureVersion)
+    {
+        printf("Unsupported trace version %u.\n", version);
+        return false;
+    }
+
+    *widthOut  = mReader.readUint();
+    *heightOut = mReader.readUint();
+    return !mReader.error();
+}
+
+bool CaptureReplay::replayFrame()
+{
+    while (!mReader.endOfTrace() && !mReader.error())
+    {
+        const gl::CaptureCall call = static_cast<gl::CaptureCall>(mReader.readUint());
+        if (call == gl::CaptureCall::EndFrame)
+        {
+            return true;
+        }
+
+        replayCall(call);
+    }
+
+    return false;
+}
+
+template <typename GenFunction>
+void CaptureReplay::replayGen(GenFunction gen, ObjectMap *objects)
+{
+    const GLsizei count = mReader.readInt();
+    const GLuint *captured = static_cast<const GLuint *>(mReader.readMemory());
+    if (count <= 0 || captured == nullptr)
+    {
+        return;
+    }
+
+    std::vector<GLuint> replayed(count);
+    gen(count, replayed.data());
+    for (GLsizei i = 0; i < count; i++)
+    {
+        objects->add(captured[i], replayed[i]);
+    }
+}
+
+template <typename DeleteFunction>
+void CaptureReplay::replayDelete(DeleteFunction deleteObjects, ObjectMap *objects)
+{
+    const GLsizei count = mReader.readInt();
+    const GLuint *captured = static_cast<const GLuint *>(mReader.readMemory());
+    if (count <= 0 || captured == nullptr)
+    {
+        return;
+    }
+
+    std::vector<GLuint> replayed(count);
+    for (GLsizei i = 0; i < count; i++)
+    {
+        replayed[i] = objects->get(captured[i]);
+        objects->remove(captured[i]);
+    }
+    deleteObjects(count, replayed.data());
+}
+
+GLint CaptureReplay::getUniformLocation(GLint capturedLocation) const
+{
+    auto iter = mUniformLocations.find(std::make_pair(mCurrentProgram, capturedLocation));
+    return iter != mUniformLocations.end() ? iter->second : capturedLocation;
+}
+
+void CaptureReplay::replayCall(gl::CaptureCall call)
+{
+    TraceReader &r = mReader;
+
+    switch (call)
+    {
+        case gl::CaptureCall::ActiveTexture:
+            glActiveTexture(r.readUint());
+            break;
+
+        case gl::CaptureCall::AttachShader:
+        {
+            const GLuint program = mShaderPrograms.get(r.readUint());
+            const GLuint shader  = mShaderPrograms.get(r.readUint());
+            glAttachShader(program, shader);
+            break;
+        }
+
+        case gl::CaptureCall::BindAttribLocation:
+        {
+            const GLuint program   = mShaderPrograms.get(r.readUint());
+            const GLuint index     = r.readUint();
+            const std::string name = r.readString();
+            glBindAttribLocation(program, index, name.c_str());
+            break;
+        }
+
+        case gl::CaptureCall::BindBuffer:
+        {
+            const GLenum target = r.readUint();
+            glBindBuffer(target, mBuffers.get(r.readUint()));
+            break;
+        }
+
+        case gl::CaptureCall::BindFramebuffer:
+        {
+            const GLenum target = r.readUint();
+            glBindFramebuffer(target, mFramebuffers.get(r.readUint()));
+            break;
+        }
+
+        case gl::CaptureCall::BindRenderbuffer:
+        {
+            const GLenum target = r.readUint();
+            glBindRenderbuffer(target, mRenderbuffers.get(r.readUint()));
+            break;
+        }
+
+        case gl::CaptureCall::BindTexture:
+        {
+            const GLenum target = r.readUint();
+            glBindTexture(target, mTextures.get(r.readUint()));
+            break;
+        }
+
+        case gl::CaptureCall::BlendColor:
+        {
+            const GLfloat red   = r.readFloat();
+            const GLfloat green = r.readFloat();
+            const GLfloat blue  = r.readFloat();
+            const GLfloat alpha = r.readFloat();
+            glBlendColor(red, green, blue, alpha);
+            break;
+        }
+
+        case gl::CaptureCall::BlendEquationSeparate:
+        {
+            const GLenum modeRGB   = r.readUint();
+            const GLenum modeAlpha = r.readUint();
+            glBlendEquationSeparate(modeRGB, modeAlpha);
+            break;
+        }
+
+        case gl::CaptureCall::BlendFuncSeparate:
+        {
+            const GLenum srcRGB   = r.readUint();
+            const GLenum dstRGB   = r.readUint();
+            const GLenum srcAlpha = r.readUint();
+            const GLenum dstAlpha = r.readUint();
+            glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+            break;
+        }
+
+        case gl::CaptureCall::BufferData:
+        {
+            const GLenum target   = r.readUint();
+            const GLsizeiptr size = static_cast<GLsizeiptr>(r.readInt64());
+            const void *data      = r.readMemory();
+            const GLenum usage    = r.readUint();
+            glBufferData(target, size, data, usage);
+            break;
+        }
+
+        case gl::CaptureCall::BufferSubData:
+        {
+            const GLenum target   = r.readUint();
+            const GLintptr offset = static_cast<GLintptr>(r.readInt64());
+            const GLsizeiptr size = static_cast<GLsizeiptr>(r.readInt64());
+            const void *data      = r.readMemory();
+            glBufferSubData(target, offset, size, data);
+            break;
+        }
+
+        case gl::CaptureCall::Clear:
+            glClear(r.readUint());
+            break;
+
+        case gl::CaptureCall::ClearColor:
+        {
+            const GLfloat red   = r.readFloat();
+            const GLfloat green = r.readFloat();
+            const GLfloat blue  = r.readFloat();
+            const GLfloat alpha = r.readFloat();
+            glClearColor(red, green, blue, alpha);
+            break;
+        }
+
+        case gl::CaptureCall::ClearDepthf:
+            glClearDepthf(r.readFloat());
+            break;
+
+        case gl::CaptureCall::ClearStencil:
+            glClearStencil(r.readInt());
+            break;
+
+        case gl::CaptureCall::ColorMask:
+        {
+            const GLboolean red   = r.readBoolean();
+            const GLboolean green = r.readBoolean();
+            const GLboolean blue  = r.readBoolean();
+            const GLboolean alpha = r.readBoolean();
+            glColorMask(red, green, blue, alpha);
+            break;
+        }
+
+        case gl::CaptureCall::CompileShader:
+            glCompileShader(mShaderPrograms.get(r.readUint()));
+            break;
+
+        case gl::CaptureCall::CompressedTexImage2D:
+        {
+            const GLenum target         = r.readUint();
+            const GLint level           = r.readInt();
+            const GLenum internalformat = r.readUint();
+            const GLsizei width         = r.readInt();
+            const GLsizei height        = r.readInt();
+            const GLint border          = r.readInt();
+            const GLsizei imageSize     = r.readInt();
+            const void *data            = r.readMemory();
+            glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize,
+                                   data);
+            break;
+        }
+
+        case gl::CaptureCall::CompressedTexSubImage2D:
+        {
+            const GLenum target     = r.readUint();
+            const GLint level       = r.readInt();
+            const GLint xoffset     = r.readInt();
+            const GLint yoffset     = r.readInt();
+            const GLsizei width     = r.readInt();
+            const GLsizei height    = r.readInt();
+            const GLenum format     = r.readUint();
+            const GLsizei imageSize = r.readInt();
+            const void *data        = r.readMemory();
+            glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
+                                      imageSize, data);
+            break;
+        }
+
+        case gl::CaptureCall::CopyTexImage2D:
+        {
+            const GLenum target         = r.readUint();
+            const GLint level           = r.readInt();
+            const GLenum internalformat = r.readUint();
+            const GLint x               = r.readInt();
+            const GLint y               = r.readInt();
+            const GLsizei width         = r.readInt();
+            const GLsizei height        = r.readInt();
+            const GLint border          = r.readInt();
+            glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+            break;
+        }
+
+        case gl::CaptureCall::CopyTexSubImage2D:
+        {
+            const GLenum target  = r.readUint();
+            const GLint level    = r.readInt();
+            const GLint xoffset  = r.readInt();
+            const GLint yoffset  = r.readInt();
+            const GLint x        = r.readInt();
+            const GLint y        = r.readInt();
+            const GLsizei width  = r.readInt();
+            const GLsizei height = r.readInt();
+            glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+            break;
+        }
+
+        case gl::CaptureCall::CreateProgram:
+            mShaderPrograms.add(r.readUint(), glCreateProgram());
+            break;
+
+        case gl::CaptureCall::CreateShader:
+        {
+            const GLenum type = r.readUint();
+            mShaderPrograms.add(r.readUint(), glCreateShader(type));
+            break;
+        }
+
+        case gl::CaptureCall::CullFace:
+            glCullFace(r.readUint());
+            break;
+
+        case gl::CaptureCall::DeleteBuffers:
+            replayDelete(glDeleteBuffers, &mBuffers);
+            break;
+
+        case gl::CaptureCall::DeleteFramebuffers:
+            replayDelete(glDeleteFramebuffers, &mFramebuffers);
+            break;
+
+        case gl::CaptureCall::DeleteProgram:
+        {
+            const GLuint program = r.readUint();
+            glDeleteProgram(mShaderPrograms.get(program));
+            mShaderPrograms.remove(program);
+            break;
+        }
+
+        case gl::CaptureCall::DeleteRenderbuffers:
+            replayDelete(glDeleteRenderbuffers, &mRenderbuffers);
+            break;
+
+        case gl::CaptureCall::DeleteShader:
+        {
+            const GLuint shader = r.readUint();
+            glDeleteShader(mShaderPrograms.get(shader));
+            mShaderPrograms.remove(shader);
+            break;
+        }
+
+        case gl::CaptureCall::DeleteTextures:
+            replayDelete(glDeleteTextures, &mTextures);
+            break;
+
+        case gl::CaptureCall::DepthFunc:
+            glDepthFunc(r.readUint());
+            break;
+
+        case gl::CaptureCall::DepthMask:
+            glDepthMask(r.readBoolean());
+            break;
+
+        case gl::CaptureCall::DepthRangef:
+        {
+            const GLfloat zNear = r.readFloat();
+            const GLfloat zFar  = r.readFloat();
+            glDepthRangef(zNear, zFar);
+            break;
+        }
+
+        case gl::CaptureCall::DetachShader:
+        {
+            const GLuint program = mShaderPrograms.get(r.readUint());
+            const GLuint shader  = mShaderPrograms.get(r.readUint());
+            glDetachShader(program, shader);
+            break;
+        }
+
+        case gl::CaptureCall::Disable:
+            glDisable(r.readUint());
+            break;
+
+        case gl::CaptureCall::DisableVertexAttribArray:
+            glDisableVertexAttribArray(r.readUint());
+            break;
+
+        case gl::CaptureCall::DrawArrays:
+        {
+            const GLenum mode   = r.readUint();
+            const GLint first   = r.readInt();
+            const GLsizei count = r.readInt();
+            glDrawArrays(mode, first, count);
+            break;
+        }
+
+        case gl::CaptureCall::DrawElements:
+        {
+            const GLenum mode   = r.readUint();
+            const GLsizei count = r.readInt();
+            const GLenum type   = r.readUint();
+            const void *indices = r.readMemory();
+            glDrawElements(mode, count, type, indices);
+            break;
+        }
+
+        case gl::CaptureCall::Enable:
+            glEnable(r.readUint());
+            break;
+
+        case gl::CaptureCall::EnableVertexAttribArray:
+            glEnableVertexAttribArray(r.readUint());
+            break;
+
+        case gl::CaptureCall::Finish:
+            glFinish();
+            break;
+
+        case gl::CaptureCall::Flush:
+            glFlush();
+            break;
+
+        case gl::CaptureCall::FramebufferRenderbuffer:
+        {
+            const GLenum target             = r.readUint();
+            const GLenum attachment         = r.readUint();
+            const GLenum renderbuffertarget = r.readUint();
+            const GLuint renderbuffer       = mRenderbuffers.get(r.readUint());
+            glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+            break;
+        }
+
+        case gl::CaptureCall::FramebufferTexture2D:
+        {
+            const GLenum target     = r.readUint();
+            const GLenum attachment = r.readUint();
+            const GLenum textarget  = r.readUint();
+            const GLuint texture    = mTextures.get(r.readUint());
+            const GLint level       = r.readInt();
+            glFramebufferTexture2D(target, attachment, textarget, texture, level);
+            break;
+        }
+
+        case gl::CaptureCall::FrontFace:
+            glFrontFace(r.readUint());
+            break;
+
+        case gl::CaptureCall::GenBuffers:
+            replayGen(glGenBuffers, &mBuffers);
+            break;
+
+        case gl::CaptureCall::GenerateMipmap:
+            glGenerateMipmap(r.readUint());
+            break;
+
+        case gl::CaptureCall::GenFramebuffers:
+            replayGen(glGenFramebuffers, &mFramebuffers);
+            break;
+
+        case gl::CaptureCall::GenRenderbuffers:
+            replayGen(glGenRenderbuffers, &mRenderbuffers);
+            break;
+
+        case gl::CaptureCall::GenTextures:
+            replayGen(glGenTextures, &mTextures);
+            break;
+
+        case gl::CaptureCall::GetUniformLocation:
+        {
+            const GLuint program   = r.readUint();
+            const std::string name = r.readString();
+            const GLint location   = r.readInt();
+            mUniformLocations[std::make_pair(program, location)] =
+                glGetUniformLocation(mShaderPrograms.get(program), name.c_str());
+            break;
+        }
+
+        case gl::CaptureCall::Hint:
+        {
+            const GLenum target = r.readUint();
+            const GLenum mode   = r.readUint();
+            glHint(target, mode);
+            break;
+        }
+
+        case gl::CaptureCall::LineWidth:
+            glLineWidth(r.readFloat());
+            break;
+
+        case gl::CaptureCall::LinkProgram:
+            glLinkProgram(mShaderPrograms.get(r.readUint()));
+            break;
+
+        case gl::CaptureCall::PixelStorei:
+        {
+            const GLenum pname = r.readUint();
+            const GLint param  = r.readInt();
+            glPixelStorei(pname, param);
+            break;
+        }
+
+        case gl::CaptureCall::PolygonOffset:
+        {
+            const GLfloat factor = r.readFloat();
+            const GLfloat units  = r.readFloat();
+            glPolygonOffset(factor, units);
+            break;
+        }
+
+        case gl::CaptureCall::RenderbufferStorage:
+        {
+            const GLenum target         = r.readUint();
+            const GLenum internalformat = r.readUint();
+            const GLsizei width         = r.readInt();
+            const GLsizei height        = r.readInt();
+            glRenderbufferStorage(target, internalformat, width, height);
+            break;
+        }
+
+        case gl::CaptureCall::SampleCoverage:
+        {
+            const GLfloat value    = r.readFloat();
+            const GLboolean invert = r.readBoolean();
+            glSampleCoverage(value, invert);
+            break;
+        }
+
+        case gl::CaptureCall::Scissor:
+        {
+            const GLint x        = r.readInt();
+            const GLint y        = r.readInt();
+            const GLsizei width  = r.readInt();
+            const GLsizei height = r.readInt();
+            glScissor(x, y, width, height);
+            break;
+        }
+
+        case gl::CaptureCall::ShaderSource:
+        {
+            const GLuint shader        = mShaderPrograms.get(r.readUint());
+            const std::string source   = r.readString();
+            const GLchar *sourceString = source.c_str();
+            glShaderSource(shader, 1, &sourceString, nullptr);
+            break;
+        }
+
+        case gl::CaptureCall::StencilFuncSeparate:
+        {
+            const GLenum face = r.readUint();
+            const GLenum func = r.readUint();
+            const GLint ref   = r.readInt();
+            const GLuint mask = r.readUint();
+            glStencilFuncSeparate(face, func, ref, mask);
+            break;
+        }
+
+        case gl::CaptureCall::StencilMaskSeparate:
+        {
+            const GLenum face = r.readUint();
+            const GLuint mask = r.readUint();
+            glStencilMaskSeparate(face, mask);
+            break;
+        }
+
+        case gl::CaptureCall::StencilOpSeparate:
+        {
+            const GLenum face  = r.readUint();
+            const GLenum fail  = r.readUint();
+            const GLenum zfail = r.readUint();
+            const GLenum zpass = r.readUint();
+            glStencilOpSeparate(face, fail, zfail, zpass);
+            break;
+        }
+
+        case gl::CaptureCall::TexImage2D:
+        {
+            const GLenum target        = r.readUint();
+            const GLint level          = r.readInt();
+            const GLint internalformat = r.readInt();
+            const GLsizei width        = r.readInt();
+            const GLsizei height       = r.readInt();
+            const GLint border         = r.readInt();
+            const GLenum format        = r.readUint();
+            const GLenum type          = r.readUint();
+            const void *pixels         = r.readMemory();
+            glTexImage2D(target, level, internalformat, width, height, border, format, type,
+                         pixels);
+            break;
+        }
+
+        case gl::CaptureCall::TexParameterf:
+        {
+            const GLenum target = r.readUint();
+            const GLenum pname  = r.readUint();
+            const GLfloat param = r.readFloat();
+            glTexParameterf(target, pname, param);
+            break;
+        }
+
+        case gl::CaptureCall::TexParameteri:
+        {
+            const GLenum target = r.readUint();
+            const GLenum pname  = r.readUint();
+            const GLint param   = r.readInt();
+            glTexParameteri(target, pname, param);
+            break;
+        }
+
+        case gl::CaptureCall::TexSubImage2D:
+        {
+            const GLenum target  = r.readUint();
+            const GLint level    = r.readInt();
+            const GLint xoffset  = r.readInt();
+            const GLint yoffset  = r.readInt();
+            const GLsizei width  = r.readInt();
+            const GLsizei height = r.readInt();
+            const GLenum format  = r.readUint();
+            const GLenum type    = r.readUint();
+            const void *pixels   = r.readMemory();
+            glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+            break;
+        }
+
+        case gl::CaptureCall::Uniform1fv:
+        case gl::CaptureCall::Uniform2fv:
+        case gl::CaptureCall::Uniform3fv:
+        case gl::CaptureCall::Uniform4fv:
+        {
+            const GLint location = getUniformLocation(r.readInt());
+            const GLsizei count  = r.readInt();
+            const GLfloat *v     = static_cast<const GLfloat *>(r.readMemory());
+            switch (call)
+            {
+                case gl::CaptureCall::Uniform1fv:
+                    glUniform1fv(location, count, v);
+                    break;
+                case gl::CaptureCall::Uniform2fv:
+                    glUniform2fv(location, count, v);
+                    break;
+                case gl::CaptureCall::Uniform3fv:
+                    glUniform3fv(location, count, v);
+                    break;
+                default:
+                    glUniform4fv(location, count, v);
+                    break;
+            }
+            break;
+        }
+
+        case gl::CaptureCall::Uniform1iv:
+        case gl::CaptureCall::Uniform2iv:
+        case gl::CaptureCall::Uniform3iv:
+        case gl::CaptureCall::Uniform4iv:
+        {
+            const GLint location = getUniformLocation(r.readInt());
+            const GLsizei count  = r.readInt();
+            const GLint *v       = static_cast<const GLint *>(r.readMemory());
+            switch (call)
+            {
+                case gl::CaptureCall::Uniform1iv:
+                    glUniform1iv(location, count, v);
+                    break;
+                case gl::CaptureCall::Uniform2iv:
+                    glUniform2iv(location, count, v);
+                    break;
+                case gl::CaptureCall::Uniform3iv:
+                    glUniform3iv(location, count, v);
+                    break;
+                default:
+                    glUniform4iv(location, count, v);
+                    break;
+            }
+            break;
+        }
+
+        case gl::CaptureCall::UniformMatrix2fv:
+        case gl::CaptureCall::UniformMatrix3fv:
+        case gl::CaptureCall::UniformMatrix4fv:
+        {
+            const GLint location      = getUniformLocation(r.readInt());
+            const GLsizei count       = r.readInt();
+            const GLboolean transpose = r.readBoolean();
+            const GLfloat *value      = static_cast<const GLfloat *>(r.readMemory());
+            switch (call)
+            {
+                case gl::CaptureCall::UniformMatrix2fv:
+                    glUniformMatrix2fv(location, count, transpose, value);
+                    break;
+                case gl::CaptureCall::UniformMatrix3fv:
+                    glUniformMatrix3fv(location, count, transpose, value);
+                    break;
+                default:
+                    glUniformMatrix4fv(location, count, transpose, value);
+                    break;
+            }
+            break;
+        }
+
+        case gl::CaptureCall::UseProgram:
+            mCurrentProgram = r.readUint();
+            glUseProgram(mShaderPrograms.get(mCurrentProgram));
+            break;
+
+        case gl::CaptureCall::VertexAttrib4f:
+        {
+            const GLuint index = r.readUint();
+            const GLfloat x    = r.readFloat();
+            const GLfloat y    = r.readFloat();
+            const GLfloat z    = r.readFloat();
+            const GLfloat w    = r.readFloat();
+            glVertexAttrib4f(index, x, y, z, w);
+            break;
+        }
+
+        case gl::CaptureCall::VertexAttribPointer:
+        {
+            const GLuint index         = r.readUint();
+            const GLint size           = r.readInt();
+            const GLenum type          = r.readUint();
+            const GLboolean normalized = r.readBoolean();
+            const GLsizei stride       = r.readInt();
+            const void *ptr            = r.readMemory();
+            glVertexAttribPointer(index, size, type, normalized, stride, ptr);
+            break;
+        }
+
+        case gl::CaptureCall::Viewport:
+        {
+            const GLint x        = r.readInt();
+            const GLint y        = r.readInt();
+            const GLsizei width  = r.readInt();
+            const GLsizei height = r.readInt();
+            glViewport(x, y, width, height);
+            break;
+        }
+
+        default:
+            printf("Unknown call %u in the trace.\n", static_cast<uint32_t>(call));
+            // The parameters of the call cannot be skipped, stop here.
+            mReader.setError();
+            break;
+    }
+}
+
+bool ReadTrace(const char *path, std::vector<uint8_t> *traceOut)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        printf("Failed to open %s.\n", path);
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    traceOut->resize(size > 0 ? static_cast<size_t>(size) : 0);
+    const bool success =
+        traceOut->empty() || fread(traceOut->data(), traceOut->size(), 1, file) == 1;
+    fclose(file);
+
+    if (!success)
+    {
+        printf("Failed to read %s.\n", path);
+    }
+    return success;
+}
+
+bool ParseRenderer(const char *name, EGLint *rendererOut)
+{
+    const std::pair<const char *, EGLint> kRenderers[] = {
+        {"default", EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE},
+        {"d3d9", EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE},
+        {"d3d11", EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE},
+        {"gl", EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE},
+        {"gles", EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE},
+    };
+
+    for (const auto &renderer : kRenderers)
+    {
+        if (strcmp(name, renderer.first) == 0)
+        {
+            *rendererOut = renderer.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    const char *tracePath = nullptr;
+    EGLint renderer       = EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE;
+    EGLint deviceType     = EGL_DONT_CARE;
+    bool finishFrames     = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--renderer=", 11) == 0)
+        {
+            if (!ParseRenderer(argv[i] + 11, &renderer))
+            {
+                printf("Unknown renderer %s.\n", argv[i] + 11);
+                return -1;
+            }
+        }
+        else if (strcmp(argv[i], "--null") == 0)
+        {
+            deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE;
+        }
+        else if (strcmp(argv[i], "--finish") == 0)
+        {
+            finishFrames = true;
+        }
+        else
+        {
+            tracePath = argv[i];
+        }
+    }
+
+    if (tracePath == nullptr)
+    {
+        printf("Usage: %s <trace file> [--renderer=d3d9|d3d11|gl|gles|default] [--null] "
+               "[--finish]\n",
+               argv[0]);
+        return -1;
+    }
+
+    // Only D3D11 has a real null device. D3D9's needs the reference rasterizer of the SDK, and the
+    // GL one still makes every call to the driver except the draws.
+    if (deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE &&
+        renderer != EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
+    {
+        printf("--null is only supported with --renderer=d3d11.\n");
+        return -1;
+    }
+
+    std::vector<uint8_t> trace;
+    if (!ReadTrace(tracePath, &trace))
+    {
+        return -1;
+    }
+
+    CaptureReplay replay(trace);
+    size_t width  = 0;
+    size_t height = 0;
+    if (!replay.readHeader(&width, &height))
+    {
+        return -1;
+    }
+
+    std::unique_ptr<OSWindow> osWindow(CreateOSWindow());
+    if (!osWindow->initialize("ANGLE capture replay", width > 0 ? width : kDefaultWindowWidth,
+                              height > 0 ? height : kDefaultWindowHeight))
+    {
+        return -1;
+    }
+    osWindow->setVisible(true);
+
+    std::unique_ptr<EGLWindow> eglWindow(
+        new EGLWindow(2, 0, EGLPlatformParameters(renderer, EGL_DONT_CARE, EGL_DONT_CARE,
+                                                  deviceType)));
+    eglWindow->setConfigRedBits(8);
+    eglWindow->setConfigGreenBits(8);
+    eglWindow->setConfigBlueBits(8);
+    eglWindow->setConfigAlphaBits(8);
+    eglWindow->setConfigDepthBits(24);
+    eglWindow->setConfigStencilBits(8);
+    eglWindow->setSwapInterval(0);
+
+    if (!eglWindow->initializeGL(osWindow.get()))
+    {
+        return -1;
+    }
+
+    std::unique_ptr<Timer> timer(CreateTimer());
+    std::vector<double> frameTimes;
+
+    timer->start();
+    double frameStart = 0.0;
+    while (replay.replayFrame())
+    {
+        if (finishFrames)
+        {
+            glFinish();
+        }
+        eglWindow->swap();
+
+        const double frameEnd = timer->getElapsedTime();
+        frameTimes.push_back((frameEnd - frameStart) * 1000.0);
+        printf("Frame %u: %.3f ms\n", static_cast<unsigned int>(frameTimes.size()),
+               frameTimes.back());
+
+        osWindow->messageLoop();
+        frameStart = timer->getElapsedTime();
+    }
+    timer->stop();
+
+    if (replay.error())
+    {
+        printf("The trace is truncated or corrupt.\n");
+    }
+
+    if (!frameTimes.empty())
+    {
+        double total = 0.0;
+        for (double frameTime : frameTimes)
+        {
+            total += frameTime;
+        }
+
+        std::vector<double> sortedFrameTimes = frameTimes;
+        std::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
+
+        printf("%u frames, mean %.3f ms, median %.3f ms, min %.3f ms, max %.3f ms\n",
+               static_cast<unsigned int>(frameTimes.size()), total / frameTimes.size(),
+               sortedFrameTimes[sortedFrameTimes.size() / 2], sortedFrameTimes.front(),
+               sortedFrameTimes.back());
+    }
+
+    eglWindow->destroyGL();
+    osWindow->destroy();
+
+    return replay.error() ? -1 : 0;
+}
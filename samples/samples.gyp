@@ -61,6 +61,14 @@
                 ],
             },
         },
+        {
+            'target_name': 'capture_replay',
+            'type': 'executable',
+            'dependencies': [ 'sample_util' ],
+            'includes': [ '../build/common_defines.gypi', ],
+            'include_dirs': [ '<(angle_path)/src', ],
+            'sources': [ 'capture_replay/CaptureReplay.cpp', ],
+        },
         {
             'target_name': 'hello_triangle',
             'type': 'executable',
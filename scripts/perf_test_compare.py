@@ -0,0 +1,130 @@
+#!/usr/bin/python
+#
+# Copyright 2016 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# perf_test_compare.py:
+#   Compares two sets of perftest results, e.g. written by angle_perftests
+#   --results-file=PATH before and after a change. For each measurement of
+#   which both sets have the list of all the trials, prints the change of the
+#   mean and whether it is statistically significant, using Welch's t-test.
+#
+#   Usage: perf_test_compare.py base_results.txt new_results.txt [alpha]
+#
+
+import math
+import re
+import sys
+
+# <*>RESULT <graph_name>: <trace_name>= [<value>,value,value,...,] <units>
+result_list_re = re.compile(r'^\*?RESULT (.+): (.+)= \[(.*)\] (.*)$')
+
+def read_results(path):
+    """Returns the lists of trials of the results file, indexed by graph and trace name."""
+    results = {}
+    with open(path) as results_file:
+        for line in results_file:
+            m = result_list_re.match(line.strip())
+            if not m:
+                continue
+            values = [float(value) for value in m.group(3).split(',') if value.strip()]
+            # Later runs of the same test add more trials.
+            key = (m.group(1), m.group(2))
+            results.setdefault(key, ([], m.group(4)))[0].extend(values)
+    return results
+
+def mean(data):
+    return float(sum(data)) / float(len(data))
+
+def sample_variance(data):
+    c = mean(data)
+    return sum((float(x) - c) ** 2 for x in data) / float(len(data) - 1)
+
+def incomplete_beta_fraction(a, b, x):
+    """Continued fraction of the regularized incomplete beta function (Numerical Recipes)."""
+    tiny = 1.0e-30
+    qab = a + b
+    qap = a + 1.0
+    qam = a - 1.0
+    c = 1.0
+    d = 1.0 - qab * x / qap
+    if abs(d) < tiny:
+        d = tiny
+    d = 1.0 / d
+    h = d
+    for m in range(1, 201):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        if abs(d) < tiny:
+            d = tiny
+        c = 1.0 + aa / c
+        if abs(c) < tiny:
+            c = tiny
+        d = 1.0 / d
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        if abs(d) < tiny:
+            d = tiny
+        c = 1.0 + aa / c
+        if abs(c) < tiny:
+            c = tiny
+        d = 1.0 / d
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1.0e-12:
+            break
+    return h
+
+def regularized_incomplete_beta(a, b, x):
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    log_front = (math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) +
+                 a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return math.exp(log_front) * incomplete_beta_fraction(a, b, x) / a
+    return 1.0 - math.exp(log_front) * incomplete_beta_fraction(b, a, 1.0 - x) / b
+
+def welch_t_test(base, new):
+    """Returns the two-tailed p-value of the means of base and new being equal."""
+    base_error = sample_variance(base) / len(base)
+    new_error = sample_variance(new) / len(new)
+    if base_error + new_error == 0.0:
+        return 1.0 if mean(base) == mean(new) else 0.0
+    t = (mean(new) - mean(base)) / math.sqrt(base_error + new_error)
+    # Welch-Satterthwaite degrees of freedom.
+    dof = (base_error + new_error) ** 2 / (base_error ** 2 / (len(base) - 1) +
+                                           new_error ** 2 / (len(new) - 1))
+    return regularized_incomplete_beta(dof / 2.0, 0.5, dof / (dof + t * t))
+
+def main():
+    if len(sys.argv) < 3:
+        print('Usage: ' + sys.argv[0] + ' base_results.txt new_results.txt [alpha]')
+        return 1
+
+    base_results = read_results(sys.argv[1])
+    new_results = read_results(sys.argv[2])
+    alpha = float(sys.argv[3]) if len(sys.argv) >= 4 else 0.05
+
+    for key in sorted(base_results.keys()):
+        if key not in new_results:
+            continue
+        base, units = base_results[key]
+        new = new_results[key][0]
+        if len(base) < 2 or len(new) < 2:
+            print('%s %s: not enough trials' % key)
+            continue
+
+        p_value = welch_t_test(base, new)
+        change = (mean(new) - mean(base)) / mean(base) * 100.0 if mean(base) != 0.0 else 0.0
+        print('%s %s: %.2f -> %.2f %s (%+.2f%%), p=%.4f%s' % (
+            key[0], key[1], mean(base), mean(new), units, change, p_value,
+            ', significant' if p_value < alpha else ''))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
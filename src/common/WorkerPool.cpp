@@ -0,0 +1,93 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// WorkerPool.cpp: Threads shared by the work that ANGLE splits between several threads.
+
+#include "common/WorkerPool.h"
+
+#include <algorithm>
+
+namespace angle
+{
+
+namespace
+{
+
+// More workers than this mostly contend for the memory bandwidth.
+const unsigned int kMaxThreads = 8;
+
+}  // anonymous namespace
+
+// static
+WorkerPool *WorkerPool::Get()
+{
+    static WorkerPool *pool = new WorkerPool();
+    return pool;
+}
+
+WorkerPool::WorkerPool() : mJob(nullptr), mJobSerial(0), mActiveWorkers(0)
+{
+    const unsigned int threadCount =
+        std::min(std::max(std::thread::hardware_concurrency(), 1u), kMaxThreads);
+    for (unsigned int workerIndex = 1; workerIndex < threadCount; ++workerIndex)
+    {
+        mWorkers.emplace_back(&WorkerPool::threadMain, this);
+    }
+}
+
+bool WorkerPool::run(const std::function<void()> &runItems)
+{
+    std::unique_lock<std::mutex> runLock(mRunMutex, std::try_to_lock);
+    if (!runLock.owns_lock())
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJob = &runItems;
+        mJobSerial++;
+    }
+    mWorkCondition.notify_all();
+
+    runItems();
+
+    // All the items are claimed, but workers may still be running theirs. The workers that have
+    // not picked the job up yet will find it gone.
+    std::unique_lock<std::mutex> lock(mMutex);
+    mJob = nullptr;
+    mIdleCondition.wait(lock, [this]() { return mActiveWorkers == 0; });
+    return true;
+}
+
+void WorkerPool::threadMain()
+{
+    uint64_t seenJobSerial = 0;
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mWorkCondition.wait(lock, [this, seenJobSerial]() { return mJobSerial != seenJobSerial; });
+        seenJobSerial = mJobSerial;
+
+        const std::function<void()> *job = mJob;
+        if (job == nullptr)
+        {
+            continue;
+        }
+
+        mActiveWorkers++;
+        lock.unlock();
+        (*job)();
+        lock.lock();
+
+        if (--mActiveWorkers == 0)
+        {
+            mIdleCondition.notify_one();
+        }
+    }
+}
+
+}  // namespace angle
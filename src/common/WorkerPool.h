@@ -0,0 +1,60 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// WorkerPool.h: Threads shared by the work that ANGLE splits between several threads, like large
+// image loads.
+
+#ifndef COMMON_WORKERPOOL_H_
+#define COMMON_WORKERPOOL_H_
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+// One job runs on the pool at a time, and the thread submitting it works on it as well.
+class WorkerPool final : angle::NonCopyable
+{
+  public:
+    // The pool is never destroyed, so that the workers are never joined while the library unloads.
+    static WorkerPool *Get();
+
+    // Number of threads working on a job, including the submitting thread.
+    size_t getThreadCount() const { return mWorkers.size() + 1; }
+
+    // Calls |runItems| on the submitting thread and on all the workers, and returns once all the
+    // calls returned. |runItems| must claim the items of the job atomically, and return when no
+    // item is left. Returns false without calling |runItems| when another job is using the pool.
+    bool run(const std::function<void()> &runItems);
+
+  private:
+    WorkerPool();
+
+    void threadMain();
+
+    // Held by the thread submitting a job for its whole duration.
+    std::mutex mRunMutex;
+
+    // Protects the members below.
+    std::mutex mMutex;
+    std::condition_variable mWorkCondition;
+    std::condition_variable mIdleCondition;
+    const std::function<void()> *mJob;
+    uint64_t mJobSerial;
+    size_t mActiveWorkers;
+
+    std::vector<std::thread> mWorkers;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_WORKERPOOL_H_
@@ -8,6 +8,7 @@
 #include "common/debug.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #include <limits>
 #include <vector>
@@ -51,3 +52,114 @@ std::string FormatString(const char *fmt, ...)
     va_end(vararg);
     return result;
 }
+
+namespace
+{
+const uint64_t kHashPrime1 = 0x9E3779B185EBCA87ull;
+const uint64_t kHashPrime2 = 0xC2B2AE3D27D4EB4Full;
+const uint64_t kHashPrime3 = 0x165667B19E3779F9ull;
+
+inline uint64_t RotateLeft64(uint64_t value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+inline uint64_t ReadUint64(const uint8_t *bytes)
+{
+    uint64_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint64_t HashRound(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * kHashPrime2;
+    accumulator = RotateLeft64(accumulator, 31);
+    return accumulator * kHashPrime1;
+}
+
+inline uint64_t HashBytes(uint64_t hash, const uint8_t *bytes, const uint8_t *end)
+{
+    for (; bytes + 8 <= end; bytes += 8)
+    {
+        hash ^= HashRound(0, ReadUint64(bytes));
+        hash = RotateLeft64(hash, 27) * kHashPrime1 + kHashPrime3;
+    }
+
+    for (; bytes < end; bytes++)
+    {
+        hash ^= (*bytes) * kHashPrime3;
+        hash = RotateLeft64(hash, 11) * kHashPrime1;
+    }
+
+    return hash;
+}
+
+// Final avalanche so that small input differences spread over all bits.
+inline uint64_t HashAvalanche(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= kHashPrime2;
+    hash ^= hash >> 29;
+    hash *= kHashPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+}  // anonymous namespace
+
+uint64_t ComputeFastHash64(const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    const uint8_t *end   = bytes + size;
+
+    uint64_t hash = 0;
+    if (size >= 32)
+    {
+        // Four independent lanes keep the multiplies pipelined on large inputs.
+        uint64_t lanes[4] = {kHashPrime1 + kHashPrime2, kHashPrime2, 0, 0 - kHashPrime1};
+        const uint8_t *blockEnd = end - 32;
+        for (; bytes <= blockEnd; bytes += 32)
+        {
+            lanes[0] = HashRound(lanes[0], ReadUint64(bytes + 0));
+            lanes[1] = HashRound(lanes[1], ReadUint64(bytes + 8));
+            lanes[2] = HashRound(lanes[2], ReadUint64(bytes + 16));
+            lanes[3] = HashRound(lanes[3], ReadUint64(bytes + 24));
+        }
+
+        hash = RotateLeft64(lanes[0], 1) + RotateLeft64(lanes[1], 7) +
+               RotateLeft64(lanes[2], 12) + RotateLeft64(lanes[3], 18);
+        for (uint64_t lane : lanes)
+        {
+            hash ^= HashRound(0, lane);
+            hash = hash * kHashPrime1 + kHashPrime3;
+        }
+    }
+    else
+    {
+        hash = kHashPrime3;
+    }
+
+    hash += static_cast<uint64_t>(size);
+    hash = HashBytes(hash, bytes, end);
+    return HashAvalanche(hash);
+}
+
+uint64_t ComputeFastHash64Strided(const void *data,
+                                  size_t elementSize,
+                                  size_t stride,
+                                  size_t elementCount)
+{
+    if (stride == elementSize)
+    {
+        return ComputeFastHash64(data, elementSize * elementCount);
+    }
+
+    const uint8_t *element = static_cast<const uint8_t *>(data);
+
+    uint64_t hash = kHashPrime3 + static_cast<uint64_t>(elementSize * elementCount);
+    for (size_t elementIndex = 0; elementIndex < elementCount; ++elementIndex, element += stride)
+    {
+        hash = HashBytes(hash, element, element + elementSize);
+    }
+    return HashAvalanche(hash);
+}
@@ -14,6 +14,7 @@
 #include <climits>
 #include <cstdarg>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <set>
 #include <sstream>
@@ -156,6 +157,17 @@ size_t FormatStringIntoVector(const char *fmt, va_list vararg, std::vector<char>
 std::string FormatString(const char *fmt, va_list vararg);
 std::string FormatString(const char *fmt, ...);
 
+// Fast non-cryptographic 64-bit hash, used to detect whether a block of memory changed.
+uint64_t ComputeFastHash64(const void *data, size_t size);
+
+// Same, over the first |elementSize| bytes of |elementCount| elements laid out |stride| bytes
+// apart. The bytes between the elements, like the other attributes of an interleaved vertex, are
+// not read.
+uint64_t ComputeFastHash64Strided(const void *data,
+                                  size_t elementSize,
+                                  size_t stride,
+                                  size_t elementCount);
+
 // snprintf is not defined with MSVC prior to to msvc14
 #if defined(_MSC_VER) && _MSC_VER < 1900
 #define snprintf _snprintf
@@ -170,6 +182,15 @@ std::string FormatString(const char *fmt, ...);
 // Hidden enum for the NULL D3D device type.
 #define EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE 0x6AC0
 
+// Hidden display attribute for the OpenGL back-end, skips re-uploading unchanged client arrays.
+#define EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE 0x6AC1
+
+// Hidden display attribute, counts the calls to each entry point and samples their latency.
+#define EGL_PLATFORM_ANGLE_ENTRY_POINT_COUNTERS_ANGLE 0x6AC2
+
+// Hidden display attribute, records the GL calls to a trace that the capture_replay sample plays.
+#define EGL_PLATFORM_ANGLE_CAPTURE_ANGLE 0x6AC3
+
 #define ANGLE_TRY_CHECKED_MATH(result)                               \
     if (!result.IsValid())                                           \
     {                                                                \
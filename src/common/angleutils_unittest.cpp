@@ -0,0 +1,57 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// angleutils_unittest:
+//   Tests of the memory hashing helpers.
+//
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/angleutils.h"
+
+namespace
+{
+
+// A tightly packed strided hash is the hash of the whole block.
+TEST(ComputeFastHash64Test, StridedPackedMatchesBlock)
+{
+    std::vector<uint8_t> data(100);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    EXPECT_EQ(ComputeFastHash64(data.data(), data.size()),
+              ComputeFastHash64Strided(data.data(), 10, 10, 10));
+}
+
+// Only the elements are hashed, not the bytes interleaved between them.
+TEST(ComputeFastHash64Test, StridedIgnoresInterleavedBytes)
+{
+    // Ten vertices of a 12 byte position followed by a 4 byte color.
+    const size_t kStride       = 16;
+    const size_t kPositionSize = 12;
+    std::vector<uint8_t> data(10 * kStride);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    const uint64_t positionHash =
+        ComputeFastHash64Strided(data.data(), kPositionSize, kStride, 10);
+
+    for (size_t vertex = 0; vertex < 10; ++vertex)
+    {
+        data[vertex * kStride + kPositionSize] ^= 0xFF;
+    }
+    EXPECT_EQ(positionHash, ComputeFastHash64Strided(data.data(), kPositionSize, kStride, 10));
+
+    data[9 * kStride + 3] ^= 0x01;
+    EXPECT_NE(positionHash, ComputeFastHash64Strided(data.data(), kPositionSize, kStride, 10));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,407 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// bitset_utils:
+//   Bitsets stored in machine words, iterated by scanning for the set bits.
+//
+
+#ifndef COMMON_BITSETUTILS_H_
+#define COMMON_BITSETUTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+
+// Drop-in replacement for std::bitset<N> when N fits in BitsT. Iterating the set bits only costs a
+// bit scan per bit, and the bitwise operators work on the word directly.
+template <size_t N, typename BitsT>
+class BitSetT final
+{
+  public:
+    static_assert(N <= sizeof(BitsT) * 8, "BitsT is too small to hold N bits.");
+
+    class Reference final
+    {
+      public:
+        Reference &operator=(bool value)
+        {
+            mParent->set(mBit, value);
+            return *this;
+        }
+        operator bool() const { return mParent->test(mBit); }
+
+      private:
+        friend class BitSetT;
+
+        Reference(BitSetT *parent, size_t bit) : mParent(parent), mBit(bit) {}
+
+        BitSetT *mParent;
+        size_t mBit;
+    };
+
+    // Walks the set bits from the least significant one.
+    class Iterator final
+    {
+      public:
+        explicit Iterator(BitsT bits) : mBits(bits) {}
+
+        Iterator &operator++()
+        {
+            ASSERT(mBits != 0);
+            mBits &= mBits - 1;
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const { return mBits == other.mBits; }
+        bool operator!=(const Iterator &other) const { return mBits != other.mBits; }
+        size_t operator*() const { return gl::ScanForward(mBits); }
+
+      private:
+        BitsT mBits;
+    };
+
+    constexpr BitSetT() : mBits(0) {}
+    constexpr explicit BitSetT(BitsT value) : mBits(value & Mask()) {}
+
+    bool operator==(const BitSetT &other) const { return mBits == other.mBits; }
+    bool operator!=(const BitSetT &other) const { return mBits != other.mBits; }
+
+    constexpr bool operator[](size_t pos) const { return test(pos); }
+    Reference operator[](size_t pos) { return Reference(this, pos); }
+
+    constexpr bool test(size_t pos) const { return (mBits & Bit(pos)) != 0; }
+
+    bool all() const { return mBits == Mask(); }
+    bool any() const { return mBits != 0; }
+    bool none() const { return mBits == 0; }
+    size_t count() const { return static_cast<size_t>(gl::BitCount(mBits)); }
+    constexpr size_t size() const { return N; }
+
+    BitSetT &operator&=(const BitSetT &other)
+    {
+        mBits &= other.mBits;
+        return *this;
+    }
+    BitSetT &operator|=(const BitSetT &other)
+    {
+        mBits |= other.mBits;
+        return *this;
+    }
+    BitSetT &operator^=(const BitSetT &other)
+    {
+        mBits ^= other.mBits;
+        return *this;
+    }
+    BitSetT operator~() const { return BitSetT(~mBits); }
+
+    BitSetT &set()
+    {
+        mBits = Mask();
+        return *this;
+    }
+    BitSetT &set(size_t pos, bool value = true)
+    {
+        ASSERT(pos < N);
+        mBits = value ? (mBits | Bit(pos)) : (mBits & ~Bit(pos));
+        return *this;
+    }
+    BitSetT &reset()
+    {
+        mBits = 0;
+        return *this;
+    }
+    BitSetT &reset(size_t pos) { return set(pos, false); }
+    BitSetT &flip()
+    {
+        mBits ^= Mask();
+        return *this;
+    }
+    BitSetT &flip(size_t pos)
+    {
+        ASSERT(pos < N);
+        mBits ^= Bit(pos);
+        return *this;
+    }
+
+    constexpr BitsT bits() const { return mBits; }
+
+    Iterator begin() const { return Iterator(mBits); }
+    Iterator end() const { return Iterator(0); }
+
+  private:
+    static constexpr BitsT Bit(size_t pos) { return static_cast<BitsT>(1) << pos; }
+
+    // Shifting by the width of BitsT is undefined, so full words are handled separately.
+    static constexpr BitsT Mask()
+    {
+        return N == sizeof(BitsT) * 8 ? static_cast<BitsT>(~static_cast<BitsT>(0))
+                                      : static_cast<BitsT>((static_cast<BitsT>(1) << (N % (sizeof(BitsT) * 8))) - 1);
+    }
+
+    BitsT mBits;
+};
+
+template <size_t N, typename BitsT>
+BitSetT<N, BitsT> operator&(const BitSetT<N, BitsT> &lhs, const BitSetT<N, BitsT> &rhs)
+{
+    return BitSetT<N, BitsT>(lhs.bits() & rhs.bits());
+}
+
+template <size_t N, typename BitsT>
+BitSetT<N, BitsT> operator|(const BitSetT<N, BitsT> &lhs, const BitSetT<N, BitsT> &rhs)
+{
+    return BitSetT<N, BitsT>(lhs.bits() | rhs.bits());
+}
+
+template <size_t N, typename BitsT>
+BitSetT<N, BitsT> operator^(const BitSetT<N, BitsT> &lhs, const BitSetT<N, BitsT> &rhs)
+{
+    return BitSetT<N, BitsT>(lhs.bits() ^ rhs.bits());
+}
+
+template <size_t N>
+using BitSet32 = BitSetT<N, uint32_t>;
+
+template <size_t N>
+using BitSet64 = BitSetT<N, uint64_t>;
+
+// Bitset of any size stored in an array of 64-bit words. The bitwise operators and any() loop over
+// the few words, which the compiler unrolls.
+template <size_t N>
+class BitSetArray final
+{
+  public:
+    class Reference final
+    {
+      public:
+        Reference &operator=(bool value)
+        {
+            mParent->set(mBit, value);
+            return *this;
+        }
+        operator bool() const { return mParent->test(mBit); }
+
+      private:
+        friend class BitSetArray;
+
+        Reference(BitSetArray *parent, size_t bit) : mParent(parent), mBit(bit) {}
+
+        BitSetArray *mParent;
+        size_t mBit;
+    };
+
+    // Walks the set bits from the least significant one, skipping the empty words.
+    class Iterator final
+    {
+      public:
+        Iterator(const BitSetArray &bitSet, size_t wordIndex)
+            : mParent(&bitSet), mWordIndex(wordIndex), mCurrentWord(0)
+        {
+            if (mWordIndex < kWordCount)
+            {
+                mCurrentWord = mParent->mWords[mWordIndex];
+                skipEmptyWords();
+            }
+        }
+
+        Iterator &operator++()
+        {
+            ASSERT(mCurrentWord != 0);
+            mCurrentWord &= mCurrentWord - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return mWordIndex == other.mWordIndex && mCurrentWord == other.mCurrentWord;
+        }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+        size_t operator*() const { return mWordIndex * kBitsPerWord + gl::ScanForward(mCurrentWord); }
+
+      private:
+        void skipEmptyWords()
+        {
+            while (mCurrentWord == 0 && ++mWordIndex < kWordCount)
+            {
+                mCurrentWord = mParent->mWords[mWordIndex];
+            }
+        }
+
+        const BitSetArray *mParent;
+        size_t mWordIndex;
+        uint64_t mCurrentWord;
+    };
+
+    BitSetArray() { reset(); }
+
+    bool operator==(const BitSetArray &other) const
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            if (mWords[index] != other.mWords[index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    bool operator!=(const BitSetArray &other) const { return !(*this == other); }
+
+    bool operator[](size_t pos) const { return test(pos); }
+    Reference operator[](size_t pos) { return Reference(this, pos); }
+
+    bool test(size_t pos) const
+    {
+        ASSERT(pos < N);
+        return (mWords[pos / kBitsPerWord] & Bit(pos)) != 0;
+    }
+
+    bool all() const { return count() == N; }
+    bool any() const
+    {
+        uint64_t bits = 0;
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            bits |= mWords[index];
+        }
+        return bits != 0;
+    }
+    bool none() const { return !any(); }
+    size_t count() const
+    {
+        size_t bitCount = 0;
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            bitCount += static_cast<size_t>(gl::BitCount(mWords[index]));
+        }
+        return bitCount;
+    }
+    size_t size() const { return N; }
+
+    BitSetArray &operator&=(const BitSetArray &other)
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            mWords[index] &= other.mWords[index];
+        }
+        return *this;
+    }
+    BitSetArray &operator|=(const BitSetArray &other)
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            mWords[index] |= other.mWords[index];
+        }
+        return *this;
+    }
+    BitSetArray &operator^=(const BitSetArray &other)
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            mWords[index] ^= other.mWords[index];
+        }
+        return *this;
+    }
+    BitSetArray operator~() const
+    {
+        BitSetArray result(*this);
+        return result.flip();
+    }
+
+    BitSetArray &set()
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            mWords[index] = ~static_cast<uint64_t>(0);
+        }
+        mWords[kWordCount - 1] &= kLastWordMask;
+        return *this;
+    }
+    BitSetArray &set(size_t pos, bool value = true)
+    {
+        ASSERT(pos < N);
+        uint64_t &word = mWords[pos / kBitsPerWord];
+        word           = value ? (word | Bit(pos)) : (word & ~Bit(pos));
+        return *this;
+    }
+    BitSetArray &reset()
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            mWords[index] = 0;
+        }
+        return *this;
+    }
+    BitSetArray &reset(size_t pos) { return set(pos, false); }
+    BitSetArray &flip()
+    {
+        for (size_t index = 0; index < kWordCount; index++)
+        {
+            mWords[index] = ~mWords[index];
+        }
+        mWords[kWordCount - 1] &= kLastWordMask;
+        return *this;
+    }
+    BitSetArray &flip(size_t pos)
+    {
+        ASSERT(pos < N);
+        mWords[pos / kBitsPerWord] ^= Bit(pos);
+        return *this;
+    }
+
+    Iterator begin() const { return Iterator(*this, 0); }
+    Iterator end() const { return Iterator(*this, kWordCount); }
+
+  private:
+    static const size_t kBitsPerWord = 64;
+    static const size_t kWordCount   = (N + kBitsPerWord - 1) / kBitsPerWord;
+    static const uint64_t kLastWordMask =
+        (N % kBitsPerWord == 0) ? ~static_cast<uint64_t>(0)
+                                : (static_cast<uint64_t>(1) << (N % kBitsPerWord)) - 1;
+
+    static uint64_t Bit(size_t pos) { return static_cast<uint64_t>(1) << (pos % kBitsPerWord); }
+
+    uint64_t mWords[kWordCount];
+};
+
+template <size_t N>
+BitSetArray<N> operator&(const BitSetArray<N> &lhs, const BitSetArray<N> &rhs)
+{
+    BitSetArray<N> result(lhs);
+    return result &= rhs;
+}
+
+template <size_t N>
+BitSetArray<N> operator|(const BitSetArray<N> &lhs, const BitSetArray<N> &rhs)
+{
+    BitSetArray<N> result(lhs);
+    return result |= rhs;
+}
+
+template <size_t N>
+BitSetArray<N> operator^(const BitSetArray<N> &lhs, const BitSetArray<N> &rhs)
+{
+    BitSetArray<N> result(lhs);
+    return result ^= rhs;
+}
+
+// Picks the smallest storage holding N bits.
+template <size_t N>
+using BitSet = typename std::conditional<
+    N <= 32,
+    BitSet32<N>,
+    typename std::conditional<N <= 64, BitSet64<N>, BitSetArray<N>>::type>::type;
+
+}  // namespace angle
+
+#endif  // COMMON_BITSETUTILS_H_
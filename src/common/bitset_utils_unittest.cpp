@@ -0,0 +1,161 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// bitset_utils_unittest:
+//   Tests of the word-based bitsets.
+//
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/bitset_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+template <typename T>
+class BitSetTest : public testing::Test
+{
+};
+
+typedef testing::Types<BitSet32<20>,
+                       BitSet32<32>,
+                       BitSet64<40>,
+                       BitSet64<64>,
+                       BitSetArray<64>,
+                       BitSetArray<79>,
+                       BitSetArray<200>>
+    BitSetTypes;
+TYPED_TEST_CASE(BitSetTest, BitSetTypes);
+
+// Sets, resets, flips and counts bits like std::bitset does.
+TYPED_TEST(BitSetTest, BasicOperations)
+{
+    TypeParam bits;
+    const size_t size = bits.size();
+
+    EXPECT_TRUE(bits.none());
+    EXPECT_FALSE(bits.any());
+    EXPECT_EQ(0u, bits.count());
+
+    bits.set(0);
+    bits.set(size / 2);
+    bits[size - 1] = true;
+    EXPECT_TRUE(bits.any());
+    EXPECT_TRUE(bits.test(0));
+    EXPECT_TRUE(bits[size / 2]);
+    EXPECT_TRUE(bits.test(size - 1));
+    EXPECT_FALSE(bits.test(1));
+    EXPECT_EQ(3u, bits.count());
+
+    bits.reset(size / 2);
+    EXPECT_FALSE(bits.test(size / 2));
+    EXPECT_EQ(2u, bits.count());
+
+    bits.flip(1);
+    EXPECT_TRUE(bits.test(1));
+    bits.set(1, false);
+    EXPECT_FALSE(bits.test(1));
+
+    bits.set();
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(size, bits.count());
+
+    bits.flip();
+    EXPECT_TRUE(bits.none());
+
+    bits.set(3);
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+}
+
+// The bitwise operators keep the bits past the size cleared.
+TYPED_TEST(BitSetTest, BitwiseOperators)
+{
+    TypeParam a;
+    TypeParam b;
+    const size_t size = a.size();
+
+    a.set(1);
+    a.set(size - 1);
+    b.set(1);
+    b.set(2);
+
+    EXPECT_EQ(1u, (a & b).count());
+    EXPECT_TRUE((a & b).test(1));
+    EXPECT_EQ(3u, (a | b).count());
+    EXPECT_EQ(2u, (a ^ b).count());
+    EXPECT_EQ(size - 2, (~a).count());
+    EXPECT_TRUE((a & ~a).none());
+
+    TypeParam c(a);
+    EXPECT_EQ(a, c);
+    c &= ~b;
+    EXPECT_NE(a, c);
+    EXPECT_EQ(1u, c.count());
+    EXPECT_TRUE(c.test(size - 1));
+    c |= b;
+    EXPECT_EQ(3u, c.count());
+    c ^= b;
+    EXPECT_EQ(1u, c.count());
+}
+
+// Iteration returns the set bits in increasing order.
+TYPED_TEST(BitSetTest, Iterator)
+{
+    TypeParam bits;
+    const size_t size = bits.size();
+
+    for (size_t bit : bits)
+    {
+        ADD_FAILURE() << "Unexpected bit " << bit;
+    }
+
+    std::vector<size_t> expected;
+    for (size_t bit = 0; bit < size; bit += 7)
+    {
+        bits.set(bit);
+        expected.push_back(bit);
+    }
+    bits.set(size - 1);
+    if (expected.back() != size - 1)
+    {
+        expected.push_back(size - 1);
+    }
+
+    std::vector<size_t> seen;
+    for (size_t bit : bits)
+    {
+        seen.push_back(bit);
+    }
+    EXPECT_EQ(expected, seen);
+
+    seen.clear();
+    bits.set();
+    for (size_t bit : bits)
+    {
+        seen.push_back(bit);
+    }
+    ASSERT_EQ(size, seen.size());
+    for (size_t bit = 0; bit < size; bit++)
+    {
+        EXPECT_EQ(bit, seen[bit]);
+    }
+}
+
+// Selects the smallest storage.
+TEST(BitSetTest, Storage)
+{
+    EXPECT_EQ(sizeof(uint32_t), sizeof(BitSet<10>));
+    EXPECT_EQ(sizeof(uint32_t), sizeof(BitSet<32>));
+    EXPECT_EQ(sizeof(uint64_t), sizeof(BitSet<33>));
+    EXPECT_EQ(sizeof(uint64_t), sizeof(BitSet<64>));
+    EXPECT_EQ(2 * sizeof(uint64_t), sizeof(BitSet<65>));
+}
+
+}  // anonymous namespace
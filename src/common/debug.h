@@ -14,6 +14,7 @@
 #include <string>
 
 #include "common/angleutils.h"
+#include "common/entry_point_counters.h"
 
 #if !defined(TRACE_OUTPUT_FILE)
 #define TRACE_OUTPUT_FILE "angle_debug.txt"
@@ -89,15 +90,16 @@ bool DebugAnnotationsActive();
 #define ERR(message, ...) (void(0))
 #endif
 
-// A macro to log a performance event around a scope.
+// A macro to log a performance event around a scope. The call is also counted when the entry
+// point counters are enabled.
 #if defined(ANGLE_TRACE_ENABLED)
 #if defined(_MSC_VER)
-#define EVENT(message, ...) gl::ScopedPerfEventHelper scopedPerfEventHelper ## __LINE__("%s" message "\n", __FUNCTION__, __VA_ARGS__);
+#define EVENT(message, ...) gl::ScopedPerfEventHelper scopedPerfEventHelper ## __LINE__("%s" message "\n", __FUNCTION__, __VA_ARGS__); ANGLE_SCOPED_ENTRY_POINT_COUNTER()
 #else
-#define EVENT(message, ...) gl::ScopedPerfEventHelper scopedPerfEventHelper("%s" message "\n", __FUNCTION__, ##__VA_ARGS__);
+#define EVENT(message, ...) gl::ScopedPerfEventHelper scopedPerfEventHelper("%s" message "\n", __FUNCTION__, ##__VA_ARGS__); ANGLE_SCOPED_ENTRY_POINT_COUNTER()
 #endif // _MSC_VER
 #else
-#define EVENT(message, ...) (void(0))
+#define EVENT(message, ...) ANGLE_SCOPED_ENTRY_POINT_COUNTER()
 #endif
 
 #if defined(ANGLE_TRACE_ENABLED)
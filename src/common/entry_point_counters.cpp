@@ -0,0 +1,327 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// entry_point_counters.cpp: Implements the per-entry-point call counters.
+
+#include "common/entry_point_counters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define ANGLE_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#include <x86intrin.h>
+#define ANGLE_HAS_RDTSC
+#endif
+
+#include "common/debug.h"
+#include "common/tls.h"
+#include "platform/Platform.h"
+
+namespace angle
+{
+
+namespace
+{
+const size_t kMaxEntryPoints = 1024;
+
+// Bucket i holds the calls that took [2^i, 2^(i+1)) timestamp ticks, the last one everything above.
+const size_t kLatencyBucketCount = 24;
+
+// Only one call out of this many is timed, reading the timestamp counter is not free.
+const uint32_t kLatencySampleInterval = 16;
+
+// Bounds the histogram updates made per entry point by a flush, the latency histograms show the
+// distribution of the calls while the call histograms show their number.
+const uint32_t kMaxReportedLatencySamples = 64;
+
+// Written by the owning thread only, other threads just read and reset them when flushing.
+struct ThreadEntryPointCounters
+{
+    std::atomic<uint32_t> calls[kMaxEntryPoints];
+    std::atomic<uint32_t> latencyBuckets[kMaxEntryPoints][kLatencyBucketCount];
+};
+
+std::atomic<size_t> gNextEntryPointIndex(0);
+std::atomic<const char *> gEntryPointApis[kMaxEntryPoints];
+std::atomic<const char *> gEntryPointNames[kMaxEntryPoints];
+
+std::atomic<bool> gThreadCountersIndexCreated(false);
+TLSIndex gThreadCountersIndex = TLS_INVALID_INDEX;
+
+// Number of enables not matched by a disable yet, guarded by the registry mutex.
+unsigned int gEnableCount = 0;
+
+std::mutex &GetRegistryMutex()
+{
+    // Intentionally leaked, counters can be used until the process exits.
+    static std::mutex *registryMutex = new std::mutex();
+    return *registryMutex;
+}
+
+// The counters of the running threads. The first ones accumulate the counts of the threads that
+// exited, so they are still part of the next flush.
+std::vector<ThreadEntryPointCounters *> &GetAllThreadCounters()
+{
+    static std::vector<ThreadEntryPointCounters *> *allThreadCounters =
+        new std::vector<ThreadEntryPointCounters *>(1, new ThreadEntryPointCounters());
+    return *allThreadCounters;
+}
+
+void ReleaseThreadCounters(void *value)
+{
+    auto *counters = static_cast<ThreadEntryPointCounters *>(value);
+
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    std::vector<ThreadEntryPointCounters *> &allThreadCounters = GetAllThreadCounters();
+
+    ThreadEntryPointCounters *exitedCounters = allThreadCounters.front();
+    for (size_t index = 0; index < kMaxEntryPoints; index++)
+    {
+        exitedCounters->calls[index].fetch_add(counters->calls[index].load(),
+                                               std::memory_order_relaxed);
+        for (size_t bucket = 0; bucket < kLatencyBucketCount; bucket++)
+        {
+            exitedCounters->latencyBuckets[index][bucket].fetch_add(
+                counters->latencyBuckets[index][bucket].load(), std::memory_order_relaxed);
+        }
+    }
+
+    allThreadCounters.erase(
+        std::find(allThreadCounters.begin(), allThreadCounters.end(), counters));
+    delete counters;
+}
+
+ThreadEntryPointCounters *GetCurrentThreadCounters()
+{
+    if (!gThreadCountersIndexCreated.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    auto *counters = static_cast<ThreadEntryPointCounters *>(GetTLSValue(gThreadCountersIndex));
+    if (counters == nullptr)
+    {
+        counters = new ThreadEntryPointCounters();
+        SetTLSValue(gThreadCountersIndex, counters);
+
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+        GetAllThreadCounters().push_back(counters);
+    }
+
+    return counters;
+}
+
+uint64_t ReadTimestamp()
+{
+#if defined(ANGLE_HAS_RDTSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+size_t GetLatencyBucket(uint64_t ticks)
+{
+    size_t bucket = 0;
+    while (ticks > 1 && bucket + 1 < kLatencyBucketCount)
+    {
+        ticks >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void IncrementCounter(std::atomic<uint32_t> *counter)
+{
+    // Only the owning thread increments, a plain load and store avoids a locked instruction.
+    counter->store(counter->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+}  // anonymous namespace
+
+std::atomic<bool> gEntryPointCountersEnabled(false);
+
+void SetEntryPointCountersEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+
+    if (enabled)
+    {
+        if (!gThreadCountersIndexCreated.load(std::memory_order_relaxed))
+        {
+            gThreadCountersIndex = CreateTLSIndex(&ReleaseThreadCounters);
+            if (gThreadCountersIndex == TLS_INVALID_INDEX)
+            {
+                return;
+            }
+            gThreadCountersIndexCreated.store(true, std::memory_order_release);
+        }
+        gEnableCount++;
+    }
+    else
+    {
+        ASSERT(gEnableCount > 0);
+        if (gEnableCount == 0)
+        {
+            return;
+        }
+        gEnableCount--;
+    }
+
+    gEntryPointCountersEnabled.store(gEnableCount > 0, std::memory_order_relaxed);
+}
+
+void FlushEntryPointCounters()
+{
+    Platform *platform = ANGLEPlatformCurrent();
+    ASSERT(platform);
+
+    struct EntryPointCounts
+    {
+        const char *api;
+        const char *name;
+        uint64_t calls;
+        uint32_t latencyBuckets[kLatencyBucketCount];
+    };
+    std::vector<EntryPointCounts> allCounts;
+
+    // The counts are gathered under the lock, then reported without it.
+    {
+        std::lock_guard<std::mutex> lock(GetRegistryMutex());
+        const std::vector<ThreadEntryPointCounters *> &allThreadCounters = GetAllThreadCounters();
+
+        const size_t entryPointCount = std::min(gNextEntryPointIndex.load(), kMaxEntryPoints);
+        for (size_t index = 0; index < entryPointCount; index++)
+        {
+            EntryPointCounts counts = {};
+            counts.name             = gEntryPointNames[index].load(std::memory_order_acquire);
+            if (counts.name == nullptr)
+            {
+                continue;
+            }
+            counts.api = gEntryPointApis[index].load(std::memory_order_relaxed);
+
+            // Calls made on other threads while flushing can be miscounted, this is only meant for
+            // statistics.
+            for (ThreadEntryPointCounters *counters : allThreadCounters)
+            {
+                counts.calls += counters->calls[index].exchange(0, std::memory_order_relaxed);
+
+                std::atomic<uint32_t> *threadLatencyBuckets = counters->latencyBuckets[index];
+                for (size_t bucket = 0; bucket < kLatencyBucketCount; bucket++)
+                {
+                    counts.latencyBuckets[bucket] +=
+                        threadLatencyBuckets[bucket].exchange(0, std::memory_order_relaxed);
+                }
+            }
+
+            if (counts.calls != 0)
+            {
+                allCounts.push_back(counts);
+            }
+        }
+    }
+
+    for (const EntryPointCounts &counts : allCounts)
+    {
+        const std::string name      = std::string(counts.api) + counts.name;
+        const std::string callsName = "GPU.ANGLE.EntryPointCalls." + name;
+        platform->histogramCustomCounts(
+            callsName.c_str(),
+            static_cast<int>(std::min<uint64_t>(counts.calls, std::numeric_limits<int>::max())), 1,
+            100000000, 50);
+
+        uint64_t latencySamples = 0;
+        for (uint32_t bucketSamples : counts.latencyBuckets)
+        {
+            latencySamples += bucketSamples;
+        }
+
+        // Buckets are scaled down to bound the number of updates, rounding up keeps the rare slow
+        // calls visible.
+        const std::string latencyName = "GPU.ANGLE.EntryPointLatencyLog2Ticks." + name;
+        for (size_t bucket = 0; bucket < kLatencyBucketCount; bucket++)
+        {
+            uint64_t samples = counts.latencyBuckets[bucket];
+            if (latencySamples > kMaxReportedLatencySamples)
+            {
+                samples = (samples * kMaxReportedLatencySamples + latencySamples - 1) /
+                          latencySamples;
+            }
+
+            for (uint64_t sample = 0; sample < samples; sample++)
+            {
+                platform->histogramEnumeration(latencyName.c_str(), static_cast<int>(bucket),
+                                               static_cast<int>(kLatencyBucketCount));
+            }
+        }
+    }
+}
+
+void ReleaseCurrentThreadEntryPointCounters()
+{
+    if (!gThreadCountersIndexCreated.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    void *counters = GetTLSValue(gThreadCountersIndex);
+    if (counters != nullptr)
+    {
+        SetTLSValue(gThreadCountersIndex, nullptr);
+        ReleaseThreadCounters(counters);
+    }
+}
+
+EntryPointCounterId::EntryPointCounterId(const char *api, const char *name)
+    : mIndex(gNextEntryPointIndex.fetch_add(1, std::memory_order_relaxed))
+{
+    if (mIndex < kMaxEntryPoints)
+    {
+        // The name is published last, the flush reads the API once it sees the name.
+        gEntryPointApis[mIndex].store(api, std::memory_order_relaxed);
+        gEntryPointNames[mIndex].store(name, std::memory_order_release);
+    }
+}
+
+void ScopedEntryPointCounter::begin(const EntryPointCounterId &id)
+{
+    const size_t index = id.getIndex();
+    if (index >= kMaxEntryPoints)
+    {
+        return;
+    }
+
+    ThreadEntryPointCounters *counters = GetCurrentThreadCounters();
+    if (counters == nullptr)
+    {
+        return;
+    }
+
+    IncrementCounter(&counters->calls[index]);
+    if (counters->calls[index].load(std::memory_order_relaxed) % kLatencySampleInterval == 0)
+    {
+        mLatencyBuckets = counters->latencyBuckets[index];
+        mStart          = ReadTimestamp();
+    }
+}
+
+void ScopedEntryPointCounter::end()
+{
+    const uint64_t elapsed = ReadTimestamp() - mStart;
+    IncrementCounter(&mLatencyBuckets[GetLatencyBucket(elapsed)]);
+}
+
+}  // namespace angle
@@ -0,0 +1,98 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// entry_point_counters.h: Per-entry-point call counters and sampled latency histograms. They are
+// cheap enough to stay compiled into release builds and cost a single load per call while
+// disabled.
+
+#ifndef COMMON_ENTRY_POINT_COUNTERS_H_
+#define COMMON_ENTRY_POINT_COUNTERS_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+extern std::atomic<bool> gEntryPointCountersEnabled;
+
+// Enabling is counted, e.g. once per display that asked for the counters. Counting stops once
+// every enable was matched by a disable, the data gathered so far is kept.
+void SetEntryPointCountersEnabled(bool enabled);
+
+// Reports the counts gathered on all threads through the platform's histograms and resets them.
+void FlushEntryPointCounters();
+
+// Frees the counters of the current thread, keeping its counts for the next flush. Only needed
+// where the thread local storage can't free them when the thread exits, i.e. in DllMain.
+void ReleaseCurrentThreadEntryPointCounters();
+
+// Assigns a slot to an entry point, meant to be a function local static.
+class EntryPointCounterId final : angle::NonCopyable
+{
+  public:
+    EntryPointCounterId(const char *api, const char *name);
+
+    size_t getIndex() const { return mIndex; }
+
+  private:
+    size_t mIndex;
+};
+
+// Counts a call to an entry point and times a sample of them.
+class ScopedEntryPointCounter final : angle::NonCopyable
+{
+  public:
+    explicit ScopedEntryPointCounter(const EntryPointCounterId &id)
+        : mLatencyBuckets(nullptr), mStart(0)
+    {
+        if (gEntryPointCountersEnabled.load(std::memory_order_relaxed))
+        {
+            begin(id);
+        }
+    }
+
+    ~ScopedEntryPointCounter()
+    {
+        if (mLatencyBuckets != nullptr)
+        {
+            end();
+        }
+    }
+
+  private:
+    void begin(const EntryPointCounterId &id);
+    void end();
+
+    std::atomic<uint32_t> *mLatencyBuckets;
+    uint64_t mStart;
+};
+
+}  // namespace angle
+
+// The API prefixed to the names of the counted functions, e.g. glGetError and eglGetError.
+// __FUNCTION__ doesn't include the namespace, so the macro finds the prefix by unqualified lookup
+// from the namespace of the entry point.
+constexpr const char kEntryPointCounterApi[] = "";
+
+namespace gl
+{
+constexpr const char kEntryPointCounterApi[] = "gl";
+}  // namespace gl
+
+namespace egl
+{
+constexpr const char kEntryPointCounterApi[] = "egl";
+}  // namespace egl
+
+#define ANGLE_SCOPED_ENTRY_POINT_COUNTER()                                                      \
+    static const angle::EntryPointCounterId entryPointCounterId(kEntryPointCounterApi,          \
+                                                                __FUNCTION__);                  \
+    angle::ScopedEntryPointCounter scopedEntryPointCounter(entryPointCounterId)
+
+#endif  // COMMON_ENTRY_POINT_COUNTERS_H_
@@ -0,0 +1,184 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_point_counters_unittest:
+//   Tests of the per-entry-point call counters.
+//
+
+#include "common/entry_point_counters.h"
+
+#include <map>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "platform/Platform.h"
+
+using namespace angle;
+
+// Entry points of different APIs can share a name.
+namespace gl
+{
+namespace
+{
+void GetError()
+{
+    ANGLE_SCOPED_ENTRY_POINT_COUNTER();
+}
+}  // anonymous namespace
+}  // namespace gl
+
+namespace egl
+{
+namespace
+{
+void GetError()
+{
+    ANGLE_SCOPED_ENTRY_POINT_COUNTER();
+}
+}  // anonymous namespace
+}  // namespace egl
+
+namespace
+{
+
+class CapturePlatform : public angle::Platform
+{
+  public:
+    void histogramCustomCounts(const char *name, int sample, int, int, int) override
+    {
+        mCounts[name] += sample;
+    }
+
+    void histogramEnumeration(const char *name, int sample, int boundaryValue) override
+    {
+        EXPECT_LT(sample, boundaryValue);
+        mEnumerationSamples[name]++;
+    }
+
+    std::map<std::string, int> mCounts;
+    std::map<std::string, int> mEnumerationSamples;
+};
+
+void CountedEntryPoint()
+{
+    ANGLE_SCOPED_ENTRY_POINT_COUNTER();
+}
+
+class EntryPointCountersTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ANGLEPlatformInitialize(&mPlatform);
+
+        // Discard anything counted by previous tests
+        FlushEntryPointCounters();
+        mPlatform.mCounts.clear();
+        mPlatform.mEnumerationSamples.clear();
+    }
+
+    void TearDown() override { ANGLEPlatformShutdown(); }
+
+    CapturePlatform mPlatform;
+};
+
+// Calls are only counted while the counters are enabled.
+TEST_F(EntryPointCountersTest, CountsCallsWhileEnabled)
+{
+    CountedEntryPoint();
+
+    SetEntryPointCountersEnabled(true);
+    for (int i = 0; i < 100; i++)
+    {
+        CountedEntryPoint();
+    }
+    SetEntryPointCountersEnabled(false);
+
+    CountedEntryPoint();
+
+    FlushEntryPointCounters();
+    EXPECT_EQ(100, mPlatform.mCounts["GPU.ANGLE.EntryPointCalls.CountedEntryPoint"]);
+
+    // One call out of sixteen is timed.
+    EXPECT_EQ(6,
+              mPlatform.mEnumerationSamples["GPU.ANGLE.EntryPointLatencyLog2Ticks.CountedEntryPoint"]);
+
+    // Flushing resets the counters.
+    mPlatform.mCounts.clear();
+    FlushEntryPointCounters();
+    EXPECT_EQ(0u, mPlatform.mCounts.count("GPU.ANGLE.EntryPointCalls.CountedEntryPoint"));
+}
+
+// Calls from all the threads are reported, including threads that already exited.
+TEST_F(EntryPointCountersTest, CountsCallsFromAllThreads)
+{
+    SetEntryPointCountersEnabled(true);
+
+    CountedEntryPoint();
+    std::thread thread([]() {
+        for (int i = 0; i < 10; i++)
+        {
+            CountedEntryPoint();
+        }
+    });
+    thread.join();
+
+    SetEntryPointCountersEnabled(false);
+
+    FlushEntryPointCounters();
+    EXPECT_EQ(11, mPlatform.mCounts["GPU.ANGLE.EntryPointCalls.CountedEntryPoint"]);
+}
+
+// Counting goes on until every enable was matched by a disable.
+TEST_F(EntryPointCountersTest, EnablesAreCounted)
+{
+    SetEntryPointCountersEnabled(true);
+    SetEntryPointCountersEnabled(true);
+    SetEntryPointCountersEnabled(false);
+    CountedEntryPoint();
+    SetEntryPointCountersEnabled(false);
+    CountedEntryPoint();
+
+    FlushEntryPointCounters();
+    EXPECT_EQ(1, mPlatform.mCounts["GPU.ANGLE.EntryPointCalls.CountedEntryPoint"]);
+}
+
+// The number of latency samples reported by a flush is bounded.
+TEST_F(EntryPointCountersTest, BoundsLatencySamples)
+{
+    SetEntryPointCountersEnabled(true);
+    for (int i = 0; i < 100000; i++)
+    {
+        CountedEntryPoint();
+    }
+    SetEntryPointCountersEnabled(false);
+
+    FlushEntryPointCounters();
+    EXPECT_EQ(100000, mPlatform.mCounts["GPU.ANGLE.EntryPointCalls.CountedEntryPoint"]);
+
+    // Scaled down to 64 samples, plus one per bucket for the rounding.
+    int samples =
+        mPlatform.mEnumerationSamples["GPU.ANGLE.EntryPointLatencyLog2Ticks.CountedEntryPoint"];
+    EXPECT_GE(samples, 64);
+    EXPECT_LE(samples, 64 + 24);
+}
+
+// Entry points are reported with the name of their API.
+TEST_F(EntryPointCountersTest, NamesIncludeTheApi)
+{
+    SetEntryPointCountersEnabled(true);
+    gl::GetError();
+    egl::GetError();
+    egl::GetError();
+    SetEntryPointCountersEnabled(false);
+
+    FlushEntryPointCounters();
+    EXPECT_EQ(1, mPlatform.mCounts["GPU.ANGLE.EntryPointCalls.glGetError"]);
+    EXPECT_EQ(2, mPlatform.mCounts["GPU.ANGLE.EntryPointCalls.eglGetError"]);
+}
+
+}  // anonymous namespace
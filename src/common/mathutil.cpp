@@ -14,6 +14,125 @@
 namespace gl
 {
 
+namespace
+{
+
+#if defined(ANGLE_USE_SSE)
+
+// SSE2 is part of x86-64, and has to be detected on 32-bit x86.
+bool UseSSE2()
+{
+#if defined(_M_X64) || defined(__x86_64__)
+    return true;
+#else
+    return supportsSSE2();
+#endif
+}
+
+__m128i SelectSSE2(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// Replicates float32ToFloat16 on the rounding and on the clamping of large values, infinities
+// and NaNs to 0x7FFF. Sets the bits of |fallbackLanes| for the values whose denormal conversion
+// needs a shift varying with each value, which SSE2 can't do.
+__m128i Float32ToFloat16SSE2(__m128 input, int *fallbackLanes)
+{
+    const __m128i bits = _mm_castps_si128(input);
+    const __m128i sign = _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x80000000)), 16);
+    const __m128i abs  = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    const __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    const __m128i rebiased = _mm_add_epi32(abs, _mm_set1_epi32(0xC8000000 + 0x00000FFF));
+    const __m128i normal   = _mm_srli_epi32(_mm_add_epi32(rebiased, roundBit), 13);
+
+    // Below 2^-37 the denormal conversion only keeps the sign.
+    const __m128i tooLarge = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    const __m128i tooSmall = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x2D000000));
+    const __m128i denormal =
+        _mm_andnot_si128(tooSmall, _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000)));
+    *fallbackLanes = _mm_movemask_ps(_mm_castsi128_ps(denormal));
+
+    __m128i result = SelectSSE2(tooLarge, _mm_set1_epi32(0x7FFF), normal);
+    result         = _mm_andnot_si128(tooSmall, result);
+    return _mm_or_si128(result, sign);
+}
+
+// Exact conversion, like the tables of float16ToFloat32. Denormals are normalized with a
+// subtraction of normal floats, so the result doesn't depend on the denormal modes of the CPU.
+__m128 Float16ToFloat32SSE2(__m128i input)
+{
+    const __m128i expMantissa = _mm_and_si128(input, _mm_set1_epi32(0x7FFF));
+    const __m128i sign        = _mm_slli_epi32(_mm_xor_si128(input, expMantissa), 16);
+
+    const __m128i shifted  = _mm_slli_epi32(expMantissa, 13);
+    const __m128i exponent = _mm_and_si128(shifted, _mm_set1_epi32(0x0F800000));
+    const __m128i rebias   = _mm_set1_epi32((127 - 15) << 23);
+    __m128i result         = _mm_add_epi32(shifted, rebias);
+
+    const __m128i infOrNaN = _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x0F800000));
+    result                 = _mm_add_epi32(result, _mm_and_si128(infOrNaN, rebias));
+
+    const __m128i zeroOrDenormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+    const __m128 normalized      = _mm_sub_ps(
+        _mm_castsi128_ps(_mm_add_epi32(result, _mm_set1_epi32(1 << 23))),
+        _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23)));
+    result = SelectSSE2(zeroOrDenormal, _mm_castps_si128(normalized), result);
+
+    return _mm_castsi128_ps(_mm_or_si128(result, sign));
+}
+
+// Packs the low 16 bits of the four lanes, which SSE2 can only do with signed saturation.
+void StoreLow16BitsSSE2(__m128i values, unsigned short *output)
+{
+    const __m128i signExtended = _mm_srai_epi32(_mm_slli_epi32(values, 16), 16);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output), _mm_packs_epi32(signExtended, signExtended));
+}
+
+__m128i LoadFloat16SSE2(const unsigned short *input)
+{
+    return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input)),
+                              _mm_setzero_si128());
+}
+
+// Replicates float32ToFloat11 and float32ToFloat10, which only differ by the number of mantissa
+// bits. NaNs and denormals are left to the scalar conversion through |fallbackLanes|.
+template <int MantissaShift>
+__m128i Float32ToPackedFloatSSE2(__m128 input, int *fallbackLanes)
+{
+    const unsigned int bitMask      = (0xFFFFFFFFu >> MantissaShift) & 0x7FF;
+    const unsigned int exponentMask = bitMask & ~((1u << (23 - MantissaShift)) - 1);
+    const unsigned int maxValue     = exponentMask - 1;
+    const unsigned int maxFloat32   = 0x47800000 - (1u << MantissaShift);
+
+    const __m128i bits     = _mm_castps_si128(input);
+    const __m128i abs      = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i negative = _mm_cmplt_epi32(bits, _mm_setzero_si128());
+
+    const __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, MantissaShift), _mm_set1_epi32(1));
+    const __m128i rebiased =
+        _mm_add_epi32(abs, _mm_set1_epi32(0xC8000000 + (1u << (MantissaShift - 1)) - 1));
+    const __m128i normal = _mm_and_si128(
+        _mm_srli_epi32(_mm_add_epi32(rebiased, roundBit), MantissaShift), _mm_set1_epi32(bitMask));
+
+    const __m128i infinity = _mm_cmpeq_epi32(abs, _mm_set1_epi32(0x7F800000));
+    const __m128i nan      = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+    const __m128i tooLarge = _mm_cmpgt_epi32(abs, _mm_set1_epi32(maxFloat32));
+    const __m128i zero     = _mm_cmpeq_epi32(abs, _mm_setzero_si128());
+    const __m128i denormal = _mm_andnot_si128(
+        _mm_or_si128(negative, zero), _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000)));
+    *fallbackLanes = _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(nan, denormal)));
+
+    __m128i result = SelectSSE2(tooLarge, _mm_set1_epi32(maxValue), normal);
+    result         = SelectSSE2(infinity, _mm_set1_epi32(exponentMask), result);
+    return _mm_andnot_si128(_mm_or_si128(negative, zero), result);
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+}  // anonymous namespace
+
 struct RGB9E5Data
 {
     unsigned int R : 9;
@@ -55,6 +174,16 @@ unsigned int convertRGBFloatsTo999E5(float red, float green, float blue)
     return bitCast<unsigned int>(output);
 }
 
+void convertRGBFloatsTo999E5(const float *input, unsigned int *output, size_t count)
+{
+    // The exponent is chosen with a logarithm, which has no exact SSE2 equivalent.
+    for (size_t index = 0; index < count; index++)
+    {
+        output[index] = convertRGBFloatsTo999E5(input[index * 3 + 0], input[index * 3 + 1],
+                                                input[index * 3 + 2]);
+    }
+}
+
 void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float *blue)
 {
     const RGB9E5Data *inputData = reinterpret_cast<const RGB9E5Data*>(&input);
@@ -64,4 +193,125 @@ void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float
     *blue = inputData->B * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
 }
 
+void float32ToFloat16(const float *input, unsigned short *output, size_t count)
+{
+    size_t index = 0;
+#if defined(ANGLE_USE_SSE)
+    if (UseSSE2())
+    {
+        for (; index + 4 <= count; index += 4)
+        {
+            int fallbackLanes = 0;
+            StoreLow16BitsSSE2(Float32ToFloat16SSE2(_mm_loadu_ps(input + index), &fallbackLanes),
+                               output + index);
+            for (; fallbackLanes != 0; fallbackLanes &= fallbackLanes - 1)
+            {
+                const size_t lane     = ScanForward(static_cast<uint32_t>(fallbackLanes));
+                output[index + lane] = float32ToFloat16(input[index + lane]);
+            }
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+    for (; index < count; index++)
+    {
+        output[index] = float32ToFloat16(input[index]);
+    }
+}
+
+void float16ToFloat32(const unsigned short *input, float *output, size_t count)
+{
+    size_t index = 0;
+#if defined(ANGLE_USE_SSE)
+    if (UseSSE2())
+    {
+        for (; index + 4 <= count; index += 4)
+        {
+            _mm_storeu_ps(output + index, Float16ToFloat32SSE2(LoadFloat16SSE2(input + index)));
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+    for (; index < count; index++)
+    {
+        output[index] = float16ToFloat32(input[index]);
+    }
+}
+
+void averageHalfFloats(const unsigned short *a,
+                       const unsigned short *b,
+                       unsigned short *output,
+                       size_t count)
+{
+    size_t index = 0;
+#if defined(ANGLE_USE_SSE)
+    if (UseSSE2())
+    {
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128 sum = _mm_add_ps(Float16ToFloat32SSE2(LoadFloat16SSE2(a + index)),
+                                          Float16ToFloat32SSE2(LoadFloat16SSE2(b + index)));
+            const __m128 average = _mm_mul_ps(sum, _mm_set1_ps(0.5f));
+
+            // NaN sums are left to the scalar code, as their sign depends on the operand order.
+            int fallbackLanes = 0;
+            StoreLow16BitsSSE2(Float32ToFloat16SSE2(average, &fallbackLanes), output + index);
+            fallbackLanes |= _mm_movemask_ps(_mm_cmpunord_ps(average, average));
+            for (; fallbackLanes != 0; fallbackLanes &= fallbackLanes - 1)
+            {
+                const size_t lane     = ScanForward(static_cast<uint32_t>(fallbackLanes));
+                output[index + lane] = averageHalfFloat(a[index + lane], b[index + lane]);
+            }
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+    for (; index < count; index++)
+    {
+        output[index] = averageHalfFloat(a[index], b[index]);
+    }
+}
+
+void convertRGBFloatsToR11G11B10F(const float *input, unsigned int *output, size_t count)
+{
+    size_t index = 0;
+#if defined(ANGLE_USE_SSE)
+    if (UseSSE2())
+    {
+        // Four pixels at a time, with the lanes of each vector holding the same component.
+        for (; index + 4 <= count; index += 4)
+        {
+            const float *pixels = input + index * 3;
+            const __m128 red    = _mm_setr_ps(pixels[0], pixels[3], pixels[6], pixels[9]);
+            const __m128 green  = _mm_setr_ps(pixels[1], pixels[4], pixels[7], pixels[10]);
+            const __m128 blue   = _mm_setr_ps(pixels[2], pixels[5], pixels[8], pixels[11]);
+
+            int redFallback   = 0;
+            int greenFallback = 0;
+            int blueFallback  = 0;
+            const __m128i packed =
+                _mm_or_si128(_mm_or_si128(Float32ToPackedFloatSSE2<17>(red, &redFallback),
+                                          _mm_slli_epi32(Float32ToPackedFloatSSE2<17>(
+                                                             green, &greenFallback),
+                                                         11)),
+                             _mm_slli_epi32(Float32ToPackedFloatSSE2<18>(blue, &blueFallback), 22));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + index), packed);
+
+            for (int fallbackLanes = redFallback | greenFallback | blueFallback; fallbackLanes != 0;
+                 fallbackLanes &= fallbackLanes - 1)
+            {
+                const size_t lane    = ScanForward(static_cast<uint32_t>(fallbackLanes));
+                const float *pixel   = pixels + lane * 3;
+                output[index + lane] = (float32ToFloat11(pixel[0]) << 0) |
+                                       (float32ToFloat11(pixel[1]) << 11) |
+                                       (float32ToFloat10(pixel[2]) << 22);
+            }
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE)
+    for (; index < count; index++)
+    {
+        const float *pixel = input + index * 3;
+        output[index] = (float32ToFloat11(pixel[0]) << 0) | (float32ToFloat11(pixel[1]) << 11) |
+                        (float32ToFloat10(pixel[2]) << 22);
+    }
+}
+
 }  // namespace gl
@@ -565,6 +565,19 @@ inline unsigned int averageFloat10(unsigned int a, unsigned int b)
     return float32ToFloat10((float10ToFloat32(static_cast<unsigned short>(a)) + float10ToFloat32(static_cast<unsigned short>(b))) * 0.5f);
 }
 
+// Conversions of arrays of |count| values, giving the same results as the functions converting one
+// value. They convert four values at a time with SSE2 when it's available.
+void float32ToFloat16(const float *input, unsigned short *output, size_t count);
+void float16ToFloat32(const unsigned short *input, float *output, size_t count);
+void averageHalfFloats(const unsigned short *a,
+                       const unsigned short *b,
+                       unsigned short *output,
+                       size_t count);
+
+// |input| holds the red, green and blue components of |count| pixels.
+void convertRGBFloatsToR11G11B10F(const float *input, unsigned int *output, size_t count);
+void convertRGBFloatsTo999E5(const float *input, unsigned int *output, size_t count);
+
 template <typename T>
 struct Range
 {
@@ -722,6 +735,87 @@ inline bool isInf(float f)
     return ((bitCast<uint32_t>(f) & 0x7f800000u) == 0x7f800000u) && !(bitCast<uint32_t>(f) & 0x7fffffu);
 }
 
+// Returns the number of bits set.
+#if defined(_MSC_VER) && !defined(_M_ARM)
+inline int BitCount(uint32_t bits)
+{
+    return static_cast<int>(__popcnt(bits));
+}
+
+inline int BitCount(uint64_t bits)
+{
+#if defined(_WIN64)
+    return static_cast<int>(__popcnt64(bits));
+#else
+    return BitCount(static_cast<uint32_t>(bits)) + BitCount(static_cast<uint32_t>(bits >> 32));
+#endif
+}
+#elif defined(ANGLE_PLATFORM_POSIX)
+inline int BitCount(uint32_t bits)
+{
+    return __builtin_popcount(bits);
+}
+
+inline int BitCount(uint64_t bits)
+{
+    return __builtin_popcountll(bits);
+}
+#else
+inline int BitCount(uint32_t bits)
+{
+    bits = bits - ((bits >> 1) & 0x55555555u);
+    bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+    return static_cast<int>((((bits + (bits >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+}
+
+inline int BitCount(uint64_t bits)
+{
+    return BitCount(static_cast<uint32_t>(bits)) + BitCount(static_cast<uint32_t>(bits >> 32));
+}
+#endif
+
+// Returns the index of the least significant bit set, bits must not be zero.
+#if defined(ANGLE_PLATFORM_WINDOWS)
+inline unsigned int ScanForward(uint32_t bits)
+{
+    ASSERT(bits != 0u);
+    unsigned long firstBitIndex = 0ul;
+    unsigned char ret           = _BitScanForward(&firstBitIndex, bits);
+    ASSERT(ret != 0u);
+    UNUSED_ASSERTION_VARIABLE(ret);
+    return static_cast<unsigned int>(firstBitIndex);
+}
+
+inline unsigned int ScanForward(uint64_t bits)
+{
+    ASSERT(bits != 0u);
+#if defined(_WIN64)
+    unsigned long firstBitIndex = 0ul;
+    unsigned char ret           = _BitScanForward64(&firstBitIndex, bits);
+    ASSERT(ret != 0u);
+    UNUSED_ASSERTION_VARIABLE(ret);
+    return static_cast<unsigned int>(firstBitIndex);
+#else
+    const uint32_t lowBits = static_cast<uint32_t>(bits);
+    return lowBits != 0u ? ScanForward(lowBits) : ScanForward(static_cast<uint32_t>(bits >> 32)) + 32u;
+#endif
+}
+#elif defined(ANGLE_PLATFORM_POSIX)
+inline unsigned int ScanForward(uint32_t bits)
+{
+    ASSERT(bits != 0u);
+    return static_cast<unsigned int>(__builtin_ctz(bits));
+}
+
+inline unsigned int ScanForward(uint64_t bits)
+{
+    ASSERT(bits != 0u);
+    return static_cast<unsigned int>(__builtin_ctzll(bits));
+}
+#else
+#error Please implement bit-scan-forward for your platform!
+#endif
+
 namespace priv
 {
 template <unsigned int N, unsigned int R>
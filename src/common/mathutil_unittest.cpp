@@ -9,6 +9,8 @@
 
 #include "mathutil.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 using namespace gl;
@@ -142,6 +144,144 @@ TEST(MathUtilTest, packAndUnpackHalf2x16)
     }
 }
 
+// Test that the bulk conversion of half floats matches the single value one, for all values.
+TEST(MathUtilTest, Float16ToFloat32Bulk)
+{
+    std::vector<unsigned short> input(0x10000);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<unsigned short>(i);
+    }
+
+    std::vector<float> output(input.size());
+    float16ToFloat32(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        EXPECT_EQ(bitCast<uint32_t>(float16ToFloat32(input[i])), bitCast<uint32_t>(output[i]))
+            << "half float 0x" << std::hex << i;
+    }
+}
+
+// Test that converting all half floats to floats and back gives the finite ones back, and the
+// clamped value of infinities and NaNs.
+TEST(MathUtilTest, Float16RoundTripBulk)
+{
+    std::vector<unsigned short> input(0x10000);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<unsigned short>(i);
+    }
+
+    std::vector<float> floats(input.size());
+    std::vector<unsigned short> output(input.size());
+    float16ToFloat32(input.data(), floats.data(), input.size());
+    float32ToFloat16(floats.data(), output.data(), floats.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        const bool finite = (i & 0x7C00) != 0x7C00;
+        EXPECT_EQ(finite ? input[i] : (i & 0x8000) | 0x7FFF, output[i])
+            << "half float 0x" << std::hex << i;
+    }
+}
+
+// Test that the bulk conversion of floats to half floats matches the single value one, over a
+// sweep of all the float bit patterns and around the rounding and range boundaries.
+TEST(MathUtilTest, Float32ToFloat16Bulk)
+{
+    std::vector<uint32_t> patterns;
+    for (uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 65521)
+    {
+        patterns.push_back(static_cast<uint32_t>(bits));
+    }
+    const uint32_t boundaries[] = {0x2D000000, 0x33000000, 0x38800000, 0x477FE000,
+                                   0x477FEFFF, 0x477FF000, 0x7F800000, 0x7FC00000};
+    for (uint32_t boundary : boundaries)
+    {
+        for (uint32_t offset = 0; offset < 0x2000; offset += 0x7F)
+        {
+            patterns.push_back(boundary + offset - 0x1000);
+            patterns.push_back((boundary + offset - 0x1000) | 0x80000000u);
+        }
+    }
+    // Halfway cases, which round to even
+    for (uint32_t mantissa = 0; mantissa < 0x400; mantissa++)
+    {
+        patterns.push_back(0x3F800000 | mantissa << 13 | 0x1000);
+        patterns.push_back(0x3F800000 | mantissa << 13 | 0x0FFF);
+    }
+
+    std::vector<float> input;
+    for (uint32_t pattern : patterns)
+    {
+        input.push_back(bitCast<float>(pattern));
+    }
+    std::vector<unsigned short> output(input.size());
+    float32ToFloat16(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        EXPECT_EQ(float32ToFloat16(input[i]), output[i]) << "float 0x" << std::hex << patterns[i];
+    }
+}
+
+// Test that the bulk average of half floats matches the single value one, including NaNs.
+TEST(MathUtilTest, AverageHalfFloatsBulk)
+{
+    std::vector<unsigned short> a;
+    std::vector<unsigned short> b;
+    for (uint32_t i = 0; i < 0x10000; i += 7)
+    {
+        for (uint32_t j = 0; j < 0x10000; j += 0x1FF)
+        {
+            a.push_back(static_cast<unsigned short>(i));
+            b.push_back(static_cast<unsigned short>(j));
+        }
+    }
+
+    std::vector<unsigned short> output(a.size());
+    averageHalfFloats(a.data(), b.data(), output.data(), a.size());
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        EXPECT_EQ(averageHalfFloat(a[i], b[i]), output[i]) << std::hex << a[i] << " " << b[i];
+    }
+}
+
+// Test that the bulk packing of RGB floats matches the packing of single pixels, with values
+// covering the denormals, the infinities, NaNs and negative values.
+TEST(MathUtilTest, PackRGBFloatsBulk)
+{
+    std::vector<float> input;
+    for (uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 0x3FFF1)
+    {
+        input.push_back(bitCast<float>(static_cast<uint32_t>(bits)));
+    }
+    for (uint32_t bits = 0x37000000; bits < 0x48000000; bits += 0x1FFF)
+    {
+        input.push_back(bitCast<float>(bits));
+    }
+    // An odd number of pixels leaves some for the scalar code.
+    input.resize((input.size() / 3) * 3 - 3);
+    const size_t pixelCount = input.size() / 3;
+
+    std::vector<unsigned int> packed(pixelCount);
+    convertRGBFloatsToR11G11B10F(input.data(), packed.data(), pixelCount);
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        const float *pixel = &input[i * 3];
+        const unsigned int expected = float32ToFloat11(pixel[0]) |
+                                      float32ToFloat11(pixel[1]) << 11 |
+                                      float32ToFloat10(pixel[2]) << 22;
+        EXPECT_EQ(expected, packed[i]) << "pixel " << i;
+    }
+
+    convertRGBFloatsTo999E5(input.data(), packed.data(), pixelCount);
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        const float *pixel = &input[i * 3];
+        EXPECT_EQ(convertRGBFloatsTo999E5(pixel[0], pixel[1], pixel[2]), packed[i])
+            << "pixel " << i;
+    }
+}
+
 // Test the correctness of gl::isNaN function.
 TEST(MathUtilTest, isNaN)
 {
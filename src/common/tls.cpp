@@ -34,11 +34,13 @@ static vector<DWORD> freeTlsIndices;
 
 #endif
 
-TLSIndex CreateTLSIndex()
+TLSIndex CreateTLSIndex(TLSDestructor destructor)
 {
     TLSIndex index;
 
 #ifdef ANGLE_PLATFORM_WINDOWS
+    (void)destructor;
+
 #ifdef ANGLE_ENABLE_WINDOWS_STORE
     if (!freeTlsIndices.empty())
     {
@@ -56,7 +58,7 @@ TLSIndex CreateTLSIndex()
 
 #elif defined(ANGLE_PLATFORM_POSIX)
     // Create global pool key
-    if ((pthread_key_create(&index, NULL)) != 0)
+    if ((pthread_key_create(&index, destructor)) != 0)
     {
         index = TLS_INVALID_INDEX;
     }
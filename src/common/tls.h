@@ -34,10 +34,32 @@
 #   error Unsupported platform.
 #endif
 
-// TODO(kbr): for POSIX platforms this will have to be changed to take
-// in a destructor function pointer, to allow the thread-local storage
-// to be properly deallocated upon thread exit.
-TLSIndex CreateTLSIndex();
+// Compiler-native thread locals are faster than the TLS indices, but aren't supported by older
+// compilers. Defining ANGLE_DISABLE_NATIVE_THREAD_LOCAL falls back to the TLS indices, e.g. for
+// DLLs loaded with LoadLibrary on Windows XP, which doesn't allocate their thread locals.
+#if !defined(ANGLE_DISABLE_NATIVE_THREAD_LOCAL)
+#   if defined(_MSC_VER)
+#       if _MSC_VER >= 1900
+#           define ANGLE_THREAD_LOCAL thread_local
+#       endif
+#   elif defined(ANGLE_PLATFORM_LINUX)
+// The thread locals of shared libraries are looked up with __tls_get_addr by default. The initial
+// exec model reads them at a fixed offset instead, using the space glibc reserves for the few
+// thread locals of the libraries loaded with dlopen.
+#       define ANGLE_THREAD_LOCAL __attribute__((tls_model("initial-exec"))) thread_local
+#   elif defined(__clang__)
+#       if __has_feature(cxx_thread_local)
+#           define ANGLE_THREAD_LOCAL thread_local
+#       endif
+#   elif defined(__GNUC__)
+#       define ANGLE_THREAD_LOCAL thread_local
+#   endif
+#endif
+
+// On POSIX platforms the destructor is called with the value of each exiting thread that set one.
+// Windows doesn't call it, the DLLs release the values of their threads in DllMain instead.
+typedef void (*TLSDestructor)(void *value);
+TLSIndex CreateTLSIndex(TLSDestructor destructor = nullptr);
 bool DestroyTLSIndex(TLSIndex index);
 
 bool SetTLSValue(TLSIndex index, void *value);
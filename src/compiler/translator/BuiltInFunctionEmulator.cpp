@@ -107,19 +107,19 @@ BuiltInFunctionEmulator::BuiltInFunctionEmulator()
 void BuiltInFunctionEmulator::addEmulatedFunction(TOperator op, const TType *param,
                                                   const char *emulatedFunctionDefinition)
 {
-    mEmulatedFunctions[FunctionId(op, param)] = std::string(emulatedFunctionDefinition);
+    mEmulatedFunctions[FunctionId(op, param)] = emulatedFunctionDefinition;
 }
 
 void BuiltInFunctionEmulator::addEmulatedFunction(TOperator op, const TType *param1, const TType *param2,
                                                   const char *emulatedFunctionDefinition)
 {
-    mEmulatedFunctions[FunctionId(op, param1, param2)] = std::string(emulatedFunctionDefinition);
+    mEmulatedFunctions[FunctionId(op, param1, param2)] = emulatedFunctionDefinition;
 }
 
 void BuiltInFunctionEmulator::addEmulatedFunction(TOperator op, const TType *param1, const TType *param2,
                                                   const TType *param3, const char *emulatedFunctionDefinition)
 {
-    mEmulatedFunctions[FunctionId(op, param1, param2, param3)] = std::string(emulatedFunctionDefinition);
+    mEmulatedFunctions[FunctionId(op, param1, param2, param3)] = emulatedFunctionDefinition;
 }
 
 bool BuiltInFunctionEmulator::IsOutputEmpty() const
@@ -75,8 +75,9 @@ class BuiltInFunctionEmulator
 
     bool SetFunctionCalled(const FunctionId &functionId);
 
-    // Map from function id to emulated function definition
-    std::map<FunctionId, std::string> mEmulatedFunctions;
+    // Map from function id to emulated function definition. The definitions are string literals,
+    // so that filling the map for each shader doesn't copy them.
+    std::map<FunctionId, const char *> mEmulatedFunctions;
 
     // Called function ids
     std::vector<FunctionId> mFunctions;
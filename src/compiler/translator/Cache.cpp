@@ -83,6 +83,8 @@ const TType *TCache::getType(TBasicType basicType,
 {
     TypeKey key(basicType, precision, qualifier,
                 primarySize, secondarySize);
+
+    std::lock_guard<std::mutex> lock(sCache->mMutex);
     auto it = sCache->mTypes.find(key);
     if (it != sCache->mTypes.end())
     {
@@ -12,6 +12,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <map>
+#include <mutex>
 
 #include "compiler/translator/Types.h"
 #include "compiler/translator/PoolAlloc.h"
@@ -44,6 +45,7 @@ class TCache
         return getType(basicType, EbpUndefined, qualifier,
                        primarySize, secondarySize);
     }
+    // Thread-safe, since shaders can be compiled on several threads at once.
     static const TType *getType(TBasicType basicType,
                                 TPrecision precision,
                                 TQualifier qualifier,
@@ -81,6 +83,8 @@ class TCache
     };
     typedef std::map<TypeKey, const TType*> TypeMap;
 
+    // Guards both the map and the allocator of the cached types.
+    std::mutex mMutex;
     TypeMap mTypes;
     TPoolAllocator mAllocator;
 
@@ -105,6 +105,48 @@ class TScopedSymbolTableLevel
     TSymbolTable* mTable;
 };
 
+// Compile options that change the outcome of parsing and validation. A cached validated tree may
+// only be reused by compiles that agree on all of these.
+const int kValidationCompileOptions =
+    SH_VALIDATE_LOOP_INDEXING | SH_TIMING_RESTRICTIONS | SH_DEPENDENCY_GRAPH |
+    SH_LIMIT_EXPRESSION_COMPLEXITY | SH_LIMIT_CALL_STACK_DEPTH | SH_DONT_PRUNE_UNUSED_FUNCTIONS |
+    SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
+
+// Computes the lazily generated mangled names of all the types in a tree. Struct and interface
+// block types are shared between copies of a tree, so their names need to be allocated from the
+// same pool as the tree itself.
+class TMangledNameInitializer : public TIntermTraverser
+{
+  public:
+    TMangledNameInitializer() : TIntermTraverser(true, false, false) {}
+
+    void visitSymbol(TIntermSymbol *node) override { node->getType().getMangledName(); }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        node->getType().getMangledName();
+    }
+    bool visitBinary(Visit, TIntermBinary *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitUnary(Visit, TIntermUnary *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitSelection(Visit, TIntermSelection *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitAggregate(Visit, TIntermAggregate *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+};
+
 int MapSpecToShaderVersion(ShShaderSpec spec)
 {
     switch (spec)
@@ -160,6 +202,32 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
 
 TCompiler::~TCompiler()
 {
+    for (TCompiler *clone : mClones)
+    {
+        DeleteCompiler(clone);
+    }
+}
+
+TCompiler::ValidatedTreeCache::ValidatedTreeCache()
+    : root(nullptr),
+      sourceHash(0),
+      validationOptions(0),
+      shaderVersion(100),
+      computeShaderLocalSizeDeclared(false),
+      fragmentPrecisionHigh(false)
+{
+    allocator.push();
+}
+
+void TCompiler::ValidatedTreeCache::clear()
+{
+    allocator.popAll();
+    allocator.push();
+    root = nullptr;
+    source.clear();
+    extensionBehavior.clear();
+    invariantVaryings.clear();
+    infoLog.clear();
 }
 
 bool TCompiler::shouldRunLoopAndIndexingValidation(int compileOptions) const
@@ -197,24 +265,47 @@ bool TCompiler::Init(const ShBuiltInResources& resources)
     return true;
 }
 
+TCompiler *TCompiler::getClone(size_t index)
+{
+    while (mClones.size() <= index)
+    {
+        TCompiler *clone = ConstructCompiler(shaderType, shaderSpec, outputType);
+        if (clone == nullptr)
+        {
+            return nullptr;
+        }
+
+        // Init() leaves the clone's allocator as the global pool allocator.
+        TPoolAllocator *currentAllocator = GetGlobalPoolAllocator();
+        bool initialized                 = clone->Init(compileResources);
+        SetGlobalPoolAllocator(currentAllocator);
+
+        if (!initialized)
+        {
+            DeleteCompiler(clone);
+            return nullptr;
+        }
+        mClones.push_back(clone);
+    }
+    return mClones[index];
+}
+
 TIntermNode *TCompiler::compileTreeForTesting(const char* const shaderStrings[],
     size_t numStrings, int compileOptions)
 {
-    return compileTreeImpl(shaderStrings, numStrings, compileOptions);
+    return compileTreeImpl(shaderStrings, numStrings, compileOptions, false);
 }
 
 TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
                                         size_t numStrings,
-                                        const int compileOptions)
+                                        const int compileOptions,
+                                        bool reflectionOnly)
 {
     clearResults();
 
     ASSERT(numStrings > 0);
     ASSERT(GetGlobalPoolAllocator());
 
-    // Reset the extension behavior for each compilation unit.
-    ResetExtensionBehavior(extensionBehavior);
-
     // First string is path of source file if flag is set. The actual source follows.
     size_t firstSource = 0;
     if (compileOptions & SH_SOURCE_PATH)
@@ -223,84 +314,50 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         ++firstSource;
     }
 
-    TIntermediate intermediate(infoSink);
-    TParseContext parseContext(symbolTable, extensionBehavior, intermediate, shaderType, shaderSpec,
-                               compileOptions, true, infoSink, getResources());
-
-    parseContext.setFragmentPrecisionHighOnESSL1(fragmentPrecisionHigh);
-    SetGlobalParseContext(&parseContext);
-
     // We preserve symbols at the built-in level from compile-to-compile.
     // Start pushing the user-defined symbols at global level.
     TScopedSymbolTableLevel scopedSymbolLevel(&symbolTable);
 
-    // Parse shader.
-    bool success =
-        (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr, &parseContext) == 0) &&
-        (parseContext.getTreeRoot() != nullptr);
-
-    shaderVersion = parseContext.getShaderVersion();
-    if (success && MapSpecToShaderVersion(shaderSpec) < shaderVersion)
+    TIntermNode *root = nullptr;
+    if ((compileOptions & SH_CACHE_VALIDATED_TREE) && !(compileOptions & SH_REGENERATE_STRUCT_NAMES))
     {
-        infoSink.info.prefix(EPrefixError);
-        infoSink.info << "unsupported shader version";
-        success = false;
+        root = getCachedValidatedTree(&shaderStrings[firstSource], numStrings - firstSource,
+                                      compileOptions);
     }
-
-    TIntermNode *root = nullptr;
-
-    if (success)
+    else
     {
-        mPragma = parseContext.pragma();
-        symbolTable.setGlobalInvariant(mPragma.stdgl.invariantAll);
-
-        mComputeShaderLocalSizeDeclared = parseContext.isComputeShaderLocalSizeDeclared();
-        mComputeShaderLocalSize         = parseContext.getComputeShaderLocalSize();
-
-        root = parseContext.getTreeRoot();
-        root = intermediate.postProcess(root);
-
-        // Highp might have been auto-enabled based on shader version
-        fragmentPrecisionHigh = parseContext.getFragmentPrecisionHigh();
-
-        // Disallow expressions deemed too complex.
-        if (success && (compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY))
-            success = limitExpressionComplexity(root);
+        root = parseAndValidate(&shaderStrings[firstSource], numStrings - firstSource,
+                                compileOptions);
+    }
 
-        // Create the function DAG and check there is no recursion
-        if (success)
-            success = initCallDag(root);
+    bool success = (root != nullptr);
 
-        if (success && (compileOptions & SH_LIMIT_CALL_STACK_DEPTH))
-            success = checkCallDepth();
+    if (success && reflectionOnly)
+    {
+        // Only the passes that affect the collected variables are run.
+        if (shaderType == GL_VERTEX_SHADER && ((compileOptions & SH_INIT_GL_POSITION) ||
+                                               (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
+            initializeGLPosition(root);
 
-        // Checks which functions are used and if "main" exists
-        if (success)
+        collectVariables(root);
+        if (compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS)
         {
-            functionMetadata.clear();
-            functionMetadata.resize(mCallDag.size());
-            success = tagUsedFunctions();
+            success = enforcePackingRestrictions();
+            if (!success)
+            {
+                infoSink.info.prefix(EPrefixError);
+                infoSink.info << "too many uniforms";
+            }
         }
 
-        if (success && !(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
-            success = pruneUnusedFunctions(root);
-
-        // Prune empty declarations to work around driver bugs and to keep declaration output simple.
-        if (success)
-            PruneEmptyDeclarations(root);
-
-        if (success && shaderVersion == 300 && shaderType == GL_FRAGMENT_SHADER)
-            success = validateOutputs(root);
-
-        if (success && shouldRunLoopAndIndexingValidation(compileOptions))
-            success = validateLimitations(root);
-
-        if (success && (compileOptions & SH_TIMING_RESTRICTIONS))
-            success = enforceTimingRestrictions(root, (compileOptions & SH_DEPENDENCY_GRAPH) != 0);
-
-        if (success && shaderSpec == SH_CSS_SHADERS_SPEC)
-            rewriteCSSShader(root);
-
+        // The broadcast replaces gl_FragColor with gl_FragData in the output variables.
+        if (success && shouldEmulateGLFragColorBroadcast())
+        {
+            EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables);
+        }
+    }
+    else if (success)
+    {
         // Unroll for-loop markup needs to happen after validateLimitations pass.
         if (success && (compileOptions & SH_UNROLL_FOR_LOOP_WITH_INTEGER_INDEX))
         {
@@ -388,9 +445,7 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             root->traverse(&gen);
         }
 
-        if (success && shaderType == GL_FRAGMENT_SHADER && shaderVersion == 100 &&
-            compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
-            IsExtensionEnabled(extensionBehavior, "GL_EXT_draw_buffers"))
+        if (success && shouldEmulateGLFragColorBroadcast())
         {
             EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables);
         }
@@ -401,6 +456,101 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         }
     }
 
+    if (success)
+        return root;
+
+    return NULL;
+}
+
+bool TCompiler::shouldEmulateGLFragColorBroadcast() const
+{
+    return shaderType == GL_FRAGMENT_SHADER && shaderVersion == 100 &&
+           compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
+           IsExtensionEnabled(extensionBehavior, "GL_EXT_draw_buffers");
+}
+
+TIntermNode *TCompiler::parseAndValidate(const char *const shaderStrings[],
+                                         size_t numStrings,
+                                         const int compileOptions)
+{
+    // Reset the extension behavior for each compilation unit.
+    ResetExtensionBehavior(extensionBehavior);
+
+    TIntermediate intermediate(infoSink);
+    TParseContext parseContext(symbolTable, extensionBehavior, intermediate, shaderType, shaderSpec,
+                               compileOptions, true, infoSink, getResources());
+
+    parseContext.setFragmentPrecisionHighOnESSL1(fragmentPrecisionHigh);
+    SetGlobalParseContext(&parseContext);
+
+    // Parse shader.
+    bool success =
+        (PaParseStrings(numStrings, shaderStrings, nullptr, &parseContext) == 0) &&
+        (parseContext.getTreeRoot() != nullptr);
+
+    shaderVersion = parseContext.getShaderVersion();
+    if (success && MapSpecToShaderVersion(shaderSpec) < shaderVersion)
+    {
+        infoSink.info.prefix(EPrefixError);
+        infoSink.info << "unsupported shader version";
+        success = false;
+    }
+
+    TIntermNode *root = nullptr;
+
+    if (success)
+    {
+        mPragma = parseContext.pragma();
+        symbolTable.setGlobalInvariant(mPragma.stdgl.invariantAll);
+
+        mComputeShaderLocalSizeDeclared = parseContext.isComputeShaderLocalSizeDeclared();
+        mComputeShaderLocalSize         = parseContext.getComputeShaderLocalSize();
+
+        root = parseContext.getTreeRoot();
+        root = intermediate.postProcess(root);
+
+        // Highp might have been auto-enabled based on shader version
+        fragmentPrecisionHigh = parseContext.getFragmentPrecisionHigh();
+
+        // Disallow expressions deemed too complex.
+        if (success && (compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY))
+            success = limitExpressionComplexity(root);
+
+        // Create the function DAG and check there is no recursion
+        if (success)
+            success = initCallDag(root);
+
+        if (success && (compileOptions & SH_LIMIT_CALL_STACK_DEPTH))
+            success = checkCallDepth();
+
+        // Checks which functions are used and if "main" exists
+        if (success)
+        {
+            functionMetadata.clear();
+            functionMetadata.resize(mCallDag.size());
+            success = tagUsedFunctions();
+        }
+
+        if (success && !(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
+            success = pruneUnusedFunctions(root);
+
+        // Prune empty declarations to work around driver bugs and to keep declaration output simple.
+        if (success)
+            PruneEmptyDeclarations(root);
+
+        if (success && shaderVersion == 300 && shaderType == GL_FRAGMENT_SHADER)
+            success = validateOutputs(root);
+
+        if (success && shouldRunLoopAndIndexingValidation(compileOptions))
+            success = validateLimitations(root);
+
+        if (success && (compileOptions & SH_TIMING_RESTRICTIONS))
+            success = enforceTimingRestrictions(root, (compileOptions & SH_DEPENDENCY_GRAPH) != 0);
+
+        if (success && shaderSpec == SH_CSS_SHADERS_SPEC)
+            rewriteCSSShader(root);
+    }
+
     SetGlobalParseContext(NULL);
     if (success)
         return root;
@@ -408,22 +558,98 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     return NULL;
 }
 
-bool TCompiler::compile(const char *const shaderStrings[], size_t numStrings, int compileOptionsIn)
+TIntermNode *TCompiler::getCachedValidatedTree(const char *const shaderStrings[],
+                                               size_t numStrings,
+                                               const int compileOptions)
 {
-    if (numStrings == 0)
-        return true;
+    std::string source;
+    for (size_t i = 0; i < numStrings; ++i)
+    {
+        source += shaderStrings[i];
+        // Keep the string boundaries, since they are visible through __LINE__ and diagnostics.
+        source += '\0';
+    }
+    size_t sourceHash     = std::hash<std::string>()(source);
+    int validationOptions = compileOptions & kValidationCompileOptions;
 
-    int compileOptions = compileOptionsIn;
+    if (mValidatedTree.root != nullptr && mValidatedTree.sourceHash == sourceHash &&
+        mValidatedTree.validationOptions == validationOptions && mValidatedTree.source == source)
+    {
+        // Restore the state that parsing and validation would have left behind.
+        shaderVersion                   = mValidatedTree.shaderVersion;
+        mPragma                         = mValidatedTree.pragma;
+        mComputeShaderLocalSizeDeclared = mValidatedTree.computeShaderLocalSizeDeclared;
+        mComputeShaderLocalSize         = mValidatedTree.computeShaderLocalSize;
+        fragmentPrecisionHigh           = mValidatedTree.fragmentPrecisionHigh;
+        extensionBehavior               = mValidatedTree.extensionBehavior;
 
+        symbolTable.setGlobalInvariant(mPragma.stdgl.invariantAll);
+        for (const std::string &varying : mValidatedTree.invariantVaryings)
+        {
+            symbolTable.addInvariantVarying(varying);
+        }
+        infoSink.info << mValidatedTree.infoLog.c_str();
+
+        return mValidatedTree.root->deepCopy();
+    }
+
+    // Parse and validate into the cache's own pool.
+    mValidatedTree.clear();
+    TPoolAllocator *compileAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&mValidatedTree.allocator);
+
+    TIntermNode *root = parseAndValidate(shaderStrings, numStrings, compileOptions);
+    if (root)
+    {
+        TMangledNameInitializer mangledNameInitializer;
+        root->traverse(&mangledNameInitializer);
+
+        mValidatedTree.root                           = root;
+        mValidatedTree.sourceHash                     = sourceHash;
+        mValidatedTree.source                         = source;
+        mValidatedTree.validationOptions              = validationOptions;
+        mValidatedTree.shaderVersion                  = shaderVersion;
+        mValidatedTree.pragma                         = mPragma;
+        mValidatedTree.computeShaderLocalSizeDeclared = mComputeShaderLocalSizeDeclared;
+        mValidatedTree.computeShaderLocalSize         = mComputeShaderLocalSize;
+        mValidatedTree.fragmentPrecisionHigh          = fragmentPrecisionHigh;
+        mValidatedTree.extensionBehavior              = extensionBehavior;
+        mValidatedTree.invariantVaryings              = symbolTable.getInvariantVaryings();
+        mValidatedTree.infoLog                        = infoSink.info.c_str();
+    }
+
+    SetGlobalPoolAllocator(compileAllocator);
+
+    if (!root)
+    {
+        mValidatedTree.clear();
+        return NULL;
+    }
+
+    // Hand out a copy so that the transformations don't modify the cached tree.
+    return root->deepCopy();
+}
+
+int TCompiler::applyCompileOptionWorkarounds(int compileOptions)
+{
     // Apply key workarounds.
     if (shouldFlattenPragmaStdglInvariantAll())
     {
         // This should be harmless to do in all cases, but for the moment, do it only conditionally.
         compileOptions |= SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
     }
+    return compileOptions;
+}
+
+bool TCompiler::compile(const char *const shaderStrings[], size_t numStrings, int compileOptionsIn)
+{
+    if (numStrings == 0)
+        return true;
+
+    int compileOptions = applyCompileOptionWorkarounds(compileOptionsIn);
 
     TScopedPoolAllocator scopedAlloc(&allocator);
-    TIntermNode *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
+    TIntermNode *root = compileTreeImpl(shaderStrings, numStrings, compileOptions, false);
 
     if (root)
     {
@@ -440,6 +666,17 @@ bool TCompiler::compile(const char *const shaderStrings[], size_t numStrings, in
     return false;
 }
 
+bool TCompiler::reflect(const char *const shaderStrings[], size_t numStrings, int compileOptions)
+{
+    if (numStrings == 0)
+        return true;
+
+    TScopedPoolAllocator scopedAlloc(&allocator);
+    TIntermNode *root = compileTreeImpl(shaderStrings, numStrings,
+                                        applyCompileOptionWorkarounds(compileOptions), true);
+    return (root != nullptr);
+}
+
 bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
 {
     compileResources = resources;
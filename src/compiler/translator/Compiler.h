@@ -24,6 +24,8 @@
 #include "compiler/translator/VariableInfo.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
 
+#include <set>
+
 class TCompiler;
 class TDependencyGraph;
 #ifdef ANGLE_ENABLE_HLSL
@@ -81,6 +83,15 @@ class TCompiler : public TShHandleBase
     bool compile(const char* const shaderStrings[],
         size_t numStrings, int compileOptions);
 
+    // Parses and validates the shader and collects its variables, skipping the transformations
+    // and the translation to object code. The results are queried like those of compile().
+    bool reflect(const char *const shaderStrings[], size_t numStrings, int compileOptions);
+
+    // Returns a compiler with the same type, spec, output and resources as this one, that can be
+    // used to compile shaders on another thread. Clones are created on first use and are owned by
+    // this compiler. Returns NULL if the clone couldn't be initialized.
+    TCompiler *getClone(size_t index);
+
     // Get results of the last compilation.
     int getShaderVersion() const { return shaderVersion; }
     TInfoSink& getInfoSink() { return infoSink; }
@@ -141,6 +152,9 @@ class TCompiler : public TShHandleBase
     // while spec says it is allowed.
     // This function should only be applied to vertex shaders.
     void initializeGLPosition(TIntermNode* root);
+    // Returns true if the writes to gl_FragColor have to be broadcast to all the draw buffers,
+    // which also changes the output variables of the shader.
+    bool shouldEmulateGLFragColorBroadcast() const;
     // Returns true if the shader passes the restrictions that aim to prevent timing attacks.
     bool enforceTimingRestrictions(TIntermNode* root, bool outputGraph);
     // Returns true if the shader does not use samplers.
@@ -191,9 +205,25 @@ class TCompiler : public TShHandleBase
     class UnusedPredicate;
     bool pruneUnusedFunctions(TIntermNode *root);
 
+    // Adds the compile options implied by workarounds of this compiler.
+    int applyCompileOptionWorkarounds(int compileOptions);
+
     TIntermNode *compileTreeImpl(const char *const shaderStrings[],
                                  size_t numStrings,
-                                 const int compileOptions);
+                                 const int compileOptions,
+                                 bool reflectionOnly);
+
+    // Parses the shader and runs the validation passes, which don't depend on the compile
+    // options that only select transformations. Returns NULL on failure.
+    TIntermNode *parseAndValidate(const char *const shaderStrings[],
+                                  size_t numStrings,
+                                  const int compileOptions);
+
+    // Returns a copy of the validated tree of the given source, parsing and validating it first
+    // unless it matches the cached one. Returns NULL on failure.
+    TIntermNode *getCachedValidatedTree(const char *const shaderStrings[],
+                                        size_t numStrings,
+                                        const int compileOptions);
 
     sh::GLenum shaderType;
     ShShaderSpec shaderSpec;
@@ -246,6 +276,34 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     unsigned int mTemporaryIndex;
+
+    // The validated tree of the last source compiled with SH_CACHE_VALIDATED_TREE, along with
+    // the compiler state that parsing and validation left behind. The tree is allocated from its
+    // own pool so that it outlives the compilation that created it.
+    struct ValidatedTreeCache
+    {
+        ValidatedTreeCache();
+        void clear();
+
+        TPoolAllocator allocator;
+        TIntermNode *root;
+
+        size_t sourceHash;
+        std::string source;
+        int validationOptions;
+
+        int shaderVersion;
+        TPragma pragma;
+        bool computeShaderLocalSizeDeclared;
+        TLocalSize computeShaderLocalSize;
+        bool fragmentPrecisionHigh;
+        TExtensionBehavior extensionBehavior;
+        std::set<std::string> invariantVaryings;
+        std::string infoLog;
+    };
+    ValidatedTreeCache mValidatedTree;
+
+    std::vector<TCompiler *> mClones;
 };
 
 //
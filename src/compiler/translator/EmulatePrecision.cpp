@@ -6,6 +6,9 @@
 
 #include "compiler/translator/EmulatePrecision.h"
 
+#include <algorithm>
+#include <iterator>
+#include <math.h>
 #include <memory>
 
 namespace
@@ -462,6 +465,263 @@ TIntermAggregate *createCompoundAssignmentFunctionCallNode(TIntermTyped *left, T
     return callNode;
 }
 
+// Returns true if rounding |value| to |precision| with the helper functions gives it back.
+bool isRepresentable(float value, TPrecision precision)
+{
+    if (precision == EbpLow)
+    {
+        // Multiples of 2^-8 up to 2
+        return fabsf(value) <= 2.0f && floorf(value * 256.0f) == value * 256.0f;
+    }
+
+    ASSERT(precision == EbpMedium);
+    if (value == 0.0f)
+    {
+        return true;
+    }
+    // 11 significant bits, with a magnitude between 2^-15 and 65504
+    int exponent = 0;
+    float mantissa = frexpf(fabsf(value), &exponent);
+    return fabsf(value) <= 65504.0f && exponent - 1 >= -15 &&
+           floorf(ldexpf(mantissa, 11)) == ldexpf(mantissa, 11);
+}
+
+bool isRepresentableConstant(const TIntermConstantUnion *constant, TPrecision precision)
+{
+    const TType &type = constant->getType();
+    if (type.getBasicType() != EbtFloat || type.isArray())
+    {
+        return false;
+    }
+    for (size_t index = 0; index < type.getObjectSize(); ++index)
+    {
+        if (!isRepresentable(constant->getFConst(index), precision))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns true if the value of |node| in the translated shader is already rounded to |precision|,
+// either because the emulation rounds it or because it was rounded before. It mirrors the nodes
+// the traverser below rounds, for nodes whose result is used.
+bool isRoundedValue(TIntermTyped *node, TPrecision precision)
+{
+    TIntermConstantUnion *constant = node->getAsConstantUnion();
+    if (constant)
+    {
+        return isRepresentableConstant(constant, precision);
+    }
+
+    if (!canRoundFloat(node->getType()) || node->getPrecision() != precision)
+    {
+        return false;
+    }
+
+    if (node->getAsSymbolNode())
+    {
+        return true;
+    }
+
+    TIntermBinary *binary = node->getAsBinaryNode();
+    if (binary)
+    {
+        switch (binary->getOp())
+        {
+          case EOpAssign:
+          case EOpAdd:
+          case EOpSub:
+          case EOpMul:
+          case EOpDiv:
+          case EOpVectorTimesScalar:
+          case EOpVectorTimesMatrix:
+          case EOpMatrixTimesVector:
+          case EOpMatrixTimesScalar:
+          case EOpMatrixTimesMatrix:
+          case EOpAddAssign:
+          case EOpSubAssign:
+          case EOpMulAssign:
+          case EOpVectorTimesMatrixAssign:
+          case EOpVectorTimesScalarAssign:
+          case EOpMatrixTimesScalarAssign:
+          case EOpMatrixTimesMatrixAssign:
+          case EOpDivAssign:
+            return true;
+          case EOpVectorSwizzle:
+          case EOpIndexDirect:
+          case EOpIndexIndirect:
+            return isRoundedValue(binary->getLeft(), precision);
+          default:
+            return false;
+        }
+    }
+
+    TIntermUnary *unary = node->getAsUnaryNode();
+    if (unary)
+    {
+        switch (unary->getOp())
+        {
+          case EOpNegative:
+            return isRoundedValue(unary->getOperand(), precision);
+          case EOpPostIncrement:
+          case EOpPostDecrement:
+          case EOpPreIncrement:
+          case EOpPreDecrement:
+            return false;
+          default:
+            return true;
+        }
+    }
+
+    TIntermAggregate *aggregate = node->getAsAggregate();
+    if (aggregate)
+    {
+        // User-defined function return values are not rounded.
+        return aggregate->getOp() != EOpFunctionCall && aggregate->getOp() != EOpConstructStruct;
+    }
+
+    TIntermSelection *selection = node->getAsSelectionNode();
+    if (selection && selection->usesTernaryOperator())
+    {
+        return isRoundedValue(selection->getTrueBlock()->getAsTyped(), precision) &&
+               isRoundedValue(selection->getFalseBlock()->getAsTyped(), precision);
+    }
+
+    return false;
+}
+
+// Returns true if the built-in function or constructor only produces values taken from its
+// arguments, which don't need to be rounded again when all the arguments are rounded.
+bool isRoundedIfArgumentsAre(TIntermAggregate *node)
+{
+    switch (node->getOp())
+    {
+      case EOpMin:
+      case EOpMax:
+      case EOpClamp:
+        break;
+      default:
+        if (!node->isConstructor())
+        {
+            return false;
+        }
+        break;
+    }
+
+    for (TIntermNode *argument : *node->getSequence())
+    {
+        if (!isRoundedValue(argument->getAsTyped(), node->getPrecision()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Finds the local and global variables that are only ever assigned values rounded to their own
+// precision. Reading them doesn't need to round them again.
+class RoundedVariablesTraverser : public TLValueTrackingTraverser
+{
+  public:
+    RoundedVariablesTraverser(const TSymbolTable &symbolTable, int shaderVersion)
+        : TLValueTrackingTraverser(true, false, false, symbolTable, shaderVersion)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+
+    std::set<int> getRoundedVariables() const;
+
+  private:
+    static bool isCandidate(const TIntermSymbol *node);
+    bool isRoundedWrite(TIntermSymbol *node);
+
+    std::set<int> mVariables;
+    std::set<int> mUnroundedVariables;
+};
+
+bool RoundedVariablesTraverser::isCandidate(const TIntermSymbol *node)
+{
+    TQualifier qualifier = node->getQualifier();
+    return canRoundFloat(node->getType()) &&
+           (qualifier == EvqTemporary || qualifier == EvqGlobal);
+}
+
+void RoundedVariablesTraverser::visitSymbol(TIntermSymbol *node)
+{
+    if (!isCandidate(node))
+    {
+        return;
+    }
+
+    mVariables.insert(node->getId());
+    if (isLValueRequiredHere() && !isRoundedWrite(node))
+    {
+        mUnroundedVariables.insert(node->getId());
+    }
+}
+
+bool RoundedVariablesTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    // Initialization doesn't require an l-value, so it's not seen by visitSymbol.
+    TIntermSymbol *symbol = node->getLeft()->getAsSymbolNode();
+    if (node->getOp() == EOpInitialize && symbol && isCandidate(symbol) &&
+        !isRoundedValue(node->getRight(), symbol->getPrecision()))
+    {
+        mUnroundedVariables.insert(symbol->getId());
+    }
+    return true;
+}
+
+// Writes through swizzles and indices are rounded when the assigned value is. Compound
+// assignments are emulated by functions rounding their result, other writes like increments or
+// out parameters are not rounded.
+bool RoundedVariablesTraverser::isRoundedWrite(TIntermSymbol *node)
+{
+    TIntermNode *written = node;
+    for (unsigned int n = 0;; ++n)
+    {
+        TIntermBinary *binary = getAncestorNode(n) ? getAncestorNode(n)->getAsBinaryNode() : nullptr;
+        if (!binary || binary->getLeft() != written)
+        {
+            return false;
+        }
+
+        switch (binary->getOp())
+        {
+          case EOpVectorSwizzle:
+          case EOpIndexDirect:
+          case EOpIndexIndirect:
+            written = binary;
+            break;
+          case EOpAssign:
+            return isRoundedValue(binary->getRight(), node->getPrecision());
+          case EOpAddAssign:
+          case EOpSubAssign:
+          case EOpMulAssign:
+          case EOpVectorTimesMatrixAssign:
+          case EOpVectorTimesScalarAssign:
+          case EOpMatrixTimesScalarAssign:
+          case EOpMatrixTimesMatrixAssign:
+          case EOpDivAssign:
+            return true;
+          default:
+            return false;
+        }
+    }
+}
+
+std::set<int> RoundedVariablesTraverser::getRoundedVariables() const
+{
+    std::set<int> roundedVariables;
+    std::set_difference(mVariables.begin(), mVariables.end(), mUnroundedVariables.begin(),
+                        mUnroundedVariables.end(),
+                        std::inserter(roundedVariables, roundedVariables.end()));
+    return roundedVariables;
+}
+
 bool parentUsesResult(TIntermNode* parent, TIntermNode* node)
 {
     if (!parent)
@@ -491,9 +751,17 @@ EmulatePrecision::EmulatePrecision(const TSymbolTable &symbolTable, int shaderVe
       mDeclaringVariables(false)
 {}
 
+void EmulatePrecision::findRoundedVariables(TIntermNode *root)
+{
+    RoundedVariablesTraverser traverser(getSymbolTable(), getShaderVersion());
+    root->traverse(&traverser);
+    mRoundedVariables = traverser.getRoundedVariables();
+}
+
 void EmulatePrecision::visitSymbol(TIntermSymbol *node)
 {
-    if (canRoundFloat(node->getType()) && !mDeclaringVariables && !isLValueRequiredHere())
+    if (canRoundFloat(node->getType()) && !mDeclaringVariables && !isLValueRequiredHere() &&
+        mRoundedVariables.count(node->getId()) == 0)
     {
         TIntermNode *replacement = createRoundingFunctionCallNode(node);
         queueReplacement(node, replacement, OriginalNode::BECOMES_CHILD);
@@ -541,6 +809,11 @@ bool EmulatePrecision::visitBinary(Visit visit, TIntermBinary *node)
             {
                 break;
             }
+            // The value of an assignment is the assigned one, which may be rounded already.
+            if (op == EOpAssign && isRoundedValue(node->getRight(), type.getPrecision()))
+            {
+                break;
+            }
             TIntermNode *replacement = createRoundingFunctionCallNode(node);
             queueReplacement(node, replacement, OriginalNode::BECOMES_CHILD);
             break;
@@ -651,7 +924,8 @@ bool EmulatePrecision::visitAggregate(Visit visit, TIntermAggregate *node)
       }
       default:
         TIntermNode *parent = getParentNode();
-        if (canRoundFloat(node->getType()) && visit == PreVisit && parentUsesResult(parent, node))
+        if (canRoundFloat(node->getType()) && visit == PreVisit && parentUsesResult(parent, node) &&
+            !isRoundedIfArgumentsAre(node))
         {
             TIntermNode *replacement = createRoundingFunctionCallNode(node);
             queueReplacement(node, replacement, OriginalNode::BECOMES_CHILD);
@@ -673,6 +947,15 @@ bool EmulatePrecision::visitUnary(Visit visit, TIntermUnary *node)
       case EOpPreIncrement:
       case EOpPreDecrement:
         break;
+      case EOpAbs:
+        // The absolute value of a rounded value is rounded.
+        if (canRoundFloat(node->getType()) && visit == PreVisit &&
+            !isRoundedValue(node->getOperand(), node->getPrecision()))
+        {
+            TIntermNode *replacement = createRoundingFunctionCallNode(node);
+            queueReplacement(node, replacement, OriginalNode::BECOMES_CHILD);
+        }
+        break;
       default:
         if (canRoundFloat(node->getType()) && visit == PreVisit)
         {
@@ -23,6 +23,10 @@ class EmulatePrecision : public TLValueTrackingTraverser
   public:
     EmulatePrecision(const TSymbolTable &symbolTable, int shaderVersion);
 
+    // Finds the variables holding values that are always rounded, which are then read without
+    // rounding them again. Optional, to be called before traversing |root|.
+    void findRoundedVariables(TIntermNode *root);
+
     void visitSymbol(TIntermSymbol *node) override;
     bool visitBinary(Visit visit, TIntermBinary *node) override;
     bool visitUnary(Visit visit, TIntermUnary *node) override;
@@ -59,6 +63,9 @@ class EmulatePrecision : public TLValueTrackingTraverser
     EmulationSet mEmulateCompoundDiv;
 
     bool mDeclaringVariables;
+
+    // Symbol ids of the variables found by findRoundedVariables
+    std::set<int> mRoundedVariables;
 };
 
 #endif  // COMPILER_TRANSLATOR_EMULATE_PRECISION_H_
@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HelperFunctionCacheHLSL: Process-wide cache of the helper functions written into the HLSL
+// output.
+//
+
+#include "compiler/translator/HelperFunctionCacheHLSL.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace sh
+{
+
+namespace
+{
+
+struct HelperFunctionCache
+{
+    std::mutex mutex;
+
+    // std::map never moves its values, so that the returned references stay valid.
+    std::map<std::pair<HelperFunctionKind, std::string>, std::string> helpers;
+};
+
+// The cache is never destroyed, so that shaders translated while the process exits can still use
+// it.
+HelperFunctionCache *GetCache()
+{
+    static HelperFunctionCache *cache = new HelperFunctionCache();
+    return cache;
+}
+
+}  // anonymous namespace
+
+// static
+const std::string &HelperFunctionCacheHLSL::get(HelperFunctionKind kind,
+                                                const TString &signature,
+                                                const Generator &generate)
+{
+    HelperFunctionCache *cache = GetCache();
+    std::lock_guard<std::mutex> lock(cache->mutex);
+
+    auto key = std::make_pair(kind, std::string(signature.c_str(), signature.length()));
+    auto helper = cache->helpers.find(key);
+    if (helper != cache->helpers.end())
+    {
+        return helper->second;
+    }
+
+    // The generators only write to |out|, so they can't use the cache again.
+    TInfoSinkBase out;
+    generate(out);
+    return cache->helpers.insert(std::make_pair(std::move(key), out.str())).first->second;
+}
+
+// static
+size_t HelperFunctionCacheHLSL::size()
+{
+    HelperFunctionCache *cache = GetCache();
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    return cache->helpers.size();
+}
+
+}  // namespace sh
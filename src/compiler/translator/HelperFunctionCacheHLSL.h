@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HelperFunctionCacheHLSL: Process-wide cache of the helper functions written into the HLSL
+// output, like the texture function implementations and the constructors of built-in types. Each
+// helper is generated when the first shader using it is translated, and later translations copy
+// the cached text.
+//
+
+#ifndef COMPILER_TRANSLATOR_HELPERFUNCTIONCACHEHLSL_H_
+#define COMPILER_TRANSLATOR_HELPERFUNCTIONCACHEHLSL_H_
+
+#include <functional>
+#include <string>
+
+#include "compiler/translator/Common.h"
+#include "compiler/translator/InfoSink.h"
+
+namespace sh
+{
+
+enum class HelperFunctionKind
+{
+    Texture,
+    Constructor,
+    ArrayEquality,
+    ArrayAssignment,
+    ArrayConstructInto
+};
+
+class HelperFunctionCacheHLSL final : angle::NonCopyable
+{
+  public:
+    typedef std::function<void(TInfoSinkBase &out)> Generator;
+
+    // Returns the definition of the helper, written by |generate| if no shader used it before.
+    // |signature| must identify the text of the helper among the helpers of the same kind,
+    // including the output type if the text depends on it. The returned text is never modified
+    // and stays valid until the process exits. Thread-safe.
+    static const std::string &get(HelperFunctionKind kind,
+                                  const TString &signature,
+                                  const Generator &generate);
+
+    // Number of helpers cached by all the translations so far.
+    static size_t size();
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_HELPERFUNCTIONCACHEHLSL_H_
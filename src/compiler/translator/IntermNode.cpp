@@ -385,9 +385,8 @@ TIntermAggregate::TIntermAggregate(const TIntermAggregate &node)
 {
     for (TIntermNode *child : node.mSequence)
     {
-        TIntermTyped *typedChild = child->getAsTyped();
-        ASSERT(typedChild != nullptr);
-        TIntermTyped *childCopy = typedChild->deepCopy();
+        TIntermNode *childCopy = child->deepCopy();
+        ASSERT(childCopy != nullptr);
         mSequence.push_back(childCopy);
     }
 }
@@ -412,18 +411,47 @@ TIntermUnary::TIntermUnary(const TIntermUnary &node)
 
 TIntermSelection::TIntermSelection(const TIntermSelection &node) : TIntermTyped(node)
 {
-    // Only supported for ternary nodes, not if statements.
-    TIntermTyped *trueTyped  = node.mTrueBlock->getAsTyped();
-    TIntermTyped *falseTyped = node.mFalseBlock->getAsTyped();
-    ASSERT(trueTyped != nullptr);
-    ASSERT(falseTyped != nullptr);
-    TIntermTyped *conditionCopy = node.mCondition->deepCopy();
-    TIntermTyped *trueCopy      = trueTyped->deepCopy();
-    TIntermTyped *falseCopy = falseTyped->deepCopy();
-    ASSERT(conditionCopy != nullptr && trueCopy != nullptr && falseCopy != nullptr);
-    mCondition  = conditionCopy;
-    mTrueBlock  = trueCopy;
-    mFalseBlock = falseCopy;
+    // The blocks of an if statement may be missing, but the branches of a ternary operator may not.
+    mCondition  = node.mCondition->deepCopy();
+    mTrueBlock  = node.mTrueBlock ? node.mTrueBlock->deepCopy() : nullptr;
+    mFalseBlock = node.mFalseBlock ? node.mFalseBlock->deepCopy() : nullptr;
+    ASSERT(mCondition != nullptr);
+    ASSERT(!usesTernaryOperator() || (mTrueBlock != nullptr && mFalseBlock != nullptr));
+}
+
+TIntermLoop::TIntermLoop(const TIntermLoop &node)
+    : TIntermNode(),
+      mType(node.mType),
+      mInit(node.mInit ? node.mInit->deepCopy() : nullptr),
+      mCond(node.mCond ? node.mCond->deepCopy() : nullptr),
+      mExpr(node.mExpr ? node.mExpr->deepCopy() : nullptr),
+      mBody(node.mBody ? node.mBody->deepCopy()->getAsAggregate() : nullptr),
+      mUnrollFlag(node.mUnrollFlag)
+{
+    mLine = node.mLine;
+}
+
+TIntermBranch::TIntermBranch(const TIntermBranch &node)
+    : TIntermNode(),
+      mFlowOp(node.mFlowOp),
+      mExpression(node.mExpression ? node.mExpression->deepCopy() : nullptr)
+{
+    mLine = node.mLine;
+}
+
+TIntermSwitch::TIntermSwitch(const TIntermSwitch &node)
+    : TIntermNode(),
+      mInit(node.mInit->deepCopy()),
+      mStatementList(node.mStatementList ? node.mStatementList->deepCopy()->getAsAggregate()
+                                         : nullptr)
+{
+    mLine = node.mLine;
+}
+
+TIntermCase::TIntermCase(const TIntermCase &node)
+    : TIntermNode(), mCondition(node.mCondition ? node.mCondition->deepCopy() : nullptr)
+{
+    mLine = node.mLine;
 }
 
 //
@@ -87,6 +87,10 @@ class TIntermNode : angle::NonCopyable
     const TSourceLoc &getLine() const { return mLine; }
     void setLine(const TSourceLoc &l) { mLine = l; }
 
+    // Returns a copy of the subtree rooted at this node. The copy is allocated from the current
+    // global pool allocator.
+    virtual TIntermNode *deepCopy() const = 0;
+
     virtual void traverse(TIntermTraverser *) = 0;
     virtual TIntermTyped *getAsTyped() { return 0; }
     virtual TIntermConstantUnion *getAsConstantUnion() { return 0; }
@@ -127,7 +131,7 @@ class TIntermTyped : public TIntermNode
   public:
     TIntermTyped(const TType &t) : mType(t)  { }
 
-    virtual TIntermTyped *deepCopy() const = 0;
+    TIntermTyped *deepCopy() const override = 0;
 
     TIntermTyped *getAsTyped() override { return this; }
 
@@ -187,6 +191,8 @@ class TIntermLoop : public TIntermNode
     {
     }
 
+    TIntermLoop *deepCopy() const override { return new TIntermLoop(*this); }
+
     TIntermLoop *getAsLoopNode() override { return this; }
     void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
@@ -212,6 +218,9 @@ class TIntermLoop : public TIntermNode
     TIntermAggregate *mBody;  // loop body
 
     bool mUnrollFlag; // Whether the loop should be unrolled or not.
+
+  private:
+    TIntermLoop(const TIntermLoop &node);  // Note: not deleted, just private!
 };
 
 //
@@ -224,6 +233,8 @@ class TIntermBranch : public TIntermNode
         : mFlowOp(op),
           mExpression(e) { }
 
+    TIntermBranch *deepCopy() const override { return new TIntermBranch(*this); }
+
     void traverse(TIntermTraverser *it) override;
     TIntermBranch *getAsBranchNode() override { return this; }
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
@@ -234,6 +245,9 @@ class TIntermBranch : public TIntermNode
 protected:
     TOperator mFlowOp;
     TIntermTyped *mExpression;  // non-zero except for "return exp;" statements
+
+  private:
+    TIntermBranch(const TIntermBranch &node);  // Note: not deleted, just private!
 };
 
 //
@@ -516,7 +530,6 @@ class TIntermAggregate : public TIntermOperator
     }
     ~TIntermAggregate() { }
 
-    // Note: only supported for nodes that can be a part of an expression.
     TIntermTyped *deepCopy() const override { return new TIntermAggregate(*this); }
 
     TIntermAggregate *getAsAggregate() override { return this; }
@@ -586,7 +599,6 @@ class TIntermSelection : public TIntermTyped
           mTrueBlock(trueB),
           mFalseBlock(falseB) {}
 
-    // Note: only supported for ternary operator nodes.
     TIntermTyped *deepCopy() const override { return new TIntermSelection(*this); }
 
     void traverse(TIntermTraverser *it) override;
@@ -623,6 +635,8 @@ class TIntermSwitch : public TIntermNode
     {
     }
 
+    TIntermSwitch *deepCopy() const override { return new TIntermSwitch(*this); }
+
     void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(
         TIntermNode *original, TIntermNode *replacement) override;
@@ -636,6 +650,9 @@ class TIntermSwitch : public TIntermNode
   protected:
     TIntermTyped *mInit;
     TIntermAggregate *mStatementList;
+
+  private:
+    TIntermSwitch(const TIntermSwitch &node);  // Note: not deleted, just private!
 };
 
 //
@@ -650,6 +667,8 @@ class TIntermCase : public TIntermNode
     {
     }
 
+    TIntermCase *deepCopy() const override { return new TIntermCase(*this); }
+
     void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(
         TIntermNode *original, TIntermNode *replacement) override;
@@ -661,6 +680,9 @@ class TIntermCase : public TIntermNode
 
   protected:
     TIntermTyped *mCondition;
+
+  private:
+    TIntermCase(const TIntermCase &node);  // Note: not deleted, just private!
 };
 
 enum Visit
@@ -939,6 +961,9 @@ class TLValueTrackingTraverser : public TIntermTraverser
     // during traversal.
     bool isInFunctionMap(const TIntermAggregate *callNode) const;
 
+    const TSymbolTable &getSymbolTable() const { return mSymbolTable; }
+    int getShaderVersion() const { return mShaderVersion; }
+
   private:
     // Track whether an l-value is required in the node that is currently being traversed by the
     // surrounding operator.
@@ -16,6 +16,7 @@
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/BuiltInFunctionEmulatorHLSL.h"
 #include "compiler/translator/FlagStd140Structs.h"
+#include "compiler/translator/HelperFunctionCacheHLSL.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/NodeSearch.h"
 #include "compiler/translator/RemoveSwitchFallThrough.h"
@@ -75,6 +76,25 @@ const TConstantUnion *WriteConstantUnionArray(TInfoSinkBase &out,
     return constUnionIterated;
 }
 
+// The helpers of arrays of structs are not cached, since the structs belong to the shader and
+// comparing them adds their equality functions to it. The name of the other helpers includes the
+// array size and the element type, which determine their definition.
+TString DefineArrayHelperFunction(sh::HelperFunctionKind kind,
+                                  const TType &type,
+                                  const TString &functionName,
+                                  const sh::HelperFunctionCacheHLSL::Generator &generate)
+{
+    if (type.getStruct())
+    {
+        TInfoSinkBase fnOut;
+        generate(fnOut);
+        return fnOut.c_str();
+    }
+
+    const std::string &definition = sh::HelperFunctionCacheHLSL::get(kind, functionName, generate);
+    return TString(definition.c_str(), definition.length());
+}
+
 } // namespace
 
 namespace sh
@@ -2780,28 +2800,29 @@ TString OutputHLSL::addArrayEqualityFunction(const TType& type)
     TType nonArrayType = type;
     nonArrayType.clearArrayness();
 
-    TInfoSinkBase fnOut;
-
-    fnOut << "bool " << function->functionName << "("
-          << typeName << " a[" << type.getArraySize() << "], "
-          << typeName << " b[" << type.getArraySize() << "])\n"
-          << "{\n"
-             "    for (int i = 0; i < " << type.getArraySize() << "; ++i)\n"
-             "    {\n"
-             "        if (";
-
-    outputEqual(PreVisit, nonArrayType, EOpNotEqual, fnOut);
-    fnOut << "a[i]";
-    outputEqual(InVisit, nonArrayType, EOpNotEqual, fnOut);
-    fnOut << "b[i]";
-    outputEqual(PostVisit, nonArrayType, EOpNotEqual, fnOut);
-
-    fnOut << ") { return false; }\n"
-             "    }\n"
-             "    return true;\n"
-             "}\n";
-
-    function->functionDefinition = fnOut.c_str();
+    auto generate = [this, &type, &typeName, &nonArrayType, function](TInfoSinkBase &fnOut) {
+        fnOut << "bool " << function->functionName << "("
+              << typeName << " a[" << type.getArraySize() << "], "
+              << typeName << " b[" << type.getArraySize() << "])\n"
+              << "{\n"
+                 "    for (int i = 0; i < " << type.getArraySize() << "; ++i)\n"
+                 "    {\n"
+                 "        if (";
+
+        outputEqual(PreVisit, nonArrayType, EOpNotEqual, fnOut);
+        fnOut << "a[i]";
+        outputEqual(InVisit, nonArrayType, EOpNotEqual, fnOut);
+        fnOut << "b[i]";
+        outputEqual(PostVisit, nonArrayType, EOpNotEqual, fnOut);
+
+        fnOut << ") { return false; }\n"
+                 "    }\n"
+                 "    return true;\n"
+                 "}\n";
+    };
+
+    function->functionDefinition = DefineArrayHelperFunction(
+        HelperFunctionKind::ArrayEquality, type, function->functionName, generate);
 
     mArrayEqualityFunctions.push_back(function);
     mEqualityFunctions.push_back(function);
@@ -2828,19 +2849,20 @@ TString OutputHLSL::addArrayAssignmentFunction(const TType& type)
     fnNameOut << "angle_assign_" << type.getArraySize() << "_" << typeName;
     function.functionName = fnNameOut.c_str();
 
-    TInfoSinkBase fnOut;
-
-    fnOut << "void " << function.functionName << "(out "
-        << typeName << " a[" << type.getArraySize() << "], "
-        << typeName << " b[" << type.getArraySize() << "])\n"
-        << "{\n"
-           "    for (int i = 0; i < " << type.getArraySize() << "; ++i)\n"
-           "    {\n"
-           "        a[i] = b[i];\n"
-           "    }\n"
-           "}\n";
-
-    function.functionDefinition = fnOut.c_str();
+    auto generate = [&type, &typeName, &function](TInfoSinkBase &fnOut) {
+        fnOut << "void " << function.functionName << "(out "
+            << typeName << " a[" << type.getArraySize() << "], "
+            << typeName << " b[" << type.getArraySize() << "])\n"
+            << "{\n"
+               "    for (int i = 0; i < " << type.getArraySize() << "; ++i)\n"
+               "    {\n"
+               "        a[i] = b[i];\n"
+               "    }\n"
+               "}\n";
+    };
+
+    function.functionDefinition = DefineArrayHelperFunction(
+        HelperFunctionKind::ArrayAssignment, type, function.functionName, generate);
 
     mArrayAssignmentFunctions.push_back(function);
 
@@ -2866,24 +2888,25 @@ TString OutputHLSL::addArrayConstructIntoFunction(const TType& type)
     fnNameOut << "angle_construct_into_" << type.getArraySize() << "_" << typeName;
     function.functionName = fnNameOut.c_str();
 
-    TInfoSinkBase fnOut;
-
-    fnOut << "void " << function.functionName << "(out "
-          << typeName << " a[" << type.getArraySize() << "]";
-    for (unsigned int i = 0u; i < type.getArraySize(); ++i)
-    {
-        fnOut << ", " << typeName << " b" << i;
-    }
-    fnOut << ")\n"
-             "{\n";
+    auto generate = [&type, &typeName, &function](TInfoSinkBase &fnOut) {
+        fnOut << "void " << function.functionName << "(out "
+              << typeName << " a[" << type.getArraySize() << "]";
+        for (unsigned int i = 0u; i < type.getArraySize(); ++i)
+        {
+            fnOut << ", " << typeName << " b" << i;
+        }
+        fnOut << ")\n"
+                 "{\n";
 
-    for (unsigned int i = 0u; i < type.getArraySize(); ++i)
-    {
-        fnOut << "    a[" << i << "] = b" << i << ";\n";
-    }
-    fnOut << "}\n";
+        for (unsigned int i = 0u; i < type.getArraySize(); ++i)
+        {
+            fnOut << "    a[" << i << "] = b" << i << ";\n";
+        }
+        fnOut << "}\n";
+    };
 
-    function.functionDefinition = fnOut.c_str();
+    function.functionDefinition = DefineArrayHelperFunction(
+        HelperFunctionKind::ArrayConstructInto, type, function.functionName, generate);
 
     mArrayConstructIntoFunctions.push_back(function);
 
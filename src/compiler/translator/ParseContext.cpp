@@ -1252,7 +1252,7 @@ const TFunction *TParseContext::findFunction(const TSourceLoc &line,
     const TSymbol *symbol = symbolTable.find(call->getName(), inputShaderVersion, builtIn);
     if (symbol == 0 || symbol->isFunction())
     {
-        symbol = symbolTable.find(call->getMangledName(), inputShaderVersion, builtIn);
+        symbol = symbolTable.find(*call, inputShaderVersion, builtIn);
     }
 
     if (symbol == 0)
@@ -1973,7 +1973,7 @@ TIntermAggregate *TParseContext::addFunctionPrototypeDeclaration(const TFunction
     // Either way the instance in the symbol table is used to track whether the function is declared
     // multiple times.
     TFunction *symbolTableFunction =
-        static_cast<TFunction *>(symbolTable.find(function.getMangledName(), getShaderVersion()));
+        static_cast<TFunction *>(symbolTable.find(function, getShaderVersion()));
     if (symbolTableFunction->hasPrototypeDeclaration() && mShaderVersion == 100)
     {
         // ESSL 1.00.17 section 4.2.7.
@@ -2046,7 +2046,7 @@ void TParseContext::parseFunctionPrototype(const TSourceLoc &location,
                                            TIntermAggregate **aggregateOut)
 {
     const TSymbol *builtIn =
-        symbolTable.findBuiltIn(function->getMangledName(), getShaderVersion());
+        symbolTable.findBuiltIn(*function, getShaderVersion());
 
     if (builtIn)
     {
@@ -2054,7 +2054,7 @@ void TParseContext::parseFunctionPrototype(const TSourceLoc &location,
     }
 
     TFunction *prevDec =
-        static_cast<TFunction *>(symbolTable.find(function->getMangledName(), getShaderVersion()));
+        static_cast<TFunction *>(symbolTable.find(*function, getShaderVersion()));
     //
     // Note:  'prevDec' could be 'function' if this is the first time we've seen function
     // as it would have just been put in the symbol table.  Otherwise, we're looking up
@@ -2149,7 +2149,7 @@ TFunction *TParseContext::parseFunctionDeclarator(const TSourceLoc &location, TF
     // here.
     //
     TFunction *prevDec =
-        static_cast<TFunction *>(symbolTable.find(function->getMangledName(), getShaderVersion()));
+        static_cast<TFunction *>(symbolTable.find(*function, getShaderVersion()));
 
     if (getShaderVersion() >= 300 && symbolTable.hasUnmangledBuiltIn(function->getName().c_str()))
     {
@@ -11,6 +11,10 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
@@ -18,6 +22,7 @@
 #include "compiler/translator/TranslatorHLSL.h"
 #endif // ANGLE_ENABLE_HLSL
 #include "compiler/translator/VariablePacker.h"
+#include "compiler/translator/blocklayout.h"
 #include "angle_gl.h"
 
 namespace
@@ -89,6 +94,54 @@ TCompiler *GetCompilerFromHandle(ShHandle handle)
     return base->getAsCompiler();
 }
 
+// Copies the results of the last compilation, except for the success status.
+void GetReflection(TCompiler *compiler, ShReflection *reflectionOut)
+{
+    reflectionOut->shaderVersion = compiler->getShaderVersion();
+    reflectionOut->infoLog       = compiler->getInfoSink().info.str();
+
+    reflectionOut->uniforms        = compiler->getUniforms();
+    reflectionOut->varyings        = compiler->getVaryings();
+    reflectionOut->attributes      = compiler->getAttributes();
+    reflectionOut->outputVariables = compiler->getOutputVariables();
+    reflectionOut->interfaceBlocks = compiler->getInterfaceBlocks();
+
+    reflectionOut->interfaceBlockLayouts.clear();
+    reflectionOut->interfaceBlockDataSizes.clear();
+    for (const sh::InterfaceBlock &interfaceBlock : reflectionOut->interfaceBlocks)
+    {
+        sh::BlockLayoutMap blockLayout;
+        size_t dataSize = 0;
+        if (interfaceBlock.layout == sh::BLOCKLAYOUT_STANDARD)
+        {
+            sh::Std140BlockEncoder std140Encoder;
+            sh::GetUniformBlockInfo(interfaceBlock.fields, interfaceBlock.fieldPrefix(),
+                                    &std140Encoder, interfaceBlock.isRowMajorLayout, &blockLayout);
+            dataSize = std140Encoder.getBlockSize();
+        }
+        reflectionOut->interfaceBlockLayouts.push_back(std::move(blockLayout));
+        reflectionOut->interfaceBlockDataSizes.push_back(dataSize);
+    }
+}
+
+// Compiles the shaders of a batch that haven't been claimed by another thread yet.
+void CompileBatchShaders(TCompiler *compiler,
+                         const char *const shaderSources[],
+                         size_t numShaders,
+                         int compileOptions,
+                         std::atomic<size_t> *nextShader,
+                         std::vector<ShCompileResult> *resultsOut)
+{
+    for (size_t shaderIndex = (*nextShader)++; shaderIndex < numShaders;
+         shaderIndex = (*nextShader)++)
+    {
+        ShCompileResult &result = (*resultsOut)[shaderIndex];
+        result.success = compiler->compile(&shaderSources[shaderIndex], 1, compileOptions);
+        GetReflection(compiler, &result);
+        result.objectCode = compiler->getInfoSink().obj.str();
+    }
+}
+
 #ifdef ANGLE_ENABLE_HLSL
 TranslatorHLSL *GetTranslatorHLSLFromHandle(ShHandle handle)
 {
@@ -280,6 +333,110 @@ bool ShCompile(
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+ShCompileResult::ShCompileResult()
+{
+}
+
+ShCompileResult::~ShCompileResult()
+{
+}
+
+ShReflection::ShReflection() : success(false), shaderVersion(0)
+{
+}
+
+ShReflection::~ShReflection()
+{
+}
+
+bool ShReflect(const ShHandle handle,
+               const char *const shaderStrings[],
+               size_t numStrings,
+               int compileOptions,
+               ShReflection *reflectionOut)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    ASSERT(reflectionOut);
+
+    reflectionOut->success = compiler->reflect(shaderStrings, numStrings, compileOptions);
+    GetReflection(compiler, reflectionOut);
+
+    return reflectionOut->success;
+}
+
+bool ShReflectShaders(const ShHandle handle,
+                      const char *const shaderSources[],
+                      size_t numShaders,
+                      int compileOptions,
+                      std::vector<ShReflection> *reflectionsOut)
+{
+    ASSERT(reflectionsOut);
+
+    reflectionsOut->clear();
+    reflectionsOut->resize(numShaders);
+
+    bool success = true;
+    for (size_t shaderIndex = 0; shaderIndex < numShaders; ++shaderIndex)
+    {
+        success = ShReflect(handle, &shaderSources[shaderIndex], 1, compileOptions,
+                            &(*reflectionsOut)[shaderIndex]) &&
+                  success;
+    }
+    return success;
+}
+
+bool ShCompileShaders(const ShHandle handle,
+                      const char *const shaderSources[],
+                      size_t numShaders,
+                      int compileOptions,
+                      size_t numThreads,
+                      std::vector<ShCompileResult> *resultsOut)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    ASSERT(resultsOut);
+
+    resultsOut->clear();
+    resultsOut->resize(numShaders);
+
+    // Clones are created here rather than on the worker threads, since initializing the built-in
+    // symbol table uses global state.
+    std::vector<TCompiler *> workerCompilers;
+    size_t numWorkers = std::min(numThreads, numShaders);
+    for (size_t workerIndex = 1; workerIndex < numWorkers; ++workerIndex)
+    {
+        TCompiler *clone = compiler->getClone(workerIndex - 1);
+        if (clone == nullptr)
+        {
+            break;
+        }
+        workerCompilers.push_back(clone);
+    }
+
+    // The calling thread compiles with the given compiler alongside the worker threads.
+    std::atomic<size_t> nextShader(0);
+    std::vector<std::thread> workers;
+    for (TCompiler *workerCompiler : workerCompilers)
+    {
+        workers.emplace_back(CompileBatchShaders, workerCompiler, shaderSources, numShaders,
+                             compileOptions, &nextShader, resultsOut);
+    }
+    CompileBatchShaders(compiler, shaderSources, numShaders, compileOptions, &nextShader,
+                        resultsOut);
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    bool success = true;
+    for (const ShCompileResult &result : *resultsOut)
+    {
+        success = success && result.success;
+    }
+    return success;
+}
+
 void ShClearResults(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
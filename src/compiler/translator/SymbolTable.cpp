@@ -17,9 +17,10 @@
 #include "compiler/translator/Cache.h"
 
 #include <stdio.h>
+#include <string.h>
 #include <algorithm>
 
-int TSymbolTable::uniqueIdCounter = 0;
+std::atomic<int> TSymbolTable::uniqueIdCounter(0);
 
 //
 // Functions have buried pointers to delete.
@@ -43,12 +44,12 @@ const TString *TFunction::buildMangledName() const
 }
 
 //
-// Symbol table levels are a map of pointers to symbols that have to be deleted.
+// Symbol table levels hold pointers to symbols that have to be deleted.
 //
 TSymbolTableLevel::~TSymbolTableLevel()
 {
-    for (tLevel::iterator it = level.begin(); it != level.end(); ++it)
-        delete (*it).second;
+    for (const Entry &entry : mEntries)
+        delete entry.symbol;
 }
 
 bool TSymbolTableLevel::insert(TSymbol *symbol)
@@ -56,9 +57,7 @@ bool TSymbolTableLevel::insert(TSymbol *symbol)
     symbol->setUniqueId(TSymbolTable::nextUniqueId());
 
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
-
-    return result.second;
+    return insert(symbol->getMangledName(), symbol->getMangledNameHash(), symbol);
 }
 
 bool TSymbolTableLevel::insertUnmangled(TFunction *function)
@@ -66,22 +65,109 @@ bool TSymbolTableLevel::insertUnmangled(TFunction *function)
     function->setUniqueId(TSymbolTable::nextUniqueId());
 
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(function->getName(), function));
+    const TString &name = function->getName();
+    return insert(name, HashSymbolName(name.c_str(), name.size()), function);
+}
 
-    return result.second;
+bool TSymbolTableLevel::insert(const TString &key, size_t hash, TSymbol *symbol)
+{
+    // Keep the load factor at most 1/2 so that probe sequences stay short.
+    if ((mSymbolCount + 1) * 2 > mEntries.size())
+    {
+        grow();
+    }
+
+    size_t mask = mEntries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        Entry &entry = mEntries[index];
+        if (entry.symbol == nullptr)
+        {
+            entry.hash   = hash;
+            entry.key    = &key;
+            entry.symbol = symbol;
+            mSymbolCount++;
+            return true;
+        }
+        if (entry.hash == hash && *entry.key == key)
+        {
+            return false;
+        }
+    }
+}
+
+void TSymbolTableLevel::grow()
+{
+    std::vector<Entry> oldEntries;
+    oldEntries.swap(mEntries);
+
+    Entry emptyEntry = {0, nullptr, nullptr};
+    mEntries.resize(std::max<size_t>(oldEntries.size() * 2, 16), emptyEntry);
+
+    size_t mask = mEntries.size() - 1;
+    for (const Entry &oldEntry : oldEntries)
+    {
+        if (oldEntry.symbol == nullptr)
+            continue;
+
+        size_t index = oldEntry.hash & mask;
+        while (mEntries[index].symbol != nullptr)
+        {
+            index = (index + 1) & mask;
+        }
+        mEntries[index] = oldEntry;
+    }
 }
 
 TSymbol *TSymbolTableLevel::find(const TString &name) const
 {
-    tLevel::const_iterator it = level.find(name);
-    if (it == level.end())
+    return find(name.c_str(), name.size(), HashSymbolName(name.c_str(), name.size()));
+}
+
+TSymbol *TSymbolTableLevel::find(const char *name, size_t length, size_t hash) const
+{
+    if (mSymbolCount == 0)
         return 0;
-    else
-        return (*it).second;
+
+    size_t mask = mEntries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        const Entry &entry = mEntries[index];
+        if (entry.symbol == nullptr)
+            return 0;
+
+        if (entry.hash == hash && entry.key->size() == length &&
+            memcmp(entry.key->c_str(), name, length) == 0)
+        {
+            return entry.symbol;
+        }
+    }
 }
 
 TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
                             bool *builtIn, bool *sameScope) const
+{
+    return find(name.c_str(), name.size(), HashSymbolName(name.c_str(), name.size()),
+                shaderVersion, builtIn, sameScope);
+}
+
+TSymbol *TSymbolTable::find(const char *name, int shaderVersion,
+                            bool *builtIn, bool *sameScope) const
+{
+    size_t length = strlen(name);
+    return find(name, length, HashSymbolName(name, length), shaderVersion, builtIn, sameScope);
+}
+
+TSymbol *TSymbolTable::find(const TFunction &function, int shaderVersion,
+                            bool *builtIn, bool *sameScope) const
+{
+    const TString &mangledName = function.getMangledName();
+    return find(mangledName.c_str(), mangledName.size(), function.getMangledNameHash(),
+                shaderVersion, builtIn, sameScope);
+}
+
+TSymbol *TSymbolTable::find(const char *name, size_t length, size_t hash, int shaderVersion,
+                            bool *builtIn, bool *sameScope) const
 {
     int level = currentLevel();
     TSymbol *symbol;
@@ -95,7 +181,7 @@ TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        symbol = table[level]->find(name);
+        symbol = table[level]->find(name, length, hash);
     }
     while (symbol == 0 && --level >= 0);
 
@@ -109,6 +195,22 @@ TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
 
 TSymbol *TSymbolTable::findBuiltIn(
     const TString &name, int shaderVersion) const
+{
+    return findBuiltIn(name.c_str(), name.size(), HashSymbolName(name.c_str(), name.size()),
+                       shaderVersion);
+}
+
+TSymbol *TSymbolTable::findBuiltIn(const TFunction &function, int shaderVersion) const
+{
+    const TString &mangledName = function.getMangledName();
+    return findBuiltIn(mangledName.c_str(), mangledName.size(), function.getMangledNameHash(),
+                       shaderVersion);
+}
+
+TSymbol *TSymbolTable::findBuiltIn(const char *name,
+                                   size_t length,
+                                   size_t hash,
+                                   int shaderVersion) const
 {
     for (int level = LAST_BUILTIN_LEVEL; level >= 0; level--)
     {
@@ -119,7 +221,7 @@ TSymbol *TSymbolTable::findBuiltIn(
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        TSymbol *symbol = table[level]->find(name);
+        TSymbol *symbol = table[level]->find(name, length, hash);
 
         if (symbol)
             return symbol;
@@ -31,13 +31,28 @@
 //
 
 #include <array>
+#include <atomic>
 #include <assert.h>
 #include <set>
+#include <vector>
 
 #include "common/angleutils.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
+// Hash of a symbol name, used as the key of the symbol table levels.
+inline size_t HashSymbolName(const char *name, size_t length)
+{
+    // FNV-1a
+    size_t hash = static_cast<size_t>(2166136261u);
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= static_cast<unsigned char>(name[i]);
+        hash *= static_cast<size_t>(16777619u);
+    }
+    return hash;
+}
+
 // Symbol base class. (Can build functions or variables out of these...)
 class TSymbol : angle::NonCopyable
 {
@@ -61,6 +76,11 @@ class TSymbol : angle::NonCopyable
     {
         return getName();
     }
+    virtual size_t getMangledNameHash() const
+    {
+        const TString &mangledName = getMangledName();
+        return HashSymbolName(mangledName.c_str(), mangledName.size());
+    }
     virtual bool isFunction() const
     {
         return false;
@@ -205,6 +225,7 @@ class TFunction : public TSymbol
         : TSymbol(name),
           returnType(retType),
           mangledName(nullptr),
+          mangledNameHash(0),
           op(tOp),
           defined(false),
           mHasPrototypeDeclaration(false)
@@ -233,10 +254,16 @@ class TFunction : public TSymbol
     {
         if (mangledName == nullptr)
         {
-            mangledName = buildMangledName();
+            mangledName     = buildMangledName();
+            mangledNameHash = HashSymbolName(mangledName->c_str(), mangledName->size());
         }
         return *mangledName;
     }
+    size_t getMangledNameHash() const override
+    {
+        getMangledName();
+        return mangledNameHash;
+    }
     const TType &getReturnType() const
     {
         return *returnType;
@@ -268,6 +295,7 @@ class TFunction : public TSymbol
     TParamList parameters;
     const TType *returnType;
     mutable const TString *mangledName;
+    mutable size_t mangledNameHash;
     TOperator op;
     bool defined;
     bool mHasPrototypeDeclaration;
@@ -287,16 +315,15 @@ class TInterfaceBlockName : public TSymbol
     }
 };
 
+// A level is an open-addressed hash table with linear probing. The keys point to the names
+// owned by the symbols, and their hashes are stored alongside so that probing rarely needs to
+// compare strings.
 class TSymbolTableLevel
 {
   public:
-    typedef TMap<TString, TSymbol *> tLevel;
-    typedef tLevel::const_iterator const_iterator;
-    typedef const tLevel::value_type tLevelPair;
-    typedef std::pair<tLevel::iterator, bool> tInsertResult;
-
     TSymbolTableLevel()
-        : mGlobalInvariant(false)
+        : mSymbolCount(0),
+          mGlobalInvariant(false)
     {
     }
     ~TSymbolTableLevel();
@@ -307,6 +334,7 @@ class TSymbolTableLevel
     bool insertUnmangled(TFunction *function);
 
     TSymbol *find(const TString &name) const;
+    TSymbol *find(const char *name, size_t length, size_t hash) const;
 
     void addInvariantVarying(const std::string &name)
     {
@@ -318,10 +346,23 @@ class TSymbolTableLevel
         return (mGlobalInvariant || mInvariantVaryings.count(name) > 0);
     }
 
+    const std::set<std::string> &getInvariantVaryings() const { return mInvariantVaryings; }
+
     void setGlobalInvariant(bool invariant) { mGlobalInvariant = invariant; }
 
   protected:
-    tLevel level;
+    struct Entry
+    {
+        size_t hash;
+        const TString *key;
+        TSymbol *symbol;
+    };
+
+    bool insert(const TString &key, size_t hash, TSymbol *symbol);
+    void grow();
+
+    std::vector<Entry> mEntries;
+    size_t mSymbolCount;
     std::set<std::string> mInvariantVaryings;
     bool mGlobalInvariant;
 };
@@ -459,7 +500,13 @@ class TSymbolTable : angle::NonCopyable
 
     TSymbol *find(const TString &name, int shaderVersion,
                   bool *builtIn = NULL, bool *sameScope = NULL) const;
+    TSymbol *find(const char *name, int shaderVersion,
+                  bool *builtIn = NULL, bool *sameScope = NULL) const;
+    // Finds a function by its mangled name, using the hash cached in the function.
+    TSymbol *find(const TFunction &function, int shaderVersion,
+                  bool *builtIn = NULL, bool *sameScope = NULL) const;
     TSymbol *findBuiltIn(const TString &name, int shaderVersion) const;
+    TSymbol *findBuiltIn(const TFunction &function, int shaderVersion) const;
     
     TSymbolTableLevel *getOuterLevel()
     {
@@ -504,12 +551,19 @@ class TSymbolTable : angle::NonCopyable
         return table[currentLevel()]->isVaryingInvariant(originalName);
     }
 
+    const std::set<std::string> &getInvariantVaryings() const
+    {
+        ASSERT(atGlobalLevel());
+        return table[currentLevel()]->getInvariantVaryings();
+    }
+
     void setGlobalInvariant(bool invariant)
     {
         ASSERT(atGlobalLevel());
         table[currentLevel()]->setGlobalInvariant(invariant);
     }
 
+    // Can be called from several compilers compiling on different threads.
     static int nextUniqueId()
     {
         return ++uniqueIdCounter;
@@ -526,6 +580,10 @@ class TSymbolTable : angle::NonCopyable
         return static_cast<ESymbolLevel>(table.size() - 1);
     }
 
+    TSymbol *find(const char *name, size_t length, size_t hash, int shaderVersion,
+                  bool *builtIn, bool *sameScope) const;
+    TSymbol *findBuiltIn(const char *name, size_t length, size_t hash, int shaderVersion) const;
+
     // Used to insert unmangled functions to check redeclaration of built-ins in ESSL 3.00.
     void insertUnmangledBuiltIn(const char *name)
     {
@@ -538,7 +596,7 @@ class TSymbolTable : angle::NonCopyable
 
     std::set<std::string> mUnmangledBuiltinNames;
 
-    static int uniqueIdCounter;
+    static std::atomic<int> uniqueIdCounter;
 };
 
 #endif // COMPILER_TRANSLATOR_SYMBOLTABLE_H_
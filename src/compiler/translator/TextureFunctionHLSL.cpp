@@ -11,6 +11,7 @@
 
 #include "compiler/translator/TextureFunctionHLSL.h"
 
+#include "compiler/translator/HelperFunctionCacheHLSL.h"
 #include "compiler/translator/UtilsHLSL.h"
 
 namespace sh
@@ -983,6 +984,48 @@ void OutputTextureSampleFunctionReturnStatement(
     out << ");\n";  // Close the sample function call and return statement
 }
 
+void OutputTextureFunction(TInfoSinkBase &out,
+                           const TextureFunctionHLSL::TextureFunction &textureFunction,
+                           const ShShaderOutput outputType)
+{
+    // Function header
+    out << textureFunction.getReturnType() << " " << textureFunction.name() << "(";
+
+    OutputTextureFunctionArgumentList(out, textureFunction, outputType);
+
+    out << ")\n"
+           "{\n";
+
+    // In some cases we use a variable to store the texture/sampler objects, but to work around a
+    // D3D11 compiler bug related to discard inside a loop that is conditional on texture sampling
+    // we need to call the function directly on references to the texture and sampler arrays. The
+    // bug was found using dEQP-GLES3.functional.shaders.discard*loop_texture* tests.
+    TString textureReference;
+    TString samplerReference;
+    GetTextureReference(out, textureFunction, outputType, &textureReference, &samplerReference);
+
+    if (textureFunction.method == TextureFunctionHLSL::TextureFunction::SIZE)
+    {
+        OutputTextureSizeFunctionBody(out, textureFunction, textureReference);
+    }
+    else
+    {
+        TString texCoordX("t.x");
+        TString texCoordY("t.y");
+        TString texCoordZ("t.z");
+        ProjectTextureCoordinates(textureFunction, &texCoordX, &texCoordY, &texCoordZ);
+        OutputIntegerTextureSampleFunctionComputations(out, textureFunction, outputType,
+                                                       textureReference, &texCoordX, &texCoordY,
+                                                       &texCoordZ);
+        OutputTextureSampleFunctionReturnStatement(out, textureFunction, outputType,
+                                                   textureReference, samplerReference, texCoordX,
+                                                   texCoordY, texCoordZ);
+    }
+
+    out << "}\n"
+           "\n";
+}
+
 }  // Anonymous namespace
 
 TString TextureFunctionHLSL::TextureFunction::name() const
@@ -1253,43 +1296,19 @@ void TextureFunctionHLSL::textureFunctionHeader(TInfoSinkBase &out, const ShShad
 {
     for (const TextureFunction &textureFunction : mUsesTexture)
     {
-        // Function header
-        out << textureFunction.getReturnType() << " " << textureFunction.name() << "(";
-
-        OutputTextureFunctionArgumentList(out, textureFunction, outputType);
-
-        out << ")\n"
-               "{\n";
-
-        // In some cases we use a variable to store the texture/sampler objects, but to work around
-        // a D3D11 compiler bug related to discard inside a loop that is conditional on texture
-        // sampling we need to call the function directly on references to the texture and sampler
-        // arrays. The bug was found using dEQP-GLES3.functional.shaders.discard*loop_texture*
-        // tests.
-        TString textureReference;
-        TString samplerReference;
-        GetTextureReference(out, textureFunction, outputType, &textureReference, &samplerReference);
-
-        if (textureFunction.method == TextureFunction::SIZE)
-        {
-            OutputTextureSizeFunctionBody(out, textureFunction, textureReference);
-        }
-        else
-        {
-            TString texCoordX("t.x");
-            TString texCoordY("t.y");
-            TString texCoordZ("t.z");
-            ProjectTextureCoordinates(textureFunction, &texCoordX, &texCoordY, &texCoordZ);
-            OutputIntegerTextureSampleFunctionComputations(out, textureFunction, outputType,
-                                                           textureReference, &texCoordX, &texCoordY,
-                                                           &texCoordZ);
-            OutputTextureSampleFunctionReturnStatement(out, textureFunction, outputType,
-                                                       textureReference, samplerReference,
-                                                       texCoordX, texCoordY, texCoordZ);
-        }
-
-        out << "}\n"
-               "\n";
+        // Overloads share the name, e.g. texture2DProj with vec3 and vec4 coordinates, so every
+        // field of the texture function is part of the signature.
+        TString signature = str(static_cast<int>(textureFunction.sampler)) + "_" +
+                            str(textureFunction.coords) + "_" +
+                            str(static_cast<int>(textureFunction.proj)) + "_" +
+                            str(static_cast<int>(textureFunction.offset)) + "_" +
+                            str(static_cast<int>(textureFunction.method)) + "_" +
+                            str(static_cast<int>(outputType));
+        out << HelperFunctionCacheHLSL::get(
+            HelperFunctionKind::Texture, signature,
+            [&textureFunction, outputType](TInfoSinkBase &functionOut) {
+                OutputTextureFunction(functionOut, textureFunction, outputType);
+            });
     }
 }
 
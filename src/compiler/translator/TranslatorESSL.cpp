@@ -47,6 +47,7 @@ void TranslatorESSL::translate(TIntermNode *root, int compileOptions)
     if (precisionEmulation)
     {
         EmulatePrecision emulatePrecision(getSymbolTable(), shaderVer);
+        emulatePrecision.findRoundedVariables(root);
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
         emulatePrecision.writeEmulationHelpers(sink, shaderVer, SH_ESSL_OUTPUT);
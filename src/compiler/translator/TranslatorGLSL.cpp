@@ -80,6 +80,7 @@ void TranslatorGLSL::translate(TIntermNode *root, int compileOptions)
     if (precisionEmulation)
     {
         EmulatePrecision emulatePrecision(getSymbolTable(), getShaderVersion());
+        emulatePrecision.findRoundedVariables(root);
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
         emulatePrecision.writeEmulationHelpers(sink, getShaderVersion(), getOutputType());
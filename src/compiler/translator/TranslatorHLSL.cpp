@@ -79,6 +79,7 @@ void TranslatorHLSL::translate(TIntermNode *root, int compileOptions)
     if (precisionEmulation)
     {
         EmulatePrecision emulatePrecision(getSymbolTable(), getShaderVersion());
+        emulatePrecision.findRoundedVariables(root);
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
         emulatePrecision.writeEmulationHelpers(getInfoSink().obj, getShaderVersion(),
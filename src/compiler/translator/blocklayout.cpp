@@ -15,6 +15,57 @@
 namespace sh
 {
 
+namespace
+{
+
+bool IsRowMajorLayout(const InterfaceBlockField &var)
+{
+    return var.isRowMajorLayout;
+}
+
+bool IsRowMajorLayout(const ShaderVariable &var)
+{
+    return false;
+}
+
+template <typename VarT>
+void GetBlockFieldsInfo(const std::vector<VarT> &fields,
+                        const std::string &prefix,
+                        BlockLayoutEncoder *encoder,
+                        bool inRowMajorLayout,
+                        BlockLayoutMap *blockInfoOut)
+{
+    for (const VarT &field : fields)
+    {
+        const std::string &fieldName = (prefix.empty() ? field.name : prefix + "." + field.name);
+
+        if (field.isStruct())
+        {
+            bool rowMajorLayout = (inRowMajorLayout || IsRowMajorLayout(field));
+
+            for (unsigned int arrayElement = 0; arrayElement < field.elementCount(); arrayElement++)
+            {
+                encoder->enterAggregateType();
+
+                const std::string uniformElementName =
+                    fieldName + (field.isArray() ? ArrayString(arrayElement) : "");
+                GetBlockFieldsInfo(field.fields, uniformElementName, encoder, rowMajorLayout,
+                                   blockInfoOut);
+
+                encoder->exitAggregateType();
+            }
+        }
+        else
+        {
+            bool isRowMajorMatrix = (gl::IsMatrixType(field.type) && inRowMajorLayout);
+            (*blockInfoOut)[fieldName] =
+                encoder->encodeType(field.type, field.arraySize, isRowMajorMatrix);
+        }
+    }
+}
+
+}  // anonymous namespace
+
 BlockLayoutEncoder::BlockLayoutEncoder()
     : mCurrentOffset(0)
 {
@@ -123,4 +174,13 @@ void Std140BlockEncoder::advanceOffset(GLenum type, unsigned int arraySize, bool
     }
 }
 
+void GetUniformBlockInfo(const std::vector<InterfaceBlockField> &fields,
+                         const std::string &prefix,
+                         BlockLayoutEncoder *encoder,
+                         bool inRowMajorLayout,
+                         BlockLayoutMap *blockInfoOut)
+{
+    GetBlockFieldsInfo(fields, prefix, encoder, inRowMajorLayout, blockInfoOut);
+}
+
 }
@@ -11,6 +11,8 @@
 #define COMMON_BLOCKLAYOUT_H_
 
 #include <cstddef>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "angle_gl.h"
@@ -24,28 +26,6 @@ struct Uniform;
 struct Varying;
 struct InterfaceBlock;
 
-struct COMPILER_EXPORT BlockMemberInfo
-{
-    BlockMemberInfo() : offset(-1), arrayStride(-1), matrixStride(-1), isRowMajorMatrix(false) {}
-
-    BlockMemberInfo(int offset, int arrayStride, int matrixStride, bool isRowMajorMatrix)
-        : offset(offset),
-          arrayStride(arrayStride),
-          matrixStride(matrixStride),
-          isRowMajorMatrix(isRowMajorMatrix)
-    {}
-
-    static BlockMemberInfo getDefaultBlockInfo()
-    {
-        return BlockMemberInfo(-1, -1, -1, false);
-    }
-
-    int offset;
-    int arrayStride;
-    int matrixStride;
-    bool isRowMajorMatrix;
-};
-
 class COMPILER_EXPORT BlockLayoutEncoder
 {
   public:
@@ -98,6 +78,16 @@ class COMPILER_EXPORT Std140BlockEncoder : public BlockLayoutEncoder
                        int matrixStride) override;
 };
 
+using BlockLayoutMap = std::map<std::string, BlockMemberInfo>;
+
+// Computes the layout of the given interface block fields with the encoder. Structs are expanded,
+// so the map is keyed by the full name of every non-struct field, prefixed with "prefix.".
+COMPILER_EXPORT void GetUniformBlockInfo(const std::vector<InterfaceBlockField> &fields,
+                                         const std::string &prefix,
+                                         BlockLayoutEncoder *encoder,
+                                         bool inRowMajorLayout,
+                                         BlockLayoutMap *blockInfoOut);
+
 }
 
 #endif // COMMON_BLOCKLAYOUT_H_
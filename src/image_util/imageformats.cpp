@@ -1281,10 +1281,8 @@ void A16B16G16R16F::average(A16B16G16R16F *dst,
                             const A16B16G16R16F *src1,
                             const A16B16G16R16F *src2)
 {
-    dst->R = gl::averageHalfFloat(src1->R, src2->R);
-    dst->G = gl::averageHalfFloat(src1->G, src2->G);
-    dst->B = gl::averageHalfFloat(src1->B, src2->B);
-    dst->A = gl::averageHalfFloat(src1->A, src2->A);
+    // The four channels are contiguous and averaged together.
+    gl::averageHalfFloats(&src1->A, &src2->A, &dst->A, 4);
 }
 
 void R16G16B16A16F::readColor(gl::ColorF *dst, const R16G16B16A16F *src)
@@ -1307,10 +1305,8 @@ void R16G16B16A16F::average(R16G16B16A16F *dst,
                             const R16G16B16A16F *src1,
                             const R16G16B16A16F *src2)
 {
-    dst->R = gl::averageHalfFloat(src1->R, src2->R);
-    dst->G = gl::averageHalfFloat(src1->G, src2->G);
-    dst->B = gl::averageHalfFloat(src1->B, src2->B);
-    dst->A = gl::averageHalfFloat(src1->A, src2->A);
+    // The four channels are contiguous and averaged together.
+    gl::averageHalfFloats(&src1->R, &src2->R, &dst->R, 4);
 }
 
 void R16F::readColor(gl::ColorF *dst, const R16F *src)
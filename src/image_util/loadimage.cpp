@@ -8,6 +8,8 @@
 
 #include "image_util/loadimage.h"
 
+#include <vector>
+
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
@@ -1051,6 +1053,7 @@ void LoadRGB16FToRGB9E5(size_t width,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
+    std::vector<float> rowFloats(width * 3);
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1059,12 +1062,8 @@ void LoadRGB16FToRGB9E5(size_t width,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = gl::convertRGBFloatsTo999E5(gl::float16ToFloat32(source[x * 3 + 0]),
-                                                      gl::float16ToFloat32(source[x * 3 + 1]),
-                                                      gl::float16ToFloat32(source[x * 3 + 2]));
-            }
+            gl::float16ToFloat32(source, rowFloats.data(), width * 3);
+            gl::convertRGBFloatsTo999E5(rowFloats.data(), dest, width);
         }
     }
 }
@@ -1087,11 +1086,7 @@ void LoadRGB32FToRGB9E5(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = gl::convertRGBFloatsTo999E5(source[x * 3 + 0], source[x * 3 + 1],
-                                                      source[x * 3 + 2]);
-            }
+            gl::convertRGBFloatsTo999E5(source, dest, width);
         }
     }
 }
@@ -1106,6 +1101,7 @@ void LoadRGB16FToRG11B10F(size_t width,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
+    std::vector<float> rowFloats(width * 3);
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1114,12 +1110,8 @@ void LoadRGB16FToRG11B10F(size_t width,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) << 0) |
-                          (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
-                          (gl::float32ToFloat10(gl::float16ToFloat32(source[x * 3 + 2])) << 22);
-            }
+            gl::float16ToFloat32(source, rowFloats.data(), width * 3);
+            gl::convertRGBFloatsToR11G11B10F(rowFloats.data(), dest, width);
         }
     }
 }
@@ -1142,12 +1134,7 @@ void LoadRGB32FToRG11B10F(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = (gl::float32ToFloat11(source[x * 3 + 0]) << 0) |
-                          (gl::float32ToFloat11(source[x * 3 + 1]) << 11) |
-                          (gl::float32ToFloat10(source[x * 3 + 2]) << 22);
-            }
+            gl::convertRGBFloatsToR11G11B10F(source, dest, width);
         }
     }
 }
@@ -1248,6 +1235,7 @@ void LoadRGB32FToRGBA16F(size_t width,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
+    std::vector<uint16_t> rowHalfFloats(width * 3);
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1256,11 +1244,12 @@ void LoadRGB32FToRGBA16F(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+            gl::float32ToFloat16(source, rowHalfFloats.data(), width * 3);
             for (size_t x = 0; x < width; x++)
             {
-                dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
+                dest[x * 4 + 0] = rowHalfFloats[x * 3 + 0];
+                dest[x * 4 + 1] = rowHalfFloats[x * 3 + 1];
+                dest[x * 4 + 2] = rowHalfFloats[x * 3 + 2];
                 dest[x * 4 + 3] = gl::Float16One;
             }
         }
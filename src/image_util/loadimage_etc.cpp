@@ -167,6 +167,75 @@ struct ETC2Block
         }
     }
 
+    // Transcodes single channel block to BC4
+    void transcodeAsBC4(uint8_t *dest,
+                        size_t x,
+                        size_t y,
+                        size_t w,
+                        size_t h,
+                        bool isSigned) const
+    {
+        // A single channel block has a base codeword, a multiplier and a modifier table, which
+        // define 8 values that pixels can have. Like for BC1, only these values are encoded: the
+        // smallest and largest values used by the block are the two BC4 endpoints, and each value
+        // is mapped to the closest of the 8 BC4 codes between them.
+
+        static const size_t kNumValues = 8;
+
+        int values[kNumValues];
+        for (size_t valueIdx = 0; valueIdx < kNumValues; valueIdx++)
+        {
+            const int value = getSingleChannelValue(static_cast<int>(valueIdx), isSigned);
+            values[valueIdx] = isSigned ? clampSByte(value) : clampByte(value);
+        }
+
+        // Pixels outside of the image use the index of the first pixel
+        int pixelIndices[kNumPixelsInBlock] = {0};
+        int minValue                        = INT_MAX;
+        int maxValue                        = INT_MIN;
+        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        {
+            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            {
+                const int valueIdx      = getSingleChannelIndex(i, j);
+                pixelIndices[j * 4 + i] = valueIdx;
+                minValue                = std::min(minValue, values[valueIdx]);
+                maxValue                = std::max(maxValue, values[valueIdx]);
+            }
+        }
+
+        // With the first endpoint larger than the second one, code 0 is the first endpoint, code
+        // 1 the second one and codes 2 to 7 the interpolations from the first to the second one.
+        static const uint8_t kStepToCode[8] = {0, 2, 3, 4, 5, 6, 7, 1};
+
+        uint8_t codes[kNumValues] = {0};
+        if (maxValue > minValue)
+        {
+            const int range = maxValue - minValue;
+            for (size_t valueIdx = 0; valueIdx < kNumValues; valueIdx++)
+            {
+                const int step =
+                    gl::clamp(((maxValue - values[valueIdx]) * 7 + range / 2) / range, 0, 7);
+                codes[valueIdx] = kStepToCode[step];
+            }
+        }
+
+        uint64_t bits = 0;
+        for (int i = kNumPixelsInBlock - 1; i >= 0; i--)
+        {
+            bits <<= 3;
+            bits |= codes[pixelIndices[i]];
+        }
+
+        // The endpoints are bytes, signed ones for signed blocks
+        dest[0] = static_cast<uint8_t>(maxValue);
+        dest[1] = static_cast<uint8_t>(minValue);
+        for (size_t byteIdx = 0; byteIdx < 6; byteIdx++)
+        {
+            dest[2 + byteIdx] = static_cast<uint8_t>(bits >> (byteIdx * 8));
+        }
+    }
+
   private:
     union {
         // Individual, differential, H and T modes
@@ -463,14 +532,7 @@ struct ETC2Block
         }
     }
 
-    void decodeTBlock(uint8_t *dest,
-                      size_t x,
-                      size_t y,
-                      size_t w,
-                      size_t h,
-                      size_t destRowPitch,
-                      const uint8_t alphaValues[4][4],
-                      bool nonOpaquePunchThroughAlpha) const
+    void computeTBlockPaintColors(R8G8B8A8 paintColors[4]) const
     {
         // Table C.8, distance index for T and H modes
         const auto &block = u.idht.mode.tm;
@@ -485,10 +547,45 @@ struct ETC2Block
         static int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
         const int d            = distance[block.Tda << 1 | block.Tdb];
 
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1, g1, b1), createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2, g2, b2),
-            createRGBA(r2 - d, g2 - d, b2 - d),
-        };
+        paintColors[0] = createRGBA(r1, g1, b1);
+        paintColors[1] = createRGBA(r2 + d, g2 + d, b2 + d);
+        paintColors[2] = createRGBA(r2, g2, b2);
+        paintColors[3] = createRGBA(r2 - d, g2 - d, b2 - d);
+    }
+
+    void computeHBlockPaintColors(R8G8B8A8 paintColors[4]) const
+    {
+        // Table C.8, distance index for T and H modes
+        const auto &block = u.idht.mode.hm;
+
+        int r1 = extend_4to8bits(block.HR1);
+        int g1 = extend_4to8bits(block.HG1a << 1 | block.HG1b);
+        int b1 = extend_4to8bits(block.HB1a << 3 | block.HB1b << 1 | block.HB1c);
+        int r2 = extend_4to8bits(block.HR2);
+        int g2 = extend_4to8bits(block.HG2a << 1 | block.HG2b);
+        int b2 = extend_4to8bits(block.HB2);
+
+        static const int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+        const int d                  = distance[(block.Hda << 2) | (block.Hdb << 1) |
+                               ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0)];
+
+        paintColors[0] = createRGBA(r1 + d, g1 + d, b1 + d);
+        paintColors[1] = createRGBA(r1 - d, g1 - d, b1 - d);
+        paintColors[2] = createRGBA(r2 + d, g2 + d, b2 + d);
+        paintColors[3] = createRGBA(r2 - d, g2 - d, b2 - d);
+    }
+
+    void decodeTBlock(uint8_t *dest,
+                      size_t x,
+                      size_t y,
+                      size_t w,
+                      size_t h,
+                      size_t destRowPitch,
+                      const uint8_t alphaValues[4][4],
+                      bool nonOpaquePunchThroughAlpha) const
+    {
+        R8G8B8A8 paintColors[4];
+        computeTBlockPaintColors(paintColors);
 
         uint8_t *curPixel = dest;
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
@@ -517,24 +614,8 @@ struct ETC2Block
                       const uint8_t alphaValues[4][4],
                       bool nonOpaquePunchThroughAlpha) const
     {
-        // Table C.8, distance index for T and H modes
-        const auto &block = u.idht.mode.hm;
-
-        int r1 = extend_4to8bits(block.HR1);
-        int g1 = extend_4to8bits(block.HG1a << 1 | block.HG1b);
-        int b1 = extend_4to8bits(block.HB1a << 3 | block.HB1b << 1 | block.HB1c);
-        int r2 = extend_4to8bits(block.HR2);
-        int g2 = extend_4to8bits(block.HG2a << 1 | block.HG2b);
-        int b2 = extend_4to8bits(block.HB2);
-
-        static const int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
-        const int d                  = distance[(block.Hda << 2) | (block.Hdb << 1) |
-                               ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0)];
-
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1 + d, g1 + d, b1 + d), createRGBA(r1 - d, g1 - d, b1 - d),
-            createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2 - d, g2 - d, b2 - d),
-        };
+        R8G8B8A8 paintColors[4];
+        computeHBlockPaintColors(paintColors);
 
         uint8_t *curPixel = dest;
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
@@ -660,7 +741,7 @@ struct ETC2Block
 
         ASSERT(numColors <= kNumPixelsInBlock);
 
-        int encodedColors[kNumPixelsInBlock];
+        int encodedColors[kNumPixelsInBlock] = {0};
         if (nonOpaquePunchThroughAlpha)
         {
             for (size_t i = 0; i < numColors; i++)
@@ -1104,8 +1185,9 @@ struct ETC2Block
             }
         }
 
-        int pixelIndices[kNumPixelsInBlock];
-        int pixelIndexCounts[kNumColors] = {0};
+        // Pixels outside of the image use the index of the first pixel
+        int pixelIndices[kNumPixelsInBlock] = {0};
+        int pixelIndexCounts[kNumColors]    = {0};
         // Extract pixel indices from a ETC block.
         for (size_t blockIdx = 0; blockIdx < 2; blockIdx++)
         {
@@ -1121,6 +1203,43 @@ struct ETC2Block
                 maxColorIndex, nonOpaquePunchThroughAlpha);
     }
 
+    void transcodePaintColorsToBC1(uint8_t *dest,
+                                   size_t x,
+                                   size_t y,
+                                   size_t w,
+                                   size_t h,
+                                   const R8G8B8A8 paintColors[4],
+                                   bool nonOpaquePunchThroughAlpha) const
+    {
+        // Like the individual and differential modes, T and H blocks pick the color of each pixel
+        // in a palette of four paint colors, so only the paint colors used by the block are
+        // encoded.
+        R8G8B8A8 colors[4] = {paintColors[0], paintColors[1], paintColors[2], paintColors[3]};
+        if (nonOpaquePunchThroughAlpha)
+        {
+            // Index 2 is the transparent pixel
+            colors[2] = createRGBA(0, 0, 0, 0);
+        }
+
+        int pixelIndices[kNumPixelsInBlock] = {0};
+        int pixelIndexCounts[4]             = {0};
+        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        {
+            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            {
+                const size_t pixelIndex = getIndex(i, j);
+                pixelIndices[j * 4 + i] = static_cast<int>(pixelIndex);
+                pixelIndexCounts[pixelIndex]++;
+            }
+        }
+
+        int minColorIndex, maxColorIndex;
+        selectEndPointPCA(pixelIndexCounts, colors, 4, &minColorIndex, &maxColorIndex);
+
+        packBC1(dest, pixelIndices, pixelIndexCounts, colors, 4, minColorIndex, maxColorIndex,
+                nonOpaquePunchThroughAlpha);
+    }
+
     void transcodeTBlockToBC1(uint8_t *dest,
                               size_t x,
                               size_t y,
@@ -1129,8 +1248,9 @@ struct ETC2Block
                               const uint8_t alphaValues[4][4],
                               bool nonOpaquePunchThroughAlpha) const
     {
-        // TODO (mgong): Will be implemented soon
-        UNIMPLEMENTED();
+        R8G8B8A8 paintColors[4];
+        computeTBlockPaintColors(paintColors);
+        transcodePaintColorsToBC1(dest, x, y, w, h, paintColors, nonOpaquePunchThroughAlpha);
     }
 
     void transcodeHBlockToBC1(uint8_t *dest,
@@ -1141,8 +1261,9 @@ struct ETC2Block
                               const uint8_t alphaValues[4][4],
                               bool nonOpaquePunchThroughAlpha) const
     {
-        // TODO (mgong): Will be implemented soon
-        UNIMPLEMENTED();
+        R8G8B8A8 paintColors[4];
+        computeHBlockPaintColors(paintColors);
+        transcodePaintColorsToBC1(dest, x, y, w, h, paintColors, nonOpaquePunchThroughAlpha);
     }
 
     void transcodePlanarBlockToBC1(uint8_t *dest,
@@ -1152,15 +1273,42 @@ struct ETC2Block
                                    size_t h,
                                    const uint8_t alphaValues[4][4]) const
     {
-        // TODO (mgong): Will be implemented soon
-        UNIMPLEMENTED();
+        // Planar blocks have no palette, each pixel is its own color. Planar blocks are opaque in
+        // the punchthrough alpha formats too.
+        R8G8B8A8 pixelColors[kNumPixelsInBlock];
+        decodePlanarBlock(reinterpret_cast<uint8_t *>(pixelColors), x, y, w, h,
+                          4 * sizeof(R8G8B8A8), alphaValues);
+
+        int pixelIndices[kNumPixelsInBlock]     = {0};
+        int pixelIndexCounts[kNumPixelsInBlock] = {0};
+        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        {
+            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            {
+                const size_t pixelIndex      = j * 4 + i;
+                pixelIndices[pixelIndex]     = static_cast<int>(pixelIndex);
+                pixelIndexCounts[pixelIndex] = 1;
+            }
+        }
+
+        int minColorIndex, maxColorIndex;
+        selectEndPointPCA(pixelIndexCounts, pixelColors, kNumPixelsInBlock, &minColorIndex,
+                          &maxColorIndex);
+
+        packBC1(dest, pixelIndices, pixelIndexCounts, pixelColors, kNumPixelsInBlock,
+                minColorIndex, maxColorIndex, false);
     }
 
     // Single channel utility functions
     int getSingleChannel(size_t x, size_t y, bool isSigned) const
+    {
+        return getSingleChannelValue(getSingleChannelIndex(x, y), isSigned);
+    }
+
+    int getSingleChannelValue(int index, bool isSigned) const
     {
         int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
+        return codeword + getSingleChannelModifier(index) * u.scblk.multiplier;
     }
 
     int getSingleChannelIndex(size_t x, size_t y) const
@@ -1191,7 +1339,7 @@ struct ETC2Block
         // clang-format on
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    int getSingleChannelModifier(int index) const
     {
         // clang-format off
         static const int modifierTable[16][8] =
@@ -1215,7 +1363,7 @@ struct ETC2Block
         };
         // clang-format on
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return modifierTable[u.scblk.table_index][index];
     }
 };
 
@@ -1297,6 +1445,71 @@ void LoadRG11EACToRG8(size_t width,
     }
 }
 
+void LoadR11EACToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch,
+                     bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlock = sourceRow + (x / 4);
+                uint8_t *destPixels          = destRow + (x * 2);
+
+                sourceBlock->transcodeAsBC4(destPixels, x, y, width, height, isSigned);
+            }
+        }
+    }
+}
+
+void LoadRG11EACToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch,
+                      bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                uint8_t *destPixelsRed          = destRow + (x * 4);
+                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+                sourceBlockRed->transcodeAsBC4(destPixelsRed, x, y, width, height, isSigned);
+
+                uint8_t *destPixelsGreen          = destPixelsRed + 8;
+                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+                sourceBlockGreen->transcodeAsBC4(destPixelsGreen, x, y, width, height, isSigned);
+            }
+        }
+    }
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1399,6 +1612,42 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
     }
 }
 
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch,
+                        bool srgb)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                // A BC3 block is a BC4 block for the alpha followed by a BC1 block for the colors
+                uint8_t *destPixelsAlpha          = destRow + (x * 4);
+                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+                sourceBlockAlpha->transcodeAsBC4(destPixelsAlpha, x, y, width, height, false);
+
+                uint8_t *destPixelsRGB          = destPixelsAlpha + 8;
+                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+                sourceBlockRGB->transcodeAsBC1(destPixelsRGB, x, y, width, height,
+                                               DefaultETCAlphaValues, false);
+            }
+        }
+    }
+}
+
 }  // anonymous namespace
 
 void LoadETC1RGB8ToRGBA8(size_t width,
@@ -1457,6 +1706,34 @@ void LoadEACR11SToR8(size_t width,
                    outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadEACR11ToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACR11SToBC4(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, true);
+}
+
 void LoadEACRG11ToRG8(size_t width,
                       size_t height,
                       size_t depth,
@@ -1485,6 +1762,34 @@ void LoadEACRG11SToRG8(size_t width,
                      outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadEACRG11ToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACRG11SToBC5(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, true);
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1513,6 +1818,34 @@ void LoadETC2SRGB8ToRGBA8(size_t width,
                         outputRowPitch, outputDepthPitch, false);
 }
 
+void LoadETC2RGB8ToBC1(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    LoadETC2RGB8ToBC1(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                      outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadETC2SRGB8ToBC1(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    LoadETC2RGB8ToBC1(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                      outputRowPitch, outputDepthPitch, false);
+}
+
 void LoadETC2RGB8A1ToRGBA8(size_t width,
                            size_t height,
                            size_t depth,
@@ -1541,6 +1874,34 @@ void LoadETC2SRGB8A1ToRGBA8(size_t width,
                         outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadETC2RGB8A1ToBC1(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    LoadETC2RGB8ToBC1(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                      outputRowPitch, outputDepthPitch, true);
+}
+
+void LoadETC2SRGB8A1ToBC1(size_t width,
+                          size_t height,
+                          size_t depth,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch)
+{
+    LoadETC2RGB8ToBC1(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                      outputRowPitch, outputDepthPitch, true);
+}
+
 void LoadETC2RGBA8ToRGBA8(size_t width,
                           size_t height,
                           size_t depth,
@@ -1569,4 +1930,32 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                          outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadETC2SRGBA8ToBC3(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch, true);
+}
+
 }  // namespace angle
@@ -0,0 +1,340 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_etc_unittest:
+//   Tests of the quality of the ETC2 and EAC to BC transcoding, measured against the full decode.
+//
+
+#include <math.h>
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "image_util/loadimage.h"
+
+using namespace angle;
+
+namespace
+{
+
+typedef void (*LoadFunction)(size_t,
+                             size_t,
+                             size_t,
+                             const uint8_t *,
+                             size_t,
+                             size_t,
+                             uint8_t *,
+                             size_t,
+                             size_t);
+
+const size_t kWidth  = 64;
+const size_t kHeight = 64;
+
+// Random blocks exercise every ETC2 mode. Single channel blocks get a small multiplier most of the
+// time, like the blocks of real images.
+std::vector<uint8_t> GenerateBlocks(size_t blockSize, bool singleChannel, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    std::vector<uint8_t> blocks((kWidth / 4) * (kHeight / 4) * blockSize);
+    for (uint8_t &byte : blocks)
+    {
+        byte = static_cast<uint8_t>(byteDistribution(generator));
+    }
+
+    if (singleChannel)
+    {
+        for (size_t offset = 0; offset < blocks.size(); offset += 8)
+        {
+            const uint8_t multiplier = static_cast<uint8_t>(byteDistribution(generator) % 4 + 1);
+            blocks[offset + 1] = static_cast<uint8_t>((multiplier << 4) | (blocks[offset + 1] & 0xF));
+        }
+    }
+
+    return blocks;
+}
+
+std::vector<uint8_t> Load(LoadFunction loadFunction,
+                          const std::vector<uint8_t> &blocks,
+                          size_t blockSize,
+                          size_t outputRowPitch,
+                          size_t outputSize)
+{
+    std::vector<uint8_t> output(outputSize, 0);
+    const size_t inputRowPitch = (kWidth / 4) * blockSize;
+    loadFunction(kWidth, kHeight, 1, blocks.data(), inputRowPitch, 0, output.data(),
+                 outputRowPitch, 0);
+    return output;
+}
+
+int Expand565Channel(int value, int bits)
+{
+    return (value << (8 - bits)) | (value >> (2 * bits - 8));
+}
+
+// Decodes a BC1 color block to RGBA8, in four color mode when opaque is true.
+void DecodeBC1Block(const uint8_t *block, bool opaque, uint8_t pixels[16][4])
+{
+    const int color0 = block[0] | (block[1] << 8);
+    const int color1 = block[2] | (block[3] << 8);
+
+    int colors[4][4];
+    const int endpoints[2] = {color0, color1};
+    for (int endpoint = 0; endpoint < 2; endpoint++)
+    {
+        colors[endpoint][0] = Expand565Channel((endpoints[endpoint] >> 11) & 0x1F, 5);
+        colors[endpoint][1] = Expand565Channel((endpoints[endpoint] >> 5) & 0x3F, 6);
+        colors[endpoint][2] = Expand565Channel(endpoints[endpoint] & 0x1F, 5);
+        colors[endpoint][3] = 255;
+    }
+
+    for (int channel = 0; channel < 3; channel++)
+    {
+        if (opaque || color0 > color1)
+        {
+            colors[2][channel] = (2 * colors[0][channel] + colors[1][channel]) / 3;
+            colors[3][channel] = (colors[0][channel] + 2 * colors[1][channel]) / 3;
+        }
+        else
+        {
+            colors[2][channel] = (colors[0][channel] + colors[1][channel]) / 2;
+            colors[3][channel] = 0;
+        }
+    }
+    colors[2][3] = 255;
+    colors[3][3] = (opaque || color0 > color1) ? 255 : 0;
+
+    const uint32_t bits = block[4] | (block[5] << 8) | (block[6] << 16) | (block[7] << 24);
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        const int code = (bits >> (pixel * 2)) & 3;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            pixels[pixel][channel] = static_cast<uint8_t>(colors[code][channel]);
+        }
+    }
+}
+
+// Decodes a BC4 block to bytes, signed ones for signed blocks.
+void DecodeBC4Block(const uint8_t *block, bool isSigned, int values[16])
+{
+    const int red0 = isSigned ? static_cast<int8_t>(block[0]) : block[0];
+    const int red1 = isSigned ? static_cast<int8_t>(block[1]) : block[1];
+
+    int reds[8] = {red0, red1};
+    if (red0 > red1)
+    {
+        for (int code = 2; code < 8; code++)
+        {
+            reds[code] = ((8 - code) * red0 + (code - 1) * red1) / 7;
+        }
+    }
+    else
+    {
+        for (int code = 2; code < 6; code++)
+        {
+            reds[code] = ((6 - code) * red0 + (code - 1) * red1) / 5;
+        }
+        reds[6] = isSigned ? -127 : 0;
+        reds[7] = isSigned ? 127 : 255;
+    }
+
+    uint64_t bits = 0;
+    for (int byte = 7; byte >= 2; byte--)
+    {
+        bits = (bits << 8) | block[byte];
+    }
+    for (int pixel = 0; pixel < 16; pixel++)
+    {
+        values[pixel] = reds[(bits >> (pixel * 3)) & 7];
+    }
+}
+
+double ComputePSNR(double squaredErrorSum, size_t count)
+{
+    if (squaredErrorSum == 0.0)
+    {
+        return INFINITY;
+    }
+    const double meanSquaredError = squaredErrorSum / static_cast<double>(count);
+    return 10.0 * log10(255.0 * 255.0 / meanSquaredError);
+}
+
+// Transcodes random single or dual channel EAC blocks to BC4 or BC5 and returns the PSNR of the
+// BC decode against the full decode.
+double MeasureEACTranscodePSNR(LoadFunction decodeFunction,
+                               LoadFunction transcodeFunction,
+                               size_t channelCount,
+                               bool isSigned,
+                               unsigned int seed)
+{
+    const size_t blockSize           = 8 * channelCount;
+    const std::vector<uint8_t> blocks = GenerateBlocks(blockSize, true, seed);
+
+    const std::vector<uint8_t> decoded = Load(decodeFunction, blocks, blockSize,
+                                              kWidth * channelCount, kWidth * kHeight * channelCount);
+    const std::vector<uint8_t> transcoded =
+        Load(transcodeFunction, blocks, blockSize, (kWidth / 4) * blockSize, blocks.size());
+
+    double squaredErrorSum = 0.0;
+    for (size_t blockY = 0; blockY < kHeight / 4; blockY++)
+    {
+        for (size_t blockX = 0; blockX < kWidth / 4; blockX++)
+        {
+            for (size_t channel = 0; channel < channelCount; channel++)
+            {
+                const size_t blockIndex = blockY * (kWidth / 4) + blockX;
+                int values[16];
+                DecodeBC4Block(&transcoded[blockIndex * blockSize + channel * 8], isSigned, values);
+
+                for (size_t pixel = 0; pixel < 16; pixel++)
+                {
+                    const size_t x = blockX * 4 + pixel % 4;
+                    const size_t y = blockY * 4 + pixel / 4;
+                    const uint8_t byte = decoded[(y * kWidth + x) * channelCount + channel];
+                    const int expected = isSigned ? static_cast<int8_t>(byte) : byte;
+                    const double error = static_cast<double>(values[pixel] - expected);
+                    squaredErrorSum += error * error;
+                }
+            }
+        }
+    }
+
+    return ComputePSNR(squaredErrorSum, kWidth * kHeight * channelCount);
+}
+
+// Transcodes random ETC2 blocks to BC1 or BC3 and returns the PSNR of the BC decode against the
+// full decode to RGBA8.
+double MeasureETC2TranscodePSNR(LoadFunction decodeFunction,
+                                LoadFunction transcodeFunction,
+                                size_t blockSize,
+                                bool punchThroughAlpha,
+                                unsigned int seed)
+{
+    const bool hasAlphaBlock          = (blockSize == 16);
+    const std::vector<uint8_t> blocks = GenerateBlocks(blockSize, false, seed);
+
+    const std::vector<uint8_t> decoded =
+        Load(decodeFunction, blocks, blockSize, kWidth * 4, kWidth * kHeight * 4);
+    const std::vector<uint8_t> transcoded =
+        Load(transcodeFunction, blocks, blockSize, (kWidth / 4) * blockSize, blocks.size());
+
+    double squaredErrorSum = 0.0;
+    for (size_t blockY = 0; blockY < kHeight / 4; blockY++)
+    {
+        for (size_t blockX = 0; blockX < kWidth / 4; blockX++)
+        {
+            const uint8_t *block = &transcoded[(blockY * (kWidth / 4) + blockX) * blockSize];
+
+            uint8_t pixels[16][4];
+            DecodeBC1Block(hasAlphaBlock ? block + 8 : block, hasAlphaBlock, pixels);
+            if (hasAlphaBlock)
+            {
+                int alphas[16];
+                DecodeBC4Block(block, false, alphas);
+                for (size_t pixel = 0; pixel < 16; pixel++)
+                {
+                    pixels[pixel][3] = static_cast<uint8_t>(alphas[pixel]);
+                }
+            }
+
+            for (size_t pixel = 0; pixel < 16; pixel++)
+            {
+                const size_t x           = blockX * 4 + pixel % 4;
+                const size_t y           = blockY * 4 + pixel / 4;
+                const uint8_t *expected  = &decoded[(y * kWidth + x) * 4];
+                const bool transparent   = punchThroughAlpha && expected[3] == 0;
+                for (size_t channel = 0; channel < 4; channel++)
+                {
+                    // The color of transparent pixels does not matter
+                    if (transparent && channel < 3)
+                    {
+                        continue;
+                    }
+                    const double error = static_cast<double>(pixels[pixel][channel]) -
+                                         static_cast<double>(expected[channel]);
+                    squaredErrorSum += error * error;
+                }
+            }
+        }
+    }
+
+    return ComputePSNR(squaredErrorSum, kWidth * kHeight * 4);
+}
+
+// EAC R11 to BC4.
+TEST(ETCTranscodeTest, EACR11ToBC4)
+{
+    const double psnr = MeasureEACTranscodePSNR(LoadEACR11ToR8, LoadEACR11ToBC4, 1, false, 1);
+    EXPECT_GT(psnr, 40.0);
+}
+
+// Signed EAC R11 to BC4.
+TEST(ETCTranscodeTest, EACR11SToBC4)
+{
+    const double psnr = MeasureEACTranscodePSNR(LoadEACR11SToR8, LoadEACR11SToBC4, 1, true, 2);
+    EXPECT_GT(psnr, 40.0);
+}
+
+// EAC RG11 to BC5.
+TEST(ETCTranscodeTest, EACRG11ToBC5)
+{
+    const double psnr = MeasureEACTranscodePSNR(LoadEACRG11ToRG8, LoadEACRG11ToBC5, 2, false, 3);
+    EXPECT_GT(psnr, 40.0);
+}
+
+// Signed EAC RG11 to BC5.
+TEST(ETCTranscodeTest, EACRG11SToBC5)
+{
+    const double psnr = MeasureEACTranscodePSNR(LoadEACRG11SToRG8, LoadEACRG11SToBC5, 2, true, 4);
+    EXPECT_GT(psnr, 40.0);
+}
+
+// ETC2 RGB8 to BC1, all modes included. Random blocks are the worst case for BC1, whose four colors
+// lie on a line, so the thresholds of the color formats are well below those of real images.
+TEST(ETCTranscodeTest, ETC2RGB8ToBC1)
+{
+    const double psnr =
+        MeasureETC2TranscodePSNR(LoadETC2RGB8ToRGBA8, LoadETC2RGB8ToBC1, 8, false, 5);
+    EXPECT_GT(psnr, 17.0);
+}
+
+// ETC2 RGB8 with punchthrough alpha to BC1.
+TEST(ETCTranscodeTest, ETC2RGB8A1ToBC1)
+{
+    const double psnr =
+        MeasureETC2TranscodePSNR(LoadETC2RGB8A1ToRGBA8, LoadETC2RGB8A1ToBC1, 8, true, 6);
+    EXPECT_GT(psnr, 19.0);
+}
+
+// ETC2 RGBA8 to BC3.
+TEST(ETCTranscodeTest, ETC2RGBA8ToBC3)
+{
+    const double psnr =
+        MeasureETC2TranscodePSNR(LoadETC2RGBA8ToRGBA8, LoadETC2RGBA8ToBC3, 16, false, 7);
+    EXPECT_GT(psnr, 17.0);
+}
+
+// Blocks with a single value are transcoded without loss.
+TEST(ETCTranscodeTest, UniformEACBlockIsExact)
+{
+    // Base codeword 200, multiplier 0
+    const uint8_t block[8] = {200, 0x05, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49};
+
+    uint8_t transcoded[8] = {};
+    LoadEACR11ToBC4(4, 4, 1, block, 8, 0, transcoded, 8, 0);
+
+    int values[16];
+    DecodeBC4Block(transcoded, false, values);
+    for (int value : values)
+    {
+        EXPECT_EQ(200, value);
+    }
+}
+
+}  // anonymous namespace
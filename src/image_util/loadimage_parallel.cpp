@@ -0,0 +1,119 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_parallel.cpp: Splits image loads in bands of rows or slices run on worker threads.
+
+#include "image_util/loadimage_parallel.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "common/WorkerPool.h"
+#include "common/angleutils.h"
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+namespace
+{
+
+// A load split in items, each item being a band of rows of one slice.
+struct LoadJob
+{
+    void runItems()
+    {
+        size_t item;
+        while ((item = nextItem.fetch_add(1)) < itemCount)
+        {
+            const size_t z    = item / bandsPerSlice;
+            const size_t y    = (item % bandsPerSlice) * rowsPerBand;
+            const size_t rows = std::min(rowsPerBand, height - y);
+            loadFunction(width, rows, 1,
+                         input + z * inputDepthPitch + (y / inputBlockHeight) * inputRowPitch,
+                         inputRowPitch, inputDepthPitch,
+                         output + z * outputDepthPitch + (y / outputBlockHeight) * outputRowPitch,
+                         outputRowPitch, outputDepthPitch);
+        }
+    }
+
+    LoadImageFunction loadFunction;
+    size_t inputBlockHeight;
+    size_t outputBlockHeight;
+    size_t width;
+    size_t height;
+    const uint8_t *input;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    uint8_t *output;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+
+    size_t rowsPerBand;
+    size_t bandsPerSlice;
+    size_t itemCount;
+    std::atomic<size_t> nextItem;
+};
+
+}  // anonymous namespace
+
+void LoadImageParallel(LoadImageFunction loadFunction,
+                       size_t inputBlockHeight,
+                       size_t outputBlockHeight,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    ASSERT(inputBlockHeight > 0 && outputBlockHeight > 0);
+
+    if (width * height * depth < kMinParallelLoadPixels)
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    WorkerPool *pool         = WorkerPool::Get();
+    const size_t threadCount = pool->getThreadCount();
+
+    // Slices are split in bands only when there are fewer slices than threads. The bands of
+    // compressed formats must not cut through blocks.
+    const size_t blockHeight   = std::max(inputBlockHeight, outputBlockHeight);
+    const size_t bandsPerSlice = (threadCount + depth - 1) / depth;
+    const size_t rowsPerBand =
+        rx::roundUp((height + bandsPerSlice - 1) / bandsPerSlice, blockHeight);
+
+    LoadJob job;
+    job.loadFunction      = loadFunction;
+    job.inputBlockHeight  = inputBlockHeight;
+    job.outputBlockHeight = outputBlockHeight;
+    job.width             = width;
+    job.height            = height;
+    job.input             = input;
+    job.inputRowPitch     = inputRowPitch;
+    job.inputDepthPitch   = inputDepthPitch;
+    job.output            = output;
+    job.outputRowPitch    = outputRowPitch;
+    job.outputDepthPitch  = outputDepthPitch;
+    job.rowsPerBand       = rowsPerBand;
+    job.bandsPerSlice     = (height + rowsPerBand - 1) / rowsPerBand;
+    job.itemCount         = depth * job.bandsPerSlice;
+    job.nextItem          = 0;
+
+    if (threadCount == 1 || job.itemCount == 1 || !pool->run([&job]() { job.runItems(); }))
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+    }
+}
+
+}  // namespace angle
@@ -0,0 +1,53 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_parallel.h: Defines the dispatch of image loading functions to worker threads
+
+#ifndef IMAGEUTIL_LOADIMAGE_PARALLEL_H_
+#define IMAGEUTIL_LOADIMAGE_PARALLEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+
+// Signature shared by all the functions of loadimage.h.
+typedef void (*LoadImageFunction)(size_t width,
+                                  size_t height,
+                                  size_t depth,
+                                  const uint8_t *input,
+                                  size_t inputRowPitch,
+                                  size_t inputDepthPitch,
+                                  uint8_t *output,
+                                  size_t outputRowPitch,
+                                  size_t outputDepthPitch);
+
+// Images with fewer pixels are loaded on the calling thread, since waking up the workers would
+// cost more than the load itself.
+const size_t kMinParallelLoadPixels = 256 * 256;
+
+// Runs |loadFunction| over bands of rows, or over the slices of 3D images, on a pool of worker
+// threads shared by all the loads and on the calling thread. Returns once the whole image is
+// loaded. The bands start on a block boundary of both the input and the output, whose row pitches
+// are the pitches of a row of blocks for compressed formats, and a block height of 1 for others.
+// The load stays on the calling thread when another thread is using the workers.
+void LoadImageParallel(LoadImageFunction loadFunction,
+                       size_t inputBlockHeight,
+                       size_t outputBlockHeight,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch);
+
+}  // namespace angle
+
+#endif  // IMAGEUTIL_LOADIMAGE_PARALLEL_H_
@@ -0,0 +1,175 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_parallel_unittest:
+//   Tests that the parallel loads write the same data as the loads on a single thread.
+//
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "image_util/loadimage.h"
+#include "image_util/loadimage_parallel.h"
+
+using namespace angle;
+
+namespace
+{
+
+struct LoadLayout
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t inputBlockHeight;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    size_t outputBlockHeight;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+};
+
+std::vector<uint8_t> GenerateInput(const LoadLayout &layout)
+{
+    std::mt19937 generator(layout.width * layout.height + layout.depth);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    std::vector<uint8_t> input(layout.inputDepthPitch * layout.depth);
+    for (uint8_t &byte : input)
+    {
+        byte = static_cast<uint8_t>(byteDistribution(generator));
+    }
+    return input;
+}
+
+// Loads the image in parallel and serially and compares the outputs, including the padding the
+// load must not write.
+void ExpectSameLoad(LoadImageFunction loadFunction, const LoadLayout &layout)
+{
+    const std::vector<uint8_t> input = GenerateInput(layout);
+    const size_t outputSize          = layout.outputDepthPitch * layout.depth;
+    std::vector<uint8_t> serialOutput(outputSize, 0xCD);
+    std::vector<uint8_t> parallelOutput(outputSize, 0xCD);
+
+    loadFunction(layout.width, layout.height, layout.depth, input.data(), layout.inputRowPitch,
+                 layout.inputDepthPitch, serialOutput.data(), layout.outputRowPitch,
+                 layout.outputDepthPitch);
+    LoadImageParallel(loadFunction, layout.inputBlockHeight, layout.outputBlockHeight,
+                      layout.width, layout.height, layout.depth, input.data(),
+                      layout.inputRowPitch, layout.inputDepthPitch, parallelOutput.data(),
+                      layout.outputRowPitch, layout.outputDepthPitch);
+
+    EXPECT_EQ(serialOutput, parallelOutput);
+}
+
+// Layout of an uncompressed image with padded rows.
+LoadLayout UncompressedLayout(size_t width,
+                              size_t height,
+                              size_t depth,
+                              size_t inputPixelSize,
+                              size_t outputPixelSize)
+{
+    LoadLayout layout;
+    layout.width             = width;
+    layout.height            = height;
+    layout.depth             = depth;
+    layout.inputBlockHeight  = 1;
+    layout.inputRowPitch     = width * inputPixelSize + 3;
+    layout.inputDepthPitch   = layout.inputRowPitch * height;
+    layout.outputBlockHeight = 1;
+    layout.outputRowPitch    = width * outputPixelSize + 16;
+    layout.outputDepthPitch  = layout.outputRowPitch * height;
+    return layout;
+}
+
+// Layout of an ETC image decoded to pixels, or transcoded to blocks when outputBlockSize isn't 0.
+LoadLayout ETCLayout(size_t width,
+                     size_t height,
+                     size_t inputBlockSize,
+                     size_t outputPixelSize,
+                     size_t outputBlockSize)
+{
+    const size_t blocksWide = (width + 3) / 4;
+    const size_t blocksHigh = (height + 3) / 4;
+
+    LoadLayout layout;
+    layout.width            = width;
+    layout.height           = height;
+    layout.depth            = 1;
+    layout.inputBlockHeight = 4;
+    layout.inputRowPitch    = blocksWide * inputBlockSize;
+    layout.inputDepthPitch  = layout.inputRowPitch * blocksHigh;
+    if (outputBlockSize > 0)
+    {
+        layout.outputBlockHeight = 4;
+        layout.outputRowPitch    = blocksWide * outputBlockSize;
+        layout.outputDepthPitch  = layout.outputRowPitch * blocksHigh;
+    }
+    else
+    {
+        layout.outputBlockHeight = 1;
+        layout.outputRowPitch    = width * outputPixelSize;
+        layout.outputDepthPitch  = layout.outputRowPitch * height;
+    }
+    return layout;
+}
+
+// 2D image with an odd height split in bands of rows.
+TEST(LoadImageParallelTest, UncompressedBands)
+{
+    ExpectSameLoad(LoadRGBA8ToBGRA8, UncompressedLayout(517, 613, 1, 4, 4));
+    ExpectSameLoad(LoadRGB8ToBGRX8, UncompressedLayout(1024, 257, 1, 3, 4));
+}
+
+// 3D images split in slices, or in bands of the slices when there are few of them.
+TEST(LoadImageParallelTest, UncompressedSlices)
+{
+    ExpectSameLoad(LoadRGBA8ToBGRA8, UncompressedLayout(64, 64, 37, 4, 4));
+    ExpectSameLoad(LoadRGB8ToBGRX8, UncompressedLayout(300, 301, 2, 3, 4));
+}
+
+// Compressed input decoded to pixels, with a height that isn't a multiple of the block height.
+TEST(LoadImageParallelTest, CompressedInput)
+{
+    ExpectSameLoad(LoadETC2RGB8ToRGBA8, ETCLayout(1022, 514, 8, 4, 0));
+    ExpectSameLoad(LoadEACRG11ToRG8, ETCLayout(512, 510, 16, 2, 0));
+}
+
+// Compressed input transcoded to compressed output.
+TEST(LoadImageParallelTest, CompressedOutput)
+{
+    ExpectSameLoad(LoadETC2RGB8ToBC1, ETCLayout(1024, 1020, 8, 0, 8));
+    ExpectSameLoad(LoadETC2RGBA8ToBC3, ETCLayout(600, 600, 16, 0, 16));
+}
+
+// Small images are loaded on the calling thread.
+TEST(LoadImageParallelTest, SmallImage)
+{
+    ExpectSameLoad(LoadRGBA8ToBGRA8, UncompressedLayout(17, 5, 1, 4, 4));
+    ExpectSameLoad(LoadETC2RGB8ToRGBA8, ETCLayout(4, 4, 8, 4, 0));
+}
+
+// Loads submitted while the workers are busy still complete, on the calling thread.
+TEST(LoadImageParallelTest, ConcurrentLoads)
+{
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+    {
+        threads.emplace_back([]() {
+            for (int iteration = 0; iteration < 4; ++iteration)
+            {
+                ExpectSameLoad(LoadETC2RGB8ToRGBA8, ETCLayout(512, 512, 8, 4, 0));
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+}  // anonymous namespace
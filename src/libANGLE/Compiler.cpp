@@ -23,6 +23,18 @@ namespace
 // ShFinalize.
 size_t activeCompilerHandles = 0;
 
+// Number of unused compiler handles of each shader type kept around for later compiles. Handles
+// are only created beyond the first when compiles of the same type are in flight concurrently.
+const size_t kMaxFreeCompilerHandles = 2;
+
+void DestructCompilerHandle(ShHandle handle)
+{
+    ShDestruct(handle);
+
+    ASSERT(activeCompilerHandles > 0);
+    activeCompilerHandles--;
+}
+
 ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion)
 {
     if (majorVersion >= 3)
@@ -42,12 +54,12 @@ ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion)
 }  // anonymous namespace
 
 Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
-    : mImplementation(implFactory->createCompiler()),
+    : RefCountObject(0),
+      mImplementation(implFactory->createCompiler()),
       mSpec(SelectShaderSpec(state.getClientMajorVersion(), state.getClientMinorVersion())),
       mOutputType(mImplementation->getTranslatorOutputType()),
       mResources(),
-      mFragmentCompiler(nullptr),
-      mVertexCompiler(nullptr)
+      mHandlesInUse(0)
 {
     ASSERT(state.getClientMajorVersion() == 2 || state.getClientMajorVersion() == 3);
 
@@ -111,29 +123,25 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
 
 Compiler::~Compiler()
 {
-    release();
+    releaseHandles();
     SafeDelete(mImplementation);
 }
 
-Error Compiler::release()
+Error Compiler::releaseHandles()
 {
-    if (mFragmentCompiler)
-    {
-        ShDestruct(mFragmentCompiler);
-        mFragmentCompiler = nullptr;
+    ASSERT(mHandlesInUse == 0);
 
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+    for (ShHandle handle : mFreeFragmentCompilers)
+    {
+        DestructCompilerHandle(handle);
     }
+    mFreeFragmentCompilers.clear();
 
-    if (mVertexCompiler)
+    for (ShHandle handle : mFreeVertexCompilers)
     {
-        ShDestruct(mVertexCompiler);
-        mVertexCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+        DestructCompilerHandle(handle);
     }
+    mFreeVertexCompilers.clear();
 
     if (activeCompilerHandles == 0)
     {
@@ -145,36 +153,67 @@ Error Compiler::release()
     return gl::Error(GL_NO_ERROR);
 }
 
-ShHandle Compiler::getCompilerHandle(GLenum type)
+std::vector<ShHandle> *Compiler::getFreeHandles(GLenum type)
 {
-    ShHandle *compiler = nullptr;
     switch (type)
     {
         case GL_VERTEX_SHADER:
-            compiler = &mVertexCompiler;
-            break;
+            return &mFreeVertexCompilers;
 
         case GL_FRAGMENT_SHADER:
-            compiler = &mFragmentCompiler;
-            break;
+            return &mFreeFragmentCompilers;
 
         default:
             UNREACHABLE();
             return nullptr;
     }
+}
+
+ShHandle Compiler::acquireCompilerHandle(GLenum type)
+{
+    std::vector<ShHandle> *freeHandles = getFreeHandles(type);
+    if (freeHandles == nullptr)
+    {
+        return nullptr;
+    }
 
-    if (!(*compiler))
+    ShHandle handle = nullptr;
+    if (!freeHandles->empty())
+    {
+        handle = freeHandles->back();
+        freeHandles->pop_back();
+    }
+    else
     {
         if (activeCompilerHandles == 0)
         {
             ShInitialize();
         }
 
-        *compiler = ShConstructCompiler(type, mSpec, mOutputType, &mResources);
+        handle = ShConstructCompiler(type, mSpec, mOutputType, &mResources);
         activeCompilerHandles++;
     }
 
-    return *compiler;
+    mHandlesInUse++;
+    return handle;
+}
+
+void Compiler::returnCompilerHandle(GLenum type, ShHandle handle)
+{
+    ASSERT(mHandlesInUse > 0);
+    mHandlesInUse--;
+
+    std::vector<ShHandle> *freeHandles = getFreeHandles(type);
+    ASSERT(freeHandles != nullptr);
+
+    if (freeHandles->size() < kMaxFreeCompilerHandles)
+    {
+        freeHandles->push_back(handle);
+    }
+    else
+    {
+        DestructCompilerHandle(handle);
+    }
 }
 
 }  // namespace gl
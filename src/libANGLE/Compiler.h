@@ -10,7 +10,10 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <vector>
+
 #include "libANGLE/Error.h"
+#include "libANGLE/RefCountObject.h"
 #include "GLSLANG/ShaderLang.h"
 
 namespace rx
@@ -23,25 +26,37 @@ namespace gl
 {
 class ContextState;
 
-class Compiler final : angle::NonCopyable
+// The compiler is reference counted, since shaders with a deferred compile keep a reference to
+// it and may outlive the context that created it.
+class Compiler final : public RefCountObject
 {
   public:
     Compiler(rx::GLImplFactory *implFactory, const ContextState &data);
-    ~Compiler();
 
-    Error release();
+    // Frees the compiler handles, for glReleaseShaderCompiler.
+    Error releaseHandles();
+
+    // Takes a compiler handle for the shader type out of the pool, creating a new one if all of
+    // them are in use. Different handles can be used to compile on different threads. The
+    // handles must be acquired and returned on the context's thread.
+    ShHandle acquireCompilerHandle(GLenum type);
+    void returnCompilerHandle(GLenum type, ShHandle handle);
 
-    ShHandle getCompilerHandle(GLenum type);
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
 
   private:
+    ~Compiler() override;
+
+    std::vector<ShHandle> *getFreeHandles(GLenum type);
+
     rx::CompilerImpl *mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShBuiltInResources mResources;
 
-    ShHandle mFragmentCompiler;
-    ShHandle mVertexCompiler;
+    std::vector<ShHandle> mFreeFragmentCompilers;
+    std::vector<ShHandle> mFreeVertexCompilers;
+    size_t mHandlesInUse;
 };
 
 }  // namespace gl
@@ -320,6 +320,7 @@ Context::Context(rx::EGLImplFactory *implFactory,
     }
 
     mCompiler = new Compiler(mImplementation.get(), mState);
+    mCompiler->addRef();
 
     // Initialize dirty bit masks
     // TODO(jmadill): additional ES3 state
@@ -417,7 +418,8 @@ Context::~Context()
         mResourceManager->release();
     }
 
-    SafeDelete(mCompiler);
+    mCompiler->release();
+    mCompiler = nullptr;
 }
 
 void Context::makeCurrent(egl::Surface *surface)
@@ -2163,6 +2165,66 @@ void Context::setVertexAttribDivisor(GLuint index, GLuint divisor)
     mGLState.setVertexAttribDivisor(index, divisor);
 }
 
+void Context::texParameteri(GLenum target, GLenum pname, GLint param)
+{
+    Texture *texture = getTargetTexture(target);
+    ASSERT(texture);
+
+    // clang-format off
+    switch (pname)
+    {
+      case GL_TEXTURE_WRAP_S:               texture->setWrapS(static_cast<GLenum>(param));        break;
+      case GL_TEXTURE_WRAP_T:               texture->setWrapT(static_cast<GLenum>(param));        break;
+      case GL_TEXTURE_WRAP_R:               texture->setWrapR(static_cast<GLenum>(param));        break;
+      case GL_TEXTURE_MIN_FILTER:           texture->setMinFilter(static_cast<GLenum>(param));    break;
+      case GL_TEXTURE_MAG_FILTER:           texture->setMagFilter(static_cast<GLenum>(param));    break;
+      case GL_TEXTURE_USAGE_ANGLE:          texture->setUsage(static_cast<GLenum>(param));        break;
+      case GL_TEXTURE_MAX_ANISOTROPY_EXT:   texture->setMaxAnisotropy(std::min(static_cast<GLfloat>(param), getExtensions().maxTextureAnisotropy)); break;
+      case GL_TEXTURE_COMPARE_MODE:         texture->setCompareMode(static_cast<GLenum>(param));  break;
+      case GL_TEXTURE_COMPARE_FUNC:         texture->setCompareFunc(static_cast<GLenum>(param));  break;
+      case GL_TEXTURE_SWIZZLE_R:            texture->setSwizzleRed(static_cast<GLenum>(param));   break;
+      case GL_TEXTURE_SWIZZLE_G:            texture->setSwizzleGreen(static_cast<GLenum>(param)); break;
+      case GL_TEXTURE_SWIZZLE_B:            texture->setSwizzleBlue(static_cast<GLenum>(param));  break;
+      case GL_TEXTURE_SWIZZLE_A:            texture->setSwizzleAlpha(static_cast<GLenum>(param)); break;
+      case GL_TEXTURE_BASE_LEVEL:           texture->setBaseLevel(static_cast<GLuint>(param));    break;
+      case GL_TEXTURE_MAX_LEVEL:            texture->setMaxLevel(static_cast<GLuint>(param));     break;
+      case GL_TEXTURE_MIN_LOD:              texture->setMinLod(static_cast<GLfloat>(param));      break;
+      case GL_TEXTURE_MAX_LOD:              texture->setMaxLod(static_cast<GLfloat>(param));      break;
+      default: UNREACHABLE(); break;
+    }
+    // clang-format on
+}
+
+void Context::texParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    Texture *texture = getTargetTexture(target);
+    ASSERT(texture);
+
+    // clang-format off
+    switch (pname)
+    {
+      case GL_TEXTURE_WRAP_S:               texture->setWrapS(uiround<GLenum>(param));        break;
+      case GL_TEXTURE_WRAP_T:               texture->setWrapT(uiround<GLenum>(param));        break;
+      case GL_TEXTURE_WRAP_R:               texture->setWrapR(uiround<GLenum>(param));        break;
+      case GL_TEXTURE_MIN_FILTER:           texture->setMinFilter(uiround<GLenum>(param));    break;
+      case GL_TEXTURE_MAG_FILTER:           texture->setMagFilter(uiround<GLenum>(param));    break;
+      case GL_TEXTURE_USAGE_ANGLE:          texture->setUsage(uiround<GLenum>(param));        break;
+      case GL_TEXTURE_MAX_ANISOTROPY_EXT:   texture->setMaxAnisotropy(std::min(param, getExtensions().maxTextureAnisotropy)); break;
+      case GL_TEXTURE_COMPARE_MODE:         texture->setCompareMode(uiround<GLenum>(param));  break;
+      case GL_TEXTURE_COMPARE_FUNC:         texture->setCompareFunc(uiround<GLenum>(param));  break;
+      case GL_TEXTURE_SWIZZLE_R:            texture->setSwizzleRed(uiround<GLenum>(param));   break;
+      case GL_TEXTURE_SWIZZLE_G:            texture->setSwizzleGreen(uiround<GLenum>(param)); break;
+      case GL_TEXTURE_SWIZZLE_B:            texture->setSwizzleBlue(uiround<GLenum>(param));  break;
+      case GL_TEXTURE_SWIZZLE_A:            texture->setSwizzleAlpha(uiround<GLenum>(param)); break;
+      case GL_TEXTURE_BASE_LEVEL:           texture->setBaseLevel(uiround<GLuint>(param));    break;
+      case GL_TEXTURE_MAX_LEVEL:            texture->setMaxLevel(uiround<GLuint>(param));     break;
+      case GL_TEXTURE_MIN_LOD:              texture->setMinLod(param);                        break;
+      case GL_TEXTURE_MAX_LOD:              texture->setMaxLod(param);                        break;
+      default: UNREACHABLE(); break;
+    }
+    // clang-format on
+}
+
 void Context::samplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
     mResourceManager->checkSamplerAllocation(mImplementation.get(), sampler);
@@ -2272,6 +2334,24 @@ void Context::programParameteri(GLuint program, GLenum pname, GLint value)
     programObject->setBinaryRetrievableHint(value != GL_FALSE);
 }
 
+void Context::uniform1iv(GLint location, GLsizei count, const GLint *v)
+{
+    Program *program = mGLState.getProgram();
+    ASSERT(program != nullptr);
+
+    program->setUniform1iv(location, count, v);
+}
+
+void Context::uniformBlockBinding(GLuint program,
+                                  GLuint uniformBlockIndex,
+                                  GLuint uniformBlockBinding)
+{
+    Program *programObject = getProgram(program);
+    ASSERT(programObject != nullptr);
+
+    programObject->bindUniformBlock(uniformBlockIndex, uniformBlockBinding);
+}
+
 void Context::initRendererString()
 {
     std::ostringstream rendererString;
@@ -158,6 +158,9 @@ class Context final : public ValidationContext
 
     void setVertexAttribDivisor(GLuint index, GLuint divisor);
 
+    void texParameteri(GLenum target, GLenum pname, GLint param);
+    void texParameterf(GLenum target, GLenum pname, GLfloat param);
+
     void samplerParameteri(GLuint sampler, GLenum pname, GLint param);
     void samplerParameterf(GLuint sampler, GLenum pname, GLfloat param);
     GLint getSamplerParameteri(GLuint sampler, GLenum pname);
@@ -165,6 +168,9 @@ class Context final : public ValidationContext
 
     void programParameteri(GLuint program, GLenum pname, GLint value);
 
+    void uniform1iv(GLint location, GLsizei count, const GLint *v);
+    void uniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+
     Buffer *getBuffer(GLuint handle) const;
     FenceNV *getFenceNV(GLuint handle);
     FenceSync *getFenceSync(GLsync handle) const;
@@ -20,6 +20,7 @@
 #include <EGL/eglext.h>
 
 #include "common/debug.h"
+#include "common/entry_point_counters.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "common/utilities.h"
@@ -432,6 +433,11 @@ Error Display::initialize()
         ASSERT(mDevice != nullptr);
     }
 
+    if (mAttributeMap.get(EGL_PLATFORM_ANGLE_ENTRY_POINT_COUNTERS_ANGLE, EGL_FALSE) == EGL_TRUE)
+    {
+        angle::SetEntryPointCountersEnabled(true);
+    }
+
     mInitialized = true;
 
     return egl::Error(EGL_SUCCESS);
@@ -472,6 +478,14 @@ void Display::terminate()
 
     mImplementation->terminate();
 
+    // The counters stay enabled while other displays use them.
+    if (mInitialized &&
+        mAttributeMap.get(EGL_PLATFORM_ANGLE_ENTRY_POINT_COUNTERS_ANGLE, EGL_FALSE) == EGL_TRUE)
+    {
+        angle::SetEntryPointCountersEnabled(false);
+        angle::FlushEntryPointCounters();
+    }
+
     mInitialized = false;
 
     // Never de-init default platform.. terminate is not that final.
@@ -14,6 +14,7 @@
 
 #include "common/Optional.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
@@ -202,7 +203,7 @@ class Framebuffer final : public LabeledObject, public angle::SignalReceiver
         DIRTY_BIT_MAX = DIRTY_BIT_UNKNOWN,
     };
 
-    typedef std::bitset<DIRTY_BIT_MAX> DirtyBits;
+    typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
     bool hasAnyDirtyBit() const { return mDirtyBits.any(); }
 
     void syncState();
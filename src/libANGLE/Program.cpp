@@ -10,6 +10,7 @@
 #include "libANGLE/Program.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 #include "common/BitSetIterator.h"
 #include "common/debug.h"
@@ -124,15 +125,18 @@ void UniformStateQueryCastLoop(DestT *dataOut, const uint8_t *srcPointer, int co
     }
 }
 
-bool UniformInList(const std::vector<LinkedUniform> &list, const std::string &name)
+// Index of the variables or blocks of one shader by name, used to match them with the ones of the
+// other shader in linear time. The first of several variables with the same name is kept.
+template <typename VarT>
+std::unordered_map<std::string, const VarT *> IndexByName(const std::vector<VarT> &variables)
 {
-    for (const LinkedUniform &uniform : list)
+    std::unordered_map<std::string, const VarT *> index;
+    index.reserve(variables.size());
+    for (const VarT &variable : variables)
     {
-        if (uniform.name == name)
-            return true;
+        index.insert(std::make_pair(variable.name, &variable));
     }
-
-    return false;
+    return index;
 }
 
 }  // anonymous namespace
@@ -526,6 +530,10 @@ Error Program::link(const ContextState &data)
     mInfoLog.reset();
     resetUniformBlockBindings();
 
+    // Deferred shader compiles are translated concurrently, so that linking waits for the
+    // slowest of the shaders rather than for all of them in turn.
+    Shader::resolveCompiles({mState.mAttachedVertexShader, mState.mAttachedFragmentShader});
+
     if (!mState.mAttachedFragmentShader || !mState.mAttachedFragmentShader->isCompiled())
     {
         return Error(GL_NO_ERROR);
@@ -1481,6 +1489,21 @@ bool Program::isValidated() const
     return mValidated;
 }
 
+void Program::setDirtyBit(DirtyBitType dirtyBit)
+{
+    mDirtyBits.set(dirtyBit);
+    mDirtyBitsChannel.signal();
+}
+
+void Program::syncImplState()
+{
+    if (mDirtyBits.any())
+    {
+        mProgram->syncState(mDirtyBits);
+        mDirtyBits.reset();
+    }
+}
+
 GLuint Program::getActiveUniformBlockCount() const
 {
     return static_cast<GLuint>(mState.mUniformBlocks.size());
@@ -1610,6 +1633,7 @@ void Program::bindUniformBlock(GLuint uniformBlockIndex, GLuint uniformBlockBind
 {
     mState.mUniformBlockBindings[uniformBlockIndex] = uniformBlockBinding;
     mProgram->setUniformBlockBinding(uniformBlockIndex, uniformBlockBinding);
+    setDirtyBit(DIRTY_BIT_UNIFORM_BLOCK_BINDINGS);
 }
 
 GLuint Program::getUniformBlockBinding(GLuint uniformBlockIndex) const
@@ -1708,31 +1732,26 @@ bool Program::linkVaryings(InfoLog &infoLog,
     const std::vector<sh::Varying> &vertexVaryings   = vertexShader->getVaryings();
     const std::vector<sh::Varying> &fragmentVaryings = fragmentShader->getVaryings();
 
+    const auto vertexVaryingsByName = IndexByName(vertexVaryings);
     std::map<GLuint, std::string> staticFragmentInputLocations;
 
     for (const sh::Varying &output : fragmentVaryings)
     {
-        bool matched = false;
-
         // Built-in varyings obey special rules
         if (output.isBuiltIn())
         {
             continue;
         }
 
-        for (const sh::Varying &input : vertexVaryings)
+        const auto input   = vertexVaryingsByName.find(output.name);
+        const bool matched = (input != vertexVaryingsByName.end());
+        if (matched)
         {
-            if (output.name == input.name)
+            ASSERT(!input->second->isBuiltIn());
+            if (!linkValidateVaryings(infoLog, output.name, *input->second, output,
+                                      vertexShader->getShaderVersion()))
             {
-                ASSERT(!input.isBuiltIn());
-                if (!linkValidateVaryings(infoLog, output.name, input, output,
-                                          vertexShader->getShaderVersion()))
-                {
-                    return false;
-                }
-
-                matched = true;
-                break;
+                return false;
             }
         }
 
@@ -1781,21 +1800,16 @@ bool Program::linkUniforms(gl::InfoLog &infoLog,
         mState.mAttachedFragmentShader->getUniforms();
 
     // Check that uniforms defined in the vertex and fragment shaders are identical
-    std::map<std::string, LinkedUniform> linkedUniforms;
-
-    for (const sh::Uniform &vertexUniform : vertexUniforms)
-    {
-        linkedUniforms[vertexUniform.name] = LinkedUniform(vertexUniform);
-    }
+    const auto vertexUniformsByName = IndexByName(vertexUniforms);
 
     for (const sh::Uniform &fragmentUniform : fragmentUniforms)
     {
-        auto entry = linkedUniforms.find(fragmentUniform.name);
-        if (entry != linkedUniforms.end())
+        auto entry = vertexUniformsByName.find(fragmentUniform.name);
+        if (entry != vertexUniformsByName.end())
         {
-            LinkedUniform *vertexUniform   = &entry->second;
-            const std::string &uniformName = "uniform '" + vertexUniform->name + "'";
-            if (!linkValidateUniforms(infoLog, uniformName, *vertexUniform, fragmentUniform))
+            const sh::Uniform &vertexUniform = *entry->second;
+            const std::string &uniformName   = "uniform '" + vertexUniform.name + "'";
+            if (!linkValidateUniforms(infoLog, uniformName, vertexUniform, fragmentUniform))
             {
                 return false;
             }
@@ -2043,14 +2057,11 @@ bool Program::linkUniformBlocks(InfoLog &infoLog, const Caps &caps)
     const std::vector<sh::InterfaceBlock> &fragmentInterfaceBlocks = fragmentShader.getInterfaceBlocks();
 
     // Check that interface blocks defined in the vertex and fragment shaders are identical
-    typedef std::map<std::string, const sh::InterfaceBlock*> UniformBlockMap;
-    UniformBlockMap linkedUniformBlocks;
+    const auto linkedUniformBlocks = IndexByName(vertexInterfaceBlocks);
 
     GLuint vertexBlockCount = 0;
     for (const sh::InterfaceBlock &vertexInterfaceBlock : vertexInterfaceBlocks)
     {
-        linkedUniformBlocks[vertexInterfaceBlock.name] = &vertexInterfaceBlock;
-
         // Note: shared and std140 layouts are always considered active
         if (vertexInterfaceBlock.staticUse || vertexInterfaceBlock.layout != sh::BLOCKLAYOUT_PACKED)
         {
@@ -2392,11 +2403,18 @@ bool Program::flattenUniformsAndCheckCaps(const Caps &caps, InfoLog &infoLog)
 
     std::vector<LinkedUniform> samplerUniforms;
 
+    // Names of the uniforms already flattened, in either list
+    std::unordered_set<std::string> flattenedNames;
+    for (const LinkedUniform &uniform : mState.mUniforms)
+    {
+        flattenedNames.insert(uniform.name);
+    }
+
     for (const sh::Uniform &uniform : vertexShader->getUniforms())
     {
         if (uniform.staticUse)
         {
-            vsCounts += flattenUniform(uniform, uniform.name, &samplerUniforms);
+            vsCounts += flattenUniform(uniform, uniform.name, &samplerUniforms, &flattenedNames);
         }
     }
 
@@ -2421,7 +2439,7 @@ bool Program::flattenUniformsAndCheckCaps(const Caps &caps, InfoLog &infoLog)
     {
         if (uniform.staticUse)
         {
-            fsCounts += flattenUniform(uniform, uniform.name, &samplerUniforms);
+            fsCounts += flattenUniform(uniform, uniform.name, &samplerUniforms, &flattenedNames);
         }
     }
 
@@ -2448,9 +2466,11 @@ bool Program::flattenUniformsAndCheckCaps(const Caps &caps, InfoLog &infoLog)
     return true;
 }
 
-Program::VectorAndSamplerCount Program::flattenUniform(const sh::ShaderVariable &uniform,
-                                                       const std::string &fullName,
-                                                       std::vector<LinkedUniform> *samplerUniforms)
+Program::VectorAndSamplerCount Program::flattenUniform(
+    const sh::ShaderVariable &uniform,
+    const std::string &fullName,
+    std::vector<LinkedUniform> *samplerUniforms,
+    std::unordered_set<std::string> *flattenedNames)
 {
     VectorAndSamplerCount vectorAndSamplerCount;
 
@@ -2465,7 +2485,8 @@ Program::VectorAndSamplerCount Program::flattenUniform(const sh::ShaderVariable
                 const sh::ShaderVariable &field  = uniform.fields[fieldIndex];
                 const std::string &fieldFullName = (fullName + elementString + "." + field.name);
 
-                vectorAndSamplerCount += flattenUniform(field, fieldFullName, samplerUniforms);
+                vectorAndSamplerCount +=
+                    flattenUniform(field, fieldFullName, samplerUniforms, flattenedNames);
             }
         }
 
@@ -2474,8 +2495,7 @@ Program::VectorAndSamplerCount Program::flattenUniform(const sh::ShaderVariable
 
     // Not a struct
     bool isSampler = IsSamplerType(uniform.type);
-    if (!UniformInList(mState.getUniforms(), fullName) &&
-        !UniformInList(*samplerUniforms, fullName))
+    if (flattenedNames->insert(fullName).second)
     {
         gl::LinkedUniform linkedUniform(uniform.type, uniform.precision, fullName,
                                         uniform.arraySize, -1,
@@ -2506,7 +2526,8 @@ Program::VectorAndSamplerCount Program::flattenUniform(const sh::ShaderVariable
 
 void Program::gatherInterfaceBlockInfo()
 {
-    std::set<std::string> visitedList;
+    // Range of mUniformBlocks defined for each block name, which holds one block per array element
+    std::unordered_map<std::string, std::pair<size_t, size_t>> visitedList;
 
     const gl::Shader *vertexShader = mState.getAttachedVertexShader();
 
@@ -2520,8 +2541,9 @@ void Program::gatherInterfaceBlockInfo()
         if (visitedList.count(vertexBlock.name) > 0)
             continue;
 
+        size_t firstBlock = mState.mUniformBlocks.size();
         defineUniformBlock(vertexBlock, GL_VERTEX_SHADER);
-        visitedList.insert(vertexBlock.name);
+        visitedList[vertexBlock.name] = std::make_pair(firstBlock, mState.mUniformBlocks.size());
     }
 
     const gl::Shader *fragmentShader = mState.getAttachedFragmentShader();
@@ -2532,21 +2554,21 @@ void Program::gatherInterfaceBlockInfo()
         if (!fragmentBlock.staticUse && fragmentBlock.layout == sh::BLOCKLAYOUT_PACKED)
             continue;
 
-        if (visitedList.count(fragmentBlock.name) > 0)
+        auto visited = visitedList.find(fragmentBlock.name);
+        if (visited != visitedList.end())
         {
-            for (gl::UniformBlock &block : mState.mUniformBlocks)
+            for (size_t blockIndex = visited->second.first; blockIndex < visited->second.second;
+                 ++blockIndex)
             {
-                if (block.name == fragmentBlock.name)
-                {
-                    block.fragmentStaticUse = fragmentBlock.staticUse;
-                }
+                mState.mUniformBlocks[blockIndex].fragmentStaticUse = fragmentBlock.staticUse;
             }
 
             continue;
         }
 
+        size_t firstBlock = mState.mUniformBlocks.size();
         defineUniformBlock(fragmentBlock, GL_FRAGMENT_SHADER);
-        visitedList.insert(fragmentBlock.name);
+        visitedList[fragmentBlock.name] = std::make_pair(firstBlock, mState.mUniformBlocks.size());
     }
 }
 
@@ -2683,6 +2705,7 @@ void Program::setUniformInternal(GLint location, GLsizei count, const T *v)
         if (linkedUniform->isSampler() && memcmp(destPointer, v, sizeof(T) * count) != 0)
         {
             mCachedValidateSamplersResult.reset();
+            setDirtyBit(DIRTY_BIT_SAMPLER_BINDINGS);
         }
 
         memcpy(destPointer, v, sizeof(T) * count);
@@ -13,12 +13,15 @@
 #include <GLES2/gl2.h>
 #include <GLSLANG/ShaderLang.h>
 
+#include <bitset>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "common/mathutil.h"
 #include "common/Optional.h"
 
@@ -27,6 +30,7 @@
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/signal_utils.h"
 
 namespace rx
 {
@@ -355,6 +359,24 @@ class Program final : angle::NonCopyable, public LabeledObject
         return mState.mActiveAttribLocationsMask;
     }
 
+    enum DirtyBitType
+    {
+        DIRTY_BIT_UNIFORM_BLOCK_BINDINGS,
+        DIRTY_BIT_SAMPLER_BINDINGS,
+
+        DIRTY_BIT_UNKNOWN,
+        DIRTY_BIT_MAX = DIRTY_BIT_UNKNOWN,
+    };
+
+    typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
+
+    // Pushes the resource binding changes made since the last sync to the implementation.
+    void syncImplState();
+    bool hasAnyDirtyBit() const { return mDirtyBits.any(); }
+
+    // Signaled on every binding change, for the States of all the contexts using the program.
+    angle::BroadcastChannel *getDirtyBitsChannel() { return &mDirtyBitsChannel; }
+
   private:
     class Bindings final : angle::NonCopyable
     {
@@ -427,7 +449,8 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     VectorAndSamplerCount flattenUniform(const sh::ShaderVariable &uniform,
                                          const std::string &fullName,
-                                         std::vector<LinkedUniform> *samplerUniforms);
+                                         std::vector<LinkedUniform> *samplerUniforms,
+                                         std::unordered_set<std::string> *flattenedNames);
 
     void gatherInterfaceBlockInfo();
     template <typename VarT>
@@ -446,7 +469,11 @@ class Program final : angle::NonCopyable, public LabeledObject
     template <typename DestT>
     void getUniformInternal(GLint location, DestT *dataOut) const;
 
+    void setDirtyBit(DirtyBitType dirtyBit);
+
     ProgramState mState;
+    DirtyBits mDirtyBits;
+    angle::BroadcastChannel mDirtyBitsChannel;
     rx::ProgramImpl *mProgram;
 
     bool mValidated;
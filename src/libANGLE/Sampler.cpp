@@ -16,7 +16,7 @@ namespace gl
 {
 
 Sampler::Sampler(rx::GLImplFactory *factory, GLuint id)
-    : RefCountObject(id), mImpl(factory->createSampler()), mLabel(), mSamplerState()
+    : RefCountObject(id), mImpl(factory->createSampler()), mLabel(), mSamplerState(), mDirtyBits()
 {
 }
 
@@ -38,6 +38,7 @@ const std::string &Sampler::getLabel() const
 void Sampler::setMinFilter(GLenum minFilter)
 {
     mSamplerState.minFilter = minFilter;
+    setDirtyBit(DIRTY_BIT_MIN_FILTER);
 }
 
 GLenum Sampler::getMinFilter() const
@@ -48,6 +49,7 @@ GLenum Sampler::getMinFilter() const
 void Sampler::setMagFilter(GLenum magFilter)
 {
     mSamplerState.magFilter = magFilter;
+    setDirtyBit(DIRTY_BIT_MAG_FILTER);
 }
 
 GLenum Sampler::getMagFilter() const
@@ -58,6 +60,7 @@ GLenum Sampler::getMagFilter() const
 void Sampler::setWrapS(GLenum wrapS)
 {
     mSamplerState.wrapS = wrapS;
+    setDirtyBit(DIRTY_BIT_WRAP_S);
 }
 
 GLenum Sampler::getWrapS() const
@@ -68,6 +71,7 @@ GLenum Sampler::getWrapS() const
 void Sampler::setWrapT(GLenum wrapT)
 {
     mSamplerState.wrapT = wrapT;
+    setDirtyBit(DIRTY_BIT_WRAP_T);
 }
 
 GLenum Sampler::getWrapT() const
@@ -78,6 +82,7 @@ GLenum Sampler::getWrapT() const
 void Sampler::setWrapR(GLenum wrapR)
 {
     mSamplerState.wrapR = wrapR;
+    setDirtyBit(DIRTY_BIT_WRAP_R);
 }
 
 GLenum Sampler::getWrapR() const
@@ -88,6 +93,7 @@ GLenum Sampler::getWrapR() const
 void Sampler::setMaxAnisotropy(float maxAnisotropy)
 {
     mSamplerState.maxAnisotropy = maxAnisotropy;
+    setDirtyBit(DIRTY_BIT_MAX_ANISOTROPY);
 }
 
 float Sampler::getMaxAnisotropy() const
@@ -98,6 +104,7 @@ float Sampler::getMaxAnisotropy() const
 void Sampler::setMinLod(GLfloat minLod)
 {
     mSamplerState.minLod = minLod;
+    setDirtyBit(DIRTY_BIT_MIN_LOD);
 }
 
 GLfloat Sampler::getMinLod() const
@@ -108,6 +115,7 @@ GLfloat Sampler::getMinLod() const
 void Sampler::setMaxLod(GLfloat maxLod)
 {
     mSamplerState.maxLod = maxLod;
+    setDirtyBit(DIRTY_BIT_MAX_LOD);
 }
 
 GLfloat Sampler::getMaxLod() const
@@ -118,6 +126,7 @@ GLfloat Sampler::getMaxLod() const
 void Sampler::setCompareMode(GLenum compareMode)
 {
     mSamplerState.compareMode = compareMode;
+    setDirtyBit(DIRTY_BIT_COMPARE_MODE);
 }
 
 GLenum Sampler::getCompareMode() const
@@ -128,6 +137,7 @@ GLenum Sampler::getCompareMode() const
 void Sampler::setCompareFunc(GLenum compareFunc)
 {
     mSamplerState.compareFunc = compareFunc;
+    setDirtyBit(DIRTY_BIT_COMPARE_FUNC);
 }
 
 GLenum Sampler::getCompareFunc() const
@@ -149,4 +159,19 @@ rx::SamplerImpl *Sampler::getImplementation()
 {
     return mImpl;
 }
+
+void Sampler::setDirtyBit(DirtyBitType dirtyBit)
+{
+    mDirtyBits.set(dirtyBit);
+    mDirtyBitsChannel.signal();
+}
+
+void Sampler::syncImplState()
+{
+    if (mDirtyBits.any())
+    {
+        mImpl->syncState(mSamplerState, mDirtyBits);
+        mDirtyBits.reset();
+    }
+}
 }
@@ -10,9 +10,11 @@
 #ifndef LIBANGLE_SAMPLER_H_
 #define LIBANGLE_SAMPLER_H_
 
+#include "common/bitset_utils.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/signal_utils.h"
 
 namespace rx
 {
@@ -67,12 +69,42 @@ class Sampler final : public RefCountObject, public LabeledObject
     const rx::SamplerImpl *getImplementation() const;
     rx::SamplerImpl *getImplementation();
 
+    enum DirtyBitType
+    {
+        DIRTY_BIT_MIN_FILTER,
+        DIRTY_BIT_MAG_FILTER,
+        DIRTY_BIT_WRAP_S,
+        DIRTY_BIT_WRAP_T,
+        DIRTY_BIT_WRAP_R,
+        DIRTY_BIT_MAX_ANISOTROPY,
+        DIRTY_BIT_MIN_LOD,
+        DIRTY_BIT_MAX_LOD,
+        DIRTY_BIT_COMPARE_MODE,
+        DIRTY_BIT_COMPARE_FUNC,
+
+        DIRTY_BIT_UNKNOWN,
+        DIRTY_BIT_MAX = DIRTY_BIT_UNKNOWN,
+    };
+
+    typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
+
+    // Pushes the parameters changed since the last sync to the implementation.
+    void syncImplState();
+    bool hasAnyDirtyBit() const { return mDirtyBits.any(); }
+
+    // Signaled on every parameter change, for the States of all the contexts binding the sampler.
+    angle::BroadcastChannel *getDirtyBitsChannel() { return &mDirtyBitsChannel; }
+
   private:
+    void setDirtyBit(DirtyBitType dirtyBit);
+
     rx::SamplerImpl *mImpl;
 
     std::string mLabel;
 
     SamplerState mSamplerState;
+    DirtyBits mDirtyBits;
+    angle::BroadcastChannel mDirtyBitsChannel;
 };
 
 }
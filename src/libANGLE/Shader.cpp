@@ -10,8 +10,10 @@
 
 #include "libANGLE/Shader.h"
 
+#include <atomic>
 #include <sstream>
 
+#include "common/WorkerPool.h"
 #include "common/utilities.h"
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Caps.h"
@@ -94,13 +96,17 @@ Shader::Shader(ResourceManager *manager,
       mRefCount(0),
       mDeleteStatus(false),
       mCompiled(false),
-      mResourceManager(manager)
+      mResourceManager(manager),
+      mCompilePending(false),
+      mPendingCompileOptions(0),
+      mTranslated(false)
 {
     ASSERT(mImplementation);
 }
 
 Shader::~Shader()
 {
+    mBoundCompiler.set(nullptr);
     SafeDelete(mImplementation);
 }
 
@@ -138,8 +144,10 @@ void Shader::setSource(GLsizei count, const char *const *string, const GLint *le
     mState.mSource = stream.str();
 }
 
-int Shader::getInfoLogLength() const
+int Shader::getInfoLogLength()
 {
+    resolveCompile();
+
     if (mInfoLog.empty())
     {
         return 0;
@@ -148,8 +156,10 @@ int Shader::getInfoLogLength() const
     return (static_cast<int>(mInfoLog.length()) + 1);
 }
 
-void Shader::getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog) const
+void Shader::getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog)
 {
+    resolveCompile();
+
     int index = 0;
 
     if (bufSize > 0)
@@ -171,8 +181,10 @@ int Shader::getSourceLength() const
     return mState.mSource.empty() ? 0 : (static_cast<int>(mState.mSource.length()) + 1);
 }
 
-int Shader::getTranslatedSourceLength() const
+int Shader::getTranslatedSourceLength()
 {
+    resolveCompile();
+
     if (mState.mTranslatedSource.empty())
     {
         return 0;
@@ -181,8 +193,10 @@ int Shader::getTranslatedSourceLength() const
     return (static_cast<int>(mState.mTranslatedSource.length()) + 1);
 }
 
-int Shader::getTranslatedSourceWithDebugInfoLength() const
+int Shader::getTranslatedSourceWithDebugInfoLength()
 {
+    resolveCompile();
+
     const std::string &debugInfo = mImplementation->getDebugInfo();
     if (debugInfo.empty())
     {
@@ -215,13 +229,16 @@ void Shader::getSource(GLsizei bufSize, GLsizei *length, char *buffer) const
     getSourceImpl(mState.mSource, bufSize, length, buffer);
 }
 
-void Shader::getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer) const
+void Shader::getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer)
 {
+    resolveCompile();
     getSourceImpl(mState.mTranslatedSource, bufSize, length, buffer);
 }
 
-void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer) const
+void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer)
 {
+    resolveCompile();
+
     const std::string &debugInfo = mImplementation->getDebugInfo();
     getSourceImpl(debugInfo, bufSize, length, buffer);
 }
@@ -237,41 +254,114 @@ void Shader::compile(Compiler *compiler)
     mState.mActiveAttributes.clear();
     mState.mActiveOutputVariables.clear();
 
-    ShHandle compilerHandle = compiler->getCompilerHandle(mState.mShaderType);
-
     std::stringstream sourceStream;
 
-    std::string sourcePath;
+    mPendingSourcePath.clear();
     int additionalOptions =
-        mImplementation->prepareSourceAndReturnOptions(&sourceStream, &sourcePath);
-    int compileOptions    = (SH_OBJECT_CODE | SH_VARIABLES | additionalOptions);
+        mImplementation->prepareSourceAndReturnOptions(&sourceStream, &mPendingSourcePath);
+    mPendingCompileOptions = (SH_OBJECT_CODE | SH_VARIABLES | additionalOptions);
 
     // Some targets (eg D3D11 Feature Level 9_3 and below) do not support non-constant loop indexes
     // in fragment shaders. Shader compilation will fail. To provide a better error message we can
     // instruct the compiler to pre-validate.
     if (mRendererLimitations.shadersRequireIndexedLoopValidation)
     {
-        compileOptions |= SH_VALIDATE_LOOP_INDEXING;
+        mPendingCompileOptions |= SH_VALIDATE_LOOP_INDEXING;
+    }
+
+    mPendingSource = sourceStream.str();
+
+    mCompiled       = false;
+    mTranslated     = false;
+    mCompilePending = true;
+    mBoundCompiler.set(compiler);
+}
+
+void Shader::resolveCompile()
+{
+    if (!mCompilePending)
+    {
+        return;
+    }
+
+    ShHandle compilerHandle = mBoundCompiler->acquireCompilerHandle(mState.mShaderType);
+    translate(compilerHandle);
+    finishCompile(compilerHandle);
+}
+
+void Shader::resolveCompiles(const std::vector<Shader *> &shaders)
+{
+    std::vector<Shader *> pendingShaders;
+    for (Shader *shader : shaders)
+    {
+        if (shader != nullptr && shader->mCompilePending)
+        {
+            pendingShaders.push_back(shader);
+        }
+    }
+
+    if (pendingShaders.size() < 2)
+    {
+        for (Shader *shader : pendingShaders)
+        {
+            shader->resolveCompile();
+        }
+        return;
+    }
+
+    // The handles are acquired up front, since the compiler's handle pool is not thread safe.
+    std::vector<ShHandle> compilerHandles;
+    for (Shader *shader : pendingShaders)
+    {
+        compilerHandles.push_back(
+            shader->mBoundCompiler->acquireCompilerHandle(shader->mState.mShaderType));
     }
 
-    std::string sourceString  = sourceStream.str();
+    // Translate on the shared worker pool, or on this thread alone when the pool is busy.
+    std::atomic<size_t> nextShader(0);
+    auto translateShaders = [&pendingShaders, &compilerHandles, &nextShader]() {
+        size_t shaderIndex;
+        while ((shaderIndex = nextShader.fetch_add(1)) < pendingShaders.size())
+        {
+            pendingShaders[shaderIndex]->translate(compilerHandles[shaderIndex]);
+        }
+    };
+    if (!angle::WorkerPool::Get()->run(translateShaders))
+    {
+        translateShaders();
+    }
+
+    for (size_t shaderIndex = 0; shaderIndex < pendingShaders.size(); ++shaderIndex)
+    {
+        pendingShaders[shaderIndex]->finishCompile(compilerHandles[shaderIndex]);
+    }
+}
+
+bool Shader::isCompiled()
+{
+    resolveCompile();
+    return mCompiled;
+}
+
+void Shader::translate(ShHandle compilerHandle)
+{
+    ASSERT(mCompilePending);
+
     std::vector<const char *> sourceCStrings;
 
-    if (!sourcePath.empty())
+    if (!mPendingSourcePath.empty())
     {
-        sourceCStrings.push_back(sourcePath.c_str());
+        sourceCStrings.push_back(mPendingSourcePath.c_str());
     }
 
-    sourceCStrings.push_back(sourceString.c_str());
+    sourceCStrings.push_back(mPendingSource.c_str());
 
-    bool result =
-        ShCompile(compilerHandle, &sourceCStrings[0], sourceCStrings.size(), compileOptions);
+    bool result = ShCompile(compilerHandle, &sourceCStrings[0], sourceCStrings.size(),
+                            mPendingCompileOptions);
 
     if (!result)
     {
         mInfoLog = ShGetInfoLog(compilerHandle);
-        TRACE("\n%s", mInfoLog.c_str());
-        mCompiled = false;
         return;
     }
 
@@ -322,7 +412,31 @@ void Shader::compile(Compiler *compiler)
 
     ASSERT(!mState.mTranslatedSource.empty());
 
-    mCompiled = mImplementation->postTranslateCompile(compiler, &mInfoLog);
+    mTranslated = true;
+}
+
+void Shader::finishCompile(ShHandle compilerHandle)
+{
+    ASSERT(mCompilePending);
+
+    Compiler *compiler = mBoundCompiler.get();
+
+    if (mTranslated)
+    {
+        mCompiled = mImplementation->postTranslateCompile(compiler, compilerHandle, &mInfoLog);
+    }
+    else
+    {
+        TRACE("\n%s", mInfoLog.c_str());
+        mCompiled = false;
+    }
+
+    compiler->returnCompilerHandle(mState.mShaderType, compilerHandle);
+
+    mCompilePending = false;
+    mPendingSource.clear();
+    mPendingSourcePath.clear();
+    mBoundCompiler.set(nullptr);
 }
 
 void Shader::addRef()
@@ -22,6 +22,7 @@
 #include "common/angleutils.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/RefCountObject.h"
 
 namespace rx
 {
@@ -98,18 +99,25 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     void deleteSource();
     void setSource(GLsizei count, const char *const *string, const GLint *length);
-    int getInfoLogLength() const;
-    void getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog) const;
+    int getInfoLogLength();
+    void getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog);
     int getSourceLength() const;
     void getSource(GLsizei bufSize, GLsizei *length, char *buffer) const;
-    int getTranslatedSourceLength() const;
-    int getTranslatedSourceWithDebugInfoLength() const;
+    int getTranslatedSourceLength();
+    int getTranslatedSourceWithDebugInfoLength();
     const std::string &getTranslatedSource() const { return mState.getTranslatedSource(); }
-    void getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer) const;
-    void getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer) const;
+    void getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer);
+    void getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer);
 
+    // Compiling is deferred until the results are needed, so that the compiles of the shaders of
+    // a program can run concurrently when it is linked. The translated source and the variables
+    // of the shader are only valid after resolveCompile().
     void compile(Compiler *compiler);
-    bool isCompiled() const { return mCompiled; }
+    void resolveCompile();
+    bool isCompiled();
+
+    // Resolves the deferred compiles of the given shaders, translating them concurrently.
+    static void resolveCompiles(const std::vector<Shader *> &shaders);
 
     void addRef();
     void release();
@@ -130,6 +138,11 @@ class Shader final : angle::NonCopyable, public LabeledObject
   private:
     static void getSourceImpl(const std::string &source, GLsizei bufSize, GLsizei *length, char *buffer);
 
+    // Translates the pending compile with the given compiler handle. Can run on any thread.
+    void translate(ShHandle compilerHandle);
+    // Completes the pending compile on the context's thread after translate().
+    void finishCompile(ShHandle compilerHandle);
+
     ShaderState mState;
     rx::ShaderImpl *mImplementation;
     const gl::Limitations &mRendererLimitations;
@@ -141,6 +154,14 @@ class Shader final : angle::NonCopyable, public LabeledObject
     std::string mInfoLog;
 
     ResourceManager *mResourceManager;
+
+    // State of the deferred compile, set by compile() and cleared by resolveCompile().
+    bool mCompilePending;
+    BindingPointer<Compiler> mBoundCompiler;
+    std::string mPendingSource;
+    std::string mPendingSourcePath;
+    int mPendingCompileOptions;
+    bool mTranslated;
 };
 
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y);
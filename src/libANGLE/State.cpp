@@ -11,7 +11,6 @@
 #include <limits>
 #include <string.h>
 
-#include "common/BitSetIterator.h"
 #include "common/matrix_utils.h"
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
@@ -59,7 +58,8 @@ State::State()
       mActiveSampler(0),
       mPrimitiveRestart(false),
       mMultiSampling(false),
-      mSampleAlphaToOne(false)
+      mSampleAlphaToOne(false),
+      mProgramChannel(this, DIRTY_OBJECT_PROGRAM)
 {
 }
 
@@ -172,6 +172,21 @@ void State::initialize(const Caps &caps,
 
     mSamplers.resize(caps.maxCombinedTextureImageUnits);
 
+    for (const auto &bindingVec : mSamplerTextures)
+    {
+        auto &channels = mSamplerTextureChannels[bindingVec.first];
+        channels.reserve(bindingVec.second.size());
+        for (size_t textureUnit = 0; textureUnit < bindingVec.second.size(); ++textureUnit)
+        {
+            channels.emplace_back(this, DIRTY_OBJECT_TEXTURES);
+        }
+    }
+    mSamplerChannels.reserve(mSamplers.size());
+    for (size_t textureUnit = 0; textureUnit < mSamplers.size(); ++textureUnit)
+    {
+        mSamplerChannels.emplace_back(this, DIRTY_OBJECT_SAMPLERS);
+    }
+
     mActiveQueries[GL_ANY_SAMPLES_PASSED].set(nullptr);
     mActiveQueries[GL_ANY_SAMPLES_PASSED_CONSERVATIVE].set(nullptr);
     mActiveQueries[GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN].set(nullptr);
@@ -210,17 +225,18 @@ void State::reset()
         TextureBindingVector &textureVector = bindingVec->second;
         for (size_t textureIdx = 0; textureIdx < textureVector.size(); textureIdx++)
         {
-            textureVector[textureIdx].set(NULL);
+            setSamplerTextureBinding(bindingVec->first, textureIdx, nullptr);
         }
     }
     for (size_t samplerIdx = 0; samplerIdx < mSamplers.size(); samplerIdx++)
     {
-        mSamplers[samplerIdx].set(NULL);
+        setSamplerBindingInternal(samplerIdx, nullptr);
     }
 
     mArrayBuffer.set(NULL);
     mRenderbuffer.set(NULL);
 
+    mProgramChannel.reset();
     if (mProgram)
     {
         mProgram->release();
@@ -714,7 +730,21 @@ unsigned int State::getActiveSampler() const
 
 void State::setSamplerTexture(GLenum type, Texture *texture)
 {
-    mSamplerTextures[type][mActiveSampler].set(texture);
+    setSamplerTextureBinding(type, mActiveSampler, texture);
+    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+
+    // Changes made to the texture while it was unbound become visible once it is bound.
+    if (texture && texture->hasAnyDirtyBit())
+    {
+        mDirtyObjects.set(DIRTY_OBJECT_TEXTURES);
+    }
+}
+
+void State::setSamplerTextureBinding(GLenum type, size_t textureUnit, Texture *texture)
+{
+    mSamplerTextureChannels[type][textureUnit].bind(texture ? texture->getDirtyBitsChannel()
+                                                            : nullptr);
+    mSamplerTextures[type][textureUnit].set(texture);
 }
 
 Texture *State::getTargetTexture(GLenum target) const
@@ -761,7 +791,8 @@ void State::detachTexture(const TextureMap &zeroTextures, GLuint texture)
                 auto it = zeroTextures.find(textureType);
                 ASSERT(it != zeroTextures.end());
                 // Zero textures are the "default" textures instead of NULL
-                binding.set(it->second.get());
+                setSamplerTextureBinding(textureType, textureIdx, it->second.get());
+                mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
             }
         }
     }
@@ -790,13 +821,27 @@ void State::initializeZeroTextures(const TextureMap &zeroTextures)
 
         for (size_t textureUnit = 0; textureUnit < samplerTextureArray.size(); ++textureUnit)
         {
-            samplerTextureArray[textureUnit].set(zeroTexture.second.get());
+            setSamplerTextureBinding(zeroTexture.first, textureUnit, zeroTexture.second.get());
         }
     }
+
+    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 void State::setSamplerBinding(GLuint textureUnit, Sampler *sampler)
 {
+    setSamplerBindingInternal(textureUnit, sampler);
+    mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+
+    if (sampler && sampler->hasAnyDirtyBit())
+    {
+        mDirtyObjects.set(DIRTY_OBJECT_SAMPLERS);
+    }
+}
+
+void State::setSamplerBindingInternal(size_t textureUnit, Sampler *sampler)
+{
+    mSamplerChannels[textureUnit].bind(sampler ? sampler->getDirtyBitsChannel() : nullptr);
     mSamplers[textureUnit].set(sampler);
 }
 
@@ -822,7 +867,8 @@ void State::detachSampler(GLuint sampler)
         BindingPointer<Sampler> &samplerBinding = mSamplers[textureUnit];
         if (samplerBinding.id() == sampler)
         {
-            samplerBinding.set(NULL);
+            setSamplerBindingInternal(textureUnit, nullptr);
+            mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
         }
     }
 }
@@ -990,6 +1036,8 @@ void State::setProgram(Program *newProgram)
 {
     if (mProgram != newProgram)
     {
+        mProgramChannel.bind(newProgram ? newProgram->getDirtyBitsChannel() : nullptr);
+
         if (mProgram)
         {
             mProgram->release();
@@ -1000,6 +1048,12 @@ void State::setProgram(Program *newProgram)
         if (mProgram)
         {
             newProgram->addRef();
+
+            // Binding changes made while the program was not current are applied on first use.
+            if (mProgram->hasAnyDirtyBit())
+            {
+                mDirtyObjects.set(DIRTY_OBJECT_PROGRAM);
+            }
         }
     }
 }
@@ -1102,6 +1156,7 @@ void State::setGenericUniformBufferBinding(Buffer *buffer)
 void State::setIndexedUniformBufferBinding(GLuint index, Buffer *buffer, GLintptr offset, GLsizeiptr size)
 {
     mUniformBuffers[index].set(buffer, offset, size);
+    mDirtyBits.set(DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
 }
 
 const OffsetBindingPointer<Buffer> &State::getIndexedUniformBuffer(size_t index) const
@@ -1894,7 +1949,7 @@ void State::syncDirtyObjects()
 
 void State::syncDirtyObjects(const DirtyObjects &bitset)
 {
-    for (auto dirtyObject : angle::IterateBitSet(bitset))
+    for (auto dirtyObject : bitset)
     {
         switch (dirtyObject)
         {
@@ -1910,8 +1965,17 @@ void State::syncDirtyObjects(const DirtyObjects &bitset)
                 ASSERT(mVertexArray);
                 mVertexArray->syncImplState();
                 break;
+            case DIRTY_OBJECT_TEXTURES:
+                syncTextures();
+                break;
+            case DIRTY_OBJECT_SAMPLERS:
+                syncSamplers();
+                break;
             case DIRTY_OBJECT_PROGRAM:
-                // TODO(jmadill): implement this
+                if (mProgram)
+                {
+                    mProgram->syncImplState();
+                }
                 break;
             default:
                 UNREACHABLE();
@@ -1922,6 +1986,33 @@ void State::syncDirtyObjects(const DirtyObjects &bitset)
     mDirtyObjects &= ~bitset;
 }
 
+void State::syncTextures()
+{
+    for (auto &bindingVec : mSamplerTextures)
+    {
+        for (BindingPointer<Texture> &binding : bindingVec.second)
+        {
+            Texture *texture = binding.get();
+            if (texture && texture->hasAnyDirtyBit())
+            {
+                texture->syncImplState();
+            }
+        }
+    }
+}
+
+void State::syncSamplers()
+{
+    for (BindingPointer<Sampler> &binding : mSamplers)
+    {
+        Sampler *sampler = binding.get();
+        if (sampler && sampler->hasAnyDirtyBit())
+        {
+            sampler->syncImplState();
+        }
+    }
+}
+
 void State::syncDirtyObject(GLenum target)
 {
     DirtyObjects localSet;
@@ -1941,6 +2032,12 @@ void State::syncDirtyObject(GLenum target)
         case GL_VERTEX_ARRAY:
             localSet.set(DIRTY_OBJECT_VERTEX_ARRAY);
             break;
+        case GL_TEXTURE:
+            localSet.set(DIRTY_OBJECT_TEXTURES);
+            break;
+        case GL_SAMPLER:
+            localSet.set(DIRTY_OBJECT_SAMPLERS);
+            break;
         case GL_PROGRAM:
             localSet.set(DIRTY_OBJECT_PROGRAM);
             break;
@@ -1966,10 +2063,22 @@ void State::setObjectDirty(GLenum target)
         case GL_VERTEX_ARRAY:
             mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
             break;
+        case GL_TEXTURE:
+            mDirtyObjects.set(DIRTY_OBJECT_TEXTURES);
+            break;
+        case GL_SAMPLER:
+            mDirtyObjects.set(DIRTY_OBJECT_SAMPLERS);
+            break;
         case GL_PROGRAM:
             mDirtyObjects.set(DIRTY_OBJECT_PROGRAM);
             break;
     }
 }
 
+void State::signal(angle::SignalToken token)
+{
+    // The token is the dirty object bit of the bound object's type.
+    mDirtyObjects.set(token);
+}
+
 }  // namespace gl
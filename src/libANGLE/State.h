@@ -9,10 +9,10 @@
 #ifndef LIBANGLE_STATE_H_
 #define LIBANGLE_STATE_H_
 
-#include <bitset>
 #include <memory>
 
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "common/Color.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/Program.h"
@@ -33,7 +33,7 @@ struct Caps;
 
 typedef std::map<GLenum, BindingPointer<Texture>> TextureMap;
 
-class State : angle::NonCopyable
+class State : angle::NonCopyable, public angle::SignalReceiver
 {
   public:
     State();
@@ -353,6 +353,9 @@ class State : angle::NonCopyable
         DIRTY_BIT_RENDERBUFFER_BINDING,
         DIRTY_BIT_VERTEX_ARRAY_BINDING,
         DIRTY_BIT_PROGRAM_BINDING,
+        DIRTY_BIT_TEXTURE_BINDINGS,
+        DIRTY_BIT_SAMPLER_BINDINGS,
+        DIRTY_BIT_UNIFORM_BUFFER_BINDINGS,
         DIRTY_BIT_MULTISAMPLING,
         DIRTY_BIT_SAMPLE_ALPHA_TO_ONE,
         DIRTY_BIT_COVERAGE_MODULATION,         // CHROMIUM_framebuffer_mixed_samples
@@ -371,18 +374,20 @@ class State : angle::NonCopyable
         DIRTY_OBJECT_READ_FRAMEBUFFER,
         DIRTY_OBJECT_DRAW_FRAMEBUFFER,
         DIRTY_OBJECT_VERTEX_ARRAY,
+        DIRTY_OBJECT_TEXTURES,
+        DIRTY_OBJECT_SAMPLERS,
         DIRTY_OBJECT_PROGRAM,
         DIRTY_OBJECT_UNKNOWN,
         DIRTY_OBJECT_MAX = DIRTY_OBJECT_UNKNOWN,
     };
 
-    typedef std::bitset<DIRTY_BIT_MAX> DirtyBits;
+    typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
     void clearDirtyBits() { mDirtyBits.reset(); }
     void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
     void setAllDirtyBits() { mDirtyBits.set(); }
 
-    typedef std::bitset<DIRTY_OBJECT_MAX> DirtyObjects;
+    typedef angle::BitSet<DIRTY_OBJECT_MAX> DirtyObjects;
     void clearDirtyObjects() { mDirtyObjects.reset(); }
     void setAllDirtyObjects() { mDirtyObjects.set(); }
     void syncDirtyObjects();
@@ -390,7 +395,17 @@ class State : angle::NonCopyable
     void syncDirtyObject(GLenum target);
     void setObjectDirty(GLenum target);
 
+    // SignalReceiver implementation, for the changes made to the bound textures, samplers and
+    // program. These objects can be shared, and changed through the State of another context.
+    void signal(angle::SignalToken token) override;
+
   private:
+    void setSamplerTextureBinding(GLenum type, size_t textureUnit, Texture *texture);
+    void setSamplerBindingInternal(size_t textureUnit, Sampler *sampler);
+
+    void syncTextures();
+    void syncSamplers();
+
     // Cached values from Context's caps
     GLuint mMaxDrawBuffers;
     GLuint mMaxCombinedTextureImageUnits;
@@ -475,6 +490,11 @@ class State : angle::NonCopyable
 
     DirtyBits mDirtyBits;
     DirtyObjects mDirtyObjects;
+
+    // Parallel to mSamplerTextures, mSamplers and mProgram.
+    std::map<GLenum, std::vector<angle::ChannelBinding>> mSamplerTextureChannels;
+    std::vector<angle::ChannelBinding> mSamplerChannels;
+    angle::ChannelBinding mProgramChannel;
 };
 
 }  // namespace gl
@@ -161,13 +161,15 @@ bool TextureState::setBaseLevel(GLuint baseLevel)
     return false;
 }
 
-void TextureState::setMaxLevel(GLuint maxLevel)
+bool TextureState::setMaxLevel(GLuint maxLevel)
 {
     if (mMaxLevel != maxLevel)
     {
         mMaxLevel                     = maxLevel;
         mCompletenessCache.cacheValid = false;
+        return true;
     }
+    return false;
 }
 
 // Tests for cube texture completeness. [OpenGL ES 2.0.24] section 3.7.10 page 81.
@@ -527,6 +529,7 @@ GLenum Texture::getTarget() const
 void Texture::setSwizzleRed(GLenum swizzleRed)
 {
     mState.mSwizzleState.swizzleRed = swizzleRed;
+    setDirtyBit(DIRTY_BIT_SWIZZLE_RED);
 }
 
 GLenum Texture::getSwizzleRed() const
@@ -537,6 +540,7 @@ GLenum Texture::getSwizzleRed() const
 void Texture::setSwizzleGreen(GLenum swizzleGreen)
 {
     mState.mSwizzleState.swizzleGreen = swizzleGreen;
+    setDirtyBit(DIRTY_BIT_SWIZZLE_GREEN);
 }
 
 GLenum Texture::getSwizzleGreen() const
@@ -547,6 +551,7 @@ GLenum Texture::getSwizzleGreen() const
 void Texture::setSwizzleBlue(GLenum swizzleBlue)
 {
     mState.mSwizzleState.swizzleBlue = swizzleBlue;
+    setDirtyBit(DIRTY_BIT_SWIZZLE_BLUE);
 }
 
 GLenum Texture::getSwizzleBlue() const
@@ -557,6 +562,7 @@ GLenum Texture::getSwizzleBlue() const
 void Texture::setSwizzleAlpha(GLenum swizzleAlpha)
 {
     mState.mSwizzleState.swizzleAlpha = swizzleAlpha;
+    setDirtyBit(DIRTY_BIT_SWIZZLE_ALPHA);
 }
 
 GLenum Texture::getSwizzleAlpha() const
@@ -567,6 +573,7 @@ GLenum Texture::getSwizzleAlpha() const
 void Texture::setMinFilter(GLenum minFilter)
 {
     mState.mSamplerState.minFilter = minFilter;
+    setDirtyBit(DIRTY_BIT_MIN_FILTER);
 }
 
 GLenum Texture::getMinFilter() const
@@ -577,6 +584,7 @@ GLenum Texture::getMinFilter() const
 void Texture::setMagFilter(GLenum magFilter)
 {
     mState.mSamplerState.magFilter = magFilter;
+    setDirtyBit(DIRTY_BIT_MAG_FILTER);
 }
 
 GLenum Texture::getMagFilter() const
@@ -587,6 +595,7 @@ GLenum Texture::getMagFilter() const
 void Texture::setWrapS(GLenum wrapS)
 {
     mState.mSamplerState.wrapS = wrapS;
+    setDirtyBit(DIRTY_BIT_WRAP_S);
 }
 
 GLenum Texture::getWrapS() const
@@ -597,6 +606,7 @@ GLenum Texture::getWrapS() const
 void Texture::setWrapT(GLenum wrapT)
 {
     mState.mSamplerState.wrapT = wrapT;
+    setDirtyBit(DIRTY_BIT_WRAP_T);
 }
 
 GLenum Texture::getWrapT() const
@@ -607,6 +617,7 @@ GLenum Texture::getWrapT() const
 void Texture::setWrapR(GLenum wrapR)
 {
     mState.mSamplerState.wrapR = wrapR;
+    setDirtyBit(DIRTY_BIT_WRAP_R);
 }
 
 GLenum Texture::getWrapR() const
@@ -617,6 +628,7 @@ GLenum Texture::getWrapR() const
 void Texture::setMaxAnisotropy(float maxAnisotropy)
 {
     mState.mSamplerState.maxAnisotropy = maxAnisotropy;
+    setDirtyBit(DIRTY_BIT_MAX_ANISOTROPY);
 }
 
 float Texture::getMaxAnisotropy() const
@@ -627,6 +639,7 @@ float Texture::getMaxAnisotropy() const
 void Texture::setMinLod(GLfloat minLod)
 {
     mState.mSamplerState.minLod = minLod;
+    setDirtyBit(DIRTY_BIT_MIN_LOD);
 }
 
 GLfloat Texture::getMinLod() const
@@ -637,6 +650,7 @@ GLfloat Texture::getMinLod() const
 void Texture::setMaxLod(GLfloat maxLod)
 {
     mState.mSamplerState.maxLod = maxLod;
+    setDirtyBit(DIRTY_BIT_MAX_LOD);
 }
 
 GLfloat Texture::getMaxLod() const
@@ -647,6 +661,7 @@ GLfloat Texture::getMaxLod() const
 void Texture::setCompareMode(GLenum compareMode)
 {
     mState.mSamplerState.compareMode = compareMode;
+    setDirtyBit(DIRTY_BIT_COMPARE_MODE);
 }
 
 GLenum Texture::getCompareMode() const
@@ -657,6 +672,7 @@ GLenum Texture::getCompareMode() const
 void Texture::setCompareFunc(GLenum compareFunc)
 {
     mState.mSamplerState.compareFunc = compareFunc;
+    setDirtyBit(DIRTY_BIT_COMPARE_FUNC);
 }
 
 GLenum Texture::getCompareFunc() const
@@ -674,6 +690,9 @@ void Texture::setBaseLevel(GLuint baseLevel)
     if (mState.setBaseLevel(baseLevel))
     {
         mTexture->setBaseLevel(mState.getEffectiveBaseLevel());
+        setDirtyBit(DIRTY_BIT_BASE_LEVEL);
+        // The effective max level of immutable textures is clamped to the base level.
+        setDirtyBit(DIRTY_BIT_MAX_LEVEL);
     }
 }
 
@@ -684,7 +703,10 @@ GLuint Texture::getBaseLevel() const
 
 void Texture::setMaxLevel(GLuint maxLevel)
 {
-    mState.setMaxLevel(maxLevel);
+    if (mState.setMaxLevel(maxLevel))
+    {
+        setDirtyBit(DIRTY_BIT_MAX_LEVEL);
+    }
 }
 
 GLuint Texture::getMaxLevel() const
@@ -705,6 +727,7 @@ GLuint Texture::getImmutableLevels() const
 void Texture::setUsage(GLenum usage)
 {
     mState.mUsage = usage;
+    setDirtyBit(DIRTY_BIT_USAGE);
 }
 
 GLenum Texture::getUsage() const
@@ -913,6 +936,12 @@ Error Texture::setStorage(GLenum target, GLsizei levels, GLenum internalFormat,
     mState.mImmutableLevels = static_cast<GLuint>(levels);
     mState.clearImageDescs();
     mState.setImageDescChain(0, static_cast<GLuint>(levels - 1), size, Format(internalFormat));
+
+    // The effective base and max levels are now clamped to the immutable levels. Push them to the
+    // implementation right away instead of waiting for the next draw to sync this texture.
+    mDirtyBits.set(DIRTY_BIT_BASE_LEVEL);
+    mDirtyBits.set(DIRTY_BIT_MAX_LEVEL);
+    syncImplState();
     mDirtyChannel.signal();
 
     return NoError();
@@ -935,6 +964,8 @@ Error Texture::generateMipmap()
 
     if (maxLevel > baseLevel)
     {
+        // The implementation needs the current base and max levels to generate the mip chain.
+        syncImplState();
         ANGLE_TRY(mTexture->generateMipmap());
 
         const ImageDesc &baseImageInfo =
@@ -1083,6 +1114,21 @@ GLuint Texture::getId() const
     return id();
 }
 
+void Texture::setDirtyBit(DirtyBitType dirtyBit)
+{
+    mDirtyBits.set(dirtyBit);
+    mDirtyBitsChannel.signal();
+}
+
+void Texture::syncImplState()
+{
+    if (mDirtyBits.any())
+    {
+        mTexture->syncState(mDirtyBits);
+        mDirtyBits.reset();
+    }
+}
+
 rx::FramebufferAttachmentObjectImpl *Texture::getAttachmentImpl() const
 {
     return mTexture;
@@ -9,10 +9,11 @@
 #ifndef LIBANGLE_TEXTURE_H_
 #define LIBANGLE_TEXTURE_H_
 
-#include <vector>
 #include <map>
+#include <vector>
 
 #include "angle_gl.h"
+#include "common/bitset_utils.h"
 #include "common/debug.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Debug.h"
@@ -89,7 +90,8 @@ struct TextureState final : public angle::NonCopyable
 
     // Returns true if base level changed.
     bool setBaseLevel(GLuint baseLevel);
-    void setMaxLevel(GLuint maxLevel);
+    // Returns true if max level changed.
+    bool setMaxLevel(GLuint maxLevel);
 
     bool isCubeComplete() const;
     bool isSamplerComplete(const SamplerState &samplerState, const ContextState &data) const;
@@ -308,6 +310,42 @@ class Texture final : public egl::ImageSibling,
     rx::TextureImpl *getImplementation() { return mTexture; }
     const rx::TextureImpl *getImplementation() const { return mTexture; }
 
+    enum DirtyBitType
+    {
+        // Sampler state
+        DIRTY_BIT_MIN_FILTER,
+        DIRTY_BIT_MAG_FILTER,
+        DIRTY_BIT_WRAP_S,
+        DIRTY_BIT_WRAP_T,
+        DIRTY_BIT_WRAP_R,
+        DIRTY_BIT_MAX_ANISOTROPY,
+        DIRTY_BIT_MIN_LOD,
+        DIRTY_BIT_MAX_LOD,
+        DIRTY_BIT_COMPARE_MODE,
+        DIRTY_BIT_COMPARE_FUNC,
+
+        // Texture state
+        DIRTY_BIT_SWIZZLE_RED,
+        DIRTY_BIT_SWIZZLE_GREEN,
+        DIRTY_BIT_SWIZZLE_BLUE,
+        DIRTY_BIT_SWIZZLE_ALPHA,
+        DIRTY_BIT_BASE_LEVEL,
+        DIRTY_BIT_MAX_LEVEL,
+        DIRTY_BIT_USAGE,
+
+        DIRTY_BIT_UNKNOWN,
+        DIRTY_BIT_MAX = DIRTY_BIT_UNKNOWN,
+    };
+
+    typedef angle::BitSet<DIRTY_BIT_MAX> DirtyBits;
+
+    // Pushes the parameters changed since the last sync to the implementation.
+    void syncImplState();
+    bool hasAnyDirtyBit() const { return mDirtyBits.any(); }
+
+    // Signaled on every parameter change, for the States of all the contexts binding the texture.
+    angle::BroadcastChannel *getDirtyBitsChannel() { return &mDirtyBitsChannel; }
+
     // FramebufferAttachmentObject implementation
     Extents getAttachmentSize(const FramebufferAttachment::Target &target) const override;
     const Format &getAttachmentFormat(const FramebufferAttachment::Target &target) const override;
@@ -332,7 +370,11 @@ class Texture final : public egl::ImageSibling,
     void acquireImageFromStream(const egl::Stream::GLTextureDescription &desc);
     void releaseImageFromStream();
 
+    void setDirtyBit(DirtyBitType dirtyBit);
+
     TextureState mState;
+    DirtyBits mDirtyBits;
+    angle::BroadcastChannel mDirtyBitsChannel;
     rx::TextureImpl *mTexture;
 
     std::string mLabel;
@@ -245,6 +245,13 @@ static bool RequireESOrExt(GLuint clientVersion, const Extensions &extensions)
     return clientVersion >= minCoreGLVersion || extensions.*bool1;
 }
 
+// Check for a minimum client version and a single extension
+template <GLuint minCoreGLVersion, ExtensionBool bool1>
+static bool RequireESAndExt(GLuint clientVersion, const Extensions &extensions)
+{
+    return clientVersion >= minCoreGLVersion && extensions.*bool1;
+}
+
 // Check for a minimum client version or two extensions
 template <GLuint minCoreGLVersion, ExtensionBool bool1, ExtensionBool bool2>
 static bool RequireESOrExtAndExt(GLuint clientVersion, const Extensions &extensions)
@@ -717,6 +724,16 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
 
     // From GL_ANGLE_lossy_etc_decode
     map.insert(InternalFormatInfoPair(GL_ETC1_RGB8_LOSSY_DECODE_ANGLE, CompressedFormat(4, 4, 64, 3, GL_ETC1_RGB8_OES, GL_UNSIGNED_BYTE, false, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE,                        CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE,                        GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE,                 CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE,                 GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE,                       CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE,                       GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE,                CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE,                GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE,                      CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE,                      GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE,                     CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE,                     GL_UNSIGNED_BYTE, true,  RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,  CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,  GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE, CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE, GL_UNSIGNED_BYTE, true,  RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE,                 CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE,                 GL_UNSIGNED_BYTE, false, RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,          CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,          GL_UNSIGNED_BYTE, true,  RequireESAndExt<3, &Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported)));
 
     // From GL_EXT_texture_norm16
     //                 | Internal format     | R | G | B | A |S | Format         | Type                           | Component type        | SRGB | Texture supported                        | Renderable                               | Filterable    |
@@ -50,9 +50,16 @@ enum class Format::ID
     B8G8R8A8_UNORM,
     B8G8R8X8_UNORM,
     BC1_RGBA_UNORM_BLOCK,
+    BC1_RGBA_UNORM_SRGB_BLOCK,
     BC1_RGB_UNORM_BLOCK,
+    BC1_RGB_UNORM_SRGB_BLOCK,
     BC2_RGBA_UNORM_BLOCK,
     BC3_RGBA_UNORM_BLOCK,
+    BC3_RGBA_UNORM_SRGB_BLOCK,
+    BC4_RED_SNORM_BLOCK,
+    BC4_RED_UNORM_BLOCK,
+    BC5_RG_SNORM_BLOCK,
+    BC5_RG_UNORM_BLOCK,
     D16_UNORM,
     D24_UNORM,
     D24_UNORM_S8_UINT,
@@ -356,6 +356,15 @@ const Format &Format::Get(ID id)
                                      nullptr);
             return info;
         }
+        case ID::BC1_RGBA_UNORM_SRGB_BLOCK:
+        {
+            static const Format info(ID::BC1_RGBA_UNORM_SRGB_BLOCK,
+                                     GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,
+                                     GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
         case ID::BC1_RGB_UNORM_BLOCK:
         {
             static const Format info(ID::BC1_RGB_UNORM_BLOCK,
@@ -365,6 +374,15 @@ const Format &Format::Get(ID id)
                                      nullptr);
             return info;
         }
+        case ID::BC1_RGB_UNORM_SRGB_BLOCK:
+        {
+            static const Format info(ID::BC1_RGB_UNORM_SRGB_BLOCK,
+                                     GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE,
+                                     GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
         case ID::BC2_RGBA_UNORM_BLOCK:
         {
             static const Format info(ID::BC2_RGBA_UNORM_BLOCK,
@@ -383,6 +401,51 @@ const Format &Format::Get(ID id)
                                      nullptr);
             return info;
         }
+        case ID::BC3_RGBA_UNORM_SRGB_BLOCK:
+        {
+            static const Format info(ID::BC3_RGBA_UNORM_SRGB_BLOCK,
+                                     GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                     GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
+        case ID::BC4_RED_SNORM_BLOCK:
+        {
+            static const Format info(ID::BC4_RED_SNORM_BLOCK,
+                                     GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                     GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
+        case ID::BC4_RED_UNORM_BLOCK:
+        {
+            static const Format info(ID::BC4_RED_UNORM_BLOCK,
+                                     GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                     GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
+        case ID::BC5_RG_SNORM_BLOCK:
+        {
+            static const Format info(ID::BC5_RG_SNORM_BLOCK,
+                                     GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                     GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
+        case ID::BC5_RG_UNORM_BLOCK:
+        {
+            static const Format info(ID::BC5_RG_UNORM_BLOCK,
+                                     GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                     GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                     nullptr,
+                                     nullptr);
+            return info;
+        }
         case ID::D16_UNORM:
         {
             static const Format info(ID::D16_UNORM,
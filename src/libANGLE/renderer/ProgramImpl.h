@@ -71,6 +71,9 @@ class ProgramImpl : angle::NonCopyable
     // TODO: synchronize in syncState when dirty bits exist.
     virtual void setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding) = 0;
 
+    // Called before drawing with the program when its sampler or uniform block bindings changed.
+    virtual void syncState(const gl::Program::DirtyBits &dirtyBits) {}
+
     // May only be called after a successful link operation.
     // Return false for inactive blocks.
     virtual bool getUniformBlockSize(const std::string &blockName, size_t *sizeOut) const = 0;
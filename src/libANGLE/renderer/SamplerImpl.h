@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_SAMPLERIMPL_H_
 
 #include "common/angleutils.h"
+#include "libANGLE/Sampler.h"
 
 namespace rx
 {
@@ -19,6 +20,11 @@ class SamplerImpl : public angle::NonCopyable
   public:
     SamplerImpl() {}
     virtual ~SamplerImpl() {}
+
+    virtual void syncState(const gl::SamplerState &samplerState,
+                           const gl::Sampler::DirtyBits &dirtyBits)
+    {
+    }
 };
 }
 
@@ -25,7 +25,9 @@ class ShaderImpl : angle::NonCopyable
     virtual int prepareSourceAndReturnOptions(std::stringstream *sourceStream,
                                               std::string *sourcePath) = 0;
     // Returns success for compiling on the driver. Returns success.
-    virtual bool postTranslateCompile(gl::Compiler *compiler, std::string *infoLog) = 0;
+    virtual bool postTranslateCompile(gl::Compiler *compiler,
+                                      ShHandle compilerHandle,
+                                      std::string *infoLog) = 0;
 
     virtual std::string getDebugInfo() const = 0;
 
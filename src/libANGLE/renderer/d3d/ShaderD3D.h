@@ -30,7 +30,9 @@ class ShaderD3D : public ShaderImpl
     // ShaderImpl implementation
     int prepareSourceAndReturnOptions(std::stringstream *sourceStream,
                                       std::string *sourcePath) override;
-    bool postTranslateCompile(gl::Compiler *compiler, std::string *infoLog) override;
+    bool postTranslateCompile(gl::Compiler *compiler,
+                              ShHandle compilerHandle,
+                              std::string *infoLog) override;
     std::string getDebugInfo() const override;
 
     // D3D-specific methods
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/d3d/d3d11/Image11.h"
 
 #include "common/utilities.h"
+#include "image_util/loadimage_parallel.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
@@ -281,9 +282,10 @@ gl::Error Image11::loadData(const gl::Box &area,
     }
 
     uint8_t *offsetMappedData = (reinterpret_cast<uint8_t*>(mappedImage.pData) + (area.y * mappedImage.RowPitch + area.x * outputPixelSize + area.z * mappedImage.DepthPitch));
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t *>(input) + inputSkipBytes, inputRowPitch,
-                 inputDepthPitch, offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    angle::LoadImageParallel(loadFunction, 1, 1, area.width, area.height, area.depth,
+                             reinterpret_cast<const uint8_t *>(input) + inputSkipBytes,
+                             inputRowPitch, inputDepthPitch, offsetMappedData,
+                             mappedImage.RowPitch, mappedImage.DepthPitch);
 
     unmap();
 
@@ -323,9 +325,11 @@ gl::Error Image11::loadCompressedData(const gl::Box &area, const void *input)
                                                                            (area.x / outputBlockWidth) * outputPixelSize +
                                                                            area.z * mappedImage.DepthPitch);
 
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                 offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    angle::LoadImageParallel(loadFunction, formatInfo.compressedBlockHeight, outputBlockHeight,
+                             area.width, area.height, area.depth,
+                             reinterpret_cast<const uint8_t *>(input), inputRowPitch,
+                             inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                             mappedImage.DepthPitch);
 
     unmap();
 
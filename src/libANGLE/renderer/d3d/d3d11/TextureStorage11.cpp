@@ -14,6 +14,7 @@
 
 #include "common/MemoryBuffer.h"
 #include "common/utilities.h"
+#include "image_util/loadimage_parallel.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/ImageIndex.h"
 #include "libANGLE/renderer/d3d/d3d11/Blit11.h"
@@ -668,9 +669,9 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index,
     if (loadFunctionInfo.requiresConversion)
     {
         ANGLE_TRY(mRenderer->getScratchMemoryBuffer(neededSize, &conversionBuffer));
-        loadFunctionInfo.loadFunction(width, height, depth, pixelData + srcSkipBytes, srcRowPitch,
-                                      srcDepthPitch, conversionBuffer->data(), bufferRowPitch,
-                                      bufferDepthPitch);
+        angle::LoadImageParallel(loadFunctionInfo.loadFunction, 1, 1, width, height, depth,
+                                 pixelData + srcSkipBytes, srcRowPitch, srcDepthPitch,
+                                 conversionBuffer->data(), bufferRowPitch, bufferDepthPitch);
         data = conversionBuffer->data();
     }
     else
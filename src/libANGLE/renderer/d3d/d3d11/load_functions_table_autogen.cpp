@@ -212,6 +212,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC4_UNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadEACR11ToBC4, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RG11_EAC:
         {
             switch (dxgiFormat)
@@ -228,6 +244,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC5_UNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadEACRG11ToBC5, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RGB8_ETC2:
         {
             switch (dxgiFormat)
@@ -244,6 +276,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC1_UNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadETC2RGB8ToBC1, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
         {
             switch (dxgiFormat)
@@ -260,6 +308,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC1_UNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadETC2RGB8A1ToBC1, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RGBA8_ETC2_EAC:
         {
             switch (dxgiFormat)
@@ -276,6 +340,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC3_UNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadETC2RGBA8ToBC3, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
         {
             static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
@@ -324,6 +404,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC4_SNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadEACR11SToBC4, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SIGNED_RG11_EAC:
         {
             switch (dxgiFormat)
@@ -340,6 +436,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC5_SNORM:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadEACRG11SToBC5, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
         {
             switch (dxgiFormat)
@@ -356,6 +468,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC3_UNORM_SRGB:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadETC2SRGBA8ToBC3, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ETC2:
         {
             switch (dxgiFormat)
@@ -372,6 +500,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC1_UNORM_SRGB:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadETC2SRGB8ToBC1, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
         {
             switch (dxgiFormat)
@@ -388,6 +532,22 @@ const std::map<GLenum, LoadImageFunctionInfo> &GetLoadFunctionsMap(GLenum intern
                     break;
             }
         }
+        case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            switch (dxgiFormat)
+            {
+                case DXGI_FORMAT_BC1_UNORM_SRGB:
+                {
+                    static const std::map<GLenum, LoadImageFunctionInfo> loadFunctionsMap = {
+                        { GL_UNSIGNED_BYTE, LoadImageFunctionInfo(LoadETC2SRGB8A1ToBC1, true) },
+                    };
+
+                    return loadFunctionsMap;
+                }
+                default:
+                    break;
+            }
+        }
         case GL_DEPTH24_STENCIL8:
         {
             switch (dxgiFormat)
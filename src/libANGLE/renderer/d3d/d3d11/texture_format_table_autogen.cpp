@@ -179,6 +179,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                     angle::Format::ID::BC4_RED_UNORM_BLOCK,
+                                     DXGI_FORMAT_BC4_UNORM,
+                                     DXGI_FORMAT_BC4_UNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC4_UNORM,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_RG11_EAC:
         {
             static const Format info(GL_COMPRESSED_RG11_EAC,
@@ -193,6 +207,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                     angle::Format::ID::BC5_RG_UNORM_BLOCK,
+                                     DXGI_FORMAT_BC5_UNORM,
+                                     DXGI_FORMAT_BC5_UNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC5_UNORM,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_RGB8_ETC2:
         {
             static const Format info(GL_COMPRESSED_RGB8_ETC2,
@@ -207,6 +235,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE,
+                                     angle::Format::ID::BC1_RGB_UNORM_BLOCK,
+                                     DXGI_FORMAT_BC1_UNORM,
+                                     DXGI_FORMAT_BC1_UNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC1_UNORM,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
         {
             static const Format info(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,
@@ -221,6 +263,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,
+                                     angle::Format::ID::BC1_RGBA_UNORM_BLOCK,
+                                     DXGI_FORMAT_BC1_UNORM,
+                                     DXGI_FORMAT_BC1_UNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC1_UNORM,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_RGBA8_ETC2_EAC:
         {
             static const Format info(GL_COMPRESSED_RGBA8_ETC2_EAC,
@@ -235,6 +291,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                     angle::Format::ID::BC3_RGBA_UNORM_BLOCK,
+                                     DXGI_FORMAT_BC3_UNORM,
+                                     DXGI_FORMAT_BC3_UNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC3_UNORM,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_RGBA_ASTC_10x10_KHR:
         {
             static const Format info(GL_COMPRESSED_RGBA_ASTC_10x10_KHR,
@@ -501,6 +571,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                     angle::Format::ID::BC4_RED_SNORM_BLOCK,
+                                     DXGI_FORMAT_BC4_SNORM,
+                                     DXGI_FORMAT_BC4_SNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC4_SNORM,
+                                     GL_RGBA8_SNORM,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_SIGNED_RG11_EAC:
         {
             static const Format info(GL_COMPRESSED_SIGNED_RG11_EAC,
@@ -515,6 +599,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                     angle::Format::ID::BC5_RG_SNORM_BLOCK,
+                                     DXGI_FORMAT_BC5_SNORM,
+                                     DXGI_FORMAT_BC5_SNORM,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC5_SNORM,
+                                     GL_RGBA8_SNORM,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
         {
             static const Format info(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR,
@@ -725,6 +823,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                     angle::Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK,
+                                     DXGI_FORMAT_BC3_UNORM_SRGB,
+                                     DXGI_FORMAT_BC3_UNORM_SRGB,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC3_UNORM_SRGB,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_SRGB8_ETC2:
         {
             static const Format info(GL_COMPRESSED_SRGB8_ETC2,
@@ -739,6 +851,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE,
+                                     angle::Format::ID::BC1_RGB_UNORM_SRGB_BLOCK,
+                                     DXGI_FORMAT_BC1_UNORM_SRGB,
+                                     DXGI_FORMAT_BC1_UNORM_SRGB,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC1_UNORM_SRGB,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
         {
             static const Format info(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2,
@@ -753,6 +879,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                      deviceCaps);
             return info;
         }
+        case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        {
+            static const Format info(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,
+                                     angle::Format::ID::BC1_RGBA_UNORM_SRGB_BLOCK,
+                                     DXGI_FORMAT_BC1_UNORM_SRGB,
+                                     DXGI_FORMAT_BC1_UNORM_SRGB,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_UNKNOWN,
+                                     DXGI_FORMAT_BC1_UNORM_SRGB,
+                                     GL_RGBA8,
+                                     nullptr,
+                                     deviceCaps);
+            return info;
+        }
         case GL_DEPTH24_STENCIL8:
         {
             if (OnlyFL10Plus(deviceCaps))
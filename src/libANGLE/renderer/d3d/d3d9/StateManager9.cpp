@@ -7,7 +7,6 @@
 // StateManager9.cpp: Defines a class for caching D3D9 state
 #include "libANGLE/renderer/d3d/d3d9/StateManager9.h"
 
-#include "common/BitSetIterator.h"
 #include "common/utilities.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/d3d/d3d9/renderer9_utils.h"
@@ -120,7 +119,7 @@ void StateManager9::syncState(const gl::State &state, const gl::State::DirtyBits
         return;
     }
 
-    for (auto dirtyBit : angle::IterateBitSet(dirtyBits))
+    for (auto dirtyBit : dirtyBits)
     {
         switch (dirtyBit)
         {
@@ -396,7 +395,7 @@ gl::Error StateManager9::setBlendDepthRasterStates(const gl::State &glState,
         mCurFrontFaceCCW = frontFaceCCW;
     }
 
-    for (auto dirtyBit : angle::IterateBitSet(mDirtyBits))
+    for (auto dirtyBit : mDirtyBits)
     {
         switch (dirtyBit)
         {
@@ -29,6 +29,15 @@ static const GLenum SourceBufferOperationTarget = GL_COPY_READ_BUFFER;
 // supported GL versions and doesn't affect any current state when it changes.
 static const GLenum DestBufferOperationTarget = GL_ARRAY_BUFFER;
 
+// Larger updates are uploaded right away, staging them would only add a copy.
+static const size_t MaxStagedUpdateSize = 16 * 1024;
+
+// Staged updates are flushed early once their bytes take this much memory.
+static const size_t MaxStagingArenaSize = 4 * 1024 * 1024;
+
+// Unchanged bytes of the shadow copy uploaded to merge two staged ranges into one call.
+static const size_t MaxUploadedGapSize = 4 * 1024;
+
 BufferGL::BufferGL(const FunctionsGL *functions, StateManagerGL *stateManager)
     : BufferImpl(),
       mIsMapped(false),
@@ -37,6 +46,7 @@ BufferGL::BufferGL(const FunctionsGL *functions, StateManagerGL *stateManager)
       mShadowBufferData(!CanMapBufferForRead(functions)),
       mShadowCopy(),
       mBufferSize(0),
+      mStaging(),
       mFunctions(functions),
       mStateManager(stateManager),
       mBufferID(0)
@@ -49,12 +59,16 @@ BufferGL::BufferGL(const FunctionsGL *functions, StateManagerGL *stateManager)
 
 BufferGL::~BufferGL()
 {
+    mStateManager->onDeleteBufferObject(this);
     mStateManager->deleteBuffer(mBufferID);
     mBufferID = 0;
 }
 
 gl::Error BufferGL::setData(const void* data, size_t size, GLenum usage)
 {
+    // The staged updates are overwritten by the new data.
+    mStaging.clear();
+
     mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
     mFunctions->bufferData(DestBufferOperationTarget, size, data, usage);
 
@@ -78,20 +92,39 @@ gl::Error BufferGL::setData(const void* data, size_t size, GLenum usage)
 
 gl::Error BufferGL::setSubData(const void* data, size_t size, size_t offset)
 {
-    mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
-    mFunctions->bufferSubData(DestBufferOperationTarget, offset, size, data);
-
     if (mShadowBufferData && size > 0)
     {
         memcpy(mShadowCopy.data() + offset, data, size);
     }
 
+    if (size > MaxStagedUpdateSize)
+    {
+        flushStagedUpdates();
+
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        mFunctions->bufferSubData(DestBufferOperationTarget, offset, size, data);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    if (mStaging.empty())
+    {
+        mStateManager->onStageBufferUpdates(this);
+    }
+    mStaging.stage(offset, size, mShadowBufferData ? nullptr : static_cast<const uint8_t *>(data));
+
+    if (mStaging.getArenaSize() > MaxStagingArenaSize)
+    {
+        flushStagedUpdates();
+    }
+
     return gl::Error(GL_NO_ERROR);
 }
 
 gl::Error BufferGL::copySubData(BufferImpl* source, GLintptr sourceOffset, GLintptr destOffset, GLsizeiptr size)
 {
     BufferGL *sourceGL = GetAs<BufferGL>(source);
+    sourceGL->flushStagedUpdates();
+    flushStagedUpdates();
 
     mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
     mStateManager->bindBuffer(SourceBufferOperationTarget, sourceGL->getBufferID());
@@ -115,6 +148,8 @@ gl::Error BufferGL::map(GLenum access, GLvoid **mapPtr)
     }
     else
     {
+        flushStagedUpdates();
+
         mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
         *mapPtr = mFunctions->mapBuffer(DestBufferOperationTarget, access);
     }
@@ -134,6 +169,8 @@ gl::Error BufferGL::mapRange(size_t offset, size_t length, GLbitfield access, GL
     }
     else
     {
+        flushStagedUpdates();
+
         mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
         *mapPtr = mFunctions->mapBufferRange(DestBufferOperationTarget, offset, length, access);
     }
@@ -182,6 +219,8 @@ gl::Error BufferGL::getIndexRange(GLenum type,
     }
     else
     {
+        flushStagedUpdates();
+
         mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
 
         const gl::Type &typeInfo  = gl::GetTypeInfo(type);
@@ -199,4 +238,45 @@ GLuint BufferGL::getBufferID() const
     return mBufferID;
 }
 
+void BufferGL::flushStagedUpdates()
+{
+    if (mStaging.empty())
+    {
+        return;
+    }
+
+    mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+
+    const std::vector<BufferStagingGL::Range> &ranges = mStaging.getRanges();
+    if (mShadowBufferData)
+    {
+        // The shadow copy holds the bytes between the ranges too, so ranges separated by small
+        // gaps are uploaded together.
+        size_t start = ranges.front().offset;
+        size_t end   = start;
+        for (const BufferStagingGL::Range &range : ranges)
+        {
+            if (range.offset - end > MaxUploadedGapSize)
+            {
+                mFunctions->bufferSubData(DestBufferOperationTarget, start, end - start,
+                                          mShadowCopy.data() + start);
+                start = range.offset;
+            }
+            end = range.offset + range.size;
+        }
+        mFunctions->bufferSubData(DestBufferOperationTarget, start, end - start,
+                                  mShadowCopy.data() + start);
+    }
+    else
+    {
+        for (const BufferStagingGL::Range &range : ranges)
+        {
+            mFunctions->bufferSubData(DestBufferOperationTarget, range.offset, range.size,
+                                      mStaging.getRangeData(range));
+        }
+    }
+
+    mStaging.clear();
+}
+
 }
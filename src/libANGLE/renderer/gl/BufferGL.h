@@ -11,6 +11,7 @@
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/BufferImpl.h"
+#include "libANGLE/renderer/gl/BufferStagingGL.h"
 
 namespace rx
 {
@@ -39,6 +40,10 @@ class BufferGL : public BufferImpl
 
     GLuint getBufferID() const;
 
+    // Uploads the updates staged by setSubData. Called by the state manager before the buffer is
+    // used by the driver.
+    void flushStagedUpdates();
+
   private:
     bool mIsMapped;
     size_t mMapOffset;
@@ -49,6 +54,10 @@ class BufferGL : public BufferImpl
 
     size_t mBufferSize;
 
+    // Small updates are staged and uploaded together at the next use of the buffer. The staged
+    // bytes are read from the shadow copy when there is one.
+    BufferStagingGL mStaging;
+
     const FunctionsGL *mFunctions;
     StateManagerGL *mStateManager;
 
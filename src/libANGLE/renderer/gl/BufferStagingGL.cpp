@@ -0,0 +1,117 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferStagingGL.cpp: Implements the class methods for BufferStagingGL.
+
+#include "libANGLE/renderer/gl/BufferStagingGL.h"
+
+#include <algorithm>
+#include <string.h>
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+BufferStagingGL::BufferStagingGL()
+{
+}
+
+BufferStagingGL::~BufferStagingGL()
+{
+}
+
+void BufferStagingGL::stage(size_t offset, size_t size, const uint8_t *data)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    const size_t end = offset + size;
+
+    // The ranges merged with the update are the ones ending at or after its start and starting at
+    // or before its end.
+    auto first = std::lower_bound(
+        mRanges.begin(), mRanges.end(), offset,
+        [](const Range &range, size_t value) { return range.offset + range.size < value; });
+    auto last = first;
+    while (last != mRanges.end() && last->offset <= end)
+    {
+        ++last;
+    }
+
+    if (first == last)
+    {
+        Range range;
+        range.offset     = offset;
+        range.size       = size;
+        range.dataOffset = mArena.size();
+        if (data != nullptr)
+        {
+            mArena.insert(mArena.end(), data, data + size);
+        }
+        mRanges.insert(first, range);
+        return;
+    }
+
+    if (last - first == 1 && first->offset <= offset)
+    {
+        // Updates inside a range and updates extending the range written last, such as a run of
+        // sequential updates, are written in place.
+        Range &range          = *first;
+        const size_t rangeEnd = range.offset + range.size;
+        const bool atArenaEnd = range.dataOffset + range.size == mArena.size();
+        if (end <= rangeEnd || data == nullptr || atArenaEnd)
+        {
+            if (end > rangeEnd)
+            {
+                if (data != nullptr)
+                {
+                    mArena.resize(mArena.size() + end - rangeEnd);
+                }
+                range.size = end - range.offset;
+            }
+            if (data != nullptr)
+            {
+                memcpy(mArena.data() + range.dataOffset + (offset - range.offset), data, size);
+            }
+            return;
+        }
+    }
+
+    // Otherwise the merged range is written at the end of the arena, oldest bytes first.
+    const size_t mergedOffset = std::min(offset, first->offset);
+    const size_t mergedEnd    = std::max(end, (last - 1)->offset + (last - 1)->size);
+
+    Range merged;
+    merged.offset     = mergedOffset;
+    merged.size       = mergedEnd - mergedOffset;
+    merged.dataOffset = mArena.size();
+
+    if (data != nullptr)
+    {
+        mArena.resize(mArena.size() + merged.size);
+        uint8_t *mergedData = mArena.data() + merged.dataOffset;
+        for (auto range = first; range != last; ++range)
+        {
+            memcpy(mergedData + (range->offset - mergedOffset), mArena.data() + range->dataOffset,
+                   range->size);
+        }
+        memcpy(mergedData + (offset - mergedOffset), data, size);
+    }
+
+    first = mRanges.erase(first, last);
+    mRanges.insert(first, merged);
+}
+
+void BufferStagingGL::clear()
+{
+    mRanges.clear();
+    mArena.clear();
+}
+
+}  // namespace rx
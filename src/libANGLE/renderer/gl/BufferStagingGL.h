@@ -0,0 +1,59 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferStagingGL.h: Defines the class interface for BufferStagingGL, the sub-range updates of a
+// buffer that haven't been uploaded yet.
+
+#ifndef LIBANGLE_RENDERER_GL_BUFFERSTAGINGGL_H_
+#define LIBANGLE_RENDERER_GL_BUFFERSTAGINGGL_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace rx
+{
+
+// Updates are merged with the staged ranges they overlap or touch, so a run of small contiguous
+// updates ends up as a single range. The bytes of each range are kept contiguous in a CPU arena
+// which only grows until the staging is cleared.
+class BufferStagingGL final : angle::NonCopyable
+{
+  public:
+    struct Range
+    {
+        size_t offset;
+        size_t size;
+
+        // Offset of the bytes of the range in the arena.
+        size_t dataOffset;
+    };
+
+    BufferStagingGL();
+    ~BufferStagingGL();
+
+    // Stages the update of size bytes at offset. The bytes are copied into the arena and override
+    // the previously staged ones, unless data is null in which case only the range is recorded.
+    void stage(size_t offset, size_t size, const uint8_t *data);
+    void clear();
+
+    bool empty() const { return mRanges.empty(); }
+
+    // Sorted by offset, the ranges neither overlap nor touch each other.
+    const std::vector<Range> &getRanges() const { return mRanges; }
+    const uint8_t *getRangeData(const Range &range) const { return mArena.data() + range.dataOffset; }
+
+    size_t getArenaSize() const { return mArena.size(); }
+
+  private:
+    std::vector<Range> mRanges;
+    std::vector<uint8_t> mArena;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_BUFFERSTAGINGGL_H_
@@ -0,0 +1,127 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BufferStagingGL_unittest:
+//   Tests of the merging of staged buffer updates.
+//
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/renderer/gl/BufferStagingGL.h"
+
+using namespace rx;
+
+namespace
+{
+
+// Applies the staged ranges to a copy of contents, the way they are uploaded.
+std::vector<uint8_t> ApplyStaging(const BufferStagingGL &staging, std::vector<uint8_t> contents)
+{
+    for (const BufferStagingGL::Range &range : staging.getRanges())
+    {
+        const uint8_t *data = staging.getRangeData(range);
+        std::copy(data, data + range.size, contents.begin() + range.offset);
+    }
+    return contents;
+}
+
+// Sequential updates end up in a single range without copying the staged bytes again.
+TEST(BufferStagingGLTest, MergesSequentialUpdates)
+{
+    BufferStagingGL staging;
+    EXPECT_TRUE(staging.empty());
+
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        const uint8_t data[4] = {i, i, i, i};
+        staging.stage(16 + i * 4, 4, data);
+    }
+
+    ASSERT_EQ(1u, staging.getRanges().size());
+    EXPECT_EQ(16u, staging.getRanges()[0].offset);
+    EXPECT_EQ(400u, staging.getRanges()[0].size);
+    EXPECT_EQ(400u, staging.getArenaSize());
+
+    const uint8_t *data = staging.getRangeData(staging.getRanges()[0]);
+    for (size_t i = 0; i < 400; i++)
+    {
+        ASSERT_EQ(i / 4, data[i]);
+    }
+
+    staging.clear();
+    EXPECT_TRUE(staging.empty());
+    EXPECT_EQ(0u, staging.getArenaSize());
+}
+
+// Disjoint updates stay sorted and separate, overlapping ones are merged with the latest bytes
+// winning.
+TEST(BufferStagingGLTest, MergesOverlappingUpdates)
+{
+    std::vector<uint8_t> expected(64, 0);
+    BufferStagingGL staging;
+
+    auto stage = [&staging, &expected](size_t offset, size_t size, uint8_t value) {
+        const std::vector<uint8_t> data(size, value);
+        staging.stage(offset, size, data.data());
+        std::fill(expected.begin() + offset, expected.begin() + offset + size, value);
+    };
+
+    stage(40, 8, 1);
+    stage(4, 4, 2);
+    stage(20, 4, 3);
+    ASSERT_EQ(3u, staging.getRanges().size());
+    EXPECT_EQ(4u, staging.getRanges()[0].offset);
+    EXPECT_EQ(20u, staging.getRanges()[1].offset);
+    EXPECT_EQ(40u, staging.getRanges()[2].offset);
+    EXPECT_EQ(expected, ApplyStaging(staging, std::vector<uint8_t>(64, 0)));
+
+    // Inside an existing range.
+    stage(42, 2, 4);
+    ASSERT_EQ(3u, staging.getRanges().size());
+    EXPECT_EQ(expected, ApplyStaging(staging, std::vector<uint8_t>(64, 0)));
+
+    // Touching the start of a range.
+    stage(16, 4, 5);
+    ASSERT_EQ(3u, staging.getRanges().size());
+    EXPECT_EQ(16u, staging.getRanges()[1].offset);
+    EXPECT_EQ(8u, staging.getRanges()[1].size);
+    EXPECT_EQ(expected, ApplyStaging(staging, std::vector<uint8_t>(64, 0)));
+
+    // Overlapping the first two ranges.
+    stage(6, 12, 6);
+    ASSERT_EQ(2u, staging.getRanges().size());
+    EXPECT_EQ(4u, staging.getRanges()[0].offset);
+    EXPECT_EQ(20u, staging.getRanges()[0].size);
+    EXPECT_EQ(expected, ApplyStaging(staging, std::vector<uint8_t>(64, 0)));
+
+    // Covering everything.
+    stage(0, 60, 7);
+    ASSERT_EQ(1u, staging.getRanges().size());
+    EXPECT_EQ(expected, ApplyStaging(staging, std::vector<uint8_t>(64, 0)));
+}
+
+// Without data only the ranges are recorded.
+TEST(BufferStagingGLTest, RangesOnly)
+{
+    BufferStagingGL staging;
+
+    staging.stage(8, 8, nullptr);
+    staging.stage(32, 8, nullptr);
+    staging.stage(16, 4, nullptr);
+    staging.stage(0, 0, nullptr);
+    ASSERT_EQ(2u, staging.getRanges().size());
+    EXPECT_EQ(8u, staging.getRanges()[0].offset);
+    EXPECT_EQ(12u, staging.getRanges()[0].size);
+
+    staging.stage(12, 24, nullptr);
+    ASSERT_EQ(1u, staging.getRanges().size());
+    EXPECT_EQ(8u, staging.getRanges()[0].offset);
+    EXPECT_EQ(32u, staging.getRanges()[0].size);
+    EXPECT_EQ(0u, staging.getArenaSize());
+}
+
+}  // anonymous namespace
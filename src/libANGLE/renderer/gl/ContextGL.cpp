@@ -84,7 +84,8 @@ BufferImpl *ContextGL::createBuffer()
 
 VertexArrayImpl *ContextGL::createVertexArray(const gl::VertexArrayState &data)
 {
-    return new VertexArrayGL(data, getFunctions(), getStateManager());
+    return new VertexArrayGL(data, getFunctions(), getStateManager(),
+                             mRenderer->isClientArrayTrackingEnabled());
 }
 
 QueryImpl *ContextGL::createQuery(GLenum type)
@@ -8,7 +8,6 @@
 
 #include "libANGLE/renderer/gl/FramebufferGL.h"
 
-#include "common/BitSetIterator.h"
 #include "common/debug.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/State.h"
@@ -278,7 +277,7 @@ void FramebufferGL::syncState(const Framebuffer::DirtyBits &dirtyBits)
 
     mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
-    for (auto dirtyBit : angle::IterateBitSet(dirtyBits))
+    for (auto dirtyBit : dirtyBits)
     {
         switch (dirtyBit)
         {
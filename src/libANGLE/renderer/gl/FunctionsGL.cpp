@@ -8,9 +8,8 @@
 
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 
-#include <algorithm>
-
 #include "common/string_utils.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
 namespace rx
@@ -55,32 +54,16 @@ static std::vector<std::string> GetIndexedExtensions(PFNGLGETINTEGERVPROC getInt
     return result;
 }
 
-template <typename T>
-static void AssignGLEntryPoint(void *function, T *outFunction)
-{
-    *outFunction = reinterpret_cast<T>(function);
-}
-
-template <typename T>
-static void AssignGLExtensionEntryPoint(const std::vector<std::string> &extensions, const char *requiredExtensionString,
-                                        void *function, T *outFunction)
+template <typename PFN>
+static void AssignGLEntryPoint(void *function, EntryPointGL<PFN> *outFunction)
 {
-    std::vector<std::string> requiredExtensions;
-    angle::SplitStringAlongWhitespace(requiredExtensionString, &requiredExtensions);
-    for (const std::string& requiredExtension : requiredExtensions)
-    {
-        if (std::find(extensions.begin(), extensions.end(), requiredExtension) == extensions.end())
-        {
-            return;
-        }
-    }
-
-    *outFunction = reinterpret_cast<T>(function);
+    *outFunction = reinterpret_cast<PFN>(function);
 }
 
 FunctionsGL::FunctionsGL()
     : version(),
       standard(),
+      profile(0),
       extensions(),
 
       blendFunc(nullptr),
@@ -796,8 +779,30 @@ FunctionsGL::~FunctionsGL()
 {
 }
 
+template <typename PFN>
+void FunctionsGL::assignExtensionEntryPoint(const char *requiredExtensionString,
+                                            const char *function,
+                                            EntryPointGL<PFN> *outFunction)
+{
+    // Entry points of unsupported extensions are never looked up, the driver could return a
+    // non-null stub for them anyway.
+    std::vector<std::string> requiredExtensions;
+    angle::SplitStringAlongWhitespace(requiredExtensionString, &requiredExtensions);
+    for (const std::string &requiredExtension : requiredExtensions)
+    {
+        if (!hasExtension(requiredExtension))
+        {
+            return;
+        }
+    }
+
+    outFunction->setLazy(this, function);
+}
+
 void FunctionsGL::initialize()
 {
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.FunctionsGLInitializeMS");
+
     // Grab the version number
     AssignGLEntryPoint(loadProcAddress("glGetString"), &getString);
     AssignGLEntryPoint(loadProcAddress("glGetIntegerv"), &getIntegerv);
@@ -814,6 +819,7 @@ void FunctionsGL::initialize()
         const char *exts = reinterpret_cast<const char*>(getString(GL_EXTENSIONS));
         angle::SplitStringAlongWhitespace(std::string(exts), &extensions);
     }
+    mExtensionSet.insert(extensions.begin(), extensions.end());
 
     // Load the entry points
     switch (standard)
@@ -848,922 +854,925 @@ void FunctionsGL::initializeProcsDesktopGL()
     // in even older versions.  Always try loading the extensions regardless of GL version.
 
     // GL_ARB_program_interface_query (loading only functions relevant to GL_NV_path_rendering here)
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_program_interface_query", loadProcAddress("glGetProgramInterfaceiv"), &getProgramInterfaceiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_program_interface_query", loadProcAddress("glGetProgramResourceName"), &getProgramResourceName);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_program_interface_query", loadProcAddress("glGetProgramResourceiv"), &getProgramResourceiv);
+    assignExtensionEntryPoint("GL_ARB_program_interface_query", "glGetProgramInterfaceiv", &getProgramInterfaceiv);
+    assignExtensionEntryPoint("GL_ARB_program_interface_query", "glGetProgramResourceName", &getProgramResourceName);
+    assignExtensionEntryPoint("GL_ARB_program_interface_query", "glGetProgramResourceiv", &getProgramResourceiv);
 
     // GL_NV_path_rendering
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glMatrixLoadfEXT"), &matrixLoadEXT);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glGenPathsNV"), &genPathsNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glDeletePathsNV"), &delPathsNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathCommandsNV"), &pathCommandsNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glIsPathNV"), &isPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathParameterfNV"), &setPathParameterfNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathParameteriNV"), &setPathParameteriNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glGetPathParameterfvNV"), &getPathParameterfNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glGetPathParameterivNV"), &getPathParameteriNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathStencilFuncNV"), &pathStencilFuncNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilFillPathNV"), &stencilFillPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilStrokePathNV"), &stencilStrokePathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverFillPathNV"), &coverFillPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverStrokePathNV"), &coverStrokePathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverFillPathNV"), &stencilThenCoverFillPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverStrokePathNV"), &stencilThenCoverStrokePathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverFillPathInstancedNV"), &coverFillPathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverStrokePathInstancedNV"), &coverStrokePathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilFillPathInstancedNV"), &stencilFillPathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilStrokePathInstancedNV"), &stencilStrokePathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverFillPathInstancedNV"), &stencilThenCoverFillPathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverStrokePathInstancedNV"), &stencilThenCoverStrokePathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glProgramPathFragmentInputGenNV"), &programPathFragmentInputGenNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glMatrixLoadfEXT", &matrixLoadEXT);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glGenPathsNV", &genPathsNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glDeletePathsNV", &delPathsNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathCommandsNV", &pathCommandsNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glIsPathNV", &isPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathParameterfNV", &setPathParameterfNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathParameteriNV", &setPathParameteriNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glGetPathParameterfvNV", &getPathParameterfNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glGetPathParameterivNV", &getPathParameteriNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathStencilFuncNV", &pathStencilFuncNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilFillPathNV", &stencilFillPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilStrokePathNV", &stencilStrokePathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverFillPathNV", &coverFillPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverStrokePathNV", &coverStrokePathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverFillPathNV", &stencilThenCoverFillPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverStrokePathNV", &stencilThenCoverStrokePathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverFillPathInstancedNV", &coverFillPathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverStrokePathInstancedNV", &coverStrokePathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilFillPathInstancedNV", &stencilFillPathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilStrokePathInstancedNV", &stencilStrokePathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverFillPathInstancedNV", &stencilThenCoverFillPathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverStrokePathInstancedNV", &stencilThenCoverStrokePathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glProgramPathFragmentInputGenNV", &programPathFragmentInputGenNV);
 
     // GL_NV_framebuffer_mixed_samples
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_framebuffer_mixed_samples", loadProcAddress("glCoverageModulationNV"), &coverageModulationNV);
+    assignExtensionEntryPoint("GL_NV_framebuffer_mixed_samples", "glCoverageModulationNV", &coverageModulationNV);
 
     // GL_NV_fence
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glDeleteFencesNV"), &deleteFencesNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glGenFencesNV"), &genFencesNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glIsFenceNV"), &isFenceNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glTestFenceNV"), &testFenceNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glGetFenceivNV"), &getFenceivNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glFinishFenceNV"), &finishFenceNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glSetFenceNV"), &setFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glDeleteFencesNV", &deleteFencesNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glGenFencesNV", &genFencesNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glIsFenceNV", &isFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glTestFenceNV", &testFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glGetFenceivNV", &getFenceivNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glFinishFenceNV", &finishFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glSetFenceNV", &setFenceNV);
 
     // GL_EXT_texture_storage
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage", loadProcAddress("glTexStorage1DEXT"), &texStorage1D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage", loadProcAddress("glTexStorage2DEXT"), &texStorage2D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage GL_EXT_texture3D", loadProcAddress("glTexStorage3DEXT"), &texStorage3D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage GL_EXT_direct_state_access", loadProcAddress("glTextureStorage1DEXT"), &textureStorage1D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage GL_EXT_direct_state_access", loadProcAddress("glTextureStorage2DEXT"), &textureStorage2D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage GL_EXT_direct_state_access GL_EXT_texture3D", loadProcAddress("glTextureStorage3DEXT"), &textureStorage3D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage", "glTexStorage1DEXT", &texStorage1D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage", "glTexStorage2DEXT", &texStorage2D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage GL_EXT_texture3D", "glTexStorage3DEXT", &texStorage3D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage GL_EXT_direct_state_access", "glTextureStorage1DEXT", &textureStorage1D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage GL_EXT_direct_state_access", "glTextureStorage2DEXT", &textureStorage2D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage GL_EXT_direct_state_access GL_EXT_texture3D", "glTextureStorage3DEXT", &textureStorage3D);
 
     // GL_ARB_vertex_array_object
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_vertex_array_object", loadProcAddress("glBindVertexArray"), &bindVertexArray);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_vertex_array_object", loadProcAddress("glDeleteVertexArrays"), &deleteVertexArrays);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_vertex_array_object", loadProcAddress("glGenVertexArrays"), &genVertexArrays);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_vertex_array_object", loadProcAddress("glIsVertexArray"), &isVertexArray);
+    assignExtensionEntryPoint("GL_ARB_vertex_array_object", "glBindVertexArray", &bindVertexArray);
+    assignExtensionEntryPoint("GL_ARB_vertex_array_object", "glDeleteVertexArrays", &deleteVertexArrays);
+    assignExtensionEntryPoint("GL_ARB_vertex_array_object", "glGenVertexArrays", &genVertexArrays);
+    assignExtensionEntryPoint("GL_ARB_vertex_array_object", "glIsVertexArray", &isVertexArray);
 
     // GL_ARB_sync
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glClientWaitSync"), &clientWaitSync);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glDeleteSync"), &deleteSync);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glFenceSync"), &fenceSync);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glGetInteger64i_v"), &getInteger64i_v);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glGetInteger64v"), &getInteger64v);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glGetSynciv"), &getSynciv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glIsSync"), &isSync);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sync", loadProcAddress("glWaitSync"), &waitSync);
+    assignExtensionEntryPoint("GL_ARB_sync", "glClientWaitSync", &clientWaitSync);
+    assignExtensionEntryPoint("GL_ARB_sync", "glDeleteSync", &deleteSync);
+    assignExtensionEntryPoint("GL_ARB_sync", "glFenceSync", &fenceSync);
+    assignExtensionEntryPoint("GL_ARB_sync", "glGetInteger64i_v", &getInteger64i_v);
+    assignExtensionEntryPoint("GL_ARB_sync", "glGetInteger64v", &getInteger64v);
+    assignExtensionEntryPoint("GL_ARB_sync", "glGetSynciv", &getSynciv);
+    assignExtensionEntryPoint("GL_ARB_sync", "glIsSync", &isSync);
+    assignExtensionEntryPoint("GL_ARB_sync", "glWaitSync", &waitSync);
+
+    // GL_ARB_buffer_storage
+    assignExtensionEntryPoint("GL_ARB_buffer_storage", "glBufferStorage", &bufferStorage);
 
     // GL_EXT_framebuffer_object
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glIsRenderbufferEXT"), &isRenderbuffer);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glBindRenderbufferEXT"), &bindRenderbuffer);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glDeleteRenderbuffersEXT"), &deleteRenderbuffers);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glGenRenderbuffersEXT"), &genRenderbuffers);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glRenderbufferStorageEXT"), &renderbufferStorage);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glGetRenderbufferParameterivEXT"), &getRenderbufferParameteriv);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glIsFramebufferEXT"), &isFramebuffer);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glBindFramebufferEXT"), &bindFramebuffer);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glDeleteFramebuffersEXT"), &deleteFramebuffers);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glGenFramebuffersEXT"), &genFramebuffers);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glCheckFramebufferStatusEXT"), &checkFramebufferStatus);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glFramebufferTexture1DEXT"), &framebufferTexture1D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glFramebufferTexture2DEXT"), &framebufferTexture2D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glFramebufferTexture3DEXT"), &framebufferTexture3D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glFramebufferRenderbufferEXT"), &framebufferRenderbuffer);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glGetFramebufferAttachmentParameterivEXT"), &getFramebufferAttachmentParameteriv);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_object", loadProcAddress("glGenerateMipmapEXT"), &generateMipmap);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glIsRenderbufferEXT", &isRenderbuffer);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glBindRenderbufferEXT", &bindRenderbuffer);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glDeleteRenderbuffersEXT", &deleteRenderbuffers);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glGenRenderbuffersEXT", &genRenderbuffers);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glRenderbufferStorageEXT", &renderbufferStorage);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glGetRenderbufferParameterivEXT", &getRenderbufferParameteriv);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glIsFramebufferEXT", &isFramebuffer);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glBindFramebufferEXT", &bindFramebuffer);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glDeleteFramebuffersEXT", &deleteFramebuffers);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glGenFramebuffersEXT", &genFramebuffers);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glCheckFramebufferStatusEXT", &checkFramebufferStatus);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glFramebufferTexture1DEXT", &framebufferTexture1D);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glFramebufferTexture2DEXT", &framebufferTexture2D);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glFramebufferTexture3DEXT", &framebufferTexture3D);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glFramebufferRenderbufferEXT", &framebufferRenderbuffer);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glGetFramebufferAttachmentParameterivEXT", &getFramebufferAttachmentParameteriv);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_object", "glGenerateMipmapEXT", &generateMipmap);
 
     // GL_EXT_framebuffer_blit
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_framebuffer_blit", loadProcAddress("glBlitFramebufferEXT"), &blitFramebuffer);
+    assignExtensionEntryPoint("GL_EXT_framebuffer_blit", "glBlitFramebufferEXT", &blitFramebuffer);
 
     // GL_KHR_debug
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glDebugMessageControl"), &debugMessageControl);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glDebugMessageInsert"), &debugMessageInsert);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glDebugMessageCallback"), &debugMessageCallback);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetDebugMessageLog"), &getDebugMessageLog);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetPointerv"), &getPointerv);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glPushDebugGroup"), &pushDebugGroup);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glPopDebugGroup"), &popDebugGroup);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glObjectLabel"), &objectLabel);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetObjectLabel"), &getObjectLabel);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glObjectPtrLabel"), &objectPtrLabel);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetObjectPtrLabel"), &getObjectPtrLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glDebugMessageControl", &debugMessageControl);
+    assignExtensionEntryPoint("GL_KHR_debug", "glDebugMessageInsert", &debugMessageInsert);
+    assignExtensionEntryPoint("GL_KHR_debug", "glDebugMessageCallback", &debugMessageCallback);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetDebugMessageLog", &getDebugMessageLog);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetPointerv", &getPointerv);
+    assignExtensionEntryPoint("GL_KHR_debug", "glPushDebugGroup", &pushDebugGroup);
+    assignExtensionEntryPoint("GL_KHR_debug", "glPopDebugGroup", &popDebugGroup);
+    assignExtensionEntryPoint("GL_KHR_debug", "glObjectLabel", &objectLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetObjectLabel", &getObjectLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glObjectPtrLabel", &objectPtrLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetObjectPtrLabel", &getObjectPtrLabel);
 
     // GL_ARB_internalformat_query
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_internalformat_query", loadProcAddress("glGetInternalformativ"), &getInternalformativ);
+    assignExtensionEntryPoint("GL_ARB_internalformat_query", "glGetInternalformativ", &getInternalformativ);
 
     // GL_ARB_ES2_compatibility
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_ES2_compatibility", loadProcAddress("glReleaseShaderCompiler"), &releaseShaderCompiler);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_ES2_compatibility", loadProcAddress("glShaderBinary"), &shaderBinary);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_ES2_compatibility", loadProcAddress("glGetShaderPrecisionFormat"), &getShaderPrecisionFormat);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_ES2_compatibility", loadProcAddress("glDepthRangef"), &depthRangef);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_ES2_compatibility", loadProcAddress("glClearDepthf"), &clearDepthf);
+    assignExtensionEntryPoint("GL_ARB_ES2_compatibility", "glReleaseShaderCompiler", &releaseShaderCompiler);
+    assignExtensionEntryPoint("GL_ARB_ES2_compatibility", "glShaderBinary", &shaderBinary);
+    assignExtensionEntryPoint("GL_ARB_ES2_compatibility", "glGetShaderPrecisionFormat", &getShaderPrecisionFormat);
+    assignExtensionEntryPoint("GL_ARB_ES2_compatibility", "glDepthRangef", &depthRangef);
+    assignExtensionEntryPoint("GL_ARB_ES2_compatibility", "glClearDepthf", &clearDepthf);
 
     // GL_ARB_instanced_arrays
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_instanced_arrays", loadProcAddress("glVertexAttribDivisorARB"), &vertexAttribDivisor);
+    assignExtensionEntryPoint("GL_ARB_instanced_arrays", "glVertexAttribDivisorARB", &vertexAttribDivisor);
 
     // GL_EXT_draw_instanced
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_draw_instanced", loadProcAddress("glDrawArraysInstancedEXT"), &drawArraysInstanced);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_draw_instanced", loadProcAddress("glDrawElementsInstancedEXT"), &drawElementsInstanced);
+    assignExtensionEntryPoint("GL_EXT_draw_instanced", "glDrawArraysInstancedEXT", &drawArraysInstanced);
+    assignExtensionEntryPoint("GL_EXT_draw_instanced", "glDrawElementsInstancedEXT", &drawElementsInstanced);
 
     // GL_ARB_draw_instanced
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_draw_instanced", loadProcAddress("glDrawArraysInstancedARB"), &drawArraysInstanced);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_draw_instanced", loadProcAddress("glDrawElementsInstancedARB"), &drawElementsInstanced);
+    assignExtensionEntryPoint("GL_ARB_draw_instanced", "glDrawArraysInstancedARB", &drawArraysInstanced);
+    assignExtensionEntryPoint("GL_ARB_draw_instanced", "glDrawElementsInstancedARB", &drawElementsInstanced);
 
     // GL_ARB_sampler_objects
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glGenSamplers"), &genSamplers);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glDeleteSamplers"), &deleteSamplers);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glIsSampler"), &isSampler);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glBindSampler"), &bindSampler);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glSamplerParameteri"), &samplerParameteri);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glSamplerParameterf"), &samplerParameterf);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glSamplerParameteriv"), &samplerParameteriv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glSamplerParameterfv"), &samplerParameterfv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glSamplerParameterIiv"), &samplerParameterIiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glSamplerParameterIuiv"), &samplerParameterIuiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glGetSamplerParameteriv"), &getSamplerParameteriv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glGetSamplerParameterfv"), &getSamplerParameterfv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glGetSamplerParameterIiv"), &getSamplerParameterIiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_sampler_objects", loadProcAddress("glGetSamplerParameterIuiv"), &getSamplerParameterIuiv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glGenSamplers", &genSamplers);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glDeleteSamplers", &deleteSamplers);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glIsSampler", &isSampler);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glBindSampler", &bindSampler);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glSamplerParameteri", &samplerParameteri);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glSamplerParameterf", &samplerParameterf);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glSamplerParameteriv", &samplerParameteriv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glSamplerParameterfv", &samplerParameterfv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glSamplerParameterIiv", &samplerParameterIiv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glSamplerParameterIuiv", &samplerParameterIuiv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glGetSamplerParameteriv", &getSamplerParameteriv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glGetSamplerParameterfv", &getSamplerParameterfv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glGetSamplerParameterIiv", &getSamplerParameterIiv);
+    assignExtensionEntryPoint("GL_ARB_sampler_objects", "glGetSamplerParameterIuiv", &getSamplerParameterIuiv);
 
     // GL_ARB_occlusion_query
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glGenQueriesARB"), &genQueries);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glDeleteQueriesARB"), &deleteQueries);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glIsQueryARB"), &isQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glBeginQueryARB"), &beginQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glEndQueryARB"), &endQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glGetQueryivARB"), &getQueryiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glGetQueryObjectivARB"), &getQueryObjectiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_occlusion_query", loadProcAddress("glGetQueryObjectuivARB"), &getQueryObjectuiv);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glGenQueriesARB", &genQueries);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glDeleteQueriesARB", &deleteQueries);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glIsQueryARB", &isQuery);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glBeginQueryARB", &beginQuery);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glEndQueryARB", &endQuery);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glGetQueryivARB", &getQueryiv);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glGetQueryObjectivARB", &getQueryObjectiv);
+    assignExtensionEntryPoint("GL_ARB_occlusion_query", "glGetQueryObjectuivARB", &getQueryObjectuiv);
 
     // EXT_transform_feedback
-    AssignGLExtensionEntryPoint(extensions, "EXT_transform_feedback", loadProcAddress("glBindBufferRangeEXT"), &bindBufferRange);
-    AssignGLExtensionEntryPoint(extensions, "EXT_transform_feedback", loadProcAddress("glBindBufferBaseEXT"), &bindBufferBase);
-    AssignGLExtensionEntryPoint(extensions, "EXT_transform_feedback", loadProcAddress("glBeginTransformFeedbackEXT"), &beginTransformFeedback);
-    AssignGLExtensionEntryPoint(extensions, "EXT_transform_feedback", loadProcAddress("glEndTransformFeedbackEXT"), &endTransformFeedback);
-    AssignGLExtensionEntryPoint(extensions, "EXT_transform_feedback", loadProcAddress("glTransformFeedbackVaryingsEXT"), &transformFeedbackVaryings);
-    AssignGLExtensionEntryPoint(extensions, "EXT_transform_feedback", loadProcAddress("glGetTransformFeedbackVaryingEXT"), &getTransformFeedbackVarying);
+    assignExtensionEntryPoint("EXT_transform_feedback", "glBindBufferRangeEXT", &bindBufferRange);
+    assignExtensionEntryPoint("EXT_transform_feedback", "glBindBufferBaseEXT", &bindBufferBase);
+    assignExtensionEntryPoint("EXT_transform_feedback", "glBeginTransformFeedbackEXT", &beginTransformFeedback);
+    assignExtensionEntryPoint("EXT_transform_feedback", "glEndTransformFeedbackEXT", &endTransformFeedback);
+    assignExtensionEntryPoint("EXT_transform_feedback", "glTransformFeedbackVaryingsEXT", &transformFeedbackVaryings);
+    assignExtensionEntryPoint("EXT_transform_feedback", "glGetTransformFeedbackVaryingEXT", &getTransformFeedbackVarying);
 
     // GL_ARB_transform_feedback2
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glBindTransformFeedback"), &bindTransformFeedback);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glDeleteTransformFeedbacks"), &deleteTransformFeedbacks);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glGenTransformFeedbacks"), &genTransformFeedbacks);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glIsTransformFeedback"), &isTransformFeedback);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glPauseTransformFeedback"), &pauseTransformFeedback);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glResumeTransformFeedback"), &resumeTransformFeedback);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback2", loadProcAddress("glDrawTransformFeedback"), &drawTransformFeedback);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glBindTransformFeedback", &bindTransformFeedback);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glDeleteTransformFeedbacks", &deleteTransformFeedbacks);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glGenTransformFeedbacks", &genTransformFeedbacks);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glIsTransformFeedback", &isTransformFeedback);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glPauseTransformFeedback", &pauseTransformFeedback);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glResumeTransformFeedback", &resumeTransformFeedback);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback2", "glDrawTransformFeedback", &drawTransformFeedback);
 
     // GL_ARB_transform_feedback3
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback3", loadProcAddress("glDrawTransformFeedbackStream"), &drawTransformFeedbackStream);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback3", loadProcAddress("glBeginQueryIndexed"), &beginQueryIndexed);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback3", loadProcAddress("glEndQueryIndexed"), &endQueryIndexed);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_transform_feedback3", loadProcAddress("glGetQueryIndexediv"), &getQueryIndexediv);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback3", "glDrawTransformFeedbackStream", &drawTransformFeedbackStream);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback3", "glBeginQueryIndexed", &beginQueryIndexed);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback3", "glEndQueryIndexed", &endQueryIndexed);
+    assignExtensionEntryPoint("GL_ARB_transform_feedback3", "glGetQueryIndexediv", &getQueryIndexediv);
 
     // GL_ARB_get_program_binary
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_get_program_binary", loadProcAddress("glGetProgramBinary"), &getProgramBinary);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_get_program_binary", loadProcAddress("glProgramBinary"), &programBinary);
-    AssignGLExtensionEntryPoint(extensions, "GL_ARB_get_program_binary", loadProcAddress("glProgramParameteri"), &programParameteri);
+    assignExtensionEntryPoint("GL_ARB_get_program_binary", "glGetProgramBinary", &getProgramBinary);
+    assignExtensionEntryPoint("GL_ARB_get_program_binary", "glProgramBinary", &programBinary);
+    assignExtensionEntryPoint("GL_ARB_get_program_binary", "glProgramParameteri", &programParameteri);
 
     // 1.0
     if (isAtLeastGL(gl::Version(1, 0)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBlendFunc"), &blendFunc);
-        AssignGLEntryPoint(loadProcAddress("glClear"), &clear);
-        AssignGLEntryPoint(loadProcAddress("glClearColor"), &clearColor);
-        AssignGLEntryPoint(loadProcAddress("glClearDepth"), &clearDepth);
-        AssignGLEntryPoint(loadProcAddress("glClearStencil"), &clearStencil);
-        AssignGLEntryPoint(loadProcAddress("glColorMask"), &colorMask);
-        AssignGLEntryPoint(loadProcAddress("glCullFace"), &cullFace);
-        AssignGLEntryPoint(loadProcAddress("glDepthFunc"), &depthFunc);
-        AssignGLEntryPoint(loadProcAddress("glDepthMask"), &depthMask);
-        AssignGLEntryPoint(loadProcAddress("glDepthRange"), &depthRange);
-        AssignGLEntryPoint(loadProcAddress("glDisable"), &disable);
-        AssignGLEntryPoint(loadProcAddress("glDrawBuffer"), &drawBuffer);
-        AssignGLEntryPoint(loadProcAddress("glEnable"), &enable);
-        AssignGLEntryPoint(loadProcAddress("glFinish"), &finish);
-        AssignGLEntryPoint(loadProcAddress("glFlush"), &flush);
-        AssignGLEntryPoint(loadProcAddress("glFrontFace"), &frontFace);
-        AssignGLEntryPoint(loadProcAddress("glGetBooleanv"), &getBooleanv);
-        AssignGLEntryPoint(loadProcAddress("glGetDoublev"), &getDoublev);
-        AssignGLEntryPoint(loadProcAddress("glGetError"), &getError);
-        AssignGLEntryPoint(loadProcAddress("glGetFloatv"), &getFloatv);
-        AssignGLEntryPoint(loadProcAddress("glGetIntegerv"), &getIntegerv);
-        AssignGLEntryPoint(loadProcAddress("glGetString"), &getString);
-        AssignGLEntryPoint(loadProcAddress("glGetTexImage"), &getTexImage);
-        AssignGLEntryPoint(loadProcAddress("glGetTexLevelParameterfv"), &getTexLevelParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexLevelParameteriv"), &getTexLevelParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameterfv"), &getTexParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameteriv"), &getTexParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glHint"), &hint);
-        AssignGLEntryPoint(loadProcAddress("glIsEnabled"), &isEnabled);
-        AssignGLEntryPoint(loadProcAddress("glLineWidth"), &lineWidth);
-        AssignGLEntryPoint(loadProcAddress("glLogicOp"), &logicOp);
-        AssignGLEntryPoint(loadProcAddress("glPixelStoref"), &pixelStoref);
-        AssignGLEntryPoint(loadProcAddress("glPixelStorei"), &pixelStorei);
-        AssignGLEntryPoint(loadProcAddress("glPointSize"), &pointSize);
-        AssignGLEntryPoint(loadProcAddress("glPolygonMode"), &polygonMode);
-        AssignGLEntryPoint(loadProcAddress("glReadBuffer"), &readBuffer);
-        AssignGLEntryPoint(loadProcAddress("glReadPixels"), &readPixels);
-        AssignGLEntryPoint(loadProcAddress("glScissor"), &scissor);
-        AssignGLEntryPoint(loadProcAddress("glStencilFunc"), &stencilFunc);
-        AssignGLEntryPoint(loadProcAddress("glStencilMask"), &stencilMask);
-        AssignGLEntryPoint(loadProcAddress("glStencilOp"), &stencilOp);
-        AssignGLEntryPoint(loadProcAddress("glTexImage1D"), &texImage1D);
-        AssignGLEntryPoint(loadProcAddress("glTexImage2D"), &texImage2D);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterf"), &texParameterf);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterfv"), &texParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glTexParameteri"), &texParameteri);
-        AssignGLEntryPoint(loadProcAddress("glTexParameteriv"), &texParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glViewport"), &viewport);
+        blendFunc.setLazy(this, "glBlendFunc");
+        clear.setLazy(this, "glClear");
+        clearColor.setLazy(this, "glClearColor");
+        clearDepth.setLazy(this, "glClearDepth");
+        clearStencil.setLazy(this, "glClearStencil");
+        colorMask.setLazy(this, "glColorMask");
+        cullFace.setLazy(this, "glCullFace");
+        depthFunc.setLazy(this, "glDepthFunc");
+        depthMask.setLazy(this, "glDepthMask");
+        depthRange.setLazy(this, "glDepthRange");
+        disable.setLazy(this, "glDisable");
+        drawBuffer.setLazy(this, "glDrawBuffer");
+        enable.setLazy(this, "glEnable");
+        finish.setLazy(this, "glFinish");
+        flush.setLazy(this, "glFlush");
+        frontFace.setLazy(this, "glFrontFace");
+        getBooleanv.setLazy(this, "glGetBooleanv");
+        getDoublev.setLazy(this, "glGetDoublev");
+        getError.setLazy(this, "glGetError");
+        getFloatv.setLazy(this, "glGetFloatv");
+        getIntegerv.setLazy(this, "glGetIntegerv");
+        getString.setLazy(this, "glGetString");
+        getTexImage.setLazy(this, "glGetTexImage");
+        getTexLevelParameterfv.setLazy(this, "glGetTexLevelParameterfv");
+        getTexLevelParameteriv.setLazy(this, "glGetTexLevelParameteriv");
+        getTexParameterfv.setLazy(this, "glGetTexParameterfv");
+        getTexParameteriv.setLazy(this, "glGetTexParameteriv");
+        hint.setLazy(this, "glHint");
+        isEnabled.setLazy(this, "glIsEnabled");
+        lineWidth.setLazy(this, "glLineWidth");
+        logicOp.setLazy(this, "glLogicOp");
+        pixelStoref.setLazy(this, "glPixelStoref");
+        pixelStorei.setLazy(this, "glPixelStorei");
+        pointSize.setLazy(this, "glPointSize");
+        polygonMode.setLazy(this, "glPolygonMode");
+        readBuffer.setLazy(this, "glReadBuffer");
+        readPixels.setLazy(this, "glReadPixels");
+        scissor.setLazy(this, "glScissor");
+        stencilFunc.setLazy(this, "glStencilFunc");
+        stencilMask.setLazy(this, "glStencilMask");
+        stencilOp.setLazy(this, "glStencilOp");
+        texImage1D.setLazy(this, "glTexImage1D");
+        texImage2D.setLazy(this, "glTexImage2D");
+        texParameterf.setLazy(this, "glTexParameterf");
+        texParameterfv.setLazy(this, "glTexParameterfv");
+        texParameteri.setLazy(this, "glTexParameteri");
+        texParameteriv.setLazy(this, "glTexParameteriv");
+        viewport.setLazy(this, "glViewport");
     }
 
     // 1.1
     if (isAtLeastGL(gl::Version(1, 1)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBindTexture"), &bindTexture);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexImage1D"), &copyTexImage1D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexImage2D"), &copyTexImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexSubImage1D"), &copyTexSubImage1D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexSubImage2D"), &copyTexSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glDeleteTextures"), &deleteTextures);
-        AssignGLEntryPoint(loadProcAddress("glDrawArrays"), &drawArrays);
-        AssignGLEntryPoint(loadProcAddress("glDrawElements"), &drawElements);
-        AssignGLEntryPoint(loadProcAddress("glGenTextures"), &genTextures);
-        AssignGLEntryPoint(loadProcAddress("glIsTexture"), &isTexture);
-        AssignGLEntryPoint(loadProcAddress("glPolygonOffset"), &polygonOffset);
-        AssignGLEntryPoint(loadProcAddress("glTexSubImage1D"), &texSubImage1D);
-        AssignGLEntryPoint(loadProcAddress("glTexSubImage2D"), &texSubImage2D);
+        bindTexture.setLazy(this, "glBindTexture");
+        copyTexImage1D.setLazy(this, "glCopyTexImage1D");
+        copyTexImage2D.setLazy(this, "glCopyTexImage2D");
+        copyTexSubImage1D.setLazy(this, "glCopyTexSubImage1D");
+        copyTexSubImage2D.setLazy(this, "glCopyTexSubImage2D");
+        deleteTextures.setLazy(this, "glDeleteTextures");
+        drawArrays.setLazy(this, "glDrawArrays");
+        drawElements.setLazy(this, "glDrawElements");
+        genTextures.setLazy(this, "glGenTextures");
+        isTexture.setLazy(this, "glIsTexture");
+        polygonOffset.setLazy(this, "glPolygonOffset");
+        texSubImage1D.setLazy(this, "glTexSubImage1D");
+        texSubImage2D.setLazy(this, "glTexSubImage2D");
     }
 
     // 1.2
     if (isAtLeastGL(gl::Version(1, 2)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBlendColor"), &blendColor);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquation"), &blendEquation);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexSubImage3D"), &copyTexSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glDrawRangeElements"), &drawRangeElements);
-        AssignGLEntryPoint(loadProcAddress("glTexImage3D"), &texImage3D);
-        AssignGLEntryPoint(loadProcAddress("glTexSubImage3D"), &texSubImage3D);
+        blendColor.setLazy(this, "glBlendColor");
+        blendEquation.setLazy(this, "glBlendEquation");
+        copyTexSubImage3D.setLazy(this, "glCopyTexSubImage3D");
+        drawRangeElements.setLazy(this, "glDrawRangeElements");
+        texImage3D.setLazy(this, "glTexImage3D");
+        texSubImage3D.setLazy(this, "glTexSubImage3D");
     }
 
     // 1.3
     if (isAtLeastGL(gl::Version(1, 3)))
     {
-        AssignGLEntryPoint(loadProcAddress("glActiveTexture"), &activeTexture);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexImage1D"), &compressedTexImage1D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexImage2D"), &compressedTexImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexImage3D"), &compressedTexImage3D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexSubImage1D"), &compressedTexSubImage1D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexSubImage2D"), &compressedTexSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexSubImage3D"), &compressedTexSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glGetCompressedTexImage"), &getCompressedTexImage);
-        AssignGLEntryPoint(loadProcAddress("glSampleCoverage"), &sampleCoverage);
+        activeTexture.setLazy(this, "glActiveTexture");
+        compressedTexImage1D.setLazy(this, "glCompressedTexImage1D");
+        compressedTexImage2D.setLazy(this, "glCompressedTexImage2D");
+        compressedTexImage3D.setLazy(this, "glCompressedTexImage3D");
+        compressedTexSubImage1D.setLazy(this, "glCompressedTexSubImage1D");
+        compressedTexSubImage2D.setLazy(this, "glCompressedTexSubImage2D");
+        compressedTexSubImage3D.setLazy(this, "glCompressedTexSubImage3D");
+        getCompressedTexImage.setLazy(this, "glGetCompressedTexImage");
+        sampleCoverage.setLazy(this, "glSampleCoverage");
     }
 
     // 1.4
     if (isAtLeastGL(gl::Version(1, 4)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBlendFuncSeparate"), &blendFuncSeparate);
-        AssignGLEntryPoint(loadProcAddress("glMultiDrawArrays"), &multiDrawArrays);
-        AssignGLEntryPoint(loadProcAddress("glMultiDrawElements"), &multiDrawElements);
-        AssignGLEntryPoint(loadProcAddress("glPointParameterf"), &pointParameterf);
-        AssignGLEntryPoint(loadProcAddress("glPointParameterfv"), &pointParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glPointParameteri"), &pointParameteri);
-        AssignGLEntryPoint(loadProcAddress("glPointParameteriv"), &pointParameteriv);
+        blendFuncSeparate.setLazy(this, "glBlendFuncSeparate");
+        multiDrawArrays.setLazy(this, "glMultiDrawArrays");
+        multiDrawElements.setLazy(this, "glMultiDrawElements");
+        pointParameterf.setLazy(this, "glPointParameterf");
+        pointParameterfv.setLazy(this, "glPointParameterfv");
+        pointParameteri.setLazy(this, "glPointParameteri");
+        pointParameteriv.setLazy(this, "glPointParameteriv");
     }
 
     // 1.5
     if (isAtLeastGL(gl::Version(1, 5)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBeginQuery"), &beginQuery);
-        AssignGLEntryPoint(loadProcAddress("glBindBuffer"), &bindBuffer);
-        AssignGLEntryPoint(loadProcAddress("glBufferData"), &bufferData);
-        AssignGLEntryPoint(loadProcAddress("glBufferSubData"), &bufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glDeleteBuffers"), &deleteBuffers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteQueries"), &deleteQueries);
-        AssignGLEntryPoint(loadProcAddress("glEndQuery"), &endQuery);
-        AssignGLEntryPoint(loadProcAddress("glGenBuffers"), &genBuffers);
-        AssignGLEntryPoint(loadProcAddress("glGenQueries"), &genQueries);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferParameteriv"), &getBufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferPointerv"), &getBufferPointerv);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferSubData"), &getBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryObjectiv"), &getQueryObjectiv);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryObjectuiv"), &getQueryObjectuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryiv"), &getQueryiv);
-        AssignGLEntryPoint(loadProcAddress("glIsBuffer"), &isBuffer);
-        AssignGLEntryPoint(loadProcAddress("glIsQuery"), &isQuery);
-        AssignGLEntryPoint(loadProcAddress("glMapBuffer"), &mapBuffer);
-        AssignGLEntryPoint(loadProcAddress("glUnmapBuffer"), &unmapBuffer);
+        beginQuery.setLazy(this, "glBeginQuery");
+        bindBuffer.setLazy(this, "glBindBuffer");
+        bufferData.setLazy(this, "glBufferData");
+        bufferSubData.setLazy(this, "glBufferSubData");
+        deleteBuffers.setLazy(this, "glDeleteBuffers");
+        deleteQueries.setLazy(this, "glDeleteQueries");
+        endQuery.setLazy(this, "glEndQuery");
+        genBuffers.setLazy(this, "glGenBuffers");
+        genQueries.setLazy(this, "glGenQueries");
+        getBufferParameteriv.setLazy(this, "glGetBufferParameteriv");
+        getBufferPointerv.setLazy(this, "glGetBufferPointerv");
+        getBufferSubData.setLazy(this, "glGetBufferSubData");
+        getQueryObjectiv.setLazy(this, "glGetQueryObjectiv");
+        getQueryObjectuiv.setLazy(this, "glGetQueryObjectuiv");
+        getQueryiv.setLazy(this, "glGetQueryiv");
+        isBuffer.setLazy(this, "glIsBuffer");
+        isQuery.setLazy(this, "glIsQuery");
+        mapBuffer.setLazy(this, "glMapBuffer");
+        unmapBuffer.setLazy(this, "glUnmapBuffer");
     }
 
     // 2.0
     if (isAtLeastGL(gl::Version(2, 0)))
     {
-        AssignGLEntryPoint(loadProcAddress("glAttachShader"), &attachShader);
-        AssignGLEntryPoint(loadProcAddress("glBindAttribLocation"), &bindAttribLocation);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquationSeparate"), &blendEquationSeparate);
-        AssignGLEntryPoint(loadProcAddress("glCompileShader"), &compileShader);
-        AssignGLEntryPoint(loadProcAddress("glCreateProgram"), &createProgram);
-        AssignGLEntryPoint(loadProcAddress("glCreateShader"), &createShader);
-        AssignGLEntryPoint(loadProcAddress("glDeleteProgram"), &deleteProgram);
-        AssignGLEntryPoint(loadProcAddress("glDeleteShader"), &deleteShader);
-        AssignGLEntryPoint(loadProcAddress("glDetachShader"), &detachShader);
-        AssignGLEntryPoint(loadProcAddress("glDisableVertexAttribArray"), &disableVertexAttribArray);
-        AssignGLEntryPoint(loadProcAddress("glDrawBuffers"), &drawBuffers);
-        AssignGLEntryPoint(loadProcAddress("glEnableVertexAttribArray"), &enableVertexAttribArray);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveAttrib"), &getActiveAttrib);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniform"), &getActiveUniform);
-        AssignGLEntryPoint(loadProcAddress("glGetAttachedShaders"), &getAttachedShaders);
-        AssignGLEntryPoint(loadProcAddress("glGetAttribLocation"), &getAttribLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramInfoLog"), &getProgramInfoLog);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramiv"), &getProgramiv);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderInfoLog"), &getShaderInfoLog);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderSource"), &getShaderSource);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderiv"), &getShaderiv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformLocation"), &getUniformLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformfv"), &getUniformfv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformiv"), &getUniformiv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribPointerv"), &getVertexAttribPointerv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribdv"), &getVertexAttribdv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribfv"), &getVertexAttribfv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribiv"), &getVertexAttribiv);
-        AssignGLEntryPoint(loadProcAddress("glIsProgram"), &isProgram);
-        AssignGLEntryPoint(loadProcAddress("glIsShader"), &isShader);
-        AssignGLEntryPoint(loadProcAddress("glLinkProgram"), &linkProgram);
-        AssignGLEntryPoint(loadProcAddress("glShaderSource"), &shaderSource);
-        AssignGLEntryPoint(loadProcAddress("glStencilFuncSeparate"), &stencilFuncSeparate);
-        AssignGLEntryPoint(loadProcAddress("glStencilMaskSeparate"), &stencilMaskSeparate);
-        AssignGLEntryPoint(loadProcAddress("glStencilOpSeparate"), &stencilOpSeparate);
-        AssignGLEntryPoint(loadProcAddress("glUniform1f"), &uniform1f);
-        AssignGLEntryPoint(loadProcAddress("glUniform1fv"), &uniform1fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform1i"), &uniform1i);
-        AssignGLEntryPoint(loadProcAddress("glUniform1iv"), &uniform1iv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2f"), &uniform2f);
-        AssignGLEntryPoint(loadProcAddress("glUniform2fv"), &uniform2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2i"), &uniform2i);
-        AssignGLEntryPoint(loadProcAddress("glUniform2iv"), &uniform2iv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3f"), &uniform3f);
-        AssignGLEntryPoint(loadProcAddress("glUniform3fv"), &uniform3fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3i"), &uniform3i);
-        AssignGLEntryPoint(loadProcAddress("glUniform3iv"), &uniform3iv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4f"), &uniform4f);
-        AssignGLEntryPoint(loadProcAddress("glUniform4fv"), &uniform4fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4i"), &uniform4i);
-        AssignGLEntryPoint(loadProcAddress("glUniform4iv"), &uniform4iv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2fv"), &uniformMatrix2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3fv"), &uniformMatrix3fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4fv"), &uniformMatrix4fv);
-        AssignGLEntryPoint(loadProcAddress("glUseProgram"), &useProgram);
-        AssignGLEntryPoint(loadProcAddress("glValidateProgram"), &validateProgram);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1d"), &vertexAttrib1d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1dv"), &vertexAttrib1dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1f"), &vertexAttrib1f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1fv"), &vertexAttrib1fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1s"), &vertexAttrib1s);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1sv"), &vertexAttrib1sv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2d"), &vertexAttrib2d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2dv"), &vertexAttrib2dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2f"), &vertexAttrib2f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2fv"), &vertexAttrib2fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2s"), &vertexAttrib2s);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2sv"), &vertexAttrib2sv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3d"), &vertexAttrib3d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3dv"), &vertexAttrib3dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3f"), &vertexAttrib3f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3fv"), &vertexAttrib3fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3s"), &vertexAttrib3s);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3sv"), &vertexAttrib3sv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Nbv"), &vertexAttrib4Nbv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Niv"), &vertexAttrib4Niv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Nsv"), &vertexAttrib4Nsv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Nub"), &vertexAttrib4Nub);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Nubv"), &vertexAttrib4Nubv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Nuiv"), &vertexAttrib4Nuiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4Nusv"), &vertexAttrib4Nusv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4bv"), &vertexAttrib4bv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4d"), &vertexAttrib4d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4dv"), &vertexAttrib4dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4f"), &vertexAttrib4f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4fv"), &vertexAttrib4fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4iv"), &vertexAttrib4iv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4s"), &vertexAttrib4s);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4sv"), &vertexAttrib4sv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4ubv"), &vertexAttrib4ubv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4uiv"), &vertexAttrib4uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4usv"), &vertexAttrib4usv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribPointer"), &vertexAttribPointer);
+        attachShader.setLazy(this, "glAttachShader");
+        bindAttribLocation.setLazy(this, "glBindAttribLocation");
+        blendEquationSeparate.setLazy(this, "glBlendEquationSeparate");
+        compileShader.setLazy(this, "glCompileShader");
+        createProgram.setLazy(this, "glCreateProgram");
+        createShader.setLazy(this, "glCreateShader");
+        deleteProgram.setLazy(this, "glDeleteProgram");
+        deleteShader.setLazy(this, "glDeleteShader");
+        detachShader.setLazy(this, "glDetachShader");
+        disableVertexAttribArray.setLazy(this, "glDisableVertexAttribArray");
+        drawBuffers.setLazy(this, "glDrawBuffers");
+        enableVertexAttribArray.setLazy(this, "glEnableVertexAttribArray");
+        getActiveAttrib.setLazy(this, "glGetActiveAttrib");
+        getActiveUniform.setLazy(this, "glGetActiveUniform");
+        getAttachedShaders.setLazy(this, "glGetAttachedShaders");
+        getAttribLocation.setLazy(this, "glGetAttribLocation");
+        getProgramInfoLog.setLazy(this, "glGetProgramInfoLog");
+        getProgramiv.setLazy(this, "glGetProgramiv");
+        getShaderInfoLog.setLazy(this, "glGetShaderInfoLog");
+        getShaderSource.setLazy(this, "glGetShaderSource");
+        getShaderiv.setLazy(this, "glGetShaderiv");
+        getUniformLocation.setLazy(this, "glGetUniformLocation");
+        getUniformfv.setLazy(this, "glGetUniformfv");
+        getUniformiv.setLazy(this, "glGetUniformiv");
+        getVertexAttribPointerv.setLazy(this, "glGetVertexAttribPointerv");
+        getVertexAttribdv.setLazy(this, "glGetVertexAttribdv");
+        getVertexAttribfv.setLazy(this, "glGetVertexAttribfv");
+        getVertexAttribiv.setLazy(this, "glGetVertexAttribiv");
+        isProgram.setLazy(this, "glIsProgram");
+        isShader.setLazy(this, "glIsShader");
+        linkProgram.setLazy(this, "glLinkProgram");
+        shaderSource.setLazy(this, "glShaderSource");
+        stencilFuncSeparate.setLazy(this, "glStencilFuncSeparate");
+        stencilMaskSeparate.setLazy(this, "glStencilMaskSeparate");
+        stencilOpSeparate.setLazy(this, "glStencilOpSeparate");
+        uniform1f.setLazy(this, "glUniform1f");
+        uniform1fv.setLazy(this, "glUniform1fv");
+        uniform1i.setLazy(this, "glUniform1i");
+        uniform1iv.setLazy(this, "glUniform1iv");
+        uniform2f.setLazy(this, "glUniform2f");
+        uniform2fv.setLazy(this, "glUniform2fv");
+        uniform2i.setLazy(this, "glUniform2i");
+        uniform2iv.setLazy(this, "glUniform2iv");
+        uniform3f.setLazy(this, "glUniform3f");
+        uniform3fv.setLazy(this, "glUniform3fv");
+        uniform3i.setLazy(this, "glUniform3i");
+        uniform3iv.setLazy(this, "glUniform3iv");
+        uniform4f.setLazy(this, "glUniform4f");
+        uniform4fv.setLazy(this, "glUniform4fv");
+        uniform4i.setLazy(this, "glUniform4i");
+        uniform4iv.setLazy(this, "glUniform4iv");
+        uniformMatrix2fv.setLazy(this, "glUniformMatrix2fv");
+        uniformMatrix3fv.setLazy(this, "glUniformMatrix3fv");
+        uniformMatrix4fv.setLazy(this, "glUniformMatrix4fv");
+        useProgram.setLazy(this, "glUseProgram");
+        validateProgram.setLazy(this, "glValidateProgram");
+        vertexAttrib1d.setLazy(this, "glVertexAttrib1d");
+        vertexAttrib1dv.setLazy(this, "glVertexAttrib1dv");
+        vertexAttrib1f.setLazy(this, "glVertexAttrib1f");
+        vertexAttrib1fv.setLazy(this, "glVertexAttrib1fv");
+        vertexAttrib1s.setLazy(this, "glVertexAttrib1s");
+        vertexAttrib1sv.setLazy(this, "glVertexAttrib1sv");
+        vertexAttrib2d.setLazy(this, "glVertexAttrib2d");
+        vertexAttrib2dv.setLazy(this, "glVertexAttrib2dv");
+        vertexAttrib2f.setLazy(this, "glVertexAttrib2f");
+        vertexAttrib2fv.setLazy(this, "glVertexAttrib2fv");
+        vertexAttrib2s.setLazy(this, "glVertexAttrib2s");
+        vertexAttrib2sv.setLazy(this, "glVertexAttrib2sv");
+        vertexAttrib3d.setLazy(this, "glVertexAttrib3d");
+        vertexAttrib3dv.setLazy(this, "glVertexAttrib3dv");
+        vertexAttrib3f.setLazy(this, "glVertexAttrib3f");
+        vertexAttrib3fv.setLazy(this, "glVertexAttrib3fv");
+        vertexAttrib3s.setLazy(this, "glVertexAttrib3s");
+        vertexAttrib3sv.setLazy(this, "glVertexAttrib3sv");
+        vertexAttrib4Nbv.setLazy(this, "glVertexAttrib4Nbv");
+        vertexAttrib4Niv.setLazy(this, "glVertexAttrib4Niv");
+        vertexAttrib4Nsv.setLazy(this, "glVertexAttrib4Nsv");
+        vertexAttrib4Nub.setLazy(this, "glVertexAttrib4Nub");
+        vertexAttrib4Nubv.setLazy(this, "glVertexAttrib4Nubv");
+        vertexAttrib4Nuiv.setLazy(this, "glVertexAttrib4Nuiv");
+        vertexAttrib4Nusv.setLazy(this, "glVertexAttrib4Nusv");
+        vertexAttrib4bv.setLazy(this, "glVertexAttrib4bv");
+        vertexAttrib4d.setLazy(this, "glVertexAttrib4d");
+        vertexAttrib4dv.setLazy(this, "glVertexAttrib4dv");
+        vertexAttrib4f.setLazy(this, "glVertexAttrib4f");
+        vertexAttrib4fv.setLazy(this, "glVertexAttrib4fv");
+        vertexAttrib4iv.setLazy(this, "glVertexAttrib4iv");
+        vertexAttrib4s.setLazy(this, "glVertexAttrib4s");
+        vertexAttrib4sv.setLazy(this, "glVertexAttrib4sv");
+        vertexAttrib4ubv.setLazy(this, "glVertexAttrib4ubv");
+        vertexAttrib4uiv.setLazy(this, "glVertexAttrib4uiv");
+        vertexAttrib4usv.setLazy(this, "glVertexAttrib4usv");
+        vertexAttribPointer.setLazy(this, "glVertexAttribPointer");
     }
 
     // 2.1
     if (isAtLeastGL(gl::Version(2, 1)))
     {
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2x3fv"), &uniformMatrix2x3fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2x4fv"), &uniformMatrix2x4fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3x2fv"), &uniformMatrix3x2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3x4fv"), &uniformMatrix3x4fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4x2fv"), &uniformMatrix4x2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4x3fv"), &uniformMatrix4x3fv);
+        uniformMatrix2x3fv.setLazy(this, "glUniformMatrix2x3fv");
+        uniformMatrix2x4fv.setLazy(this, "glUniformMatrix2x4fv");
+        uniformMatrix3x2fv.setLazy(this, "glUniformMatrix3x2fv");
+        uniformMatrix3x4fv.setLazy(this, "glUniformMatrix3x4fv");
+        uniformMatrix4x2fv.setLazy(this, "glUniformMatrix4x2fv");
+        uniformMatrix4x3fv.setLazy(this, "glUniformMatrix4x3fv");
     }
 
     // 3.0
     if (isAtLeastGL(gl::Version(3, 0)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBeginConditionalRender"), &beginConditionalRender);
-        AssignGLEntryPoint(loadProcAddress("glBeginTransformFeedback"), &beginTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glBindBufferBase"), &bindBufferBase);
-        AssignGLEntryPoint(loadProcAddress("glBindBufferRange"), &bindBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glBindFragDataLocation"), &bindFragDataLocation);
-        AssignGLEntryPoint(loadProcAddress("glBindFramebuffer"), &bindFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glBindRenderbuffer"), &bindRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glBindVertexArray"), &bindVertexArray);
-        AssignGLEntryPoint(loadProcAddress("glBlitFramebuffer"), &blitFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glCheckFramebufferStatus"), &checkFramebufferStatus);
-        AssignGLEntryPoint(loadProcAddress("glClampColor"), &clampColor);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferfi"), &clearBufferfi);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferfv"), &clearBufferfv);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferiv"), &clearBufferiv);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferuiv"), &clearBufferuiv);
-        AssignGLEntryPoint(loadProcAddress("glColorMaski"), &colorMaski);
-        AssignGLEntryPoint(loadProcAddress("glDeleteFramebuffers"), &deleteFramebuffers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteRenderbuffers"), &deleteRenderbuffers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteVertexArrays"), &deleteVertexArrays);
-        AssignGLEntryPoint(loadProcAddress("glDisablei"), &disablei);
-        AssignGLEntryPoint(loadProcAddress("glEnablei"), &enablei);
-        AssignGLEntryPoint(loadProcAddress("glEndConditionalRender"), &endConditionalRender);
-        AssignGLEntryPoint(loadProcAddress("glEndTransformFeedback"), &endTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glFlushMappedBufferRange"), &flushMappedBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferRenderbuffer"), &framebufferRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTexture1D"), &framebufferTexture1D);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTexture2D"), &framebufferTexture2D);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTexture3D"), &framebufferTexture3D);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTextureLayer"), &framebufferTextureLayer);
-        AssignGLEntryPoint(loadProcAddress("glGenFramebuffers"), &genFramebuffers);
-        AssignGLEntryPoint(loadProcAddress("glGenRenderbuffers"), &genRenderbuffers);
-        AssignGLEntryPoint(loadProcAddress("glGenVertexArrays"), &genVertexArrays);
-        AssignGLEntryPoint(loadProcAddress("glGenerateMipmap"), &generateMipmap);
-        AssignGLEntryPoint(loadProcAddress("glGetBooleani_v"), &getBooleani_v);
-        AssignGLEntryPoint(loadProcAddress("glGetFragDataLocation"), &getFragDataLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetFramebufferAttachmentParameteriv"), &getFramebufferAttachmentParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetIntegeri_v"), &getIntegeri_v);
-        AssignGLEntryPoint(loadProcAddress("glGetRenderbufferParameteriv"), &getRenderbufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetStringi"), &getStringi);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameterIiv"), &getTexParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameterIuiv"), &getTexParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTransformFeedbackVarying"), &getTransformFeedbackVarying);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformuiv"), &getUniformuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribIiv"), &getVertexAttribIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribIuiv"), &getVertexAttribIuiv);
-        AssignGLEntryPoint(loadProcAddress("glIsEnabledi"), &isEnabledi);
-        AssignGLEntryPoint(loadProcAddress("glIsFramebuffer"), &isFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glIsRenderbuffer"), &isRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glIsVertexArray"), &isVertexArray);
-        AssignGLEntryPoint(loadProcAddress("glMapBufferRange"), &mapBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glRenderbufferStorage"), &renderbufferStorage);
-        AssignGLEntryPoint(loadProcAddress("glRenderbufferStorageMultisample"), &renderbufferStorageMultisample);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterIiv"), &texParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterIuiv"), &texParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glTransformFeedbackVaryings"), &transformFeedbackVaryings);
-        AssignGLEntryPoint(loadProcAddress("glUniform1ui"), &uniform1ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform1uiv"), &uniform1uiv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2ui"), &uniform2ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform2uiv"), &uniform2uiv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3ui"), &uniform3ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform3uiv"), &uniform3uiv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4ui"), &uniform4ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform4uiv"), &uniform4uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI1i"), &vertexAttribI1i);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI1iv"), &vertexAttribI1iv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI1ui"), &vertexAttribI1ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI1uiv"), &vertexAttribI1uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI2i"), &vertexAttribI2i);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI2iv"), &vertexAttribI2iv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI2ui"), &vertexAttribI2ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI2uiv"), &vertexAttribI2uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI3i"), &vertexAttribI3i);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI3iv"), &vertexAttribI3iv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI3ui"), &vertexAttribI3ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI3uiv"), &vertexAttribI3uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4bv"), &vertexAttribI4bv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4i"), &vertexAttribI4i);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4iv"), &vertexAttribI4iv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4sv"), &vertexAttribI4sv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4ubv"), &vertexAttribI4ubv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4ui"), &vertexAttribI4ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4uiv"), &vertexAttribI4uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4usv"), &vertexAttribI4usv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribIPointer"), &vertexAttribIPointer);
+        beginConditionalRender.setLazy(this, "glBeginConditionalRender");
+        beginTransformFeedback.setLazy(this, "glBeginTransformFeedback");
+        bindBufferBase.setLazy(this, "glBindBufferBase");
+        bindBufferRange.setLazy(this, "glBindBufferRange");
+        bindFragDataLocation.setLazy(this, "glBindFragDataLocation");
+        bindFramebuffer.setLazy(this, "glBindFramebuffer");
+        bindRenderbuffer.setLazy(this, "glBindRenderbuffer");
+        bindVertexArray.setLazy(this, "glBindVertexArray");
+        blitFramebuffer.setLazy(this, "glBlitFramebuffer");
+        checkFramebufferStatus.setLazy(this, "glCheckFramebufferStatus");
+        clampColor.setLazy(this, "glClampColor");
+        clearBufferfi.setLazy(this, "glClearBufferfi");
+        clearBufferfv.setLazy(this, "glClearBufferfv");
+        clearBufferiv.setLazy(this, "glClearBufferiv");
+        clearBufferuiv.setLazy(this, "glClearBufferuiv");
+        colorMaski.setLazy(this, "glColorMaski");
+        deleteFramebuffers.setLazy(this, "glDeleteFramebuffers");
+        deleteRenderbuffers.setLazy(this, "glDeleteRenderbuffers");
+        deleteVertexArrays.setLazy(this, "glDeleteVertexArrays");
+        disablei.setLazy(this, "glDisablei");
+        enablei.setLazy(this, "glEnablei");
+        endConditionalRender.setLazy(this, "glEndConditionalRender");
+        endTransformFeedback.setLazy(this, "glEndTransformFeedback");
+        flushMappedBufferRange.setLazy(this, "glFlushMappedBufferRange");
+        framebufferRenderbuffer.setLazy(this, "glFramebufferRenderbuffer");
+        framebufferTexture1D.setLazy(this, "glFramebufferTexture1D");
+        framebufferTexture2D.setLazy(this, "glFramebufferTexture2D");
+        framebufferTexture3D.setLazy(this, "glFramebufferTexture3D");
+        framebufferTextureLayer.setLazy(this, "glFramebufferTextureLayer");
+        genFramebuffers.setLazy(this, "glGenFramebuffers");
+        genRenderbuffers.setLazy(this, "glGenRenderbuffers");
+        genVertexArrays.setLazy(this, "glGenVertexArrays");
+        generateMipmap.setLazy(this, "glGenerateMipmap");
+        getBooleani_v.setLazy(this, "glGetBooleani_v");
+        getFragDataLocation.setLazy(this, "glGetFragDataLocation");
+        getFramebufferAttachmentParameteriv.setLazy(this, "glGetFramebufferAttachmentParameteriv");
+        getIntegeri_v.setLazy(this, "glGetIntegeri_v");
+        getRenderbufferParameteriv.setLazy(this, "glGetRenderbufferParameteriv");
+        getStringi.setLazy(this, "glGetStringi");
+        getTexParameterIiv.setLazy(this, "glGetTexParameterIiv");
+        getTexParameterIuiv.setLazy(this, "glGetTexParameterIuiv");
+        getTransformFeedbackVarying.setLazy(this, "glGetTransformFeedbackVarying");
+        getUniformuiv.setLazy(this, "glGetUniformuiv");
+        getVertexAttribIiv.setLazy(this, "glGetVertexAttribIiv");
+        getVertexAttribIuiv.setLazy(this, "glGetVertexAttribIuiv");
+        isEnabledi.setLazy(this, "glIsEnabledi");
+        isFramebuffer.setLazy(this, "glIsFramebuffer");
+        isRenderbuffer.setLazy(this, "glIsRenderbuffer");
+        isVertexArray.setLazy(this, "glIsVertexArray");
+        mapBufferRange.setLazy(this, "glMapBufferRange");
+        renderbufferStorage.setLazy(this, "glRenderbufferStorage");
+        renderbufferStorageMultisample.setLazy(this, "glRenderbufferStorageMultisample");
+        texParameterIiv.setLazy(this, "glTexParameterIiv");
+        texParameterIuiv.setLazy(this, "glTexParameterIuiv");
+        transformFeedbackVaryings.setLazy(this, "glTransformFeedbackVaryings");
+        uniform1ui.setLazy(this, "glUniform1ui");
+        uniform1uiv.setLazy(this, "glUniform1uiv");
+        uniform2ui.setLazy(this, "glUniform2ui");
+        uniform2uiv.setLazy(this, "glUniform2uiv");
+        uniform3ui.setLazy(this, "glUniform3ui");
+        uniform3uiv.setLazy(this, "glUniform3uiv");
+        uniform4ui.setLazy(this, "glUniform4ui");
+        uniform4uiv.setLazy(this, "glUniform4uiv");
+        vertexAttribI1i.setLazy(this, "glVertexAttribI1i");
+        vertexAttribI1iv.setLazy(this, "glVertexAttribI1iv");
+        vertexAttribI1ui.setLazy(this, "glVertexAttribI1ui");
+        vertexAttribI1uiv.setLazy(this, "glVertexAttribI1uiv");
+        vertexAttribI2i.setLazy(this, "glVertexAttribI2i");
+        vertexAttribI2iv.setLazy(this, "glVertexAttribI2iv");
+        vertexAttribI2ui.setLazy(this, "glVertexAttribI2ui");
+        vertexAttribI2uiv.setLazy(this, "glVertexAttribI2uiv");
+        vertexAttribI3i.setLazy(this, "glVertexAttribI3i");
+        vertexAttribI3iv.setLazy(this, "glVertexAttribI3iv");
+        vertexAttribI3ui.setLazy(this, "glVertexAttribI3ui");
+        vertexAttribI3uiv.setLazy(this, "glVertexAttribI3uiv");
+        vertexAttribI4bv.setLazy(this, "glVertexAttribI4bv");
+        vertexAttribI4i.setLazy(this, "glVertexAttribI4i");
+        vertexAttribI4iv.setLazy(this, "glVertexAttribI4iv");
+        vertexAttribI4sv.setLazy(this, "glVertexAttribI4sv");
+        vertexAttribI4ubv.setLazy(this, "glVertexAttribI4ubv");
+        vertexAttribI4ui.setLazy(this, "glVertexAttribI4ui");
+        vertexAttribI4uiv.setLazy(this, "glVertexAttribI4uiv");
+        vertexAttribI4usv.setLazy(this, "glVertexAttribI4usv");
+        vertexAttribIPointer.setLazy(this, "glVertexAttribIPointer");
     }
 
     // 3.1
     if (isAtLeastGL(gl::Version(3, 1)))
     {
-        AssignGLEntryPoint(loadProcAddress("glCopyBufferSubData"), &copyBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glDrawArraysInstanced"), &drawArraysInstanced);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsInstanced"), &drawElementsInstanced);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformBlockName"), &getActiveUniformBlockName);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformBlockiv"), &getActiveUniformBlockiv);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformName"), &getActiveUniformName);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformsiv"), &getActiveUniformsiv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformBlockIndex"), &getUniformBlockIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformIndices"), &getUniformIndices);
-        AssignGLEntryPoint(loadProcAddress("glPrimitiveRestartIndex"), &primitiveRestartIndex);
-        AssignGLEntryPoint(loadProcAddress("glTexBuffer"), &texBuffer);
-        AssignGLEntryPoint(loadProcAddress("glUniformBlockBinding"), &uniformBlockBinding);
+        copyBufferSubData.setLazy(this, "glCopyBufferSubData");
+        drawArraysInstanced.setLazy(this, "glDrawArraysInstanced");
+        drawElementsInstanced.setLazy(this, "glDrawElementsInstanced");
+        getActiveUniformBlockName.setLazy(this, "glGetActiveUniformBlockName");
+        getActiveUniformBlockiv.setLazy(this, "glGetActiveUniformBlockiv");
+        getActiveUniformName.setLazy(this, "glGetActiveUniformName");
+        getActiveUniformsiv.setLazy(this, "glGetActiveUniformsiv");
+        getUniformBlockIndex.setLazy(this, "glGetUniformBlockIndex");
+        getUniformIndices.setLazy(this, "glGetUniformIndices");
+        primitiveRestartIndex.setLazy(this, "glPrimitiveRestartIndex");
+        texBuffer.setLazy(this, "glTexBuffer");
+        uniformBlockBinding.setLazy(this, "glUniformBlockBinding");
     }
 
     // 3.2
     if (isAtLeastGL(gl::Version(3, 2)))
     {
-        AssignGLEntryPoint(loadProcAddress("glClientWaitSync"), &clientWaitSync);
-        AssignGLEntryPoint(loadProcAddress("glDeleteSync"), &deleteSync);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsBaseVertex"), &drawElementsBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsInstancedBaseVertex"), &drawElementsInstancedBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glDrawRangeElementsBaseVertex"), &drawRangeElementsBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glFenceSync"), &fenceSync);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTexture"), &framebufferTexture);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferParameteri64v"), &getBufferParameteri64v);
-        AssignGLEntryPoint(loadProcAddress("glGetInteger64i_v"), &getInteger64i_v);
-        AssignGLEntryPoint(loadProcAddress("glGetInteger64v"), &getInteger64v);
-        AssignGLEntryPoint(loadProcAddress("glGetMultisamplefv"), &getMultisamplefv);
-        AssignGLEntryPoint(loadProcAddress("glGetSynciv"), &getSynciv);
-        AssignGLEntryPoint(loadProcAddress("glIsSync"), &isSync);
-        AssignGLEntryPoint(loadProcAddress("glMultiDrawElementsBaseVertex"), &multiDrawElementsBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glProvokingVertex"), &provokingVertex);
-        AssignGLEntryPoint(loadProcAddress("glSampleMaski"), &sampleMaski);
-        AssignGLEntryPoint(loadProcAddress("glTexImage2DMultisample"), &texImage2DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glTexImage3DMultisample"), &texImage3DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glWaitSync"), &waitSync);
+        clientWaitSync.setLazy(this, "glClientWaitSync");
+        deleteSync.setLazy(this, "glDeleteSync");
+        drawElementsBaseVertex.setLazy(this, "glDrawElementsBaseVertex");
+        drawElementsInstancedBaseVertex.setLazy(this, "glDrawElementsInstancedBaseVertex");
+        drawRangeElementsBaseVertex.setLazy(this, "glDrawRangeElementsBaseVertex");
+        fenceSync.setLazy(this, "glFenceSync");
+        framebufferTexture.setLazy(this, "glFramebufferTexture");
+        getBufferParameteri64v.setLazy(this, "glGetBufferParameteri64v");
+        getInteger64i_v.setLazy(this, "glGetInteger64i_v");
+        getInteger64v.setLazy(this, "glGetInteger64v");
+        getMultisamplefv.setLazy(this, "glGetMultisamplefv");
+        getSynciv.setLazy(this, "glGetSynciv");
+        isSync.setLazy(this, "glIsSync");
+        multiDrawElementsBaseVertex.setLazy(this, "glMultiDrawElementsBaseVertex");
+        provokingVertex.setLazy(this, "glProvokingVertex");
+        sampleMaski.setLazy(this, "glSampleMaski");
+        texImage2DMultisample.setLazy(this, "glTexImage2DMultisample");
+        texImage3DMultisample.setLazy(this, "glTexImage3DMultisample");
+        waitSync.setLazy(this, "glWaitSync");
     }
 
     // 3.3
     if (isAtLeastGL(gl::Version(3, 3)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBindFragDataLocationIndexed"), &bindFragDataLocationIndexed);
-        AssignGLEntryPoint(loadProcAddress("glBindSampler"), &bindSampler);
-        AssignGLEntryPoint(loadProcAddress("glDeleteSamplers"), &deleteSamplers);
-        AssignGLEntryPoint(loadProcAddress("glGenSamplers"), &genSamplers);
-        AssignGLEntryPoint(loadProcAddress("glGetFragDataIndex"), &getFragDataIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryObjecti64v"), &getQueryObjecti64v);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryObjectui64v"), &getQueryObjectui64v);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameterIiv"), &getSamplerParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameterIuiv"), &getSamplerParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameterfv"), &getSamplerParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameteriv"), &getSamplerParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glIsSampler"), &isSampler);
-        AssignGLEntryPoint(loadProcAddress("glQueryCounter"), &queryCounter);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterIiv"), &samplerParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterIuiv"), &samplerParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterf"), &samplerParameterf);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterfv"), &samplerParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameteri"), &samplerParameteri);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameteriv"), &samplerParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribDivisor"), &vertexAttribDivisor);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP1ui"), &vertexAttribP1ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP1uiv"), &vertexAttribP1uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP2ui"), &vertexAttribP2ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP2uiv"), &vertexAttribP2uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP3ui"), &vertexAttribP3ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP3uiv"), &vertexAttribP3uiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP4ui"), &vertexAttribP4ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribP4uiv"), &vertexAttribP4uiv);
+        bindFragDataLocationIndexed.setLazy(this, "glBindFragDataLocationIndexed");
+        bindSampler.setLazy(this, "glBindSampler");
+        deleteSamplers.setLazy(this, "glDeleteSamplers");
+        genSamplers.setLazy(this, "glGenSamplers");
+        getFragDataIndex.setLazy(this, "glGetFragDataIndex");
+        getQueryObjecti64v.setLazy(this, "glGetQueryObjecti64v");
+        getQueryObjectui64v.setLazy(this, "glGetQueryObjectui64v");
+        getSamplerParameterIiv.setLazy(this, "glGetSamplerParameterIiv");
+        getSamplerParameterIuiv.setLazy(this, "glGetSamplerParameterIuiv");
+        getSamplerParameterfv.setLazy(this, "glGetSamplerParameterfv");
+        getSamplerParameteriv.setLazy(this, "glGetSamplerParameteriv");
+        isSampler.setLazy(this, "glIsSampler");
+        queryCounter.setLazy(this, "glQueryCounter");
+        samplerParameterIiv.setLazy(this, "glSamplerParameterIiv");
+        samplerParameterIuiv.setLazy(this, "glSamplerParameterIuiv");
+        samplerParameterf.setLazy(this, "glSamplerParameterf");
+        samplerParameterfv.setLazy(this, "glSamplerParameterfv");
+        samplerParameteri.setLazy(this, "glSamplerParameteri");
+        samplerParameteriv.setLazy(this, "glSamplerParameteriv");
+        vertexAttribDivisor.setLazy(this, "glVertexAttribDivisor");
+        vertexAttribP1ui.setLazy(this, "glVertexAttribP1ui");
+        vertexAttribP1uiv.setLazy(this, "glVertexAttribP1uiv");
+        vertexAttribP2ui.setLazy(this, "glVertexAttribP2ui");
+        vertexAttribP2uiv.setLazy(this, "glVertexAttribP2uiv");
+        vertexAttribP3ui.setLazy(this, "glVertexAttribP3ui");
+        vertexAttribP3uiv.setLazy(this, "glVertexAttribP3uiv");
+        vertexAttribP4ui.setLazy(this, "glVertexAttribP4ui");
+        vertexAttribP4uiv.setLazy(this, "glVertexAttribP4uiv");
     }
 
     // 4.0
     if (isAtLeastGL(gl::Version(4, 0)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBeginQueryIndexed"), &beginQueryIndexed);
-        AssignGLEntryPoint(loadProcAddress("glBindTransformFeedback"), &bindTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquationSeparatei"), &blendEquationSeparatei);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquationi"), &blendEquationi);
-        AssignGLEntryPoint(loadProcAddress("glBlendFuncSeparatei"), &blendFuncSeparatei);
-        AssignGLEntryPoint(loadProcAddress("glBlendFunci"), &blendFunci);
-        AssignGLEntryPoint(loadProcAddress("glDeleteTransformFeedbacks"), &deleteTransformFeedbacks);
-        AssignGLEntryPoint(loadProcAddress("glDrawArraysIndirect"), &drawArraysIndirect);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsIndirect"), &drawElementsIndirect);
-        AssignGLEntryPoint(loadProcAddress("glDrawTransformFeedback"), &drawTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glDrawTransformFeedbackStream"), &drawTransformFeedbackStream);
-        AssignGLEntryPoint(loadProcAddress("glEndQueryIndexed"), &endQueryIndexed);
-        AssignGLEntryPoint(loadProcAddress("glGenTransformFeedbacks"), &genTransformFeedbacks);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveSubroutineName"), &getActiveSubroutineName);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveSubroutineUniformName"), &getActiveSubroutineUniformName);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveSubroutineUniformiv"), &getActiveSubroutineUniformiv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramStageiv"), &getProgramStageiv);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryIndexediv"), &getQueryIndexediv);
-        AssignGLEntryPoint(loadProcAddress("glGetSubroutineIndex"), &getSubroutineIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetSubroutineUniformLocation"), &getSubroutineUniformLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformSubroutineuiv"), &getUniformSubroutineuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformdv"), &getUniformdv);
-        AssignGLEntryPoint(loadProcAddress("glIsTransformFeedback"), &isTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glMinSampleShading"), &minSampleShading);
-        AssignGLEntryPoint(loadProcAddress("glPatchParameterfv"), &patchParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glPatchParameteri"), &patchParameteri);
-        AssignGLEntryPoint(loadProcAddress("glPauseTransformFeedback"), &pauseTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glResumeTransformFeedback"), &resumeTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glUniform1d"), &uniform1d);
-        AssignGLEntryPoint(loadProcAddress("glUniform1dv"), &uniform1dv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2d"), &uniform2d);
-        AssignGLEntryPoint(loadProcAddress("glUniform2dv"), &uniform2dv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3d"), &uniform3d);
-        AssignGLEntryPoint(loadProcAddress("glUniform3dv"), &uniform3dv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4d"), &uniform4d);
-        AssignGLEntryPoint(loadProcAddress("glUniform4dv"), &uniform4dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2dv"), &uniformMatrix2dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2x3dv"), &uniformMatrix2x3dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2x4dv"), &uniformMatrix2x4dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3dv"), &uniformMatrix3dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3x2dv"), &uniformMatrix3x2dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3x4dv"), &uniformMatrix3x4dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4dv"), &uniformMatrix4dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4x2dv"), &uniformMatrix4x2dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4x3dv"), &uniformMatrix4x3dv);
-        AssignGLEntryPoint(loadProcAddress("glUniformSubroutinesuiv"), &uniformSubroutinesuiv);
+        beginQueryIndexed.setLazy(this, "glBeginQueryIndexed");
+        bindTransformFeedback.setLazy(this, "glBindTransformFeedback");
+        blendEquationSeparatei.setLazy(this, "glBlendEquationSeparatei");
+        blendEquationi.setLazy(this, "glBlendEquationi");
+        blendFuncSeparatei.setLazy(this, "glBlendFuncSeparatei");
+        blendFunci.setLazy(this, "glBlendFunci");
+        deleteTransformFeedbacks.setLazy(this, "glDeleteTransformFeedbacks");
+        drawArraysIndirect.setLazy(this, "glDrawArraysIndirect");
+        drawElementsIndirect.setLazy(this, "glDrawElementsIndirect");
+        drawTransformFeedback.setLazy(this, "glDrawTransformFeedback");
+        drawTransformFeedbackStream.setLazy(this, "glDrawTransformFeedbackStream");
+        endQueryIndexed.setLazy(this, "glEndQueryIndexed");
+        genTransformFeedbacks.setLazy(this, "glGenTransformFeedbacks");
+        getActiveSubroutineName.setLazy(this, "glGetActiveSubroutineName");
+        getActiveSubroutineUniformName.setLazy(this, "glGetActiveSubroutineUniformName");
+        getActiveSubroutineUniformiv.setLazy(this, "glGetActiveSubroutineUniformiv");
+        getProgramStageiv.setLazy(this, "glGetProgramStageiv");
+        getQueryIndexediv.setLazy(this, "glGetQueryIndexediv");
+        getSubroutineIndex.setLazy(this, "glGetSubroutineIndex");
+        getSubroutineUniformLocation.setLazy(this, "glGetSubroutineUniformLocation");
+        getUniformSubroutineuiv.setLazy(this, "glGetUniformSubroutineuiv");
+        getUniformdv.setLazy(this, "glGetUniformdv");
+        isTransformFeedback.setLazy(this, "glIsTransformFeedback");
+        minSampleShading.setLazy(this, "glMinSampleShading");
+        patchParameterfv.setLazy(this, "glPatchParameterfv");
+        patchParameteri.setLazy(this, "glPatchParameteri");
+        pauseTransformFeedback.setLazy(this, "glPauseTransformFeedback");
+        resumeTransformFeedback.setLazy(this, "glResumeTransformFeedback");
+        uniform1d.setLazy(this, "glUniform1d");
+        uniform1dv.setLazy(this, "glUniform1dv");
+        uniform2d.setLazy(this, "glUniform2d");
+        uniform2dv.setLazy(this, "glUniform2dv");
+        uniform3d.setLazy(this, "glUniform3d");
+        uniform3dv.setLazy(this, "glUniform3dv");
+        uniform4d.setLazy(this, "glUniform4d");
+        uniform4dv.setLazy(this, "glUniform4dv");
+        uniformMatrix2dv.setLazy(this, "glUniformMatrix2dv");
+        uniformMatrix2x3dv.setLazy(this, "glUniformMatrix2x3dv");
+        uniformMatrix2x4dv.setLazy(this, "glUniformMatrix2x4dv");
+        uniformMatrix3dv.setLazy(this, "glUniformMatrix3dv");
+        uniformMatrix3x2dv.setLazy(this, "glUniformMatrix3x2dv");
+        uniformMatrix3x4dv.setLazy(this, "glUniformMatrix3x4dv");
+        uniformMatrix4dv.setLazy(this, "glUniformMatrix4dv");
+        uniformMatrix4x2dv.setLazy(this, "glUniformMatrix4x2dv");
+        uniformMatrix4x3dv.setLazy(this, "glUniformMatrix4x3dv");
+        uniformSubroutinesuiv.setLazy(this, "glUniformSubroutinesuiv");
     }
 
     // 4.1
     if (isAtLeastGL(gl::Version(4, 1)))
     {
-        AssignGLEntryPoint(loadProcAddress("glActiveShaderProgram"), &activeShaderProgram);
-        AssignGLEntryPoint(loadProcAddress("glBindProgramPipeline"), &bindProgramPipeline);
-        AssignGLEntryPoint(loadProcAddress("glClearDepthf"), &clearDepthf);
-        AssignGLEntryPoint(loadProcAddress("glCreateShaderProgramv"), &createShaderProgramv);
-        AssignGLEntryPoint(loadProcAddress("glDeleteProgramPipelines"), &deleteProgramPipelines);
-        AssignGLEntryPoint(loadProcAddress("glDepthRangeArrayv"), &depthRangeArrayv);
-        AssignGLEntryPoint(loadProcAddress("glDepthRangeIndexed"), &depthRangeIndexed);
-        AssignGLEntryPoint(loadProcAddress("glDepthRangef"), &depthRangef);
-        AssignGLEntryPoint(loadProcAddress("glGenProgramPipelines"), &genProgramPipelines);
-        AssignGLEntryPoint(loadProcAddress("glGetDoublei_v"), &getDoublei_v);
-        AssignGLEntryPoint(loadProcAddress("glGetFloati_v"), &getFloati_v);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramBinary"), &getProgramBinary);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramPipelineInfoLog"), &getProgramPipelineInfoLog);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramPipelineiv"), &getProgramPipelineiv);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderPrecisionFormat"), &getShaderPrecisionFormat);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribLdv"), &getVertexAttribLdv);
-        AssignGLEntryPoint(loadProcAddress("glIsProgramPipeline"), &isProgramPipeline);
-        AssignGLEntryPoint(loadProcAddress("glProgramBinary"), &programBinary);
-        AssignGLEntryPoint(loadProcAddress("glProgramParameteri"), &programParameteri);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1d"), &programUniform1d);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1dv"), &programUniform1dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1f"), &programUniform1f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1fv"), &programUniform1fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1i"), &programUniform1i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1iv"), &programUniform1iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1ui"), &programUniform1ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1uiv"), &programUniform1uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2d"), &programUniform2d);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2dv"), &programUniform2dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2f"), &programUniform2f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2fv"), &programUniform2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2i"), &programUniform2i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2iv"), &programUniform2iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2ui"), &programUniform2ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2uiv"), &programUniform2uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3d"), &programUniform3d);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3dv"), &programUniform3dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3f"), &programUniform3f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3fv"), &programUniform3fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3i"), &programUniform3i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3iv"), &programUniform3iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3ui"), &programUniform3ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3uiv"), &programUniform3uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4d"), &programUniform4d);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4dv"), &programUniform4dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4f"), &programUniform4f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4fv"), &programUniform4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4i"), &programUniform4i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4iv"), &programUniform4iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4ui"), &programUniform4ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4uiv"), &programUniform4uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2dv"), &programUniformMatrix2dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2fv"), &programUniformMatrix2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2x3dv"), &programUniformMatrix2x3dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2x3fv"), &programUniformMatrix2x3fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2x4dv"), &programUniformMatrix2x4dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2x4fv"), &programUniformMatrix2x4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3dv"), &programUniformMatrix3dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3fv"), &programUniformMatrix3fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3x2dv"), &programUniformMatrix3x2dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3x2fv"), &programUniformMatrix3x2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3x4dv"), &programUniformMatrix3x4dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3x4fv"), &programUniformMatrix3x4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4dv"), &programUniformMatrix4dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4fv"), &programUniformMatrix4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4x2dv"), &programUniformMatrix4x2dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4x2fv"), &programUniformMatrix4x2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4x3dv"), &programUniformMatrix4x3dv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4x3fv"), &programUniformMatrix4x3fv);
-        AssignGLEntryPoint(loadProcAddress("glReleaseShaderCompiler"), &releaseShaderCompiler);
-        AssignGLEntryPoint(loadProcAddress("glScissorArrayv"), &scissorArrayv);
-        AssignGLEntryPoint(loadProcAddress("glScissorIndexed"), &scissorIndexed);
-        AssignGLEntryPoint(loadProcAddress("glScissorIndexedv"), &scissorIndexedv);
-        AssignGLEntryPoint(loadProcAddress("glShaderBinary"), &shaderBinary);
-        AssignGLEntryPoint(loadProcAddress("glUseProgramStages"), &useProgramStages);
-        AssignGLEntryPoint(loadProcAddress("glValidateProgramPipeline"), &validateProgramPipeline);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL1d"), &vertexAttribL1d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL1dv"), &vertexAttribL1dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL2d"), &vertexAttribL2d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL2dv"), &vertexAttribL2dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL3d"), &vertexAttribL3d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL3dv"), &vertexAttribL3dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL4d"), &vertexAttribL4d);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribL4dv"), &vertexAttribL4dv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribLPointer"), &vertexAttribLPointer);
-        AssignGLEntryPoint(loadProcAddress("glViewportArrayv"), &viewportArrayv);
-        AssignGLEntryPoint(loadProcAddress("glViewportIndexedf"), &viewportIndexedf);
-        AssignGLEntryPoint(loadProcAddress("glViewportIndexedfv"), &viewportIndexedfv);
+        activeShaderProgram.setLazy(this, "glActiveShaderProgram");
+        bindProgramPipeline.setLazy(this, "glBindProgramPipeline");
+        clearDepthf.setLazy(this, "glClearDepthf");
+        createShaderProgramv.setLazy(this, "glCreateShaderProgramv");
+        deleteProgramPipelines.setLazy(this, "glDeleteProgramPipelines");
+        depthRangeArrayv.setLazy(this, "glDepthRangeArrayv");
+        depthRangeIndexed.setLazy(this, "glDepthRangeIndexed");
+        depthRangef.setLazy(this, "glDepthRangef");
+        genProgramPipelines.setLazy(this, "glGenProgramPipelines");
+        getDoublei_v.setLazy(this, "glGetDoublei_v");
+        getFloati_v.setLazy(this, "glGetFloati_v");
+        getProgramBinary.setLazy(this, "glGetProgramBinary");
+        getProgramPipelineInfoLog.setLazy(this, "glGetProgramPipelineInfoLog");
+        getProgramPipelineiv.setLazy(this, "glGetProgramPipelineiv");
+        getShaderPrecisionFormat.setLazy(this, "glGetShaderPrecisionFormat");
+        getVertexAttribLdv.setLazy(this, "glGetVertexAttribLdv");
+        isProgramPipeline.setLazy(this, "glIsProgramPipeline");
+        programBinary.setLazy(this, "glProgramBinary");
+        programParameteri.setLazy(this, "glProgramParameteri");
+        programUniform1d.setLazy(this, "glProgramUniform1d");
+        programUniform1dv.setLazy(this, "glProgramUniform1dv");
+        programUniform1f.setLazy(this, "glProgramUniform1f");
+        programUniform1fv.setLazy(this, "glProgramUniform1fv");
+        programUniform1i.setLazy(this, "glProgramUniform1i");
+        programUniform1iv.setLazy(this, "glProgramUniform1iv");
+        programUniform1ui.setLazy(this, "glProgramUniform1ui");
+        programUniform1uiv.setLazy(this, "glProgramUniform1uiv");
+        programUniform2d.setLazy(this, "glProgramUniform2d");
+        programUniform2dv.setLazy(this, "glProgramUniform2dv");
+        programUniform2f.setLazy(this, "glProgramUniform2f");
+        programUniform2fv.setLazy(this, "glProgramUniform2fv");
+        programUniform2i.setLazy(this, "glProgramUniform2i");
+        programUniform2iv.setLazy(this, "glProgramUniform2iv");
+        programUniform2ui.setLazy(this, "glProgramUniform2ui");
+        programUniform2uiv.setLazy(this, "glProgramUniform2uiv");
+        programUniform3d.setLazy(this, "glProgramUniform3d");
+        programUniform3dv.setLazy(this, "glProgramUniform3dv");
+        programUniform3f.setLazy(this, "glProgramUniform3f");
+        programUniform3fv.setLazy(this, "glProgramUniform3fv");
+        programUniform3i.setLazy(this, "glProgramUniform3i");
+        programUniform3iv.setLazy(this, "glProgramUniform3iv");
+        programUniform3ui.setLazy(this, "glProgramUniform3ui");
+        programUniform3uiv.setLazy(this, "glProgramUniform3uiv");
+        programUniform4d.setLazy(this, "glProgramUniform4d");
+        programUniform4dv.setLazy(this, "glProgramUniform4dv");
+        programUniform4f.setLazy(this, "glProgramUniform4f");
+        programUniform4fv.setLazy(this, "glProgramUniform4fv");
+        programUniform4i.setLazy(this, "glProgramUniform4i");
+        programUniform4iv.setLazy(this, "glProgramUniform4iv");
+        programUniform4ui.setLazy(this, "glProgramUniform4ui");
+        programUniform4uiv.setLazy(this, "glProgramUniform4uiv");
+        programUniformMatrix2dv.setLazy(this, "glProgramUniformMatrix2dv");
+        programUniformMatrix2fv.setLazy(this, "glProgramUniformMatrix2fv");
+        programUniformMatrix2x3dv.setLazy(this, "glProgramUniformMatrix2x3dv");
+        programUniformMatrix2x3fv.setLazy(this, "glProgramUniformMatrix2x3fv");
+        programUniformMatrix2x4dv.setLazy(this, "glProgramUniformMatrix2x4dv");
+        programUniformMatrix2x4fv.setLazy(this, "glProgramUniformMatrix2x4fv");
+        programUniformMatrix3dv.setLazy(this, "glProgramUniformMatrix3dv");
+        programUniformMatrix3fv.setLazy(this, "glProgramUniformMatrix3fv");
+        programUniformMatrix3x2dv.setLazy(this, "glProgramUniformMatrix3x2dv");
+        programUniformMatrix3x2fv.setLazy(this, "glProgramUniformMatrix3x2fv");
+        programUniformMatrix3x4dv.setLazy(this, "glProgramUniformMatrix3x4dv");
+        programUniformMatrix3x4fv.setLazy(this, "glProgramUniformMatrix3x4fv");
+        programUniformMatrix4dv.setLazy(this, "glProgramUniformMatrix4dv");
+        programUniformMatrix4fv.setLazy(this, "glProgramUniformMatrix4fv");
+        programUniformMatrix4x2dv.setLazy(this, "glProgramUniformMatrix4x2dv");
+        programUniformMatrix4x2fv.setLazy(this, "glProgramUniformMatrix4x2fv");
+        programUniformMatrix4x3dv.setLazy(this, "glProgramUniformMatrix4x3dv");
+        programUniformMatrix4x3fv.setLazy(this, "glProgramUniformMatrix4x3fv");
+        releaseShaderCompiler.setLazy(this, "glReleaseShaderCompiler");
+        scissorArrayv.setLazy(this, "glScissorArrayv");
+        scissorIndexed.setLazy(this, "glScissorIndexed");
+        scissorIndexedv.setLazy(this, "glScissorIndexedv");
+        shaderBinary.setLazy(this, "glShaderBinary");
+        useProgramStages.setLazy(this, "glUseProgramStages");
+        validateProgramPipeline.setLazy(this, "glValidateProgramPipeline");
+        vertexAttribL1d.setLazy(this, "glVertexAttribL1d");
+        vertexAttribL1dv.setLazy(this, "glVertexAttribL1dv");
+        vertexAttribL2d.setLazy(this, "glVertexAttribL2d");
+        vertexAttribL2dv.setLazy(this, "glVertexAttribL2dv");
+        vertexAttribL3d.setLazy(this, "glVertexAttribL3d");
+        vertexAttribL3dv.setLazy(this, "glVertexAttribL3dv");
+        vertexAttribL4d.setLazy(this, "glVertexAttribL4d");
+        vertexAttribL4dv.setLazy(this, "glVertexAttribL4dv");
+        vertexAttribLPointer.setLazy(this, "glVertexAttribLPointer");
+        viewportArrayv.setLazy(this, "glViewportArrayv");
+        viewportIndexedf.setLazy(this, "glViewportIndexedf");
+        viewportIndexedfv.setLazy(this, "glViewportIndexedfv");
     }
 
     // 4.2
     if (isAtLeastGL(gl::Version(4, 2)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBindImageTexture"), &bindImageTexture);
-        AssignGLEntryPoint(loadProcAddress("glDrawArraysInstancedBaseInstance"), &drawArraysInstancedBaseInstance);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsInstancedBaseInstance"), &drawElementsInstancedBaseInstance);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsInstancedBaseVertexBaseInstance"), &drawElementsInstancedBaseVertexBaseInstance);
-        AssignGLEntryPoint(loadProcAddress("glDrawTransformFeedbackInstanced"), &drawTransformFeedbackInstanced);
-        AssignGLEntryPoint(loadProcAddress("glDrawTransformFeedbackStreamInstanced"), &drawTransformFeedbackStreamInstanced);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveAtomicCounterBufferiv"), &getActiveAtomicCounterBufferiv);
-        AssignGLEntryPoint(loadProcAddress("glGetInternalformativ"), &getInternalformativ);
-        AssignGLEntryPoint(loadProcAddress("glMemoryBarrier"), &memoryBarrier);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage1D"), &texStorage1D);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage2D"), &texStorage2D);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage3D"), &texStorage3D);
+        bindImageTexture.setLazy(this, "glBindImageTexture");
+        drawArraysInstancedBaseInstance.setLazy(this, "glDrawArraysInstancedBaseInstance");
+        drawElementsInstancedBaseInstance.setLazy(this, "glDrawElementsInstancedBaseInstance");
+        drawElementsInstancedBaseVertexBaseInstance.setLazy(this, "glDrawElementsInstancedBaseVertexBaseInstance");
+        drawTransformFeedbackInstanced.setLazy(this, "glDrawTransformFeedbackInstanced");
+        drawTransformFeedbackStreamInstanced.setLazy(this, "glDrawTransformFeedbackStreamInstanced");
+        getActiveAtomicCounterBufferiv.setLazy(this, "glGetActiveAtomicCounterBufferiv");
+        getInternalformativ.setLazy(this, "glGetInternalformativ");
+        memoryBarrier.setLazy(this, "glMemoryBarrier");
+        texStorage1D.setLazy(this, "glTexStorage1D");
+        texStorage2D.setLazy(this, "glTexStorage2D");
+        texStorage3D.setLazy(this, "glTexStorage3D");
     }
 
     // 4.3
     if (isAtLeastGL(gl::Version(4, 3)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBindVertexBuffer"), &bindVertexBuffer);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferData"), &clearBufferData);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferSubData"), &clearBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glCopyImageSubData"), &copyImageSubData);
-        AssignGLEntryPoint(loadProcAddress("glDebugMessageCallback"), &debugMessageCallback);
-        AssignGLEntryPoint(loadProcAddress("glDebugMessageControl"), &debugMessageControl);
-        AssignGLEntryPoint(loadProcAddress("glDebugMessageInsert"), &debugMessageInsert);
-        AssignGLEntryPoint(loadProcAddress("glDispatchCompute"), &dispatchCompute);
-        AssignGLEntryPoint(loadProcAddress("glDispatchComputeIndirect"), &dispatchComputeIndirect);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferParameteri"), &framebufferParameteri);
-        AssignGLEntryPoint(loadProcAddress("glGetDebugMessageLog"), &getDebugMessageLog);
-        AssignGLEntryPoint(loadProcAddress("glGetFramebufferParameteriv"), &getFramebufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetInternalformati64v"), &getInternalformati64v);
-        AssignGLEntryPoint(loadProcAddress("glGetPointerv"), &getPointerv);
-        AssignGLEntryPoint(loadProcAddress("glGetObjectLabel"), &getObjectLabel);
-        AssignGLEntryPoint(loadProcAddress("glGetObjectPtrLabel"), &getObjectPtrLabel);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramInterfaceiv"), &getProgramInterfaceiv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceIndex"), &getProgramResourceIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceLocation"), &getProgramResourceLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceLocationIndex"), &getProgramResourceLocationIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceName"), &getProgramResourceName);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceiv"), &getProgramResourceiv);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateBufferData"), &invalidateBufferData);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateBufferSubData"), &invalidateBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateFramebuffer"), &invalidateFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateSubFramebuffer"), &invalidateSubFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateTexImage"), &invalidateTexImage);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateTexSubImage"), &invalidateTexSubImage);
-        AssignGLEntryPoint(loadProcAddress("glMultiDrawArraysIndirect"), &multiDrawArraysIndirect);
-        AssignGLEntryPoint(loadProcAddress("glMultiDrawElementsIndirect"), &multiDrawElementsIndirect);
-        AssignGLEntryPoint(loadProcAddress("glObjectLabel"), &objectLabel);
-        AssignGLEntryPoint(loadProcAddress("glObjectPtrLabel"), &objectPtrLabel);
-        AssignGLEntryPoint(loadProcAddress("glPopDebugGroup"), &popDebugGroup);
-        AssignGLEntryPoint(loadProcAddress("glPushDebugGroup"), &pushDebugGroup);
-        AssignGLEntryPoint(loadProcAddress("glShaderStorageBlockBinding"), &shaderStorageBlockBinding);
-        AssignGLEntryPoint(loadProcAddress("glTexBufferRange"), &texBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage2DMultisample"), &texStorage2DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage3DMultisample"), &texStorage3DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glTextureView"), &textureView);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribBinding"), &vertexAttribBinding);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribFormat"), &vertexAttribFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribIFormat"), &vertexAttribIFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribLFormat"), &vertexAttribLFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexBindingDivisor"), &vertexBindingDivisor);
+        bindVertexBuffer.setLazy(this, "glBindVertexBuffer");
+        clearBufferData.setLazy(this, "glClearBufferData");
+        clearBufferSubData.setLazy(this, "glClearBufferSubData");
+        copyImageSubData.setLazy(this, "glCopyImageSubData");
+        debugMessageCallback.setLazy(this, "glDebugMessageCallback");
+        debugMessageControl.setLazy(this, "glDebugMessageControl");
+        debugMessageInsert.setLazy(this, "glDebugMessageInsert");
+        dispatchCompute.setLazy(this, "glDispatchCompute");
+        dispatchComputeIndirect.setLazy(this, "glDispatchComputeIndirect");
+        framebufferParameteri.setLazy(this, "glFramebufferParameteri");
+        getDebugMessageLog.setLazy(this, "glGetDebugMessageLog");
+        getFramebufferParameteriv.setLazy(this, "glGetFramebufferParameteriv");
+        getInternalformati64v.setLazy(this, "glGetInternalformati64v");
+        getPointerv.setLazy(this, "glGetPointerv");
+        getObjectLabel.setLazy(this, "glGetObjectLabel");
+        getObjectPtrLabel.setLazy(this, "glGetObjectPtrLabel");
+        getProgramInterfaceiv.setLazy(this, "glGetProgramInterfaceiv");
+        getProgramResourceIndex.setLazy(this, "glGetProgramResourceIndex");
+        getProgramResourceLocation.setLazy(this, "glGetProgramResourceLocation");
+        getProgramResourceLocationIndex.setLazy(this, "glGetProgramResourceLocationIndex");
+        getProgramResourceName.setLazy(this, "glGetProgramResourceName");
+        getProgramResourceiv.setLazy(this, "glGetProgramResourceiv");
+        invalidateBufferData.setLazy(this, "glInvalidateBufferData");
+        invalidateBufferSubData.setLazy(this, "glInvalidateBufferSubData");
+        invalidateFramebuffer.setLazy(this, "glInvalidateFramebuffer");
+        invalidateSubFramebuffer.setLazy(this, "glInvalidateSubFramebuffer");
+        invalidateTexImage.setLazy(this, "glInvalidateTexImage");
+        invalidateTexSubImage.setLazy(this, "glInvalidateTexSubImage");
+        multiDrawArraysIndirect.setLazy(this, "glMultiDrawArraysIndirect");
+        multiDrawElementsIndirect.setLazy(this, "glMultiDrawElementsIndirect");
+        objectLabel.setLazy(this, "glObjectLabel");
+        objectPtrLabel.setLazy(this, "glObjectPtrLabel");
+        popDebugGroup.setLazy(this, "glPopDebugGroup");
+        pushDebugGroup.setLazy(this, "glPushDebugGroup");
+        shaderStorageBlockBinding.setLazy(this, "glShaderStorageBlockBinding");
+        texBufferRange.setLazy(this, "glTexBufferRange");
+        texStorage2DMultisample.setLazy(this, "glTexStorage2DMultisample");
+        texStorage3DMultisample.setLazy(this, "glTexStorage3DMultisample");
+        textureView.setLazy(this, "glTextureView");
+        vertexAttribBinding.setLazy(this, "glVertexAttribBinding");
+        vertexAttribFormat.setLazy(this, "glVertexAttribFormat");
+        vertexAttribIFormat.setLazy(this, "glVertexAttribIFormat");
+        vertexAttribLFormat.setLazy(this, "glVertexAttribLFormat");
+        vertexBindingDivisor.setLazy(this, "glVertexBindingDivisor");
     }
 
     // 4.4
     if (isAtLeastGL(gl::Version(4, 4)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBindBuffersBase"), &bindBuffersBase);
-        AssignGLEntryPoint(loadProcAddress("glBindBuffersRange"), &bindBuffersRange);
-        AssignGLEntryPoint(loadProcAddress("glBindImageTextures"), &bindImageTextures);
-        AssignGLEntryPoint(loadProcAddress("glBindSamplers"), &bindSamplers);
-        AssignGLEntryPoint(loadProcAddress("glBindTextures"), &bindTextures);
-        AssignGLEntryPoint(loadProcAddress("glBindVertexBuffers"), &bindVertexBuffers);
-        AssignGLEntryPoint(loadProcAddress("glBufferStorage"), &bufferStorage);
-        AssignGLEntryPoint(loadProcAddress("glClearTexImage"), &clearTexImage);
-        AssignGLEntryPoint(loadProcAddress("glClearTexSubImage"), &clearTexSubImage);
+        bindBuffersBase.setLazy(this, "glBindBuffersBase");
+        bindBuffersRange.setLazy(this, "glBindBuffersRange");
+        bindImageTextures.setLazy(this, "glBindImageTextures");
+        bindSamplers.setLazy(this, "glBindSamplers");
+        bindTextures.setLazy(this, "glBindTextures");
+        bindVertexBuffers.setLazy(this, "glBindVertexBuffers");
+        bufferStorage.setLazy(this, "glBufferStorage");
+        clearTexImage.setLazy(this, "glClearTexImage");
+        clearTexSubImage.setLazy(this, "glClearTexSubImage");
     }
 
     // 4.5
     if (isAtLeastGL(gl::Version(4, 5)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBindTextureUnit"), &bindTextureUnit);
-        AssignGLEntryPoint(loadProcAddress("glBlitNamedFramebuffer"), &blitNamedFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glCheckNamedFramebufferStatus"), &checkNamedFramebufferStatus);
-        AssignGLEntryPoint(loadProcAddress("glClearNamedBufferData"), &clearNamedBufferData);
-        AssignGLEntryPoint(loadProcAddress("glClearNamedBufferSubData"), &clearNamedBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glClearNamedFramebufferfi"), &clearNamedFramebufferfi);
-        AssignGLEntryPoint(loadProcAddress("glClearNamedFramebufferfv"), &clearNamedFramebufferfv);
-        AssignGLEntryPoint(loadProcAddress("glClearNamedFramebufferiv"), &clearNamedFramebufferiv);
-        AssignGLEntryPoint(loadProcAddress("glClearNamedFramebufferuiv"), &clearNamedFramebufferuiv);
-        AssignGLEntryPoint(loadProcAddress("glClipControl"), &clipControl);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTextureSubImage1D"), &compressedTextureSubImage1D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTextureSubImage2D"), &compressedTextureSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTextureSubImage3D"), &compressedTextureSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glCopyNamedBufferSubData"), &copyNamedBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glCopyTextureSubImage1D"), &copyTextureSubImage1D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTextureSubImage2D"), &copyTextureSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTextureSubImage3D"), &copyTextureSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glCreateBuffers"), &createBuffers);
-        AssignGLEntryPoint(loadProcAddress("glCreateFramebuffers"), &createFramebuffers);
-        AssignGLEntryPoint(loadProcAddress("glCreateProgramPipelines"), &createProgramPipelines);
-        AssignGLEntryPoint(loadProcAddress("glCreateQueries"), &createQueries);
-        AssignGLEntryPoint(loadProcAddress("glCreateRenderbuffers"), &createRenderbuffers);
-        AssignGLEntryPoint(loadProcAddress("glCreateSamplers"), &createSamplers);
-        AssignGLEntryPoint(loadProcAddress("glCreateTextures"), &createTextures);
-        AssignGLEntryPoint(loadProcAddress("glCreateTransformFeedbacks"), &createTransformFeedbacks);
-        AssignGLEntryPoint(loadProcAddress("glCreateVertexArrays"), &createVertexArrays);
-        AssignGLEntryPoint(loadProcAddress("glDisableVertexArrayAttrib"), &disableVertexArrayAttrib);
-        AssignGLEntryPoint(loadProcAddress("glEnableVertexArrayAttrib"), &enableVertexArrayAttrib);
-        AssignGLEntryPoint(loadProcAddress("glFlushMappedNamedBufferRange"), &flushMappedNamedBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glGenerateTextureMipmap"), &generateTextureMipmap);
-        AssignGLEntryPoint(loadProcAddress("glGetCompressedTextureImage"), &getCompressedTextureImage);
-        AssignGLEntryPoint(loadProcAddress("glGetCompressedTextureSubImage"), &getCompressedTextureSubImage);
-        AssignGLEntryPoint(loadProcAddress("glGetGraphicsResetStatus"), &getGraphicsResetStatus);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedBufferParameteri64v"), &getNamedBufferParameteri64v);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedBufferParameteriv"), &getNamedBufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedBufferPointerv"), &getNamedBufferPointerv);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedBufferSubData"), &getNamedBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedFramebufferAttachmentParameteriv"), &getNamedFramebufferAttachmentParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedFramebufferParameteriv"), &getNamedFramebufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetNamedRenderbufferParameteriv"), &getNamedRenderbufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryBufferObjecti64v"), &getQueryBufferObjecti64v);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryBufferObjectiv"), &getQueryBufferObjectiv);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryBufferObjectui64v"), &getQueryBufferObjectui64v);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryBufferObjectuiv"), &getQueryBufferObjectuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureImage"), &getTextureImage);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureLevelParameterfv"), &getTextureLevelParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureLevelParameteriv"), &getTextureLevelParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureParameterIiv"), &getTextureParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureParameterIuiv"), &getTextureParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureParameterfv"), &getTextureParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureParameteriv"), &getTextureParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetTextureSubImage"), &getTextureSubImage);
-        AssignGLEntryPoint(loadProcAddress("glGetTransformFeedbacki64_v"), &getTransformFeedbacki64_v);
-        AssignGLEntryPoint(loadProcAddress("glGetTransformFeedbacki_v"), &getTransformFeedbacki_v);
-        AssignGLEntryPoint(loadProcAddress("glGetTransformFeedbackiv"), &getTransformFeedbackiv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexArrayIndexed64iv"), &getVertexArrayIndexed64iv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexArrayIndexediv"), &getVertexArrayIndexediv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexArrayiv"), &getVertexArrayiv);
-        AssignGLEntryPoint(loadProcAddress("glGetnCompressedTexImage"), &getnCompressedTexImage);
-        AssignGLEntryPoint(loadProcAddress("glGetnTexImage"), &getnTexImage);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformdv"), &getnUniformdv);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformfv"), &getnUniformfv);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformiv"), &getnUniformiv);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformuiv"), &getnUniformuiv);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateNamedFramebufferData"), &invalidateNamedFramebufferData);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateNamedFramebufferSubData"), &invalidateNamedFramebufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glMapNamedBuffer"), &mapNamedBuffer);
-        AssignGLEntryPoint(loadProcAddress("glMapNamedBufferRange"), &mapNamedBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glMemoryBarrierByRegion"), &memoryBarrierByRegion);
-        AssignGLEntryPoint(loadProcAddress("glNamedBufferData"), &namedBufferData);
-        AssignGLEntryPoint(loadProcAddress("glNamedBufferStorage"), &namedBufferStorage);
-        AssignGLEntryPoint(loadProcAddress("glNamedBufferSubData"), &namedBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferDrawBuffer"), &namedFramebufferDrawBuffer);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferDrawBuffers"), &namedFramebufferDrawBuffers);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferParameteri"), &namedFramebufferParameteri);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferReadBuffer"), &namedFramebufferReadBuffer);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferRenderbuffer"), &namedFramebufferRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferTexture"), &namedFramebufferTexture);
-        AssignGLEntryPoint(loadProcAddress("glNamedFramebufferTextureLayer"), &namedFramebufferTextureLayer);
-        AssignGLEntryPoint(loadProcAddress("glNamedRenderbufferStorage"), &namedRenderbufferStorage);
-        AssignGLEntryPoint(loadProcAddress("glNamedRenderbufferStorageMultisample"), &namedRenderbufferStorageMultisample);
-        AssignGLEntryPoint(loadProcAddress("glReadnPixels"), &readnPixels);
-        AssignGLEntryPoint(loadProcAddress("glTextureBarrier"), &textureBarrier);
-        AssignGLEntryPoint(loadProcAddress("glTextureBuffer"), &textureBuffer);
-        AssignGLEntryPoint(loadProcAddress("glTextureBufferRange"), &textureBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glTextureParameterIiv"), &textureParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glTextureParameterIuiv"), &textureParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glTextureParameterf"), &textureParameterf);
-        AssignGLEntryPoint(loadProcAddress("glTextureParameterfv"), &textureParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glTextureParameteri"), &textureParameteri);
-        AssignGLEntryPoint(loadProcAddress("glTextureParameteriv"), &textureParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glTextureStorage1D"), &textureStorage1D);
-        AssignGLEntryPoint(loadProcAddress("glTextureStorage2D"), &textureStorage2D);
-        AssignGLEntryPoint(loadProcAddress("glTextureStorage2DMultisample"), &textureStorage2DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glTextureStorage3D"), &textureStorage3D);
-        AssignGLEntryPoint(loadProcAddress("glTextureStorage3DMultisample"), &textureStorage3DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glTextureSubImage1D"), &textureSubImage1D);
-        AssignGLEntryPoint(loadProcAddress("glTextureSubImage2D"), &textureSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glTextureSubImage3D"), &textureSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glTransformFeedbackBufferBase"), &transformFeedbackBufferBase);
-        AssignGLEntryPoint(loadProcAddress("glTransformFeedbackBufferRange"), &transformFeedbackBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glUnmapNamedBuffer"), &unmapNamedBuffer);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayAttribBinding"), &vertexArrayAttribBinding);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayAttribFormat"), &vertexArrayAttribFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayAttribIFormat"), &vertexArrayAttribIFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayAttribLFormat"), &vertexArrayAttribLFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayBindingDivisor"), &vertexArrayBindingDivisor);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayElementBuffer"), &vertexArrayElementBuffer);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayVertexBuffer"), &vertexArrayVertexBuffer);
-        AssignGLEntryPoint(loadProcAddress("glVertexArrayVertexBuffers"), &vertexArrayVertexBuffers);
+        bindTextureUnit.setLazy(this, "glBindTextureUnit");
+        blitNamedFramebuffer.setLazy(this, "glBlitNamedFramebuffer");
+        checkNamedFramebufferStatus.setLazy(this, "glCheckNamedFramebufferStatus");
+        clearNamedBufferData.setLazy(this, "glClearNamedBufferData");
+        clearNamedBufferSubData.setLazy(this, "glClearNamedBufferSubData");
+        clearNamedFramebufferfi.setLazy(this, "glClearNamedFramebufferfi");
+        clearNamedFramebufferfv.setLazy(this, "glClearNamedFramebufferfv");
+        clearNamedFramebufferiv.setLazy(this, "glClearNamedFramebufferiv");
+        clearNamedFramebufferuiv.setLazy(this, "glClearNamedFramebufferuiv");
+        clipControl.setLazy(this, "glClipControl");
+        compressedTextureSubImage1D.setLazy(this, "glCompressedTextureSubImage1D");
+        compressedTextureSubImage2D.setLazy(this, "glCompressedTextureSubImage2D");
+        compressedTextureSubImage3D.setLazy(this, "glCompressedTextureSubImage3D");
+        copyNamedBufferSubData.setLazy(this, "glCopyNamedBufferSubData");
+        copyTextureSubImage1D.setLazy(this, "glCopyTextureSubImage1D");
+        copyTextureSubImage2D.setLazy(this, "glCopyTextureSubImage2D");
+        copyTextureSubImage3D.setLazy(this, "glCopyTextureSubImage3D");
+        createBuffers.setLazy(this, "glCreateBuffers");
+        createFramebuffers.setLazy(this, "glCreateFramebuffers");
+        createProgramPipelines.setLazy(this, "glCreateProgramPipelines");
+        createQueries.setLazy(this, "glCreateQueries");
+        createRenderbuffers.setLazy(this, "glCreateRenderbuffers");
+        createSamplers.setLazy(this, "glCreateSamplers");
+        createTextures.setLazy(this, "glCreateTextures");
+        createTransformFeedbacks.setLazy(this, "glCreateTransformFeedbacks");
+        createVertexArrays.setLazy(this, "glCreateVertexArrays");
+        disableVertexArrayAttrib.setLazy(this, "glDisableVertexArrayAttrib");
+        enableVertexArrayAttrib.setLazy(this, "glEnableVertexArrayAttrib");
+        flushMappedNamedBufferRange.setLazy(this, "glFlushMappedNamedBufferRange");
+        generateTextureMipmap.setLazy(this, "glGenerateTextureMipmap");
+        getCompressedTextureImage.setLazy(this, "glGetCompressedTextureImage");
+        getCompressedTextureSubImage.setLazy(this, "glGetCompressedTextureSubImage");
+        getGraphicsResetStatus.setLazy(this, "glGetGraphicsResetStatus");
+        getNamedBufferParameteri64v.setLazy(this, "glGetNamedBufferParameteri64v");
+        getNamedBufferParameteriv.setLazy(this, "glGetNamedBufferParameteriv");
+        getNamedBufferPointerv.setLazy(this, "glGetNamedBufferPointerv");
+        getNamedBufferSubData.setLazy(this, "glGetNamedBufferSubData");
+        getNamedFramebufferAttachmentParameteriv.setLazy(this, "glGetNamedFramebufferAttachmentParameteriv");
+        getNamedFramebufferParameteriv.setLazy(this, "glGetNamedFramebufferParameteriv");
+        getNamedRenderbufferParameteriv.setLazy(this, "glGetNamedRenderbufferParameteriv");
+        getQueryBufferObjecti64v.setLazy(this, "glGetQueryBufferObjecti64v");
+        getQueryBufferObjectiv.setLazy(this, "glGetQueryBufferObjectiv");
+        getQueryBufferObjectui64v.setLazy(this, "glGetQueryBufferObjectui64v");
+        getQueryBufferObjectuiv.setLazy(this, "glGetQueryBufferObjectuiv");
+        getTextureImage.setLazy(this, "glGetTextureImage");
+        getTextureLevelParameterfv.setLazy(this, "glGetTextureLevelParameterfv");
+        getTextureLevelParameteriv.setLazy(this, "glGetTextureLevelParameteriv");
+        getTextureParameterIiv.setLazy(this, "glGetTextureParameterIiv");
+        getTextureParameterIuiv.setLazy(this, "glGetTextureParameterIuiv");
+        getTextureParameterfv.setLazy(this, "glGetTextureParameterfv");
+        getTextureParameteriv.setLazy(this, "glGetTextureParameteriv");
+        getTextureSubImage.setLazy(this, "glGetTextureSubImage");
+        getTransformFeedbacki64_v.setLazy(this, "glGetTransformFeedbacki64_v");
+        getTransformFeedbacki_v.setLazy(this, "glGetTransformFeedbacki_v");
+        getTransformFeedbackiv.setLazy(this, "glGetTransformFeedbackiv");
+        getVertexArrayIndexed64iv.setLazy(this, "glGetVertexArrayIndexed64iv");
+        getVertexArrayIndexediv.setLazy(this, "glGetVertexArrayIndexediv");
+        getVertexArrayiv.setLazy(this, "glGetVertexArrayiv");
+        getnCompressedTexImage.setLazy(this, "glGetnCompressedTexImage");
+        getnTexImage.setLazy(this, "glGetnTexImage");
+        getnUniformdv.setLazy(this, "glGetnUniformdv");
+        getnUniformfv.setLazy(this, "glGetnUniformfv");
+        getnUniformiv.setLazy(this, "glGetnUniformiv");
+        getnUniformuiv.setLazy(this, "glGetnUniformuiv");
+        invalidateNamedFramebufferData.setLazy(this, "glInvalidateNamedFramebufferData");
+        invalidateNamedFramebufferSubData.setLazy(this, "glInvalidateNamedFramebufferSubData");
+        mapNamedBuffer.setLazy(this, "glMapNamedBuffer");
+        mapNamedBufferRange.setLazy(this, "glMapNamedBufferRange");
+        memoryBarrierByRegion.setLazy(this, "glMemoryBarrierByRegion");
+        namedBufferData.setLazy(this, "glNamedBufferData");
+        namedBufferStorage.setLazy(this, "glNamedBufferStorage");
+        namedBufferSubData.setLazy(this, "glNamedBufferSubData");
+        namedFramebufferDrawBuffer.setLazy(this, "glNamedFramebufferDrawBuffer");
+        namedFramebufferDrawBuffers.setLazy(this, "glNamedFramebufferDrawBuffers");
+        namedFramebufferParameteri.setLazy(this, "glNamedFramebufferParameteri");
+        namedFramebufferReadBuffer.setLazy(this, "glNamedFramebufferReadBuffer");
+        namedFramebufferRenderbuffer.setLazy(this, "glNamedFramebufferRenderbuffer");
+        namedFramebufferTexture.setLazy(this, "glNamedFramebufferTexture");
+        namedFramebufferTextureLayer.setLazy(this, "glNamedFramebufferTextureLayer");
+        namedRenderbufferStorage.setLazy(this, "glNamedRenderbufferStorage");
+        namedRenderbufferStorageMultisample.setLazy(this, "glNamedRenderbufferStorageMultisample");
+        readnPixels.setLazy(this, "glReadnPixels");
+        textureBarrier.setLazy(this, "glTextureBarrier");
+        textureBuffer.setLazy(this, "glTextureBuffer");
+        textureBufferRange.setLazy(this, "glTextureBufferRange");
+        textureParameterIiv.setLazy(this, "glTextureParameterIiv");
+        textureParameterIuiv.setLazy(this, "glTextureParameterIuiv");
+        textureParameterf.setLazy(this, "glTextureParameterf");
+        textureParameterfv.setLazy(this, "glTextureParameterfv");
+        textureParameteri.setLazy(this, "glTextureParameteri");
+        textureParameteriv.setLazy(this, "glTextureParameteriv");
+        textureStorage1D.setLazy(this, "glTextureStorage1D");
+        textureStorage2D.setLazy(this, "glTextureStorage2D");
+        textureStorage2DMultisample.setLazy(this, "glTextureStorage2DMultisample");
+        textureStorage3D.setLazy(this, "glTextureStorage3D");
+        textureStorage3DMultisample.setLazy(this, "glTextureStorage3DMultisample");
+        textureSubImage1D.setLazy(this, "glTextureSubImage1D");
+        textureSubImage2D.setLazy(this, "glTextureSubImage2D");
+        textureSubImage3D.setLazy(this, "glTextureSubImage3D");
+        transformFeedbackBufferBase.setLazy(this, "glTransformFeedbackBufferBase");
+        transformFeedbackBufferRange.setLazy(this, "glTransformFeedbackBufferRange");
+        unmapNamedBuffer.setLazy(this, "glUnmapNamedBuffer");
+        vertexArrayAttribBinding.setLazy(this, "glVertexArrayAttribBinding");
+        vertexArrayAttribFormat.setLazy(this, "glVertexArrayAttribFormat");
+        vertexArrayAttribIFormat.setLazy(this, "glVertexArrayAttribIFormat");
+        vertexArrayAttribLFormat.setLazy(this, "glVertexArrayAttribLFormat");
+        vertexArrayBindingDivisor.setLazy(this, "glVertexArrayBindingDivisor");
+        vertexArrayElementBuffer.setLazy(this, "glVertexArrayElementBuffer");
+        vertexArrayVertexBuffer.setLazy(this, "glVertexArrayVertexBuffer");
+        vertexArrayVertexBuffers.setLazy(this, "glVertexArrayVertexBuffers");
     }
 
     // clang-format on
@@ -1777,490 +1786,493 @@ void FunctionsGL::initializeProcsGLES()
     // clang-format off
 
     // GL_NV_path_rendering
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glMatrixLoadfEXT"), &matrixLoadEXT);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glGenPathsNV"), &genPathsNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glDeletePathsNV"), &delPathsNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathCommandsNV"), &pathCommandsNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glIsPathNV"), &isPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathParameterfNV"), &setPathParameterfNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathParameteriNV"), &setPathParameteriNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glGetPathParameterfvNV"), &getPathParameterfNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glGetPathParameterivNV"), &getPathParameteriNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glPathStencilFuncNV"), &pathStencilFuncNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilFillPathNV"), &stencilFillPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilStrokePathNV"), &stencilStrokePathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverFillPathNV"), &coverFillPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverStrokePathNV"), &coverStrokePathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverFillPathNV"), &stencilThenCoverFillPathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverStrokePathNV"), &stencilThenCoverStrokePathNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverFillPathInstancedNV"), &coverFillPathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glCoverStrokePathInstancedNV"), &coverStrokePathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilFillPathInstancedNV"), &stencilFillPathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilStrokePathInstancedNV"), &stencilStrokePathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverFillPathInstancedNV"), &stencilThenCoverFillPathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glStencilThenCoverStrokePathInstancedNV"), &stencilThenCoverStrokePathInstancedNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_path_rendering", loadProcAddress("glProgramPathFragmentInputGenNV"), &programPathFragmentInputGenNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glMatrixLoadfEXT", &matrixLoadEXT);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glGenPathsNV", &genPathsNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glDeletePathsNV", &delPathsNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathCommandsNV", &pathCommandsNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glIsPathNV", &isPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathParameterfNV", &setPathParameterfNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathParameteriNV", &setPathParameteriNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glGetPathParameterfvNV", &getPathParameterfNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glGetPathParameterivNV", &getPathParameteriNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glPathStencilFuncNV", &pathStencilFuncNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilFillPathNV", &stencilFillPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilStrokePathNV", &stencilStrokePathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverFillPathNV", &coverFillPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverStrokePathNV", &coverStrokePathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverFillPathNV", &stencilThenCoverFillPathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverStrokePathNV", &stencilThenCoverStrokePathNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverFillPathInstancedNV", &coverFillPathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glCoverStrokePathInstancedNV", &coverStrokePathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilFillPathInstancedNV", &stencilFillPathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilStrokePathInstancedNV", &stencilStrokePathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverFillPathInstancedNV", &stencilThenCoverFillPathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glStencilThenCoverStrokePathInstancedNV", &stencilThenCoverStrokePathInstancedNV);
+    assignExtensionEntryPoint("GL_NV_path_rendering", "glProgramPathFragmentInputGenNV", &programPathFragmentInputGenNV);
 
     // GL_OES_texture_3D
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_texture_3D", loadProcAddress("glTexImage3DOES"), &texImage3D);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_texture_3D", loadProcAddress("glTexSubImage3DOES"), &texSubImage3D);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_texture_3D", loadProcAddress("glCopyTexSubImage3DOES"), &copyTexSubImage3D);
+    assignExtensionEntryPoint("GL_OES_texture_3D", "glTexImage3DOES", &texImage3D);
+    assignExtensionEntryPoint("GL_OES_texture_3D", "glTexSubImage3DOES", &texSubImage3D);
+    assignExtensionEntryPoint("GL_OES_texture_3D", "glCopyTexSubImage3DOES", &copyTexSubImage3D);
 
     // GL_NV_framebuffer_mixed_samples
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_framebuffer_mixed_samples", loadProcAddress("glCoverageModulationNV"), &coverageModulationNV);
+    assignExtensionEntryPoint("GL_NV_framebuffer_mixed_samples", "glCoverageModulationNV", &coverageModulationNV);
 
     // GL_NV_fence
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glDeleteFencesNV"), &deleteFencesNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glGenFencesNV"), &genFencesNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glIsFenceNV"), &isFenceNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glTestFenceNV"), &testFenceNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glGetFenceivNV"), &getFenceivNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glFinishFenceNV"), &finishFenceNV);
-    AssignGLExtensionEntryPoint(extensions, "GL_NV_fence", loadProcAddress("glSetFenceNV"), &setFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glDeleteFencesNV", &deleteFencesNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glGenFencesNV", &genFencesNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glIsFenceNV", &isFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glTestFenceNV", &testFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glGetFenceivNV", &getFenceivNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glFinishFenceNV", &finishFenceNV);
+    assignExtensionEntryPoint("GL_NV_fence", "glSetFenceNV", &setFenceNV);
 
     // GL_EXT_texture_storage
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage", loadProcAddress("glTexStorage2DEXT"), &texStorage2D);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_texture_storage GL_OES_texture3D", loadProcAddress("glTexStorage3DEXT"), &texStorage3D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage", "glTexStorage2DEXT", &texStorage2D);
+    assignExtensionEntryPoint("GL_EXT_texture_storage GL_OES_texture3D", "glTexStorage3DEXT", &texStorage3D);
 
     // GL_OES_vertex_array_object
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_vertex_array_object", loadProcAddress("glBindVertexArray"), &bindVertexArray);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_vertex_array_object", loadProcAddress("glDeleteVertexArrays"), &deleteVertexArrays);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_vertex_array_object", loadProcAddress("glGenVertexArrays"), &genVertexArrays);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_vertex_array_object", loadProcAddress("glIsVertexArray"), &isVertexArray);
+    assignExtensionEntryPoint("GL_OES_vertex_array_object", "glBindVertexArray", &bindVertexArray);
+    assignExtensionEntryPoint("GL_OES_vertex_array_object", "glDeleteVertexArrays", &deleteVertexArrays);
+    assignExtensionEntryPoint("GL_OES_vertex_array_object", "glGenVertexArrays", &genVertexArrays);
+    assignExtensionEntryPoint("GL_OES_vertex_array_object", "glIsVertexArray", &isVertexArray);
 
     // GL_EXT_map_buffer_range
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_map_buffer_range", loadProcAddress("glMapBufferRangeEXT"), &mapBufferRange);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_map_buffer_range", loadProcAddress("glFlushMappedBufferRangeEXT"), &flushMappedBufferRange);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_map_buffer_range", loadProcAddress("glUnmapBufferOES"), &unmapBuffer);
+    assignExtensionEntryPoint("GL_EXT_map_buffer_range", "glMapBufferRangeEXT", &mapBufferRange);
+    assignExtensionEntryPoint("GL_EXT_map_buffer_range", "glFlushMappedBufferRangeEXT", &flushMappedBufferRange);
+    assignExtensionEntryPoint("GL_EXT_map_buffer_range", "glUnmapBufferOES", &unmapBuffer);
+
+    // GL_EXT_buffer_storage
+    assignExtensionEntryPoint("GL_EXT_buffer_storage", "glBufferStorageEXT", &bufferStorage);
 
     // GL_OES_mapbuffer
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_mapbuffer", loadProcAddress("glMapBufferOES"), &mapBuffer);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_mapbuffer", loadProcAddress("glUnmapBufferOES"), &unmapBuffer);
+    assignExtensionEntryPoint("GL_OES_mapbuffer", "glMapBufferOES", &mapBuffer);
+    assignExtensionEntryPoint("GL_OES_mapbuffer", "glUnmapBufferOES", &unmapBuffer);
 
     // GL_KHR_debug
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glDebugMessageControlKHR"), &debugMessageControl);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glDebugMessageInsertKHR"), &debugMessageInsert);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glDebugMessageCallbackKHR"), &debugMessageCallback);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetDebugMessageLogKHR"), &getDebugMessageLog);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetPointervKHR"), &getPointerv);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glPushDebugGroupKHR"), &pushDebugGroup);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glPopDebugGroupKHR"), &popDebugGroup);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glObjectLabelKHR"), &objectLabel);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetObjectLabelKHR"), &getObjectLabel);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glObjectPtrLabelKHR"), &objectPtrLabel);
-    AssignGLExtensionEntryPoint(extensions, "GL_KHR_debug", loadProcAddress("glGetObjectPtrLabelKHR"), &getObjectPtrLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glDebugMessageControlKHR", &debugMessageControl);
+    assignExtensionEntryPoint("GL_KHR_debug", "glDebugMessageInsertKHR", &debugMessageInsert);
+    assignExtensionEntryPoint("GL_KHR_debug", "glDebugMessageCallbackKHR", &debugMessageCallback);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetDebugMessageLogKHR", &getDebugMessageLog);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetPointervKHR", &getPointerv);
+    assignExtensionEntryPoint("GL_KHR_debug", "glPushDebugGroupKHR", &pushDebugGroup);
+    assignExtensionEntryPoint("GL_KHR_debug", "glPopDebugGroupKHR", &popDebugGroup);
+    assignExtensionEntryPoint("GL_KHR_debug", "glObjectLabelKHR", &objectLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetObjectLabelKHR", &getObjectLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glObjectPtrLabelKHR", &objectPtrLabel);
+    assignExtensionEntryPoint("GL_KHR_debug", "glGetObjectPtrLabelKHR", &getObjectPtrLabel);
 
     // GL_EXT_draw_instanced
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_draw_instanced", loadProcAddress("glVertexAttribDivisorEXT"), &vertexAttribDivisor);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_draw_instanced", loadProcAddress("glDrawArraysInstancedEXT"), &drawArraysInstanced);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_draw_instanced", loadProcAddress("glDrawElementsInstancedEXT"), &drawElementsInstanced);
+    assignExtensionEntryPoint("GL_EXT_draw_instanced", "glVertexAttribDivisorEXT", &vertexAttribDivisor);
+    assignExtensionEntryPoint("GL_EXT_draw_instanced", "glDrawArraysInstancedEXT", &drawArraysInstanced);
+    assignExtensionEntryPoint("GL_EXT_draw_instanced", "glDrawElementsInstancedEXT", &drawElementsInstanced);
 
     // GL_EXT_occlusion_query_boolean
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glGenQueriesEXT"), &genQueries);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glDeleteQueriesEXT"), &deleteQueries);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glIsQueryEXT"), &isQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glBeginQueryEXT"), &beginQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glEndQueryEXT"), &endQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glGetQueryivEXT"), &getQueryiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_occlusion_query_boolean", loadProcAddress("glGetQueryObjectuivEXT"), &getQueryObjectuiv);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glGenQueriesEXT", &genQueries);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glDeleteQueriesEXT", &deleteQueries);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glIsQueryEXT", &isQuery);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glBeginQueryEXT", &beginQuery);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glEndQueryEXT", &endQuery);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glGetQueryivEXT", &getQueryiv);
+    assignExtensionEntryPoint("GL_EXT_occlusion_query_boolean", "glGetQueryObjectuivEXT", &getQueryObjectuiv);
 
     // GL_EXT_disjoint_timer_query
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glGenQueriesEXT"), &genQueries);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glDeleteQueriesEXT"), &deleteQueries);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glIsQueryEXT"), &isQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glBeginQueryEXT"), &beginQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glEndQueryEXT"), &endQuery);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glQueryCounterEXT"), &queryCounter);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glGetQueryivEXT"), &getQueryiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glGetQueryObjectivEXT"), &getQueryObjectiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glGetQueryObjectuivEXT"), &getQueryObjectuiv);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glGetQueryObjecti64vEXT"), &getQueryObjecti64v);
-    AssignGLExtensionEntryPoint(extensions, "GL_EXT_disjoint_timer_query", loadProcAddress("glGetQueryObjectui64vEXT"), &getQueryObjectui64v);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glGenQueriesEXT", &genQueries);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glDeleteQueriesEXT", &deleteQueries);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glIsQueryEXT", &isQuery);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glBeginQueryEXT", &beginQuery);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glEndQueryEXT", &endQuery);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glQueryCounterEXT", &queryCounter);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glGetQueryivEXT", &getQueryiv);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glGetQueryObjectivEXT", &getQueryObjectiv);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glGetQueryObjectuivEXT", &getQueryObjectuiv);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glGetQueryObjecti64vEXT", &getQueryObjecti64v);
+    assignExtensionEntryPoint("GL_EXT_disjoint_timer_query", "glGetQueryObjectui64vEXT", &getQueryObjectui64v);
 
     // GL_OES_EGL_image
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_EGL_image", loadProcAddress("glEGLImageTargetRenderbufferStorageOES"), &eglImageTargetRenderbufferStorageOES);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_EGL_image", loadProcAddress("glEGLImageTargetTexture2DOES"), &eglImageTargetTexture2DOES);
+    assignExtensionEntryPoint("GL_OES_EGL_image", "glEGLImageTargetRenderbufferStorageOES", &eglImageTargetRenderbufferStorageOES);
+    assignExtensionEntryPoint("GL_OES_EGL_image", "glEGLImageTargetTexture2DOES", &eglImageTargetTexture2DOES);
 
     // GL_OES_get_program_binary
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_get_program_binary", loadProcAddress("glGetProgramBinaryOES"), &getProgramBinary);
-    AssignGLExtensionEntryPoint(extensions, "GL_OES_get_program_binary", loadProcAddress("glProgramBinaryOES"), &programBinary);
+    assignExtensionEntryPoint("GL_OES_get_program_binary", "glGetProgramBinaryOES", &getProgramBinary);
+    assignExtensionEntryPoint("GL_OES_get_program_binary", "glProgramBinaryOES", &programBinary);
 
     // 2.0
     if (isAtLeastGLES(gl::Version(2, 0)))
     {
-        AssignGLEntryPoint(loadProcAddress("glActiveTexture"), &activeTexture);
-        AssignGLEntryPoint(loadProcAddress("glAttachShader"), &attachShader);
-        AssignGLEntryPoint(loadProcAddress("glBindAttribLocation"), &bindAttribLocation);
-        AssignGLEntryPoint(loadProcAddress("glBindBuffer"), &bindBuffer);
-        AssignGLEntryPoint(loadProcAddress("glBindFramebuffer"), &bindFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glBindRenderbuffer"), &bindRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glBindTexture"), &bindTexture);
-        AssignGLEntryPoint(loadProcAddress("glBlendColor"), &blendColor);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquation"), &blendEquation);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquationSeparate"), &blendEquationSeparate);
-        AssignGLEntryPoint(loadProcAddress("glBlendFunc"), &blendFunc);
-        AssignGLEntryPoint(loadProcAddress("glBlendFuncSeparate"), &blendFuncSeparate);
-        AssignGLEntryPoint(loadProcAddress("glBufferData"), &bufferData);
-        AssignGLEntryPoint(loadProcAddress("glBufferSubData"), &bufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glCheckFramebufferStatus"), &checkFramebufferStatus);
-        AssignGLEntryPoint(loadProcAddress("glClear"), &clear);
-        AssignGLEntryPoint(loadProcAddress("glClearColor"), &clearColor);
-        AssignGLEntryPoint(loadProcAddress("glClearDepthf"), &clearDepthf);
-        AssignGLEntryPoint(loadProcAddress("glClearStencil"), &clearStencil);
-        AssignGLEntryPoint(loadProcAddress("glColorMask"), &colorMask);
-        AssignGLEntryPoint(loadProcAddress("glCompileShader"), &compileShader);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexImage2D"), &compressedTexImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexSubImage2D"), &compressedTexSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexImage2D"), &copyTexImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexSubImage2D"), &copyTexSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glCreateProgram"), &createProgram);
-        AssignGLEntryPoint(loadProcAddress("glCreateShader"), &createShader);
-        AssignGLEntryPoint(loadProcAddress("glCullFace"), &cullFace);
-        AssignGLEntryPoint(loadProcAddress("glDeleteBuffers"), &deleteBuffers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteFramebuffers"), &deleteFramebuffers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteProgram"), &deleteProgram);
-        AssignGLEntryPoint(loadProcAddress("glDeleteRenderbuffers"), &deleteRenderbuffers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteShader"), &deleteShader);
-        AssignGLEntryPoint(loadProcAddress("glDeleteTextures"), &deleteTextures);
-        AssignGLEntryPoint(loadProcAddress("glDepthFunc"), &depthFunc);
-        AssignGLEntryPoint(loadProcAddress("glDepthMask"), &depthMask);
-        AssignGLEntryPoint(loadProcAddress("glDepthRangef"), &depthRangef);
-        AssignGLEntryPoint(loadProcAddress("glDetachShader"), &detachShader);
-        AssignGLEntryPoint(loadProcAddress("glDisable"), &disable);
-        AssignGLEntryPoint(loadProcAddress("glDisableVertexAttribArray"), &disableVertexAttribArray);
-        AssignGLEntryPoint(loadProcAddress("glDrawArrays"), &drawArrays);
-        AssignGLEntryPoint(loadProcAddress("glDrawElements"), &drawElements);
-        AssignGLEntryPoint(loadProcAddress("glEnable"), &enable);
-        AssignGLEntryPoint(loadProcAddress("glEnableVertexAttribArray"), &enableVertexAttribArray);
-        AssignGLEntryPoint(loadProcAddress("glFinish"), &finish);
-        AssignGLEntryPoint(loadProcAddress("glFlush"), &flush);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferRenderbuffer"), &framebufferRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTexture2D"), &framebufferTexture2D);
-        AssignGLEntryPoint(loadProcAddress("glFrontFace"), &frontFace);
-        AssignGLEntryPoint(loadProcAddress("glGenBuffers"), &genBuffers);
-        AssignGLEntryPoint(loadProcAddress("glGenerateMipmap"), &generateMipmap);
-        AssignGLEntryPoint(loadProcAddress("glGenFramebuffers"), &genFramebuffers);
-        AssignGLEntryPoint(loadProcAddress("glGenRenderbuffers"), &genRenderbuffers);
-        AssignGLEntryPoint(loadProcAddress("glGenTextures"), &genTextures);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveAttrib"), &getActiveAttrib);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniform"), &getActiveUniform);
-        AssignGLEntryPoint(loadProcAddress("glGetAttachedShaders"), &getAttachedShaders);
-        AssignGLEntryPoint(loadProcAddress("glGetAttribLocation"), &getAttribLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetBooleanv"), &getBooleanv);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferParameteriv"), &getBufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetError"), &getError);
-        AssignGLEntryPoint(loadProcAddress("glGetFloatv"), &getFloatv);
-        AssignGLEntryPoint(loadProcAddress("glGetFramebufferAttachmentParameteriv"), &getFramebufferAttachmentParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetIntegerv"), &getIntegerv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramiv"), &getProgramiv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramInfoLog"), &getProgramInfoLog);
-        AssignGLEntryPoint(loadProcAddress("glGetRenderbufferParameteriv"), &getRenderbufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderiv"), &getShaderiv);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderInfoLog"), &getShaderInfoLog);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderPrecisionFormat"), &getShaderPrecisionFormat);
-        AssignGLEntryPoint(loadProcAddress("glGetShaderSource"), &getShaderSource);
-        AssignGLEntryPoint(loadProcAddress("glGetString"), &getString);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameterfv"), &getTexParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameteriv"), &getTexParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformfv"), &getUniformfv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformiv"), &getUniformiv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformLocation"), &getUniformLocation);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribfv"), &getVertexAttribfv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribiv"), &getVertexAttribiv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribPointerv"), &getVertexAttribPointerv);
-        AssignGLEntryPoint(loadProcAddress("glHint"), &hint);
-        AssignGLEntryPoint(loadProcAddress("glIsBuffer"), &isBuffer);
-        AssignGLEntryPoint(loadProcAddress("glIsEnabled"), &isEnabled);
-        AssignGLEntryPoint(loadProcAddress("glIsFramebuffer"), &isFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glIsProgram"), &isProgram);
-        AssignGLEntryPoint(loadProcAddress("glIsRenderbuffer"), &isRenderbuffer);
-        AssignGLEntryPoint(loadProcAddress("glIsShader"), &isShader);
-        AssignGLEntryPoint(loadProcAddress("glIsTexture"), &isTexture);
-        AssignGLEntryPoint(loadProcAddress("glLineWidth"), &lineWidth);
-        AssignGLEntryPoint(loadProcAddress("glLinkProgram"), &linkProgram);
-        AssignGLEntryPoint(loadProcAddress("glPixelStorei"), &pixelStorei);
-        AssignGLEntryPoint(loadProcAddress("glPolygonOffset"), &polygonOffset);
-        AssignGLEntryPoint(loadProcAddress("glReadPixels"), &readPixels);
-        AssignGLEntryPoint(loadProcAddress("glReleaseShaderCompiler"), &releaseShaderCompiler);
-        AssignGLEntryPoint(loadProcAddress("glRenderbufferStorage"), &renderbufferStorage);
-        AssignGLEntryPoint(loadProcAddress("glSampleCoverage"), &sampleCoverage);
-        AssignGLEntryPoint(loadProcAddress("glScissor"), &scissor);
-        AssignGLEntryPoint(loadProcAddress("glShaderBinary"), &shaderBinary);
-        AssignGLEntryPoint(loadProcAddress("glShaderSource"), &shaderSource);
-        AssignGLEntryPoint(loadProcAddress("glStencilFunc"), &stencilFunc);
-        AssignGLEntryPoint(loadProcAddress("glStencilFuncSeparate"), &stencilFuncSeparate);
-        AssignGLEntryPoint(loadProcAddress("glStencilMask"), &stencilMask);
-        AssignGLEntryPoint(loadProcAddress("glStencilMaskSeparate"), &stencilMaskSeparate);
-        AssignGLEntryPoint(loadProcAddress("glStencilOp"), &stencilOp);
-        AssignGLEntryPoint(loadProcAddress("glStencilOpSeparate"), &stencilOpSeparate);
-        AssignGLEntryPoint(loadProcAddress("glTexImage2D"), &texImage2D);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterf"), &texParameterf);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterfv"), &texParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glTexParameteri"), &texParameteri);
-        AssignGLEntryPoint(loadProcAddress("glTexParameteriv"), &texParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glTexSubImage2D"), &texSubImage2D);
-        AssignGLEntryPoint(loadProcAddress("glUniform1f"), &uniform1f);
-        AssignGLEntryPoint(loadProcAddress("glUniform1fv"), &uniform1fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform1i"), &uniform1i);
-        AssignGLEntryPoint(loadProcAddress("glUniform1iv"), &uniform1iv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2f"), &uniform2f);
-        AssignGLEntryPoint(loadProcAddress("glUniform2fv"), &uniform2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2i"), &uniform2i);
-        AssignGLEntryPoint(loadProcAddress("glUniform2iv"), &uniform2iv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3f"), &uniform3f);
-        AssignGLEntryPoint(loadProcAddress("glUniform3fv"), &uniform3fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3i"), &uniform3i);
-        AssignGLEntryPoint(loadProcAddress("glUniform3iv"), &uniform3iv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4f"), &uniform4f);
-        AssignGLEntryPoint(loadProcAddress("glUniform4fv"), &uniform4fv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4i"), &uniform4i);
-        AssignGLEntryPoint(loadProcAddress("glUniform4iv"), &uniform4iv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2fv"), &uniformMatrix2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3fv"), &uniformMatrix3fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4fv"), &uniformMatrix4fv);
-        AssignGLEntryPoint(loadProcAddress("glUseProgram"), &useProgram);
-        AssignGLEntryPoint(loadProcAddress("glValidateProgram"), &validateProgram);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1f"), &vertexAttrib1f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib1fv"), &vertexAttrib1fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2f"), &vertexAttrib2f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib2fv"), &vertexAttrib2fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3f"), &vertexAttrib3f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib3fv"), &vertexAttrib3fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4f"), &vertexAttrib4f);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttrib4fv"), &vertexAttrib4fv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribPointer"), &vertexAttribPointer);
-        AssignGLEntryPoint(loadProcAddress("glViewport"), &viewport);
+        activeTexture.setLazy(this, "glActiveTexture");
+        attachShader.setLazy(this, "glAttachShader");
+        bindAttribLocation.setLazy(this, "glBindAttribLocation");
+        bindBuffer.setLazy(this, "glBindBuffer");
+        bindFramebuffer.setLazy(this, "glBindFramebuffer");
+        bindRenderbuffer.setLazy(this, "glBindRenderbuffer");
+        bindTexture.setLazy(this, "glBindTexture");
+        blendColor.setLazy(this, "glBlendColor");
+        blendEquation.setLazy(this, "glBlendEquation");
+        blendEquationSeparate.setLazy(this, "glBlendEquationSeparate");
+        blendFunc.setLazy(this, "glBlendFunc");
+        blendFuncSeparate.setLazy(this, "glBlendFuncSeparate");
+        bufferData.setLazy(this, "glBufferData");
+        bufferSubData.setLazy(this, "glBufferSubData");
+        checkFramebufferStatus.setLazy(this, "glCheckFramebufferStatus");
+        clear.setLazy(this, "glClear");
+        clearColor.setLazy(this, "glClearColor");
+        clearDepthf.setLazy(this, "glClearDepthf");
+        clearStencil.setLazy(this, "glClearStencil");
+        colorMask.setLazy(this, "glColorMask");
+        compileShader.setLazy(this, "glCompileShader");
+        compressedTexImage2D.setLazy(this, "glCompressedTexImage2D");
+        compressedTexSubImage2D.setLazy(this, "glCompressedTexSubImage2D");
+        copyTexImage2D.setLazy(this, "glCopyTexImage2D");
+        copyTexSubImage2D.setLazy(this, "glCopyTexSubImage2D");
+        createProgram.setLazy(this, "glCreateProgram");
+        createShader.setLazy(this, "glCreateShader");
+        cullFace.setLazy(this, "glCullFace");
+        deleteBuffers.setLazy(this, "glDeleteBuffers");
+        deleteFramebuffers.setLazy(this, "glDeleteFramebuffers");
+        deleteProgram.setLazy(this, "glDeleteProgram");
+        deleteRenderbuffers.setLazy(this, "glDeleteRenderbuffers");
+        deleteShader.setLazy(this, "glDeleteShader");
+        deleteTextures.setLazy(this, "glDeleteTextures");
+        depthFunc.setLazy(this, "glDepthFunc");
+        depthMask.setLazy(this, "glDepthMask");
+        depthRangef.setLazy(this, "glDepthRangef");
+        detachShader.setLazy(this, "glDetachShader");
+        disable.setLazy(this, "glDisable");
+        disableVertexAttribArray.setLazy(this, "glDisableVertexAttribArray");
+        drawArrays.setLazy(this, "glDrawArrays");
+        drawElements.setLazy(this, "glDrawElements");
+        enable.setLazy(this, "glEnable");
+        enableVertexAttribArray.setLazy(this, "glEnableVertexAttribArray");
+        finish.setLazy(this, "glFinish");
+        flush.setLazy(this, "glFlush");
+        framebufferRenderbuffer.setLazy(this, "glFramebufferRenderbuffer");
+        framebufferTexture2D.setLazy(this, "glFramebufferTexture2D");
+        frontFace.setLazy(this, "glFrontFace");
+        genBuffers.setLazy(this, "glGenBuffers");
+        generateMipmap.setLazy(this, "glGenerateMipmap");
+        genFramebuffers.setLazy(this, "glGenFramebuffers");
+        genRenderbuffers.setLazy(this, "glGenRenderbuffers");
+        genTextures.setLazy(this, "glGenTextures");
+        getActiveAttrib.setLazy(this, "glGetActiveAttrib");
+        getActiveUniform.setLazy(this, "glGetActiveUniform");
+        getAttachedShaders.setLazy(this, "glGetAttachedShaders");
+        getAttribLocation.setLazy(this, "glGetAttribLocation");
+        getBooleanv.setLazy(this, "glGetBooleanv");
+        getBufferParameteriv.setLazy(this, "glGetBufferParameteriv");
+        getError.setLazy(this, "glGetError");
+        getFloatv.setLazy(this, "glGetFloatv");
+        getFramebufferAttachmentParameteriv.setLazy(this, "glGetFramebufferAttachmentParameteriv");
+        getIntegerv.setLazy(this, "glGetIntegerv");
+        getProgramiv.setLazy(this, "glGetProgramiv");
+        getProgramInfoLog.setLazy(this, "glGetProgramInfoLog");
+        getRenderbufferParameteriv.setLazy(this, "glGetRenderbufferParameteriv");
+        getShaderiv.setLazy(this, "glGetShaderiv");
+        getShaderInfoLog.setLazy(this, "glGetShaderInfoLog");
+        getShaderPrecisionFormat.setLazy(this, "glGetShaderPrecisionFormat");
+        getShaderSource.setLazy(this, "glGetShaderSource");
+        getString.setLazy(this, "glGetString");
+        getTexParameterfv.setLazy(this, "glGetTexParameterfv");
+        getTexParameteriv.setLazy(this, "glGetTexParameteriv");
+        getUniformfv.setLazy(this, "glGetUniformfv");
+        getUniformiv.setLazy(this, "glGetUniformiv");
+        getUniformLocation.setLazy(this, "glGetUniformLocation");
+        getVertexAttribfv.setLazy(this, "glGetVertexAttribfv");
+        getVertexAttribiv.setLazy(this, "glGetVertexAttribiv");
+        getVertexAttribPointerv.setLazy(this, "glGetVertexAttribPointerv");
+        hint.setLazy(this, "glHint");
+        isBuffer.setLazy(this, "glIsBuffer");
+        isEnabled.setLazy(this, "glIsEnabled");
+        isFramebuffer.setLazy(this, "glIsFramebuffer");
+        isProgram.setLazy(this, "glIsProgram");
+        isRenderbuffer.setLazy(this, "glIsRenderbuffer");
+        isShader.setLazy(this, "glIsShader");
+        isTexture.setLazy(this, "glIsTexture");
+        lineWidth.setLazy(this, "glLineWidth");
+        linkProgram.setLazy(this, "glLinkProgram");
+        pixelStorei.setLazy(this, "glPixelStorei");
+        polygonOffset.setLazy(this, "glPolygonOffset");
+        readPixels.setLazy(this, "glReadPixels");
+        releaseShaderCompiler.setLazy(this, "glReleaseShaderCompiler");
+        renderbufferStorage.setLazy(this, "glRenderbufferStorage");
+        sampleCoverage.setLazy(this, "glSampleCoverage");
+        scissor.setLazy(this, "glScissor");
+        shaderBinary.setLazy(this, "glShaderBinary");
+        shaderSource.setLazy(this, "glShaderSource");
+        stencilFunc.setLazy(this, "glStencilFunc");
+        stencilFuncSeparate.setLazy(this, "glStencilFuncSeparate");
+        stencilMask.setLazy(this, "glStencilMask");
+        stencilMaskSeparate.setLazy(this, "glStencilMaskSeparate");
+        stencilOp.setLazy(this, "glStencilOp");
+        stencilOpSeparate.setLazy(this, "glStencilOpSeparate");
+        texImage2D.setLazy(this, "glTexImage2D");
+        texParameterf.setLazy(this, "glTexParameterf");
+        texParameterfv.setLazy(this, "glTexParameterfv");
+        texParameteri.setLazy(this, "glTexParameteri");
+        texParameteriv.setLazy(this, "glTexParameteriv");
+        texSubImage2D.setLazy(this, "glTexSubImage2D");
+        uniform1f.setLazy(this, "glUniform1f");
+        uniform1fv.setLazy(this, "glUniform1fv");
+        uniform1i.setLazy(this, "glUniform1i");
+        uniform1iv.setLazy(this, "glUniform1iv");
+        uniform2f.setLazy(this, "glUniform2f");
+        uniform2fv.setLazy(this, "glUniform2fv");
+        uniform2i.setLazy(this, "glUniform2i");
+        uniform2iv.setLazy(this, "glUniform2iv");
+        uniform3f.setLazy(this, "glUniform3f");
+        uniform3fv.setLazy(this, "glUniform3fv");
+        uniform3i.setLazy(this, "glUniform3i");
+        uniform3iv.setLazy(this, "glUniform3iv");
+        uniform4f.setLazy(this, "glUniform4f");
+        uniform4fv.setLazy(this, "glUniform4fv");
+        uniform4i.setLazy(this, "glUniform4i");
+        uniform4iv.setLazy(this, "glUniform4iv");
+        uniformMatrix2fv.setLazy(this, "glUniformMatrix2fv");
+        uniformMatrix3fv.setLazy(this, "glUniformMatrix3fv");
+        uniformMatrix4fv.setLazy(this, "glUniformMatrix4fv");
+        useProgram.setLazy(this, "glUseProgram");
+        validateProgram.setLazy(this, "glValidateProgram");
+        vertexAttrib1f.setLazy(this, "glVertexAttrib1f");
+        vertexAttrib1fv.setLazy(this, "glVertexAttrib1fv");
+        vertexAttrib2f.setLazy(this, "glVertexAttrib2f");
+        vertexAttrib2fv.setLazy(this, "glVertexAttrib2fv");
+        vertexAttrib3f.setLazy(this, "glVertexAttrib3f");
+        vertexAttrib3fv.setLazy(this, "glVertexAttrib3fv");
+        vertexAttrib4f.setLazy(this, "glVertexAttrib4f");
+        vertexAttrib4fv.setLazy(this, "glVertexAttrib4fv");
+        vertexAttribPointer.setLazy(this, "glVertexAttribPointer");
+        viewport.setLazy(this, "glViewport");
     }
 
     // 3.0
     if (isAtLeastGLES(gl::Version(3, 0)))
     {
-        AssignGLEntryPoint(loadProcAddress("glReadBuffer"), &readBuffer);
-        AssignGLEntryPoint(loadProcAddress("glDrawRangeElements"), &drawRangeElements);
-        AssignGLEntryPoint(loadProcAddress("glTexImage3D"), &texImage3D);
-        AssignGLEntryPoint(loadProcAddress("glTexSubImage3D"), &texSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glCopyTexSubImage3D"), &copyTexSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexImage3D"), &compressedTexImage3D);
-        AssignGLEntryPoint(loadProcAddress("glCompressedTexSubImage3D"), &compressedTexSubImage3D);
-        AssignGLEntryPoint(loadProcAddress("glGenQueries"), &genQueries);
-        AssignGLEntryPoint(loadProcAddress("glDeleteQueries"), &deleteQueries);
-        AssignGLEntryPoint(loadProcAddress("glIsQuery"), &isQuery);
-        AssignGLEntryPoint(loadProcAddress("glBeginQuery"), &beginQuery);
-        AssignGLEntryPoint(loadProcAddress("glEndQuery"), &endQuery);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryiv"), &getQueryiv);
-        AssignGLEntryPoint(loadProcAddress("glGetQueryObjectuiv"), &getQueryObjectuiv);
-        AssignGLEntryPoint(loadProcAddress("glUnmapBuffer"), &unmapBuffer);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferPointerv"), &getBufferPointerv);
-        AssignGLEntryPoint(loadProcAddress("glDrawBuffers"), &drawBuffers);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2x3fv"), &uniformMatrix2x3fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3x2fv"), &uniformMatrix3x2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix2x4fv"), &uniformMatrix2x4fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4x2fv"), &uniformMatrix4x2fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix3x4fv"), &uniformMatrix3x4fv);
-        AssignGLEntryPoint(loadProcAddress("glUniformMatrix4x3fv"), &uniformMatrix4x3fv);
-        AssignGLEntryPoint(loadProcAddress("glBlitFramebuffer"), &blitFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glRenderbufferStorageMultisample"), &renderbufferStorageMultisample);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTextureLayer"), &framebufferTextureLayer);
-        AssignGLEntryPoint(loadProcAddress("glMapBufferRange"), &mapBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glFlushMappedBufferRange"), &flushMappedBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glBindVertexArray"), &bindVertexArray);
-        AssignGLEntryPoint(loadProcAddress("glDeleteVertexArrays"), &deleteVertexArrays);
-        AssignGLEntryPoint(loadProcAddress("glGenVertexArrays"), &genVertexArrays);
-        AssignGLEntryPoint(loadProcAddress("glIsVertexArray"), &isVertexArray);
-        AssignGLEntryPoint(loadProcAddress("glGetIntegeri_v"), &getIntegeri_v);
-        AssignGLEntryPoint(loadProcAddress("glBeginTransformFeedback"), &beginTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glEndTransformFeedback"), &endTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glBindBufferRange"), &bindBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glBindBufferBase"), &bindBufferBase);
-        AssignGLEntryPoint(loadProcAddress("glTransformFeedbackVaryings"), &transformFeedbackVaryings);
-        AssignGLEntryPoint(loadProcAddress("glGetTransformFeedbackVarying"), &getTransformFeedbackVarying);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribIPointer"), &vertexAttribIPointer);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribIiv"), &getVertexAttribIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetVertexAttribIuiv"), &getVertexAttribIuiv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4i"), &vertexAttribI4i);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4ui"), &vertexAttribI4ui);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4iv"), &vertexAttribI4iv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribI4uiv"), &vertexAttribI4uiv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformuiv"), &getUniformuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetFragDataLocation"), &getFragDataLocation);
-        AssignGLEntryPoint(loadProcAddress("glUniform1ui"), &uniform1ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform2ui"), &uniform2ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform3ui"), &uniform3ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform4ui"), &uniform4ui);
-        AssignGLEntryPoint(loadProcAddress("glUniform1uiv"), &uniform1uiv);
-        AssignGLEntryPoint(loadProcAddress("glUniform2uiv"), &uniform2uiv);
-        AssignGLEntryPoint(loadProcAddress("glUniform3uiv"), &uniform3uiv);
-        AssignGLEntryPoint(loadProcAddress("glUniform4uiv"), &uniform4uiv);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferiv"), &clearBufferiv);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferuiv"), &clearBufferuiv);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferfv"), &clearBufferfv);
-        AssignGLEntryPoint(loadProcAddress("glClearBufferfi"), &clearBufferfi);
-        AssignGLEntryPoint(loadProcAddress("glGetStringi"), &getStringi);
-        AssignGLEntryPoint(loadProcAddress("glCopyBufferSubData"), &copyBufferSubData);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformIndices"), &getUniformIndices);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformsiv"), &getActiveUniformsiv);
-        AssignGLEntryPoint(loadProcAddress("glGetUniformBlockIndex"), &getUniformBlockIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformBlockiv"), &getActiveUniformBlockiv);
-        AssignGLEntryPoint(loadProcAddress("glGetActiveUniformBlockName"), &getActiveUniformBlockName);
-        AssignGLEntryPoint(loadProcAddress("glUniformBlockBinding"), &uniformBlockBinding);
-        AssignGLEntryPoint(loadProcAddress("glDrawArraysInstanced"), &drawArraysInstanced);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsInstanced"), &drawElementsInstanced);
-        AssignGLEntryPoint(loadProcAddress("glFenceSync"), &fenceSync);
-        AssignGLEntryPoint(loadProcAddress("glIsSync"), &isSync);
-        AssignGLEntryPoint(loadProcAddress("glDeleteSync"), &deleteSync);
-        AssignGLEntryPoint(loadProcAddress("glClientWaitSync"), &clientWaitSync);
-        AssignGLEntryPoint(loadProcAddress("glWaitSync"), &waitSync);
-        AssignGLEntryPoint(loadProcAddress("glGetInteger64v"), &getInteger64v);
-        AssignGLEntryPoint(loadProcAddress("glGetSynciv"), &getSynciv);
-        AssignGLEntryPoint(loadProcAddress("glGetInteger64i_v"), &getInteger64i_v);
-        AssignGLEntryPoint(loadProcAddress("glGetBufferParameteri64v"), &getBufferParameteri64v);
-        AssignGLEntryPoint(loadProcAddress("glGenSamplers"), &genSamplers);
-        AssignGLEntryPoint(loadProcAddress("glDeleteSamplers"), &deleteSamplers);
-        AssignGLEntryPoint(loadProcAddress("glIsSampler"), &isSampler);
-        AssignGLEntryPoint(loadProcAddress("glBindSampler"), &bindSampler);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameteri"), &samplerParameteri);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameteriv"), &samplerParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterf"), &samplerParameterf);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterfv"), &samplerParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameteriv"), &getSamplerParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameterfv"), &getSamplerParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribDivisor"), &vertexAttribDivisor);
-        AssignGLEntryPoint(loadProcAddress("glBindTransformFeedback"), &bindTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glDeleteTransformFeedbacks"), &deleteTransformFeedbacks);
-        AssignGLEntryPoint(loadProcAddress("glGenTransformFeedbacks"), &genTransformFeedbacks);
-        AssignGLEntryPoint(loadProcAddress("glIsTransformFeedback"), &isTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glPauseTransformFeedback"), &pauseTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glResumeTransformFeedback"), &resumeTransformFeedback);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramBinary"), &getProgramBinary);
-        AssignGLEntryPoint(loadProcAddress("glProgramBinary"), &programBinary);
-        AssignGLEntryPoint(loadProcAddress("glProgramParameteri"), &programParameteri);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateFramebuffer"), &invalidateFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glInvalidateSubFramebuffer"), &invalidateSubFramebuffer);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage2D"), &texStorage2D);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage3D"), &texStorage3D);
-        AssignGLEntryPoint(loadProcAddress("glGetInternalformativ"), &getInternalformativ);
+        readBuffer.setLazy(this, "glReadBuffer");
+        drawRangeElements.setLazy(this, "glDrawRangeElements");
+        texImage3D.setLazy(this, "glTexImage3D");
+        texSubImage3D.setLazy(this, "glTexSubImage3D");
+        copyTexSubImage3D.setLazy(this, "glCopyTexSubImage3D");
+        compressedTexImage3D.setLazy(this, "glCompressedTexImage3D");
+        compressedTexSubImage3D.setLazy(this, "glCompressedTexSubImage3D");
+        genQueries.setLazy(this, "glGenQueries");
+        deleteQueries.setLazy(this, "glDeleteQueries");
+        isQuery.setLazy(this, "glIsQuery");
+        beginQuery.setLazy(this, "glBeginQuery");
+        endQuery.setLazy(this, "glEndQuery");
+        getQueryiv.setLazy(this, "glGetQueryiv");
+        getQueryObjectuiv.setLazy(this, "glGetQueryObjectuiv");
+        unmapBuffer.setLazy(this, "glUnmapBuffer");
+        getBufferPointerv.setLazy(this, "glGetBufferPointerv");
+        drawBuffers.setLazy(this, "glDrawBuffers");
+        uniformMatrix2x3fv.setLazy(this, "glUniformMatrix2x3fv");
+        uniformMatrix3x2fv.setLazy(this, "glUniformMatrix3x2fv");
+        uniformMatrix2x4fv.setLazy(this, "glUniformMatrix2x4fv");
+        uniformMatrix4x2fv.setLazy(this, "glUniformMatrix4x2fv");
+        uniformMatrix3x4fv.setLazy(this, "glUniformMatrix3x4fv");
+        uniformMatrix4x3fv.setLazy(this, "glUniformMatrix4x3fv");
+        blitFramebuffer.setLazy(this, "glBlitFramebuffer");
+        renderbufferStorageMultisample.setLazy(this, "glRenderbufferStorageMultisample");
+        framebufferTextureLayer.setLazy(this, "glFramebufferTextureLayer");
+        mapBufferRange.setLazy(this, "glMapBufferRange");
+        flushMappedBufferRange.setLazy(this, "glFlushMappedBufferRange");
+        bindVertexArray.setLazy(this, "glBindVertexArray");
+        deleteVertexArrays.setLazy(this, "glDeleteVertexArrays");
+        genVertexArrays.setLazy(this, "glGenVertexArrays");
+        isVertexArray.setLazy(this, "glIsVertexArray");
+        getIntegeri_v.setLazy(this, "glGetIntegeri_v");
+        beginTransformFeedback.setLazy(this, "glBeginTransformFeedback");
+        endTransformFeedback.setLazy(this, "glEndTransformFeedback");
+        bindBufferRange.setLazy(this, "glBindBufferRange");
+        bindBufferBase.setLazy(this, "glBindBufferBase");
+        transformFeedbackVaryings.setLazy(this, "glTransformFeedbackVaryings");
+        getTransformFeedbackVarying.setLazy(this, "glGetTransformFeedbackVarying");
+        vertexAttribIPointer.setLazy(this, "glVertexAttribIPointer");
+        getVertexAttribIiv.setLazy(this, "glGetVertexAttribIiv");
+        getVertexAttribIuiv.setLazy(this, "glGetVertexAttribIuiv");
+        vertexAttribI4i.setLazy(this, "glVertexAttribI4i");
+        vertexAttribI4ui.setLazy(this, "glVertexAttribI4ui");
+        vertexAttribI4iv.setLazy(this, "glVertexAttribI4iv");
+        vertexAttribI4uiv.setLazy(this, "glVertexAttribI4uiv");
+        getUniformuiv.setLazy(this, "glGetUniformuiv");
+        getFragDataLocation.setLazy(this, "glGetFragDataLocation");
+        uniform1ui.setLazy(this, "glUniform1ui");
+        uniform2ui.setLazy(this, "glUniform2ui");
+        uniform3ui.setLazy(this, "glUniform3ui");
+        uniform4ui.setLazy(this, "glUniform4ui");
+        uniform1uiv.setLazy(this, "glUniform1uiv");
+        uniform2uiv.setLazy(this, "glUniform2uiv");
+        uniform3uiv.setLazy(this, "glUniform3uiv");
+        uniform4uiv.setLazy(this, "glUniform4uiv");
+        clearBufferiv.setLazy(this, "glClearBufferiv");
+        clearBufferuiv.setLazy(this, "glClearBufferuiv");
+        clearBufferfv.setLazy(this, "glClearBufferfv");
+        clearBufferfi.setLazy(this, "glClearBufferfi");
+        getStringi.setLazy(this, "glGetStringi");
+        copyBufferSubData.setLazy(this, "glCopyBufferSubData");
+        getUniformIndices.setLazy(this, "glGetUniformIndices");
+        getActiveUniformsiv.setLazy(this, "glGetActiveUniformsiv");
+        getUniformBlockIndex.setLazy(this, "glGetUniformBlockIndex");
+        getActiveUniformBlockiv.setLazy(this, "glGetActiveUniformBlockiv");
+        getActiveUniformBlockName.setLazy(this, "glGetActiveUniformBlockName");
+        uniformBlockBinding.setLazy(this, "glUniformBlockBinding");
+        drawArraysInstanced.setLazy(this, "glDrawArraysInstanced");
+        drawElementsInstanced.setLazy(this, "glDrawElementsInstanced");
+        fenceSync.setLazy(this, "glFenceSync");
+        isSync.setLazy(this, "glIsSync");
+        deleteSync.setLazy(this, "glDeleteSync");
+        clientWaitSync.setLazy(this, "glClientWaitSync");
+        waitSync.setLazy(this, "glWaitSync");
+        getInteger64v.setLazy(this, "glGetInteger64v");
+        getSynciv.setLazy(this, "glGetSynciv");
+        getInteger64i_v.setLazy(this, "glGetInteger64i_v");
+        getBufferParameteri64v.setLazy(this, "glGetBufferParameteri64v");
+        genSamplers.setLazy(this, "glGenSamplers");
+        deleteSamplers.setLazy(this, "glDeleteSamplers");
+        isSampler.setLazy(this, "glIsSampler");
+        bindSampler.setLazy(this, "glBindSampler");
+        samplerParameteri.setLazy(this, "glSamplerParameteri");
+        samplerParameteriv.setLazy(this, "glSamplerParameteriv");
+        samplerParameterf.setLazy(this, "glSamplerParameterf");
+        samplerParameterfv.setLazy(this, "glSamplerParameterfv");
+        getSamplerParameteriv.setLazy(this, "glGetSamplerParameteriv");
+        getSamplerParameterfv.setLazy(this, "glGetSamplerParameterfv");
+        vertexAttribDivisor.setLazy(this, "glVertexAttribDivisor");
+        bindTransformFeedback.setLazy(this, "glBindTransformFeedback");
+        deleteTransformFeedbacks.setLazy(this, "glDeleteTransformFeedbacks");
+        genTransformFeedbacks.setLazy(this, "glGenTransformFeedbacks");
+        isTransformFeedback.setLazy(this, "glIsTransformFeedback");
+        pauseTransformFeedback.setLazy(this, "glPauseTransformFeedback");
+        resumeTransformFeedback.setLazy(this, "glResumeTransformFeedback");
+        getProgramBinary.setLazy(this, "glGetProgramBinary");
+        programBinary.setLazy(this, "glProgramBinary");
+        programParameteri.setLazy(this, "glProgramParameteri");
+        invalidateFramebuffer.setLazy(this, "glInvalidateFramebuffer");
+        invalidateSubFramebuffer.setLazy(this, "glInvalidateSubFramebuffer");
+        texStorage2D.setLazy(this, "glTexStorage2D");
+        texStorage3D.setLazy(this, "glTexStorage3D");
+        getInternalformativ.setLazy(this, "glGetInternalformativ");
     }
 
     // 3.1
     if (isAtLeastGLES(gl::Version(3, 1)))
     {
-        AssignGLEntryPoint(loadProcAddress("glDispatchCompute"), &dispatchCompute);
-        AssignGLEntryPoint(loadProcAddress("glDispatchComputeIndirect"), &dispatchComputeIndirect);
-        AssignGLEntryPoint(loadProcAddress("glDrawArraysIndirect"), &drawArraysIndirect);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsIndirect"), &drawElementsIndirect);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferParameteri"), &framebufferParameteri);
-        AssignGLEntryPoint(loadProcAddress("glGetFramebufferParameteriv"), &getFramebufferParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramInterfaceiv"), &getProgramInterfaceiv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceIndex"), &getProgramResourceIndex);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceName"), &getProgramResourceName);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceiv"), &getProgramResourceiv);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramResourceLocation"), &getProgramResourceLocation);
-        AssignGLEntryPoint(loadProcAddress("glUseProgramStages"), &useProgramStages);
-        AssignGLEntryPoint(loadProcAddress("glActiveShaderProgram"), &activeShaderProgram);
-        AssignGLEntryPoint(loadProcAddress("glCreateShaderProgramv"), &createShaderProgramv);
-        AssignGLEntryPoint(loadProcAddress("glBindProgramPipeline"), &bindProgramPipeline);
-        AssignGLEntryPoint(loadProcAddress("glDeleteProgramPipelines"), &deleteProgramPipelines);
-        AssignGLEntryPoint(loadProcAddress("glGenProgramPipelines"), &genProgramPipelines);
-        AssignGLEntryPoint(loadProcAddress("glIsProgramPipeline"), &isProgramPipeline);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramPipelineiv"), &getProgramPipelineiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1i"), &programUniform1i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2i"), &programUniform2i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3i"), &programUniform3i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4i"), &programUniform4i);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1ui"), &programUniform1ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2ui"), &programUniform2ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3ui"), &programUniform3ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4ui"), &programUniform4ui);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1f"), &programUniform1f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2f"), &programUniform2f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3f"), &programUniform3f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4f"), &programUniform4f);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1iv"), &programUniform1iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2iv"), &programUniform2iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3iv"), &programUniform3iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4iv"), &programUniform4iv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1uiv"), &programUniform1uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2uiv"), &programUniform2uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3uiv"), &programUniform3uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4uiv"), &programUniform4uiv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform1fv"), &programUniform1fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform2fv"), &programUniform2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform3fv"), &programUniform3fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniform4fv"), &programUniform4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2fv"), &programUniformMatrix2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3fv"), &programUniformMatrix3fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4fv"), &programUniformMatrix4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2x3fv"), &programUniformMatrix2x3fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3x2fv"), &programUniformMatrix3x2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix2x4fv"), &programUniformMatrix2x4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4x2fv"), &programUniformMatrix4x2fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix3x4fv"), &programUniformMatrix3x4fv);
-        AssignGLEntryPoint(loadProcAddress("glProgramUniformMatrix4x3fv"), &programUniformMatrix4x3fv);
-        AssignGLEntryPoint(loadProcAddress("glValidateProgramPipeline"), &validateProgramPipeline);
-        AssignGLEntryPoint(loadProcAddress("glGetProgramPipelineInfoLog"), &getProgramPipelineInfoLog);
-        AssignGLEntryPoint(loadProcAddress("glBindImageTexture"), &bindImageTexture);
-        AssignGLEntryPoint(loadProcAddress("glGetBooleani_v"), &getBooleani_v);
-        AssignGLEntryPoint(loadProcAddress("glMemoryBarrier"), &memoryBarrier);
-        AssignGLEntryPoint(loadProcAddress("glMemoryBarrierByRegion"), &memoryBarrierByRegion);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage2DMultisample"), &texStorage2DMultisample);
-        AssignGLEntryPoint(loadProcAddress("glGetMultisamplefv"), &getMultisamplefv);
-        AssignGLEntryPoint(loadProcAddress("glSampleMaski"), &sampleMaski);
-        AssignGLEntryPoint(loadProcAddress("glGetTexLevelParameteriv"), &getTexLevelParameteriv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexLevelParameterfv"), &getTexLevelParameterfv);
-        AssignGLEntryPoint(loadProcAddress("glBindVertexBuffer"), &bindVertexBuffer);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribFormat"), &vertexAttribFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribIFormat"), &vertexAttribIFormat);
-        AssignGLEntryPoint(loadProcAddress("glVertexAttribBinding"), &vertexAttribBinding);
-        AssignGLEntryPoint(loadProcAddress("glVertexBindingDivisor"), &vertexBindingDivisor);
+        dispatchCompute.setLazy(this, "glDispatchCompute");
+        dispatchComputeIndirect.setLazy(this, "glDispatchComputeIndirect");
+        drawArraysIndirect.setLazy(this, "glDrawArraysIndirect");
+        drawElementsIndirect.setLazy(this, "glDrawElementsIndirect");
+        framebufferParameteri.setLazy(this, "glFramebufferParameteri");
+        getFramebufferParameteriv.setLazy(this, "glGetFramebufferParameteriv");
+        getProgramInterfaceiv.setLazy(this, "glGetProgramInterfaceiv");
+        getProgramResourceIndex.setLazy(this, "glGetProgramResourceIndex");
+        getProgramResourceName.setLazy(this, "glGetProgramResourceName");
+        getProgramResourceiv.setLazy(this, "glGetProgramResourceiv");
+        getProgramResourceLocation.setLazy(this, "glGetProgramResourceLocation");
+        useProgramStages.setLazy(this, "glUseProgramStages");
+        activeShaderProgram.setLazy(this, "glActiveShaderProgram");
+        createShaderProgramv.setLazy(this, "glCreateShaderProgramv");
+        bindProgramPipeline.setLazy(this, "glBindProgramPipeline");
+        deleteProgramPipelines.setLazy(this, "glDeleteProgramPipelines");
+        genProgramPipelines.setLazy(this, "glGenProgramPipelines");
+        isProgramPipeline.setLazy(this, "glIsProgramPipeline");
+        getProgramPipelineiv.setLazy(this, "glGetProgramPipelineiv");
+        programUniform1i.setLazy(this, "glProgramUniform1i");
+        programUniform2i.setLazy(this, "glProgramUniform2i");
+        programUniform3i.setLazy(this, "glProgramUniform3i");
+        programUniform4i.setLazy(this, "glProgramUniform4i");
+        programUniform1ui.setLazy(this, "glProgramUniform1ui");
+        programUniform2ui.setLazy(this, "glProgramUniform2ui");
+        programUniform3ui.setLazy(this, "glProgramUniform3ui");
+        programUniform4ui.setLazy(this, "glProgramUniform4ui");
+        programUniform1f.setLazy(this, "glProgramUniform1f");
+        programUniform2f.setLazy(this, "glProgramUniform2f");
+        programUniform3f.setLazy(this, "glProgramUniform3f");
+        programUniform4f.setLazy(this, "glProgramUniform4f");
+        programUniform1iv.setLazy(this, "glProgramUniform1iv");
+        programUniform2iv.setLazy(this, "glProgramUniform2iv");
+        programUniform3iv.setLazy(this, "glProgramUniform3iv");
+        programUniform4iv.setLazy(this, "glProgramUniform4iv");
+        programUniform1uiv.setLazy(this, "glProgramUniform1uiv");
+        programUniform2uiv.setLazy(this, "glProgramUniform2uiv");
+        programUniform3uiv.setLazy(this, "glProgramUniform3uiv");
+        programUniform4uiv.setLazy(this, "glProgramUniform4uiv");
+        programUniform1fv.setLazy(this, "glProgramUniform1fv");
+        programUniform2fv.setLazy(this, "glProgramUniform2fv");
+        programUniform3fv.setLazy(this, "glProgramUniform3fv");
+        programUniform4fv.setLazy(this, "glProgramUniform4fv");
+        programUniformMatrix2fv.setLazy(this, "glProgramUniformMatrix2fv");
+        programUniformMatrix3fv.setLazy(this, "glProgramUniformMatrix3fv");
+        programUniformMatrix4fv.setLazy(this, "glProgramUniformMatrix4fv");
+        programUniformMatrix2x3fv.setLazy(this, "glProgramUniformMatrix2x3fv");
+        programUniformMatrix3x2fv.setLazy(this, "glProgramUniformMatrix3x2fv");
+        programUniformMatrix2x4fv.setLazy(this, "glProgramUniformMatrix2x4fv");
+        programUniformMatrix4x2fv.setLazy(this, "glProgramUniformMatrix4x2fv");
+        programUniformMatrix3x4fv.setLazy(this, "glProgramUniformMatrix3x4fv");
+        programUniformMatrix4x3fv.setLazy(this, "glProgramUniformMatrix4x3fv");
+        validateProgramPipeline.setLazy(this, "glValidateProgramPipeline");
+        getProgramPipelineInfoLog.setLazy(this, "glGetProgramPipelineInfoLog");
+        bindImageTexture.setLazy(this, "glBindImageTexture");
+        getBooleani_v.setLazy(this, "glGetBooleani_v");
+        memoryBarrier.setLazy(this, "glMemoryBarrier");
+        memoryBarrierByRegion.setLazy(this, "glMemoryBarrierByRegion");
+        texStorage2DMultisample.setLazy(this, "glTexStorage2DMultisample");
+        getMultisamplefv.setLazy(this, "glGetMultisamplefv");
+        sampleMaski.setLazy(this, "glSampleMaski");
+        getTexLevelParameteriv.setLazy(this, "glGetTexLevelParameteriv");
+        getTexLevelParameterfv.setLazy(this, "glGetTexLevelParameterfv");
+        bindVertexBuffer.setLazy(this, "glBindVertexBuffer");
+        vertexAttribFormat.setLazy(this, "glVertexAttribFormat");
+        vertexAttribIFormat.setLazy(this, "glVertexAttribIFormat");
+        vertexAttribBinding.setLazy(this, "glVertexAttribBinding");
+        vertexBindingDivisor.setLazy(this, "glVertexBindingDivisor");
     }
 
     // 3.2
     if (isAtLeastGLES(gl::Version(3, 2)))
     {
-        AssignGLEntryPoint(loadProcAddress("glBlendBarrier"), &blendBarrier);
-        AssignGLEntryPoint(loadProcAddress("glCopyImageSubData"), &copyImageSubData);
-        AssignGLEntryPoint(loadProcAddress("glDebugMessageControl"), &debugMessageControl);
-        AssignGLEntryPoint(loadProcAddress("glDebugMessageInsert"), &debugMessageInsert);
-        AssignGLEntryPoint(loadProcAddress("glDebugMessageCallback"), &debugMessageCallback);
-        AssignGLEntryPoint(loadProcAddress("glGetDebugMessageLog"), &getDebugMessageLog);
-        AssignGLEntryPoint(loadProcAddress("glPushDebugGroup"), &pushDebugGroup);
-        AssignGLEntryPoint(loadProcAddress("glPopDebugGroup"), &popDebugGroup);
-        AssignGLEntryPoint(loadProcAddress("glObjectLabel"), &objectLabel);
-        AssignGLEntryPoint(loadProcAddress("glGetObjectLabel"), &getObjectLabel);
-        AssignGLEntryPoint(loadProcAddress("glObjectPtrLabel"), &objectPtrLabel);
-        AssignGLEntryPoint(loadProcAddress("glGetObjectPtrLabel"), &getObjectPtrLabel);
-        AssignGLEntryPoint(loadProcAddress("glGetPointerv"), &getPointerv);
-        AssignGLEntryPoint(loadProcAddress("glEnablei"), &enablei);
-        AssignGLEntryPoint(loadProcAddress("glDisablei"), &disablei);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquationi"), &blendEquationi);
-        AssignGLEntryPoint(loadProcAddress("glBlendEquationSeparatei"), &blendEquationSeparatei);
-        AssignGLEntryPoint(loadProcAddress("glBlendFunci"), &blendFunci);
-        AssignGLEntryPoint(loadProcAddress("glBlendFuncSeparatei"), &blendFuncSeparatei);
-        AssignGLEntryPoint(loadProcAddress("glColorMaski"), &colorMaski);
-        AssignGLEntryPoint(loadProcAddress("glIsEnabledi"), &isEnabledi);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsBaseVertex"), &drawElementsBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glDrawRangeElementsBaseVertex"), &drawRangeElementsBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glDrawElementsInstancedBaseVertex"), &drawElementsInstancedBaseVertex);
-        AssignGLEntryPoint(loadProcAddress("glFramebufferTexture"), &framebufferTexture);
-        AssignGLEntryPoint(loadProcAddress("glPrimitiveBoundingBox"), &primitiveBoundingBox);
-        AssignGLEntryPoint(loadProcAddress("glGetGraphicsResetStatus"), &getGraphicsResetStatus);
-        AssignGLEntryPoint(loadProcAddress("glReadnPixels"), &readnPixels);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformfv"), &getnUniformfv);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformiv"), &getnUniformiv);
-        AssignGLEntryPoint(loadProcAddress("glGetnUniformuiv"), &getnUniformuiv);
-        AssignGLEntryPoint(loadProcAddress("glMinSampleShading"), &minSampleShading);
-        AssignGLEntryPoint(loadProcAddress("glPatchParameteri"), &patchParameteri);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterIiv"), &texParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glTexParameterIuiv"), &texParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameterIiv"), &getTexParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetTexParameterIuiv"), &getTexParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterIiv"), &samplerParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glSamplerParameterIuiv"), &samplerParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameterIiv"), &getSamplerParameterIiv);
-        AssignGLEntryPoint(loadProcAddress("glGetSamplerParameterIuiv"), &getSamplerParameterIuiv);
-        AssignGLEntryPoint(loadProcAddress("glTexBuffer"), &texBuffer);
-        AssignGLEntryPoint(loadProcAddress("glTexBufferRange"), &texBufferRange);
-        AssignGLEntryPoint(loadProcAddress("glTexStorage3DMultisample"), &texStorage3DMultisample);
+        blendBarrier.setLazy(this, "glBlendBarrier");
+        copyImageSubData.setLazy(this, "glCopyImageSubData");
+        debugMessageControl.setLazy(this, "glDebugMessageControl");
+        debugMessageInsert.setLazy(this, "glDebugMessageInsert");
+        debugMessageCallback.setLazy(this, "glDebugMessageCallback");
+        getDebugMessageLog.setLazy(this, "glGetDebugMessageLog");
+        pushDebugGroup.setLazy(this, "glPushDebugGroup");
+        popDebugGroup.setLazy(this, "glPopDebugGroup");
+        objectLabel.setLazy(this, "glObjectLabel");
+        getObjectLabel.setLazy(this, "glGetObjectLabel");
+        objectPtrLabel.setLazy(this, "glObjectPtrLabel");
+        getObjectPtrLabel.setLazy(this, "glGetObjectPtrLabel");
+        getPointerv.setLazy(this, "glGetPointerv");
+        enablei.setLazy(this, "glEnablei");
+        disablei.setLazy(this, "glDisablei");
+        blendEquationi.setLazy(this, "glBlendEquationi");
+        blendEquationSeparatei.setLazy(this, "glBlendEquationSeparatei");
+        blendFunci.setLazy(this, "glBlendFunci");
+        blendFuncSeparatei.setLazy(this, "glBlendFuncSeparatei");
+        colorMaski.setLazy(this, "glColorMaski");
+        isEnabledi.setLazy(this, "glIsEnabledi");
+        drawElementsBaseVertex.setLazy(this, "glDrawElementsBaseVertex");
+        drawRangeElementsBaseVertex.setLazy(this, "glDrawRangeElementsBaseVertex");
+        drawElementsInstancedBaseVertex.setLazy(this, "glDrawElementsInstancedBaseVertex");
+        framebufferTexture.setLazy(this, "glFramebufferTexture");
+        primitiveBoundingBox.setLazy(this, "glPrimitiveBoundingBox");
+        getGraphicsResetStatus.setLazy(this, "glGetGraphicsResetStatus");
+        readnPixels.setLazy(this, "glReadnPixels");
+        getnUniformfv.setLazy(this, "glGetnUniformfv");
+        getnUniformiv.setLazy(this, "glGetnUniformiv");
+        getnUniformuiv.setLazy(this, "glGetnUniformuiv");
+        minSampleShading.setLazy(this, "glMinSampleShading");
+        patchParameteri.setLazy(this, "glPatchParameteri");
+        texParameterIiv.setLazy(this, "glTexParameterIiv");
+        texParameterIuiv.setLazy(this, "glTexParameterIuiv");
+        getTexParameterIiv.setLazy(this, "glGetTexParameterIiv");
+        getTexParameterIuiv.setLazy(this, "glGetTexParameterIuiv");
+        samplerParameterIiv.setLazy(this, "glSamplerParameterIiv");
+        samplerParameterIuiv.setLazy(this, "glSamplerParameterIuiv");
+        getSamplerParameterIiv.setLazy(this, "glGetSamplerParameterIiv");
+        getSamplerParameterIuiv.setLazy(this, "glGetSamplerParameterIuiv");
+        texBuffer.setLazy(this, "glTexBuffer");
+        texBufferRange.setLazy(this, "glTexBufferRange");
+        texStorage3DMultisample.setLazy(this, "glTexStorage3DMultisample");
     }
 
     // clang-format on
@@ -2278,7 +2290,7 @@ bool FunctionsGL::isAtLeastGLES(const gl::Version &glesVersion) const
 
 bool FunctionsGL::hasExtension(const std::string &ext) const
 {
-    return std::find(extensions.begin(), extensions.end(), ext) != extensions.end();
+    return mExtensionSet.count(ext) > 0;
 }
 
 bool FunctionsGL::hasGLExtension(const std::string &ext) const
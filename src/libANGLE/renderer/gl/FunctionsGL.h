@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_GL_FUNCTIONSGL_H_
 #define LIBANGLE_RENDERER_GL_FUNCTIONSGL_H_
 
+#include <unordered_set>
+
 #include "common/debug.h"
 #include "libANGLE/Version.h"
 #include "libANGLE/renderer/gl/functionsgl_enums.h"
@@ -23,6 +25,51 @@ enum StandardGL
     STANDARD_GL_ES,
 };
 
+class FunctionsGL;
+
+// An entry point of a FunctionsGL, looked up with its loadProcAddress on first use. It converts to
+// the function pointer, so it is called and tested against nullptr like one.
+template <typename PFN>
+class EntryPointGL final
+{
+  public:
+    typedef PFN FunctionType;
+
+    EntryPointGL(PFN function = nullptr) : mFunction(function), mOwner(nullptr), mName(nullptr) {}
+
+    EntryPointGL &operator=(PFN function)
+    {
+        mFunction = function;
+        mName     = nullptr;
+        return *this;
+    }
+
+    void setLazy(FunctionsGL *owner, const char *name)
+    {
+        mFunction = nullptr;
+        mOwner    = owner;
+        mName     = name;
+    }
+
+    operator PFN() const
+    {
+        if (mName != nullptr)
+        {
+            resolve();
+        }
+        return mFunction;
+    }
+
+  private:
+    void resolve() const;
+
+    mutable PFN mFunction;
+    FunctionsGL *mOwner;
+
+    // Name of the entry point while it is not looked up yet.
+    mutable const char *mName;
+};
+
 class FunctionsGL
 {
   public:
@@ -46,744 +93,768 @@ class FunctionsGL
 
     // Entry Points
     // 1.0
-    PFNGLBLENDFUNCPROC blendFunc;
-    PFNGLCLEARPROC clear;
-    PFNGLCLEARCOLORPROC clearColor;
-    PFNGLCLEARDEPTHPROC clearDepth;
-    PFNGLCLEARSTENCILPROC clearStencil;
-    PFNGLCOLORMASKPROC colorMask;
-    PFNGLCULLFACEPROC cullFace;
-    PFNGLDEPTHFUNCPROC depthFunc;
-    PFNGLDEPTHMASKPROC depthMask;
-    PFNGLDEPTHRANGEPROC depthRange;
-    PFNGLDISABLEPROC disable;
-    PFNGLDRAWBUFFERPROC drawBuffer;
-    PFNGLENABLEPROC enable;
-    PFNGLFINISHPROC finish;
-    PFNGLFLUSHPROC flush;
-    PFNGLFRONTFACEPROC frontFace;
-    PFNGLGETBOOLEANVPROC getBooleanv;
-    PFNGLGETDOUBLEVPROC getDoublev;
-    PFNGLGETERRORPROC getError;
-    PFNGLGETFLOATVPROC getFloatv;
-    PFNGLGETINTEGERVPROC getIntegerv;
-    PFNGLGETSTRINGPROC getString;
-    PFNGLGETTEXIMAGEPROC getTexImage;
-    PFNGLGETTEXLEVELPARAMETERFVPROC getTexLevelParameterfv;
-    PFNGLGETTEXLEVELPARAMETERIVPROC getTexLevelParameteriv;
-    PFNGLGETTEXPARAMETERFVPROC getTexParameterfv;
-    PFNGLGETTEXPARAMETERIVPROC getTexParameteriv;
-    PFNGLHINTPROC hint;
-    PFNGLISENABLEDPROC isEnabled;
-    PFNGLLINEWIDTHPROC lineWidth;
-    PFNGLLOGICOPPROC logicOp;
-    PFNGLPIXELSTOREFPROC pixelStoref;
-    PFNGLPIXELSTOREIPROC pixelStorei;
-    PFNGLPOINTSIZEPROC pointSize;
-    PFNGLPOLYGONMODEPROC polygonMode;
-    PFNGLREADBUFFERPROC readBuffer;
-    PFNGLREADPIXELSPROC readPixels;
-    PFNGLSCISSORPROC scissor;
-    PFNGLSTENCILFUNCPROC stencilFunc;
-    PFNGLSTENCILMASKPROC stencilMask;
-    PFNGLSTENCILOPPROC stencilOp;
-    PFNGLTEXIMAGE1DPROC texImage1D;
-    PFNGLTEXIMAGE2DPROC texImage2D;
-    PFNGLTEXPARAMETERFPROC texParameterf;
-    PFNGLTEXPARAMETERFVPROC texParameterfv;
-    PFNGLTEXPARAMETERIPROC texParameteri;
-    PFNGLTEXPARAMETERIVPROC texParameteriv;
-    PFNGLVIEWPORTPROC viewport;
+    EntryPointGL<PFNGLBLENDFUNCPROC> blendFunc;
+    EntryPointGL<PFNGLCLEARPROC> clear;
+    EntryPointGL<PFNGLCLEARCOLORPROC> clearColor;
+    EntryPointGL<PFNGLCLEARDEPTHPROC> clearDepth;
+    EntryPointGL<PFNGLCLEARSTENCILPROC> clearStencil;
+    EntryPointGL<PFNGLCOLORMASKPROC> colorMask;
+    EntryPointGL<PFNGLCULLFACEPROC> cullFace;
+    EntryPointGL<PFNGLDEPTHFUNCPROC> depthFunc;
+    EntryPointGL<PFNGLDEPTHMASKPROC> depthMask;
+    EntryPointGL<PFNGLDEPTHRANGEPROC> depthRange;
+    EntryPointGL<PFNGLDISABLEPROC> disable;
+    EntryPointGL<PFNGLDRAWBUFFERPROC> drawBuffer;
+    EntryPointGL<PFNGLENABLEPROC> enable;
+    EntryPointGL<PFNGLFINISHPROC> finish;
+    EntryPointGL<PFNGLFLUSHPROC> flush;
+    EntryPointGL<PFNGLFRONTFACEPROC> frontFace;
+    EntryPointGL<PFNGLGETBOOLEANVPROC> getBooleanv;
+    EntryPointGL<PFNGLGETDOUBLEVPROC> getDoublev;
+    EntryPointGL<PFNGLGETERRORPROC> getError;
+    EntryPointGL<PFNGLGETFLOATVPROC> getFloatv;
+    EntryPointGL<PFNGLGETINTEGERVPROC> getIntegerv;
+    EntryPointGL<PFNGLGETSTRINGPROC> getString;
+    EntryPointGL<PFNGLGETTEXIMAGEPROC> getTexImage;
+    EntryPointGL<PFNGLGETTEXLEVELPARAMETERFVPROC> getTexLevelParameterfv;
+    EntryPointGL<PFNGLGETTEXLEVELPARAMETERIVPROC> getTexLevelParameteriv;
+    EntryPointGL<PFNGLGETTEXPARAMETERFVPROC> getTexParameterfv;
+    EntryPointGL<PFNGLGETTEXPARAMETERIVPROC> getTexParameteriv;
+    EntryPointGL<PFNGLHINTPROC> hint;
+    EntryPointGL<PFNGLISENABLEDPROC> isEnabled;
+    EntryPointGL<PFNGLLINEWIDTHPROC> lineWidth;
+    EntryPointGL<PFNGLLOGICOPPROC> logicOp;
+    EntryPointGL<PFNGLPIXELSTOREFPROC> pixelStoref;
+    EntryPointGL<PFNGLPIXELSTOREIPROC> pixelStorei;
+    EntryPointGL<PFNGLPOINTSIZEPROC> pointSize;
+    EntryPointGL<PFNGLPOLYGONMODEPROC> polygonMode;
+    EntryPointGL<PFNGLREADBUFFERPROC> readBuffer;
+    EntryPointGL<PFNGLREADPIXELSPROC> readPixels;
+    EntryPointGL<PFNGLSCISSORPROC> scissor;
+    EntryPointGL<PFNGLSTENCILFUNCPROC> stencilFunc;
+    EntryPointGL<PFNGLSTENCILMASKPROC> stencilMask;
+    EntryPointGL<PFNGLSTENCILOPPROC> stencilOp;
+    EntryPointGL<PFNGLTEXIMAGE1DPROC> texImage1D;
+    EntryPointGL<PFNGLTEXIMAGE2DPROC> texImage2D;
+    EntryPointGL<PFNGLTEXPARAMETERFPROC> texParameterf;
+    EntryPointGL<PFNGLTEXPARAMETERFVPROC> texParameterfv;
+    EntryPointGL<PFNGLTEXPARAMETERIPROC> texParameteri;
+    EntryPointGL<PFNGLTEXPARAMETERIVPROC> texParameteriv;
+    EntryPointGL<PFNGLVIEWPORTPROC> viewport;
 
     // 1.1
-    PFNGLBINDTEXTUREPROC bindTexture;
-    PFNGLCOPYTEXIMAGE1DPROC copyTexImage1D;
-    PFNGLCOPYTEXIMAGE2DPROC copyTexImage2D;
-    PFNGLCOPYTEXSUBIMAGE1DPROC copyTexSubImage1D;
-    PFNGLCOPYTEXSUBIMAGE2DPROC copyTexSubImage2D;
-    PFNGLDELETETEXTURESPROC deleteTextures;
-    PFNGLDRAWARRAYSPROC drawArrays;
-    PFNGLDRAWELEMENTSPROC drawElements;
-    PFNGLGENTEXTURESPROC genTextures;
-    PFNGLISTEXTUREPROC isTexture;
-    PFNGLPOLYGONOFFSETPROC polygonOffset;
-    PFNGLTEXSUBIMAGE1DPROC texSubImage1D;
-    PFNGLTEXSUBIMAGE2DPROC texSubImage2D;
+    EntryPointGL<PFNGLBINDTEXTUREPROC> bindTexture;
+    EntryPointGL<PFNGLCOPYTEXIMAGE1DPROC> copyTexImage1D;
+    EntryPointGL<PFNGLCOPYTEXIMAGE2DPROC> copyTexImage2D;
+    EntryPointGL<PFNGLCOPYTEXSUBIMAGE1DPROC> copyTexSubImage1D;
+    EntryPointGL<PFNGLCOPYTEXSUBIMAGE2DPROC> copyTexSubImage2D;
+    EntryPointGL<PFNGLDELETETEXTURESPROC> deleteTextures;
+    EntryPointGL<PFNGLDRAWARRAYSPROC> drawArrays;
+    EntryPointGL<PFNGLDRAWELEMENTSPROC> drawElements;
+    EntryPointGL<PFNGLGENTEXTURESPROC> genTextures;
+    EntryPointGL<PFNGLISTEXTUREPROC> isTexture;
+    EntryPointGL<PFNGLPOLYGONOFFSETPROC> polygonOffset;
+    EntryPointGL<PFNGLTEXSUBIMAGE1DPROC> texSubImage1D;
+    EntryPointGL<PFNGLTEXSUBIMAGE2DPROC> texSubImage2D;
 
     // 1.2
-    PFNGLBLENDCOLORPROC blendColor;
-    PFNGLBLENDEQUATIONPROC blendEquation;
-    PFNGLCOPYTEXSUBIMAGE3DPROC copyTexSubImage3D;
-    PFNGLDRAWRANGEELEMENTSPROC drawRangeElements;
-    PFNGLTEXIMAGE3DPROC texImage3D;
-    PFNGLTEXSUBIMAGE3DPROC texSubImage3D;
+    EntryPointGL<PFNGLBLENDCOLORPROC> blendColor;
+    EntryPointGL<PFNGLBLENDEQUATIONPROC> blendEquation;
+    EntryPointGL<PFNGLCOPYTEXSUBIMAGE3DPROC> copyTexSubImage3D;
+    EntryPointGL<PFNGLDRAWRANGEELEMENTSPROC> drawRangeElements;
+    EntryPointGL<PFNGLTEXIMAGE3DPROC> texImage3D;
+    EntryPointGL<PFNGLTEXSUBIMAGE3DPROC> texSubImage3D;
 
     // 1.2 Extensions
-    PFNGLDELETEFENCESNVPROC deleteFencesNV;
-    PFNGLGENFENCESNVPROC genFencesNV;
-    PFNGLISFENCENVPROC isFenceNV;
-    PFNGLTESTFENCENVPROC testFenceNV;
-    PFNGLGETFENCEIVNVPROC getFenceivNV;
-    PFNGLFINISHFENCENVPROC finishFenceNV;
-    PFNGLSETFENCENVPROC setFenceNV;
+    EntryPointGL<PFNGLDELETEFENCESNVPROC> deleteFencesNV;
+    EntryPointGL<PFNGLGENFENCESNVPROC> genFencesNV;
+    EntryPointGL<PFNGLISFENCENVPROC> isFenceNV;
+    EntryPointGL<PFNGLTESTFENCENVPROC> testFenceNV;
+    EntryPointGL<PFNGLGETFENCEIVNVPROC> getFenceivNV;
+    EntryPointGL<PFNGLFINISHFENCENVPROC> finishFenceNV;
+    EntryPointGL<PFNGLSETFENCENVPROC> setFenceNV;
 
     // 1.3
-    PFNGLACTIVETEXTUREPROC activeTexture;
-    PFNGLCOMPRESSEDTEXIMAGE1DPROC compressedTexImage1D;
-    PFNGLCOMPRESSEDTEXIMAGE2DPROC compressedTexImage2D;
-    PFNGLCOMPRESSEDTEXIMAGE3DPROC compressedTexImage3D;
-    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC compressedTexSubImage1D;
-    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC compressedTexSubImage2D;
-    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC compressedTexSubImage3D;
-    PFNGLGETCOMPRESSEDTEXIMAGEPROC getCompressedTexImage;
-    PFNGLSAMPLECOVERAGEPROC sampleCoverage;
+    EntryPointGL<PFNGLACTIVETEXTUREPROC> activeTexture;
+    EntryPointGL<PFNGLCOMPRESSEDTEXIMAGE1DPROC> compressedTexImage1D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXIMAGE2DPROC> compressedTexImage2D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXIMAGE3DPROC> compressedTexImage3D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC> compressedTexSubImage1D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC> compressedTexSubImage2D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC> compressedTexSubImage3D;
+    EntryPointGL<PFNGLGETCOMPRESSEDTEXIMAGEPROC> getCompressedTexImage;
+    EntryPointGL<PFNGLSAMPLECOVERAGEPROC> sampleCoverage;
 
     // 1.4
-    PFNGLBLENDFUNCSEPARATEPROC blendFuncSeparate;
-    PFNGLMULTIDRAWARRAYSPROC multiDrawArrays;
-    PFNGLMULTIDRAWELEMENTSPROC multiDrawElements;
-    PFNGLPOINTPARAMETERFPROC pointParameterf;
-    PFNGLPOINTPARAMETERFVPROC pointParameterfv;
-    PFNGLPOINTPARAMETERIPROC pointParameteri;
-    PFNGLPOINTPARAMETERIVPROC pointParameteriv;
+    EntryPointGL<PFNGLBLENDFUNCSEPARATEPROC> blendFuncSeparate;
+    EntryPointGL<PFNGLMULTIDRAWARRAYSPROC> multiDrawArrays;
+    EntryPointGL<PFNGLMULTIDRAWELEMENTSPROC> multiDrawElements;
+    EntryPointGL<PFNGLPOINTPARAMETERFPROC> pointParameterf;
+    EntryPointGL<PFNGLPOINTPARAMETERFVPROC> pointParameterfv;
+    EntryPointGL<PFNGLPOINTPARAMETERIPROC> pointParameteri;
+    EntryPointGL<PFNGLPOINTPARAMETERIVPROC> pointParameteriv;
 
     // 1.5
-    PFNGLBEGINQUERYPROC beginQuery;
-    PFNGLBINDBUFFERPROC bindBuffer;
-    PFNGLBUFFERDATAPROC bufferData;
-    PFNGLBUFFERSUBDATAPROC bufferSubData;
-    PFNGLDELETEBUFFERSPROC deleteBuffers;
-    PFNGLDELETEQUERIESPROC deleteQueries;
-    PFNGLENDQUERYPROC endQuery;
-    PFNGLGENBUFFERSPROC genBuffers;
-    PFNGLGENQUERIESPROC genQueries;
-    PFNGLGETBUFFERPARAMETERIVPROC getBufferParameteriv;
-    PFNGLGETBUFFERPOINTERVPROC getBufferPointerv;
-    PFNGLGETBUFFERSUBDATAPROC getBufferSubData;
-    PFNGLGETQUERYOBJECTIVPROC getQueryObjectiv;
-    PFNGLGETQUERYOBJECTUIVPROC getQueryObjectuiv;
-    PFNGLGETQUERYIVPROC getQueryiv;
-    PFNGLISBUFFERPROC isBuffer;
-    PFNGLISQUERYPROC isQuery;
-    PFNGLMAPBUFFERPROC mapBuffer;
-    PFNGLUNMAPBUFFERPROC unmapBuffer;
+    EntryPointGL<PFNGLBEGINQUERYPROC> beginQuery;
+    EntryPointGL<PFNGLBINDBUFFERPROC> bindBuffer;
+    EntryPointGL<PFNGLBUFFERDATAPROC> bufferData;
+    EntryPointGL<PFNGLBUFFERSUBDATAPROC> bufferSubData;
+    EntryPointGL<PFNGLDELETEBUFFERSPROC> deleteBuffers;
+    EntryPointGL<PFNGLDELETEQUERIESPROC> deleteQueries;
+    EntryPointGL<PFNGLENDQUERYPROC> endQuery;
+    EntryPointGL<PFNGLGENBUFFERSPROC> genBuffers;
+    EntryPointGL<PFNGLGENQUERIESPROC> genQueries;
+    EntryPointGL<PFNGLGETBUFFERPARAMETERIVPROC> getBufferParameteriv;
+    EntryPointGL<PFNGLGETBUFFERPOINTERVPROC> getBufferPointerv;
+    EntryPointGL<PFNGLGETBUFFERSUBDATAPROC> getBufferSubData;
+    EntryPointGL<PFNGLGETQUERYOBJECTIVPROC> getQueryObjectiv;
+    EntryPointGL<PFNGLGETQUERYOBJECTUIVPROC> getQueryObjectuiv;
+    EntryPointGL<PFNGLGETQUERYIVPROC> getQueryiv;
+    EntryPointGL<PFNGLISBUFFERPROC> isBuffer;
+    EntryPointGL<PFNGLISQUERYPROC> isQuery;
+    EntryPointGL<PFNGLMAPBUFFERPROC> mapBuffer;
+    EntryPointGL<PFNGLUNMAPBUFFERPROC> unmapBuffer;
 
     // 2.0
-    PFNGLATTACHSHADERPROC attachShader;
-    PFNGLBINDATTRIBLOCATIONPROC bindAttribLocation;
-    PFNGLBLENDEQUATIONSEPARATEPROC blendEquationSeparate;
-    PFNGLCOMPILESHADERPROC compileShader;
-    PFNGLCREATEPROGRAMPROC createProgram;
-    PFNGLCREATESHADERPROC createShader;
-    PFNGLDELETEPROGRAMPROC deleteProgram;
-    PFNGLDELETESHADERPROC deleteShader;
-    PFNGLDETACHSHADERPROC detachShader;
-    PFNGLDISABLEVERTEXATTRIBARRAYPROC disableVertexAttribArray;
-    PFNGLDRAWBUFFERSPROC drawBuffers;
-    PFNGLENABLEVERTEXATTRIBARRAYPROC enableVertexAttribArray;
-    PFNGLGETACTIVEATTRIBPROC getActiveAttrib;
-    PFNGLGETACTIVEUNIFORMPROC getActiveUniform;
-    PFNGLGETATTACHEDSHADERSPROC getAttachedShaders;
-    PFNGLGETATTRIBLOCATIONPROC getAttribLocation;
-    PFNGLGETPROGRAMINFOLOGPROC getProgramInfoLog;
-    PFNGLGETPROGRAMIVPROC getProgramiv;
-    PFNGLGETSHADERINFOLOGPROC getShaderInfoLog;
-    PFNGLGETSHADERSOURCEPROC getShaderSource;
-    PFNGLGETSHADERIVPROC getShaderiv;
-    PFNGLGETUNIFORMLOCATIONPROC getUniformLocation;
-    PFNGLGETUNIFORMFVPROC getUniformfv;
-    PFNGLGETUNIFORMIVPROC getUniformiv;
-    PFNGLGETVERTEXATTRIBPOINTERVPROC getVertexAttribPointerv;
-    PFNGLGETVERTEXATTRIBDVPROC getVertexAttribdv;
-    PFNGLGETVERTEXATTRIBFVPROC getVertexAttribfv;
-    PFNGLGETVERTEXATTRIBIVPROC getVertexAttribiv;
-    PFNGLISPROGRAMPROC isProgram;
-    PFNGLISSHADERPROC isShader;
-    PFNGLLINKPROGRAMPROC linkProgram;
-    PFNGLSHADERSOURCEPROC shaderSource;
-    PFNGLSTENCILFUNCSEPARATEPROC stencilFuncSeparate;
-    PFNGLSTENCILMASKSEPARATEPROC stencilMaskSeparate;
-    PFNGLSTENCILOPSEPARATEPROC stencilOpSeparate;
-    PFNGLUNIFORM1FPROC uniform1f;
-    PFNGLUNIFORM1FVPROC uniform1fv;
-    PFNGLUNIFORM1IPROC uniform1i;
-    PFNGLUNIFORM1IVPROC uniform1iv;
-    PFNGLUNIFORM2FPROC uniform2f;
-    PFNGLUNIFORM2FVPROC uniform2fv;
-    PFNGLUNIFORM2IPROC uniform2i;
-    PFNGLUNIFORM2IVPROC uniform2iv;
-    PFNGLUNIFORM3FPROC uniform3f;
-    PFNGLUNIFORM3FVPROC uniform3fv;
-    PFNGLUNIFORM3IPROC uniform3i;
-    PFNGLUNIFORM3IVPROC uniform3iv;
-    PFNGLUNIFORM4FPROC uniform4f;
-    PFNGLUNIFORM4FVPROC uniform4fv;
-    PFNGLUNIFORM4IPROC uniform4i;
-    PFNGLUNIFORM4IVPROC uniform4iv;
-    PFNGLUNIFORMMATRIX2FVPROC uniformMatrix2fv;
-    PFNGLUNIFORMMATRIX3FVPROC uniformMatrix3fv;
-    PFNGLUNIFORMMATRIX4FVPROC uniformMatrix4fv;
-    PFNGLUSEPROGRAMPROC useProgram;
-    PFNGLVALIDATEPROGRAMPROC validateProgram;
-    PFNGLVERTEXATTRIB1DPROC vertexAttrib1d;
-    PFNGLVERTEXATTRIB1DVPROC vertexAttrib1dv;
-    PFNGLVERTEXATTRIB1FPROC vertexAttrib1f;
-    PFNGLVERTEXATTRIB1FVPROC vertexAttrib1fv;
-    PFNGLVERTEXATTRIB1SPROC vertexAttrib1s;
-    PFNGLVERTEXATTRIB1SVPROC vertexAttrib1sv;
-    PFNGLVERTEXATTRIB2DPROC vertexAttrib2d;
-    PFNGLVERTEXATTRIB2DVPROC vertexAttrib2dv;
-    PFNGLVERTEXATTRIB2FPROC vertexAttrib2f;
-    PFNGLVERTEXATTRIB2FVPROC vertexAttrib2fv;
-    PFNGLVERTEXATTRIB2SPROC vertexAttrib2s;
-    PFNGLVERTEXATTRIB2SVPROC vertexAttrib2sv;
-    PFNGLVERTEXATTRIB3DPROC vertexAttrib3d;
-    PFNGLVERTEXATTRIB3DVPROC vertexAttrib3dv;
-    PFNGLVERTEXATTRIB3FPROC vertexAttrib3f;
-    PFNGLVERTEXATTRIB3FVPROC vertexAttrib3fv;
-    PFNGLVERTEXATTRIB3SPROC vertexAttrib3s;
-    PFNGLVERTEXATTRIB3SVPROC vertexAttrib3sv;
-    PFNGLVERTEXATTRIB4NBVPROC vertexAttrib4Nbv;
-    PFNGLVERTEXATTRIB4NIVPROC vertexAttrib4Niv;
-    PFNGLVERTEXATTRIB4NSVPROC vertexAttrib4Nsv;
-    PFNGLVERTEXATTRIB4NUBPROC vertexAttrib4Nub;
-    PFNGLVERTEXATTRIB4NUBVPROC vertexAttrib4Nubv;
-    PFNGLVERTEXATTRIB4NUIVPROC vertexAttrib4Nuiv;
-    PFNGLVERTEXATTRIB4NUSVPROC vertexAttrib4Nusv;
-    PFNGLVERTEXATTRIB4BVPROC vertexAttrib4bv;
-    PFNGLVERTEXATTRIB4DPROC vertexAttrib4d;
-    PFNGLVERTEXATTRIB4DVPROC vertexAttrib4dv;
-    PFNGLVERTEXATTRIB4FPROC vertexAttrib4f;
-    PFNGLVERTEXATTRIB4FVPROC vertexAttrib4fv;
-    PFNGLVERTEXATTRIB4IVPROC vertexAttrib4iv;
-    PFNGLVERTEXATTRIB4SPROC vertexAttrib4s;
-    PFNGLVERTEXATTRIB4SVPROC vertexAttrib4sv;
-    PFNGLVERTEXATTRIB4UBVPROC vertexAttrib4ubv;
-    PFNGLVERTEXATTRIB4UIVPROC vertexAttrib4uiv;
-    PFNGLVERTEXATTRIB4USVPROC vertexAttrib4usv;
-    PFNGLVERTEXATTRIBPOINTERPROC vertexAttribPointer;
+    EntryPointGL<PFNGLATTACHSHADERPROC> attachShader;
+    EntryPointGL<PFNGLBINDATTRIBLOCATIONPROC> bindAttribLocation;
+    EntryPointGL<PFNGLBLENDEQUATIONSEPARATEPROC> blendEquationSeparate;
+    EntryPointGL<PFNGLCOMPILESHADERPROC> compileShader;
+    EntryPointGL<PFNGLCREATEPROGRAMPROC> createProgram;
+    EntryPointGL<PFNGLCREATESHADERPROC> createShader;
+    EntryPointGL<PFNGLDELETEPROGRAMPROC> deleteProgram;
+    EntryPointGL<PFNGLDELETESHADERPROC> deleteShader;
+    EntryPointGL<PFNGLDETACHSHADERPROC> detachShader;
+    EntryPointGL<PFNGLDISABLEVERTEXATTRIBARRAYPROC> disableVertexAttribArray;
+    EntryPointGL<PFNGLDRAWBUFFERSPROC> drawBuffers;
+    EntryPointGL<PFNGLENABLEVERTEXATTRIBARRAYPROC> enableVertexAttribArray;
+    EntryPointGL<PFNGLGETACTIVEATTRIBPROC> getActiveAttrib;
+    EntryPointGL<PFNGLGETACTIVEUNIFORMPROC> getActiveUniform;
+    EntryPointGL<PFNGLGETATTACHEDSHADERSPROC> getAttachedShaders;
+    EntryPointGL<PFNGLGETATTRIBLOCATIONPROC> getAttribLocation;
+    EntryPointGL<PFNGLGETPROGRAMINFOLOGPROC> getProgramInfoLog;
+    EntryPointGL<PFNGLGETPROGRAMIVPROC> getProgramiv;
+    EntryPointGL<PFNGLGETSHADERINFOLOGPROC> getShaderInfoLog;
+    EntryPointGL<PFNGLGETSHADERSOURCEPROC> getShaderSource;
+    EntryPointGL<PFNGLGETSHADERIVPROC> getShaderiv;
+    EntryPointGL<PFNGLGETUNIFORMLOCATIONPROC> getUniformLocation;
+    EntryPointGL<PFNGLGETUNIFORMFVPROC> getUniformfv;
+    EntryPointGL<PFNGLGETUNIFORMIVPROC> getUniformiv;
+    EntryPointGL<PFNGLGETVERTEXATTRIBPOINTERVPROC> getVertexAttribPointerv;
+    EntryPointGL<PFNGLGETVERTEXATTRIBDVPROC> getVertexAttribdv;
+    EntryPointGL<PFNGLGETVERTEXATTRIBFVPROC> getVertexAttribfv;
+    EntryPointGL<PFNGLGETVERTEXATTRIBIVPROC> getVertexAttribiv;
+    EntryPointGL<PFNGLISPROGRAMPROC> isProgram;
+    EntryPointGL<PFNGLISSHADERPROC> isShader;
+    EntryPointGL<PFNGLLINKPROGRAMPROC> linkProgram;
+    EntryPointGL<PFNGLSHADERSOURCEPROC> shaderSource;
+    EntryPointGL<PFNGLSTENCILFUNCSEPARATEPROC> stencilFuncSeparate;
+    EntryPointGL<PFNGLSTENCILMASKSEPARATEPROC> stencilMaskSeparate;
+    EntryPointGL<PFNGLSTENCILOPSEPARATEPROC> stencilOpSeparate;
+    EntryPointGL<PFNGLUNIFORM1FPROC> uniform1f;
+    EntryPointGL<PFNGLUNIFORM1FVPROC> uniform1fv;
+    EntryPointGL<PFNGLUNIFORM1IPROC> uniform1i;
+    EntryPointGL<PFNGLUNIFORM1IVPROC> uniform1iv;
+    EntryPointGL<PFNGLUNIFORM2FPROC> uniform2f;
+    EntryPointGL<PFNGLUNIFORM2FVPROC> uniform2fv;
+    EntryPointGL<PFNGLUNIFORM2IPROC> uniform2i;
+    EntryPointGL<PFNGLUNIFORM2IVPROC> uniform2iv;
+    EntryPointGL<PFNGLUNIFORM3FPROC> uniform3f;
+    EntryPointGL<PFNGLUNIFORM3FVPROC> uniform3fv;
+    EntryPointGL<PFNGLUNIFORM3IPROC> uniform3i;
+    EntryPointGL<PFNGLUNIFORM3IVPROC> uniform3iv;
+    EntryPointGL<PFNGLUNIFORM4FPROC> uniform4f;
+    EntryPointGL<PFNGLUNIFORM4FVPROC> uniform4fv;
+    EntryPointGL<PFNGLUNIFORM4IPROC> uniform4i;
+    EntryPointGL<PFNGLUNIFORM4IVPROC> uniform4iv;
+    EntryPointGL<PFNGLUNIFORMMATRIX2FVPROC> uniformMatrix2fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX3FVPROC> uniformMatrix3fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX4FVPROC> uniformMatrix4fv;
+    EntryPointGL<PFNGLUSEPROGRAMPROC> useProgram;
+    EntryPointGL<PFNGLVALIDATEPROGRAMPROC> validateProgram;
+    EntryPointGL<PFNGLVERTEXATTRIB1DPROC> vertexAttrib1d;
+    EntryPointGL<PFNGLVERTEXATTRIB1DVPROC> vertexAttrib1dv;
+    EntryPointGL<PFNGLVERTEXATTRIB1FPROC> vertexAttrib1f;
+    EntryPointGL<PFNGLVERTEXATTRIB1FVPROC> vertexAttrib1fv;
+    EntryPointGL<PFNGLVERTEXATTRIB1SPROC> vertexAttrib1s;
+    EntryPointGL<PFNGLVERTEXATTRIB1SVPROC> vertexAttrib1sv;
+    EntryPointGL<PFNGLVERTEXATTRIB2DPROC> vertexAttrib2d;
+    EntryPointGL<PFNGLVERTEXATTRIB2DVPROC> vertexAttrib2dv;
+    EntryPointGL<PFNGLVERTEXATTRIB2FPROC> vertexAttrib2f;
+    EntryPointGL<PFNGLVERTEXATTRIB2FVPROC> vertexAttrib2fv;
+    EntryPointGL<PFNGLVERTEXATTRIB2SPROC> vertexAttrib2s;
+    EntryPointGL<PFNGLVERTEXATTRIB2SVPROC> vertexAttrib2sv;
+    EntryPointGL<PFNGLVERTEXATTRIB3DPROC> vertexAttrib3d;
+    EntryPointGL<PFNGLVERTEXATTRIB3DVPROC> vertexAttrib3dv;
+    EntryPointGL<PFNGLVERTEXATTRIB3FPROC> vertexAttrib3f;
+    EntryPointGL<PFNGLVERTEXATTRIB3FVPROC> vertexAttrib3fv;
+    EntryPointGL<PFNGLVERTEXATTRIB3SPROC> vertexAttrib3s;
+    EntryPointGL<PFNGLVERTEXATTRIB3SVPROC> vertexAttrib3sv;
+    EntryPointGL<PFNGLVERTEXATTRIB4NBVPROC> vertexAttrib4Nbv;
+    EntryPointGL<PFNGLVERTEXATTRIB4NIVPROC> vertexAttrib4Niv;
+    EntryPointGL<PFNGLVERTEXATTRIB4NSVPROC> vertexAttrib4Nsv;
+    EntryPointGL<PFNGLVERTEXATTRIB4NUBPROC> vertexAttrib4Nub;
+    EntryPointGL<PFNGLVERTEXATTRIB4NUBVPROC> vertexAttrib4Nubv;
+    EntryPointGL<PFNGLVERTEXATTRIB4NUIVPROC> vertexAttrib4Nuiv;
+    EntryPointGL<PFNGLVERTEXATTRIB4NUSVPROC> vertexAttrib4Nusv;
+    EntryPointGL<PFNGLVERTEXATTRIB4BVPROC> vertexAttrib4bv;
+    EntryPointGL<PFNGLVERTEXATTRIB4DPROC> vertexAttrib4d;
+    EntryPointGL<PFNGLVERTEXATTRIB4DVPROC> vertexAttrib4dv;
+    EntryPointGL<PFNGLVERTEXATTRIB4FPROC> vertexAttrib4f;
+    EntryPointGL<PFNGLVERTEXATTRIB4FVPROC> vertexAttrib4fv;
+    EntryPointGL<PFNGLVERTEXATTRIB4IVPROC> vertexAttrib4iv;
+    EntryPointGL<PFNGLVERTEXATTRIB4SPROC> vertexAttrib4s;
+    EntryPointGL<PFNGLVERTEXATTRIB4SVPROC> vertexAttrib4sv;
+    EntryPointGL<PFNGLVERTEXATTRIB4UBVPROC> vertexAttrib4ubv;
+    EntryPointGL<PFNGLVERTEXATTRIB4UIVPROC> vertexAttrib4uiv;
+    EntryPointGL<PFNGLVERTEXATTRIB4USVPROC> vertexAttrib4usv;
+    EntryPointGL<PFNGLVERTEXATTRIBPOINTERPROC> vertexAttribPointer;
 
     // 2.1
-    PFNGLUNIFORMMATRIX2X3FVPROC uniformMatrix2x3fv;
-    PFNGLUNIFORMMATRIX2X4FVPROC uniformMatrix2x4fv;
-    PFNGLUNIFORMMATRIX3X2FVPROC uniformMatrix3x2fv;
-    PFNGLUNIFORMMATRIX3X4FVPROC uniformMatrix3x4fv;
-    PFNGLUNIFORMMATRIX4X2FVPROC uniformMatrix4x2fv;
-    PFNGLUNIFORMMATRIX4X3FVPROC uniformMatrix4x3fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX2X3FVPROC> uniformMatrix2x3fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX2X4FVPROC> uniformMatrix2x4fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX3X2FVPROC> uniformMatrix3x2fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX3X4FVPROC> uniformMatrix3x4fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX4X2FVPROC> uniformMatrix4x2fv;
+    EntryPointGL<PFNGLUNIFORMMATRIX4X3FVPROC> uniformMatrix4x3fv;
 
     // 3.0
-    PFNGLBEGINCONDITIONALRENDERPROC beginConditionalRender;
-    PFNGLBEGINTRANSFORMFEEDBACKPROC beginTransformFeedback;
-    PFNGLBINDBUFFERBASEPROC bindBufferBase;
-    PFNGLBINDBUFFERRANGEPROC bindBufferRange;
-    PFNGLBINDFRAGDATALOCATIONPROC bindFragDataLocation;
-    PFNGLBINDFRAMEBUFFERPROC bindFramebuffer;
-    PFNGLBINDRENDERBUFFERPROC bindRenderbuffer;
-    PFNGLBINDVERTEXARRAYPROC bindVertexArray;
-    PFNGLBLITFRAMEBUFFERPROC blitFramebuffer;
-    PFNGLCHECKFRAMEBUFFERSTATUSPROC checkFramebufferStatus;
-    PFNGLCLAMPCOLORPROC clampColor;
-    PFNGLCLEARBUFFERFIPROC clearBufferfi;
-    PFNGLCLEARBUFFERFVPROC clearBufferfv;
-    PFNGLCLEARBUFFERIVPROC clearBufferiv;
-    PFNGLCLEARBUFFERUIVPROC clearBufferuiv;
-    PFNGLCOLORMASKIPROC colorMaski;
-    PFNGLDELETEFRAMEBUFFERSPROC deleteFramebuffers;
-    PFNGLDELETERENDERBUFFERSPROC deleteRenderbuffers;
-    PFNGLDELETEVERTEXARRAYSPROC deleteVertexArrays;
-    PFNGLDISABLEIPROC disablei;
-    PFNGLENABLEIPROC enablei;
-    PFNGLENDCONDITIONALRENDERPROC endConditionalRender;
-    PFNGLENDTRANSFORMFEEDBACKPROC endTransformFeedback;
-    PFNGLFLUSHMAPPEDBUFFERRANGEPROC flushMappedBufferRange;
-    PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer;
-    PFNGLFRAMEBUFFERTEXTURE1DPROC framebufferTexture1D;
-    PFNGLFRAMEBUFFERTEXTURE2DPROC framebufferTexture2D;
-    PFNGLFRAMEBUFFERTEXTURE3DPROC framebufferTexture3D;
-    PFNGLFRAMEBUFFERTEXTURELAYERPROC framebufferTextureLayer;
-    PFNGLGENFRAMEBUFFERSPROC genFramebuffers;
-    PFNGLGENRENDERBUFFERSPROC genRenderbuffers;
-    PFNGLGENVERTEXARRAYSPROC genVertexArrays;
-    PFNGLGENERATEMIPMAPPROC generateMipmap;
-    PFNGLGETBOOLEANI_VPROC getBooleani_v;
-    PFNGLGETFRAGDATALOCATIONPROC getFragDataLocation;
-    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC getFramebufferAttachmentParameteriv;
-    PFNGLGETINTEGERI_VPROC getIntegeri_v;
-    PFNGLGETRENDERBUFFERPARAMETERIVPROC getRenderbufferParameteriv;
-    PFNGLGETSTRINGIPROC getStringi;
-    PFNGLGETTEXPARAMETERIIVPROC getTexParameterIiv;
-    PFNGLGETTEXPARAMETERIUIVPROC getTexParameterIuiv;
-    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC getTransformFeedbackVarying;
-    PFNGLGETUNIFORMUIVPROC getUniformuiv;
-    PFNGLGETVERTEXATTRIBIIVPROC getVertexAttribIiv;
-    PFNGLGETVERTEXATTRIBIUIVPROC getVertexAttribIuiv;
-    PFNGLISENABLEDIPROC isEnabledi;
-    PFNGLISFRAMEBUFFERPROC isFramebuffer;
-    PFNGLISRENDERBUFFERPROC isRenderbuffer;
-    PFNGLISVERTEXARRAYPROC isVertexArray;
-    PFNGLMAPBUFFERRANGEPROC mapBufferRange;
-    PFNGLRENDERBUFFERSTORAGEPROC renderbufferStorage;
-    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC renderbufferStorageMultisample;
-    PFNGLTEXPARAMETERIIVPROC texParameterIiv;
-    PFNGLTEXPARAMETERIUIVPROC texParameterIuiv;
-    PFNGLTRANSFORMFEEDBACKVARYINGSPROC transformFeedbackVaryings;
-    PFNGLUNIFORM1UIPROC uniform1ui;
-    PFNGLUNIFORM1UIVPROC uniform1uiv;
-    PFNGLUNIFORM2UIPROC uniform2ui;
-    PFNGLUNIFORM2UIVPROC uniform2uiv;
-    PFNGLUNIFORM3UIPROC uniform3ui;
-    PFNGLUNIFORM3UIVPROC uniform3uiv;
-    PFNGLUNIFORM4UIPROC uniform4ui;
-    PFNGLUNIFORM4UIVPROC uniform4uiv;
-    PFNGLVERTEXATTRIBI1IPROC vertexAttribI1i;
-    PFNGLVERTEXATTRIBI1IVPROC vertexAttribI1iv;
-    PFNGLVERTEXATTRIBI1UIPROC vertexAttribI1ui;
-    PFNGLVERTEXATTRIBI1UIVPROC vertexAttribI1uiv;
-    PFNGLVERTEXATTRIBI2IPROC vertexAttribI2i;
-    PFNGLVERTEXATTRIBI2IVPROC vertexAttribI2iv;
-    PFNGLVERTEXATTRIBI2UIPROC vertexAttribI2ui;
-    PFNGLVERTEXATTRIBI2UIVPROC vertexAttribI2uiv;
-    PFNGLVERTEXATTRIBI3IPROC vertexAttribI3i;
-    PFNGLVERTEXATTRIBI3IVPROC vertexAttribI3iv;
-    PFNGLVERTEXATTRIBI3UIPROC vertexAttribI3ui;
-    PFNGLVERTEXATTRIBI3UIVPROC vertexAttribI3uiv;
-    PFNGLVERTEXATTRIBI4BVPROC vertexAttribI4bv;
-    PFNGLVERTEXATTRIBI4IPROC vertexAttribI4i;
-    PFNGLVERTEXATTRIBI4IVPROC vertexAttribI4iv;
-    PFNGLVERTEXATTRIBI4SVPROC vertexAttribI4sv;
-    PFNGLVERTEXATTRIBI4UBVPROC vertexAttribI4ubv;
-    PFNGLVERTEXATTRIBI4UIPROC vertexAttribI4ui;
-    PFNGLVERTEXATTRIBI4UIVPROC vertexAttribI4uiv;
-    PFNGLVERTEXATTRIBI4USVPROC vertexAttribI4usv;
-    PFNGLVERTEXATTRIBIPOINTERPROC vertexAttribIPointer;
+    EntryPointGL<PFNGLBEGINCONDITIONALRENDERPROC> beginConditionalRender;
+    EntryPointGL<PFNGLBEGINTRANSFORMFEEDBACKPROC> beginTransformFeedback;
+    EntryPointGL<PFNGLBINDBUFFERBASEPROC> bindBufferBase;
+    EntryPointGL<PFNGLBINDBUFFERRANGEPROC> bindBufferRange;
+    EntryPointGL<PFNGLBINDFRAGDATALOCATIONPROC> bindFragDataLocation;
+    EntryPointGL<PFNGLBINDFRAMEBUFFERPROC> bindFramebuffer;
+    EntryPointGL<PFNGLBINDRENDERBUFFERPROC> bindRenderbuffer;
+    EntryPointGL<PFNGLBINDVERTEXARRAYPROC> bindVertexArray;
+    EntryPointGL<PFNGLBLITFRAMEBUFFERPROC> blitFramebuffer;
+    EntryPointGL<PFNGLCHECKFRAMEBUFFERSTATUSPROC> checkFramebufferStatus;
+    EntryPointGL<PFNGLCLAMPCOLORPROC> clampColor;
+    EntryPointGL<PFNGLCLEARBUFFERFIPROC> clearBufferfi;
+    EntryPointGL<PFNGLCLEARBUFFERFVPROC> clearBufferfv;
+    EntryPointGL<PFNGLCLEARBUFFERIVPROC> clearBufferiv;
+    EntryPointGL<PFNGLCLEARBUFFERUIVPROC> clearBufferuiv;
+    EntryPointGL<PFNGLCOLORMASKIPROC> colorMaski;
+    EntryPointGL<PFNGLDELETEFRAMEBUFFERSPROC> deleteFramebuffers;
+    EntryPointGL<PFNGLDELETERENDERBUFFERSPROC> deleteRenderbuffers;
+    EntryPointGL<PFNGLDELETEVERTEXARRAYSPROC> deleteVertexArrays;
+    EntryPointGL<PFNGLDISABLEIPROC> disablei;
+    EntryPointGL<PFNGLENABLEIPROC> enablei;
+    EntryPointGL<PFNGLENDCONDITIONALRENDERPROC> endConditionalRender;
+    EntryPointGL<PFNGLENDTRANSFORMFEEDBACKPROC> endTransformFeedback;
+    EntryPointGL<PFNGLFLUSHMAPPEDBUFFERRANGEPROC> flushMappedBufferRange;
+    EntryPointGL<PFNGLFRAMEBUFFERRENDERBUFFERPROC> framebufferRenderbuffer;
+    EntryPointGL<PFNGLFRAMEBUFFERTEXTURE1DPROC> framebufferTexture1D;
+    EntryPointGL<PFNGLFRAMEBUFFERTEXTURE2DPROC> framebufferTexture2D;
+    EntryPointGL<PFNGLFRAMEBUFFERTEXTURE3DPROC> framebufferTexture3D;
+    EntryPointGL<PFNGLFRAMEBUFFERTEXTURELAYERPROC> framebufferTextureLayer;
+    EntryPointGL<PFNGLGENFRAMEBUFFERSPROC> genFramebuffers;
+    EntryPointGL<PFNGLGENRENDERBUFFERSPROC> genRenderbuffers;
+    EntryPointGL<PFNGLGENVERTEXARRAYSPROC> genVertexArrays;
+    EntryPointGL<PFNGLGENERATEMIPMAPPROC> generateMipmap;
+    EntryPointGL<PFNGLGETBOOLEANI_VPROC> getBooleani_v;
+    EntryPointGL<PFNGLGETFRAGDATALOCATIONPROC> getFragDataLocation;
+    EntryPointGL<PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC> getFramebufferAttachmentParameteriv;
+    EntryPointGL<PFNGLGETINTEGERI_VPROC> getIntegeri_v;
+    EntryPointGL<PFNGLGETRENDERBUFFERPARAMETERIVPROC> getRenderbufferParameteriv;
+    EntryPointGL<PFNGLGETSTRINGIPROC> getStringi;
+    EntryPointGL<PFNGLGETTEXPARAMETERIIVPROC> getTexParameterIiv;
+    EntryPointGL<PFNGLGETTEXPARAMETERIUIVPROC> getTexParameterIuiv;
+    EntryPointGL<PFNGLGETTRANSFORMFEEDBACKVARYINGPROC> getTransformFeedbackVarying;
+    EntryPointGL<PFNGLGETUNIFORMUIVPROC> getUniformuiv;
+    EntryPointGL<PFNGLGETVERTEXATTRIBIIVPROC> getVertexAttribIiv;
+    EntryPointGL<PFNGLGETVERTEXATTRIBIUIVPROC> getVertexAttribIuiv;
+    EntryPointGL<PFNGLISENABLEDIPROC> isEnabledi;
+    EntryPointGL<PFNGLISFRAMEBUFFERPROC> isFramebuffer;
+    EntryPointGL<PFNGLISRENDERBUFFERPROC> isRenderbuffer;
+    EntryPointGL<PFNGLISVERTEXARRAYPROC> isVertexArray;
+    EntryPointGL<PFNGLMAPBUFFERRANGEPROC> mapBufferRange;
+    EntryPointGL<PFNGLRENDERBUFFERSTORAGEPROC> renderbufferStorage;
+    EntryPointGL<PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC> renderbufferStorageMultisample;
+    EntryPointGL<PFNGLTEXPARAMETERIIVPROC> texParameterIiv;
+    EntryPointGL<PFNGLTEXPARAMETERIUIVPROC> texParameterIuiv;
+    EntryPointGL<PFNGLTRANSFORMFEEDBACKVARYINGSPROC> transformFeedbackVaryings;
+    EntryPointGL<PFNGLUNIFORM1UIPROC> uniform1ui;
+    EntryPointGL<PFNGLUNIFORM1UIVPROC> uniform1uiv;
+    EntryPointGL<PFNGLUNIFORM2UIPROC> uniform2ui;
+    EntryPointGL<PFNGLUNIFORM2UIVPROC> uniform2uiv;
+    EntryPointGL<PFNGLUNIFORM3UIPROC> uniform3ui;
+    EntryPointGL<PFNGLUNIFORM3UIVPROC> uniform3uiv;
+    EntryPointGL<PFNGLUNIFORM4UIPROC> uniform4ui;
+    EntryPointGL<PFNGLUNIFORM4UIVPROC> uniform4uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBI1IPROC> vertexAttribI1i;
+    EntryPointGL<PFNGLVERTEXATTRIBI1IVPROC> vertexAttribI1iv;
+    EntryPointGL<PFNGLVERTEXATTRIBI1UIPROC> vertexAttribI1ui;
+    EntryPointGL<PFNGLVERTEXATTRIBI1UIVPROC> vertexAttribI1uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBI2IPROC> vertexAttribI2i;
+    EntryPointGL<PFNGLVERTEXATTRIBI2IVPROC> vertexAttribI2iv;
+    EntryPointGL<PFNGLVERTEXATTRIBI2UIPROC> vertexAttribI2ui;
+    EntryPointGL<PFNGLVERTEXATTRIBI2UIVPROC> vertexAttribI2uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBI3IPROC> vertexAttribI3i;
+    EntryPointGL<PFNGLVERTEXATTRIBI3IVPROC> vertexAttribI3iv;
+    EntryPointGL<PFNGLVERTEXATTRIBI3UIPROC> vertexAttribI3ui;
+    EntryPointGL<PFNGLVERTEXATTRIBI3UIVPROC> vertexAttribI3uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBI4BVPROC> vertexAttribI4bv;
+    EntryPointGL<PFNGLVERTEXATTRIBI4IPROC> vertexAttribI4i;
+    EntryPointGL<PFNGLVERTEXATTRIBI4IVPROC> vertexAttribI4iv;
+    EntryPointGL<PFNGLVERTEXATTRIBI4SVPROC> vertexAttribI4sv;
+    EntryPointGL<PFNGLVERTEXATTRIBI4UBVPROC> vertexAttribI4ubv;
+    EntryPointGL<PFNGLVERTEXATTRIBI4UIPROC> vertexAttribI4ui;
+    EntryPointGL<PFNGLVERTEXATTRIBI4UIVPROC> vertexAttribI4uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBI4USVPROC> vertexAttribI4usv;
+    EntryPointGL<PFNGLVERTEXATTRIBIPOINTERPROC> vertexAttribIPointer;
 
     // 3.1
-    PFNGLCOPYBUFFERSUBDATAPROC copyBufferSubData;
-    PFNGLDRAWARRAYSINSTANCEDPROC drawArraysInstanced;
-    PFNGLDRAWELEMENTSINSTANCEDPROC drawElementsInstanced;
-    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC getActiveUniformBlockName;
-    PFNGLGETACTIVEUNIFORMBLOCKIVPROC getActiveUniformBlockiv;
-    PFNGLGETACTIVEUNIFORMNAMEPROC getActiveUniformName;
-    PFNGLGETACTIVEUNIFORMSIVPROC getActiveUniformsiv;
-    PFNGLGETUNIFORMBLOCKINDEXPROC getUniformBlockIndex;
-    PFNGLGETUNIFORMINDICESPROC getUniformIndices;
-    PFNGLPRIMITIVERESTARTINDEXPROC primitiveRestartIndex;
-    PFNGLTEXBUFFERPROC texBuffer;
-    PFNGLUNIFORMBLOCKBINDINGPROC uniformBlockBinding;
+    EntryPointGL<PFNGLCOPYBUFFERSUBDATAPROC> copyBufferSubData;
+    EntryPointGL<PFNGLDRAWARRAYSINSTANCEDPROC> drawArraysInstanced;
+    EntryPointGL<PFNGLDRAWELEMENTSINSTANCEDPROC> drawElementsInstanced;
+    EntryPointGL<PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC> getActiveUniformBlockName;
+    EntryPointGL<PFNGLGETACTIVEUNIFORMBLOCKIVPROC> getActiveUniformBlockiv;
+    EntryPointGL<PFNGLGETACTIVEUNIFORMNAMEPROC> getActiveUniformName;
+    EntryPointGL<PFNGLGETACTIVEUNIFORMSIVPROC> getActiveUniformsiv;
+    EntryPointGL<PFNGLGETUNIFORMBLOCKINDEXPROC> getUniformBlockIndex;
+    EntryPointGL<PFNGLGETUNIFORMINDICESPROC> getUniformIndices;
+    EntryPointGL<PFNGLPRIMITIVERESTARTINDEXPROC> primitiveRestartIndex;
+    EntryPointGL<PFNGLTEXBUFFERPROC> texBuffer;
+    EntryPointGL<PFNGLUNIFORMBLOCKBINDINGPROC> uniformBlockBinding;
 
     // 3.2
-    PFNGLCLIENTWAITSYNCPROC clientWaitSync;
-    PFNGLDELETESYNCPROC deleteSync;
-    PFNGLDRAWELEMENTSBASEVERTEXPROC drawElementsBaseVertex;
-    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC drawElementsInstancedBaseVertex;
-    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC drawRangeElementsBaseVertex;
-    PFNGLFENCESYNCPROC fenceSync;
-    PFNGLFRAMEBUFFERTEXTUREPROC framebufferTexture;
-    PFNGLGETBUFFERPARAMETERI64VPROC getBufferParameteri64v;
-    PFNGLGETINTEGER64I_VPROC getInteger64i_v;
-    PFNGLGETINTEGER64VPROC getInteger64v;
-    PFNGLGETMULTISAMPLEFVPROC getMultisamplefv;
-    PFNGLGETSYNCIVPROC getSynciv;
-    PFNGLISSYNCPROC isSync;
-    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC multiDrawElementsBaseVertex;
-    PFNGLPROVOKINGVERTEXPROC provokingVertex;
-    PFNGLSAMPLEMASKIPROC sampleMaski;
-    PFNGLTEXIMAGE2DMULTISAMPLEPROC texImage2DMultisample;
-    PFNGLTEXIMAGE3DMULTISAMPLEPROC texImage3DMultisample;
-    PFNGLWAITSYNCPROC waitSync;
+    EntryPointGL<PFNGLCLIENTWAITSYNCPROC> clientWaitSync;
+    EntryPointGL<PFNGLDELETESYNCPROC> deleteSync;
+    EntryPointGL<PFNGLDRAWELEMENTSBASEVERTEXPROC> drawElementsBaseVertex;
+    EntryPointGL<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC> drawElementsInstancedBaseVertex;
+    EntryPointGL<PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC> drawRangeElementsBaseVertex;
+    EntryPointGL<PFNGLFENCESYNCPROC> fenceSync;
+    EntryPointGL<PFNGLFRAMEBUFFERTEXTUREPROC> framebufferTexture;
+    EntryPointGL<PFNGLGETBUFFERPARAMETERI64VPROC> getBufferParameteri64v;
+    EntryPointGL<PFNGLGETINTEGER64I_VPROC> getInteger64i_v;
+    EntryPointGL<PFNGLGETINTEGER64VPROC> getInteger64v;
+    EntryPointGL<PFNGLGETMULTISAMPLEFVPROC> getMultisamplefv;
+    EntryPointGL<PFNGLGETSYNCIVPROC> getSynciv;
+    EntryPointGL<PFNGLISSYNCPROC> isSync;
+    EntryPointGL<PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC> multiDrawElementsBaseVertex;
+    EntryPointGL<PFNGLPROVOKINGVERTEXPROC> provokingVertex;
+    EntryPointGL<PFNGLSAMPLEMASKIPROC> sampleMaski;
+    EntryPointGL<PFNGLTEXIMAGE2DMULTISAMPLEPROC> texImage2DMultisample;
+    EntryPointGL<PFNGLTEXIMAGE3DMULTISAMPLEPROC> texImage3DMultisample;
+    EntryPointGL<PFNGLWAITSYNCPROC> waitSync;
 
     // NV_path_rendering (originally written against 3.2 compatibility profile)
-    PFNGLMATRIXLOADFEXTPROC matrixLoadEXT;
-    PFNGLGENPATHSNVPROC genPathsNV;
-    PFNGLDELETEPATHSNVPROC delPathsNV;
-    PFNGLPATHCOMMANDSNVPROC pathCommandsNV;
-    PFNGLISPATHNVPROC isPathNV;
-    PFNGLPATHPARAMETERFNVPROC setPathParameterfNV;
-    PFNGLPATHPARAMETERINVPROC setPathParameteriNV;
-    PFNGLGETPATHPARAMETERFVNVPROC getPathParameterfNV;
-    PFNGLGETPATHPARAMETERIVNVPROC getPathParameteriNV;
-    PFNGLPATHSTENCILFUNCNVPROC pathStencilFuncNV;
-    PFNGLSTENCILFILLPATHNVPROC stencilFillPathNV;
-    PFNGLSTENCILSTROKEPATHNVPROC stencilStrokePathNV;
-    PFNGLCOVERFILLPATHNVPROC coverFillPathNV;
-    PFNGLCOVERSTROKEPATHNVPROC coverStrokePathNV;
-    PFNGLSTENCILTHENCOVERFILLPATHNVPROC stencilThenCoverFillPathNV;
-    PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC stencilThenCoverStrokePathNV;
-    PFNGLCOVERFILLPATHINSTANCEDNVPROC coverFillPathInstancedNV;
-    PFNGLCOVERSTROKEPATHINSTANCEDNVPROC coverStrokePathInstancedNV;
-    PFNGLSTENCILFILLPATHINSTANCEDNVPROC stencilFillPathInstancedNV;
-    PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC stencilStrokePathInstancedNV;
-    PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC stencilThenCoverFillPathInstancedNV;
-    PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC stencilThenCoverStrokePathInstancedNV;
-    PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC programPathFragmentInputGenNV;
+    EntryPointGL<PFNGLMATRIXLOADFEXTPROC> matrixLoadEXT;
+    EntryPointGL<PFNGLGENPATHSNVPROC> genPathsNV;
+    EntryPointGL<PFNGLDELETEPATHSNVPROC> delPathsNV;
+    EntryPointGL<PFNGLPATHCOMMANDSNVPROC> pathCommandsNV;
+    EntryPointGL<PFNGLISPATHNVPROC> isPathNV;
+    EntryPointGL<PFNGLPATHPARAMETERFNVPROC> setPathParameterfNV;
+    EntryPointGL<PFNGLPATHPARAMETERINVPROC> setPathParameteriNV;
+    EntryPointGL<PFNGLGETPATHPARAMETERFVNVPROC> getPathParameterfNV;
+    EntryPointGL<PFNGLGETPATHPARAMETERIVNVPROC> getPathParameteriNV;
+    EntryPointGL<PFNGLPATHSTENCILFUNCNVPROC> pathStencilFuncNV;
+    EntryPointGL<PFNGLSTENCILFILLPATHNVPROC> stencilFillPathNV;
+    EntryPointGL<PFNGLSTENCILSTROKEPATHNVPROC> stencilStrokePathNV;
+    EntryPointGL<PFNGLCOVERFILLPATHNVPROC> coverFillPathNV;
+    EntryPointGL<PFNGLCOVERSTROKEPATHNVPROC> coverStrokePathNV;
+    EntryPointGL<PFNGLSTENCILTHENCOVERFILLPATHNVPROC> stencilThenCoverFillPathNV;
+    EntryPointGL<PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC> stencilThenCoverStrokePathNV;
+    EntryPointGL<PFNGLCOVERFILLPATHINSTANCEDNVPROC> coverFillPathInstancedNV;
+    EntryPointGL<PFNGLCOVERSTROKEPATHINSTANCEDNVPROC> coverStrokePathInstancedNV;
+    EntryPointGL<PFNGLSTENCILFILLPATHINSTANCEDNVPROC> stencilFillPathInstancedNV;
+    EntryPointGL<PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC> stencilStrokePathInstancedNV;
+    EntryPointGL<PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC> stencilThenCoverFillPathInstancedNV;
+    EntryPointGL<PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC>
+        stencilThenCoverStrokePathInstancedNV;
+    EntryPointGL<PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC> programPathFragmentInputGenNV;
 
     // 3.3
-    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC bindFragDataLocationIndexed;
-    PFNGLBINDSAMPLERPROC bindSampler;
-    PFNGLDELETESAMPLERSPROC deleteSamplers;
-    PFNGLGENSAMPLERSPROC genSamplers;
-    PFNGLGETFRAGDATAINDEXPROC getFragDataIndex;
-    PFNGLGETQUERYOBJECTI64VPROC getQueryObjecti64v;
-    PFNGLGETQUERYOBJECTUI64VPROC getQueryObjectui64v;
-    PFNGLGETSAMPLERPARAMETERIIVPROC getSamplerParameterIiv;
-    PFNGLGETSAMPLERPARAMETERIUIVPROC getSamplerParameterIuiv;
-    PFNGLGETSAMPLERPARAMETERFVPROC getSamplerParameterfv;
-    PFNGLGETSAMPLERPARAMETERIVPROC getSamplerParameteriv;
-    PFNGLISSAMPLERPROC isSampler;
-    PFNGLQUERYCOUNTERPROC queryCounter;
-    PFNGLSAMPLERPARAMETERIIVPROC samplerParameterIiv;
-    PFNGLSAMPLERPARAMETERIUIVPROC samplerParameterIuiv;
-    PFNGLSAMPLERPARAMETERFPROC samplerParameterf;
-    PFNGLSAMPLERPARAMETERFVPROC samplerParameterfv;
-    PFNGLSAMPLERPARAMETERIPROC samplerParameteri;
-    PFNGLSAMPLERPARAMETERIVPROC samplerParameteriv;
-    PFNGLVERTEXATTRIBDIVISORPROC vertexAttribDivisor;
-    PFNGLVERTEXATTRIBP1UIPROC vertexAttribP1ui;
-    PFNGLVERTEXATTRIBP1UIVPROC vertexAttribP1uiv;
-    PFNGLVERTEXATTRIBP2UIPROC vertexAttribP2ui;
-    PFNGLVERTEXATTRIBP2UIVPROC vertexAttribP2uiv;
-    PFNGLVERTEXATTRIBP3UIPROC vertexAttribP3ui;
-    PFNGLVERTEXATTRIBP3UIVPROC vertexAttribP3uiv;
-    PFNGLVERTEXATTRIBP4UIPROC vertexAttribP4ui;
-    PFNGLVERTEXATTRIBP4UIVPROC vertexAttribP4uiv;
+    EntryPointGL<PFNGLBINDFRAGDATALOCATIONINDEXEDPROC> bindFragDataLocationIndexed;
+    EntryPointGL<PFNGLBINDSAMPLERPROC> bindSampler;
+    EntryPointGL<PFNGLDELETESAMPLERSPROC> deleteSamplers;
+    EntryPointGL<PFNGLGENSAMPLERSPROC> genSamplers;
+    EntryPointGL<PFNGLGETFRAGDATAINDEXPROC> getFragDataIndex;
+    EntryPointGL<PFNGLGETQUERYOBJECTI64VPROC> getQueryObjecti64v;
+    EntryPointGL<PFNGLGETQUERYOBJECTUI64VPROC> getQueryObjectui64v;
+    EntryPointGL<PFNGLGETSAMPLERPARAMETERIIVPROC> getSamplerParameterIiv;
+    EntryPointGL<PFNGLGETSAMPLERPARAMETERIUIVPROC> getSamplerParameterIuiv;
+    EntryPointGL<PFNGLGETSAMPLERPARAMETERFVPROC> getSamplerParameterfv;
+    EntryPointGL<PFNGLGETSAMPLERPARAMETERIVPROC> getSamplerParameteriv;
+    EntryPointGL<PFNGLISSAMPLERPROC> isSampler;
+    EntryPointGL<PFNGLQUERYCOUNTERPROC> queryCounter;
+    EntryPointGL<PFNGLSAMPLERPARAMETERIIVPROC> samplerParameterIiv;
+    EntryPointGL<PFNGLSAMPLERPARAMETERIUIVPROC> samplerParameterIuiv;
+    EntryPointGL<PFNGLSAMPLERPARAMETERFPROC> samplerParameterf;
+    EntryPointGL<PFNGLSAMPLERPARAMETERFVPROC> samplerParameterfv;
+    EntryPointGL<PFNGLSAMPLERPARAMETERIPROC> samplerParameteri;
+    EntryPointGL<PFNGLSAMPLERPARAMETERIVPROC> samplerParameteriv;
+    EntryPointGL<PFNGLVERTEXATTRIBDIVISORPROC> vertexAttribDivisor;
+    EntryPointGL<PFNGLVERTEXATTRIBP1UIPROC> vertexAttribP1ui;
+    EntryPointGL<PFNGLVERTEXATTRIBP1UIVPROC> vertexAttribP1uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBP2UIPROC> vertexAttribP2ui;
+    EntryPointGL<PFNGLVERTEXATTRIBP2UIVPROC> vertexAttribP2uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBP3UIPROC> vertexAttribP3ui;
+    EntryPointGL<PFNGLVERTEXATTRIBP3UIVPROC> vertexAttribP3uiv;
+    EntryPointGL<PFNGLVERTEXATTRIBP4UIPROC> vertexAttribP4ui;
+    EntryPointGL<PFNGLVERTEXATTRIBP4UIVPROC> vertexAttribP4uiv;
 
     // 4.0
-    PFNGLBEGINQUERYINDEXEDPROC beginQueryIndexed;
-    PFNGLBINDTRANSFORMFEEDBACKPROC bindTransformFeedback;
-    PFNGLBLENDEQUATIONSEPARATEIPROC blendEquationSeparatei;
-    PFNGLBLENDEQUATIONIPROC blendEquationi;
-    PFNGLBLENDFUNCSEPARATEIPROC blendFuncSeparatei;
-    PFNGLBLENDFUNCIPROC blendFunci;
-    PFNGLDELETETRANSFORMFEEDBACKSPROC deleteTransformFeedbacks;
-    PFNGLDRAWARRAYSINDIRECTPROC drawArraysIndirect;
-    PFNGLDRAWELEMENTSINDIRECTPROC drawElementsIndirect;
-    PFNGLDRAWTRANSFORMFEEDBACKPROC drawTransformFeedback;
-    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC drawTransformFeedbackStream;
-    PFNGLENDQUERYINDEXEDPROC endQueryIndexed;
-    PFNGLGENTRANSFORMFEEDBACKSPROC genTransformFeedbacks;
-    PFNGLGETACTIVESUBROUTINENAMEPROC getActiveSubroutineName;
-    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC getActiveSubroutineUniformName;
-    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC getActiveSubroutineUniformiv;
-    PFNGLGETPROGRAMSTAGEIVPROC getProgramStageiv;
-    PFNGLGETQUERYINDEXEDIVPROC getQueryIndexediv;
-    PFNGLGETSUBROUTINEINDEXPROC getSubroutineIndex;
-    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC getSubroutineUniformLocation;
-    PFNGLGETUNIFORMSUBROUTINEUIVPROC getUniformSubroutineuiv;
-    PFNGLGETUNIFORMDVPROC getUniformdv;
-    PFNGLISTRANSFORMFEEDBACKPROC isTransformFeedback;
-    PFNGLMINSAMPLESHADINGPROC minSampleShading;
-    PFNGLPATCHPARAMETERFVPROC patchParameterfv;
-    PFNGLPATCHPARAMETERIPROC patchParameteri;
-    PFNGLPAUSETRANSFORMFEEDBACKPROC pauseTransformFeedback;
-    PFNGLRESUMETRANSFORMFEEDBACKPROC resumeTransformFeedback;
-    PFNGLUNIFORM1DPROC uniform1d;
-    PFNGLUNIFORM1DVPROC uniform1dv;
-    PFNGLUNIFORM2DPROC uniform2d;
-    PFNGLUNIFORM2DVPROC uniform2dv;
-    PFNGLUNIFORM3DPROC uniform3d;
-    PFNGLUNIFORM3DVPROC uniform3dv;
-    PFNGLUNIFORM4DPROC uniform4d;
-    PFNGLUNIFORM4DVPROC uniform4dv;
-    PFNGLUNIFORMMATRIX2DVPROC uniformMatrix2dv;
-    PFNGLUNIFORMMATRIX2X3DVPROC uniformMatrix2x3dv;
-    PFNGLUNIFORMMATRIX2X4DVPROC uniformMatrix2x4dv;
-    PFNGLUNIFORMMATRIX3DVPROC uniformMatrix3dv;
-    PFNGLUNIFORMMATRIX3X2DVPROC uniformMatrix3x2dv;
-    PFNGLUNIFORMMATRIX3X4DVPROC uniformMatrix3x4dv;
-    PFNGLUNIFORMMATRIX4DVPROC uniformMatrix4dv;
-    PFNGLUNIFORMMATRIX4X2DVPROC uniformMatrix4x2dv;
-    PFNGLUNIFORMMATRIX4X3DVPROC uniformMatrix4x3dv;
-    PFNGLUNIFORMSUBROUTINESUIVPROC uniformSubroutinesuiv;
+    EntryPointGL<PFNGLBEGINQUERYINDEXEDPROC> beginQueryIndexed;
+    EntryPointGL<PFNGLBINDTRANSFORMFEEDBACKPROC> bindTransformFeedback;
+    EntryPointGL<PFNGLBLENDEQUATIONSEPARATEIPROC> blendEquationSeparatei;
+    EntryPointGL<PFNGLBLENDEQUATIONIPROC> blendEquationi;
+    EntryPointGL<PFNGLBLENDFUNCSEPARATEIPROC> blendFuncSeparatei;
+    EntryPointGL<PFNGLBLENDFUNCIPROC> blendFunci;
+    EntryPointGL<PFNGLDELETETRANSFORMFEEDBACKSPROC> deleteTransformFeedbacks;
+    EntryPointGL<PFNGLDRAWARRAYSINDIRECTPROC> drawArraysIndirect;
+    EntryPointGL<PFNGLDRAWELEMENTSINDIRECTPROC> drawElementsIndirect;
+    EntryPointGL<PFNGLDRAWTRANSFORMFEEDBACKPROC> drawTransformFeedback;
+    EntryPointGL<PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC> drawTransformFeedbackStream;
+    EntryPointGL<PFNGLENDQUERYINDEXEDPROC> endQueryIndexed;
+    EntryPointGL<PFNGLGENTRANSFORMFEEDBACKSPROC> genTransformFeedbacks;
+    EntryPointGL<PFNGLGETACTIVESUBROUTINENAMEPROC> getActiveSubroutineName;
+    EntryPointGL<PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC> getActiveSubroutineUniformName;
+    EntryPointGL<PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC> getActiveSubroutineUniformiv;
+    EntryPointGL<PFNGLGETPROGRAMSTAGEIVPROC> getProgramStageiv;
+    EntryPointGL<PFNGLGETQUERYINDEXEDIVPROC> getQueryIndexediv;
+    EntryPointGL<PFNGLGETSUBROUTINEINDEXPROC> getSubroutineIndex;
+    EntryPointGL<PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC> getSubroutineUniformLocation;
+    EntryPointGL<PFNGLGETUNIFORMSUBROUTINEUIVPROC> getUniformSubroutineuiv;
+    EntryPointGL<PFNGLGETUNIFORMDVPROC> getUniformdv;
+    EntryPointGL<PFNGLISTRANSFORMFEEDBACKPROC> isTransformFeedback;
+    EntryPointGL<PFNGLMINSAMPLESHADINGPROC> minSampleShading;
+    EntryPointGL<PFNGLPATCHPARAMETERFVPROC> patchParameterfv;
+    EntryPointGL<PFNGLPATCHPARAMETERIPROC> patchParameteri;
+    EntryPointGL<PFNGLPAUSETRANSFORMFEEDBACKPROC> pauseTransformFeedback;
+    EntryPointGL<PFNGLRESUMETRANSFORMFEEDBACKPROC> resumeTransformFeedback;
+    EntryPointGL<PFNGLUNIFORM1DPROC> uniform1d;
+    EntryPointGL<PFNGLUNIFORM1DVPROC> uniform1dv;
+    EntryPointGL<PFNGLUNIFORM2DPROC> uniform2d;
+    EntryPointGL<PFNGLUNIFORM2DVPROC> uniform2dv;
+    EntryPointGL<PFNGLUNIFORM3DPROC> uniform3d;
+    EntryPointGL<PFNGLUNIFORM3DVPROC> uniform3dv;
+    EntryPointGL<PFNGLUNIFORM4DPROC> uniform4d;
+    EntryPointGL<PFNGLUNIFORM4DVPROC> uniform4dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX2DVPROC> uniformMatrix2dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX2X3DVPROC> uniformMatrix2x3dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX2X4DVPROC> uniformMatrix2x4dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX3DVPROC> uniformMatrix3dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX3X2DVPROC> uniformMatrix3x2dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX3X4DVPROC> uniformMatrix3x4dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX4DVPROC> uniformMatrix4dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX4X2DVPROC> uniformMatrix4x2dv;
+    EntryPointGL<PFNGLUNIFORMMATRIX4X3DVPROC> uniformMatrix4x3dv;
+    EntryPointGL<PFNGLUNIFORMSUBROUTINESUIVPROC> uniformSubroutinesuiv;
 
     // 4.1
-    PFNGLACTIVESHADERPROGRAMPROC activeShaderProgram;
-    PFNGLBINDPROGRAMPIPELINEPROC bindProgramPipeline;
-    PFNGLCLEARDEPTHFPROC clearDepthf;
-    PFNGLCREATESHADERPROGRAMVPROC createShaderProgramv;
-    PFNGLDELETEPROGRAMPIPELINESPROC deleteProgramPipelines;
-    PFNGLDEPTHRANGEARRAYVPROC depthRangeArrayv;
-    PFNGLDEPTHRANGEINDEXEDPROC depthRangeIndexed;
-    PFNGLDEPTHRANGEFPROC depthRangef;
-    PFNGLGENPROGRAMPIPELINESPROC genProgramPipelines;
-    PFNGLGETDOUBLEI_VPROC getDoublei_v;
-    PFNGLGETFLOATI_VPROC getFloati_v;
-    PFNGLGETPROGRAMBINARYPROC getProgramBinary;
-    PFNGLGETPROGRAMPIPELINEINFOLOGPROC getProgramPipelineInfoLog;
-    PFNGLGETPROGRAMPIPELINEIVPROC getProgramPipelineiv;
-    PFNGLGETSHADERPRECISIONFORMATPROC getShaderPrecisionFormat;
-    PFNGLGETVERTEXATTRIBLDVPROC getVertexAttribLdv;
-    PFNGLISPROGRAMPIPELINEPROC isProgramPipeline;
-    PFNGLPROGRAMBINARYPROC programBinary;
-    PFNGLPROGRAMPARAMETERIPROC programParameteri;
-    PFNGLPROGRAMUNIFORM1DPROC programUniform1d;
-    PFNGLPROGRAMUNIFORM1DVPROC programUniform1dv;
-    PFNGLPROGRAMUNIFORM1FPROC programUniform1f;
-    PFNGLPROGRAMUNIFORM1FVPROC programUniform1fv;
-    PFNGLPROGRAMUNIFORM1IPROC programUniform1i;
-    PFNGLPROGRAMUNIFORM1IVPROC programUniform1iv;
-    PFNGLPROGRAMUNIFORM1UIPROC programUniform1ui;
-    PFNGLPROGRAMUNIFORM1UIVPROC programUniform1uiv;
-    PFNGLPROGRAMUNIFORM2DPROC programUniform2d;
-    PFNGLPROGRAMUNIFORM2DVPROC programUniform2dv;
-    PFNGLPROGRAMUNIFORM2FPROC programUniform2f;
-    PFNGLPROGRAMUNIFORM2FVPROC programUniform2fv;
-    PFNGLPROGRAMUNIFORM2IPROC programUniform2i;
-    PFNGLPROGRAMUNIFORM2IVPROC programUniform2iv;
-    PFNGLPROGRAMUNIFORM2UIPROC programUniform2ui;
-    PFNGLPROGRAMUNIFORM2UIVPROC programUniform2uiv;
-    PFNGLPROGRAMUNIFORM3DPROC programUniform3d;
-    PFNGLPROGRAMUNIFORM3DVPROC programUniform3dv;
-    PFNGLPROGRAMUNIFORM3FPROC programUniform3f;
-    PFNGLPROGRAMUNIFORM3FVPROC programUniform3fv;
-    PFNGLPROGRAMUNIFORM3IPROC programUniform3i;
-    PFNGLPROGRAMUNIFORM3IVPROC programUniform3iv;
-    PFNGLPROGRAMUNIFORM3UIPROC programUniform3ui;
-    PFNGLPROGRAMUNIFORM3UIVPROC programUniform3uiv;
-    PFNGLPROGRAMUNIFORM4DPROC programUniform4d;
-    PFNGLPROGRAMUNIFORM4DVPROC programUniform4dv;
-    PFNGLPROGRAMUNIFORM4FPROC programUniform4f;
-    PFNGLPROGRAMUNIFORM4FVPROC programUniform4fv;
-    PFNGLPROGRAMUNIFORM4IPROC programUniform4i;
-    PFNGLPROGRAMUNIFORM4IVPROC programUniform4iv;
-    PFNGLPROGRAMUNIFORM4UIPROC programUniform4ui;
-    PFNGLPROGRAMUNIFORM4UIVPROC programUniform4uiv;
-    PFNGLPROGRAMUNIFORMMATRIX2DVPROC programUniformMatrix2dv;
-    PFNGLPROGRAMUNIFORMMATRIX2FVPROC programUniformMatrix2fv;
-    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC programUniformMatrix2x3dv;
-    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC programUniformMatrix2x3fv;
-    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC programUniformMatrix2x4dv;
-    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC programUniformMatrix2x4fv;
-    PFNGLPROGRAMUNIFORMMATRIX3DVPROC programUniformMatrix3dv;
-    PFNGLPROGRAMUNIFORMMATRIX3FVPROC programUniformMatrix3fv;
-    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC programUniformMatrix3x2dv;
-    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC programUniformMatrix3x2fv;
-    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC programUniformMatrix3x4dv;
-    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC programUniformMatrix3x4fv;
-    PFNGLPROGRAMUNIFORMMATRIX4DVPROC programUniformMatrix4dv;
-    PFNGLPROGRAMUNIFORMMATRIX4FVPROC programUniformMatrix4fv;
-    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC programUniformMatrix4x2dv;
-    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC programUniformMatrix4x2fv;
-    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC programUniformMatrix4x3dv;
-    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC programUniformMatrix4x3fv;
-    PFNGLRELEASESHADERCOMPILERPROC releaseShaderCompiler;
-    PFNGLSCISSORARRAYVPROC scissorArrayv;
-    PFNGLSCISSORINDEXEDPROC scissorIndexed;
-    PFNGLSCISSORINDEXEDVPROC scissorIndexedv;
-    PFNGLSHADERBINARYPROC shaderBinary;
-    PFNGLUSEPROGRAMSTAGESPROC useProgramStages;
-    PFNGLVALIDATEPROGRAMPIPELINEPROC validateProgramPipeline;
-    PFNGLVERTEXATTRIBL1DPROC vertexAttribL1d;
-    PFNGLVERTEXATTRIBL1DVPROC vertexAttribL1dv;
-    PFNGLVERTEXATTRIBL2DPROC vertexAttribL2d;
-    PFNGLVERTEXATTRIBL2DVPROC vertexAttribL2dv;
-    PFNGLVERTEXATTRIBL3DPROC vertexAttribL3d;
-    PFNGLVERTEXATTRIBL3DVPROC vertexAttribL3dv;
-    PFNGLVERTEXATTRIBL4DPROC vertexAttribL4d;
-    PFNGLVERTEXATTRIBL4DVPROC vertexAttribL4dv;
-    PFNGLVERTEXATTRIBLPOINTERPROC vertexAttribLPointer;
-    PFNGLVIEWPORTARRAYVPROC viewportArrayv;
-    PFNGLVIEWPORTINDEXEDFPROC viewportIndexedf;
-    PFNGLVIEWPORTINDEXEDFVPROC viewportIndexedfv;
+    EntryPointGL<PFNGLACTIVESHADERPROGRAMPROC> activeShaderProgram;
+    EntryPointGL<PFNGLBINDPROGRAMPIPELINEPROC> bindProgramPipeline;
+    EntryPointGL<PFNGLCLEARDEPTHFPROC> clearDepthf;
+    EntryPointGL<PFNGLCREATESHADERPROGRAMVPROC> createShaderProgramv;
+    EntryPointGL<PFNGLDELETEPROGRAMPIPELINESPROC> deleteProgramPipelines;
+    EntryPointGL<PFNGLDEPTHRANGEARRAYVPROC> depthRangeArrayv;
+    EntryPointGL<PFNGLDEPTHRANGEINDEXEDPROC> depthRangeIndexed;
+    EntryPointGL<PFNGLDEPTHRANGEFPROC> depthRangef;
+    EntryPointGL<PFNGLGENPROGRAMPIPELINESPROC> genProgramPipelines;
+    EntryPointGL<PFNGLGETDOUBLEI_VPROC> getDoublei_v;
+    EntryPointGL<PFNGLGETFLOATI_VPROC> getFloati_v;
+    EntryPointGL<PFNGLGETPROGRAMBINARYPROC> getProgramBinary;
+    EntryPointGL<PFNGLGETPROGRAMPIPELINEINFOLOGPROC> getProgramPipelineInfoLog;
+    EntryPointGL<PFNGLGETPROGRAMPIPELINEIVPROC> getProgramPipelineiv;
+    EntryPointGL<PFNGLGETSHADERPRECISIONFORMATPROC> getShaderPrecisionFormat;
+    EntryPointGL<PFNGLGETVERTEXATTRIBLDVPROC> getVertexAttribLdv;
+    EntryPointGL<PFNGLISPROGRAMPIPELINEPROC> isProgramPipeline;
+    EntryPointGL<PFNGLPROGRAMBINARYPROC> programBinary;
+    EntryPointGL<PFNGLPROGRAMPARAMETERIPROC> programParameteri;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1DPROC> programUniform1d;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1DVPROC> programUniform1dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1FPROC> programUniform1f;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1FVPROC> programUniform1fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1IPROC> programUniform1i;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1IVPROC> programUniform1iv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1UIPROC> programUniform1ui;
+    EntryPointGL<PFNGLPROGRAMUNIFORM1UIVPROC> programUniform1uiv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2DPROC> programUniform2d;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2DVPROC> programUniform2dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2FPROC> programUniform2f;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2FVPROC> programUniform2fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2IPROC> programUniform2i;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2IVPROC> programUniform2iv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2UIPROC> programUniform2ui;
+    EntryPointGL<PFNGLPROGRAMUNIFORM2UIVPROC> programUniform2uiv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3DPROC> programUniform3d;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3DVPROC> programUniform3dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3FPROC> programUniform3f;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3FVPROC> programUniform3fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3IPROC> programUniform3i;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3IVPROC> programUniform3iv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3UIPROC> programUniform3ui;
+    EntryPointGL<PFNGLPROGRAMUNIFORM3UIVPROC> programUniform3uiv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4DPROC> programUniform4d;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4DVPROC> programUniform4dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4FPROC> programUniform4f;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4FVPROC> programUniform4fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4IPROC> programUniform4i;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4IVPROC> programUniform4iv;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4UIPROC> programUniform4ui;
+    EntryPointGL<PFNGLPROGRAMUNIFORM4UIVPROC> programUniform4uiv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX2DVPROC> programUniformMatrix2dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX2FVPROC> programUniformMatrix2fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC> programUniformMatrix2x3dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC> programUniformMatrix2x3fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC> programUniformMatrix2x4dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC> programUniformMatrix2x4fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX3DVPROC> programUniformMatrix3dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX3FVPROC> programUniformMatrix3fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC> programUniformMatrix3x2dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC> programUniformMatrix3x2fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC> programUniformMatrix3x4dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC> programUniformMatrix3x4fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX4DVPROC> programUniformMatrix4dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX4FVPROC> programUniformMatrix4fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC> programUniformMatrix4x2dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC> programUniformMatrix4x2fv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC> programUniformMatrix4x3dv;
+    EntryPointGL<PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC> programUniformMatrix4x3fv;
+    EntryPointGL<PFNGLRELEASESHADERCOMPILERPROC> releaseShaderCompiler;
+    EntryPointGL<PFNGLSCISSORARRAYVPROC> scissorArrayv;
+    EntryPointGL<PFNGLSCISSORINDEXEDPROC> scissorIndexed;
+    EntryPointGL<PFNGLSCISSORINDEXEDVPROC> scissorIndexedv;
+    EntryPointGL<PFNGLSHADERBINARYPROC> shaderBinary;
+    EntryPointGL<PFNGLUSEPROGRAMSTAGESPROC> useProgramStages;
+    EntryPointGL<PFNGLVALIDATEPROGRAMPIPELINEPROC> validateProgramPipeline;
+    EntryPointGL<PFNGLVERTEXATTRIBL1DPROC> vertexAttribL1d;
+    EntryPointGL<PFNGLVERTEXATTRIBL1DVPROC> vertexAttribL1dv;
+    EntryPointGL<PFNGLVERTEXATTRIBL2DPROC> vertexAttribL2d;
+    EntryPointGL<PFNGLVERTEXATTRIBL2DVPROC> vertexAttribL2dv;
+    EntryPointGL<PFNGLVERTEXATTRIBL3DPROC> vertexAttribL3d;
+    EntryPointGL<PFNGLVERTEXATTRIBL3DVPROC> vertexAttribL3dv;
+    EntryPointGL<PFNGLVERTEXATTRIBL4DPROC> vertexAttribL4d;
+    EntryPointGL<PFNGLVERTEXATTRIBL4DVPROC> vertexAttribL4dv;
+    EntryPointGL<PFNGLVERTEXATTRIBLPOINTERPROC> vertexAttribLPointer;
+    EntryPointGL<PFNGLVIEWPORTARRAYVPROC> viewportArrayv;
+    EntryPointGL<PFNGLVIEWPORTINDEXEDFPROC> viewportIndexedf;
+    EntryPointGL<PFNGLVIEWPORTINDEXEDFVPROC> viewportIndexedfv;
 
     // 4.2
-    PFNGLBINDIMAGETEXTUREPROC bindImageTexture;
-    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC drawArraysInstancedBaseInstance;
-    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC drawElementsInstancedBaseInstance;
-    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC drawElementsInstancedBaseVertexBaseInstance;
-    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC drawTransformFeedbackInstanced;
-    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC drawTransformFeedbackStreamInstanced;
-    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC getActiveAtomicCounterBufferiv;
-    PFNGLGETINTERNALFORMATIVPROC getInternalformativ;
-    PFNGLMEMORYBARRIERPROC memoryBarrier;
-    PFNGLTEXSTORAGE1DPROC texStorage1D;
-    PFNGLTEXSTORAGE2DPROC texStorage2D;
-    PFNGLTEXSTORAGE3DPROC texStorage3D;
+    EntryPointGL<PFNGLBINDIMAGETEXTUREPROC> bindImageTexture;
+    EntryPointGL<PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC> drawArraysInstancedBaseInstance;
+    EntryPointGL<PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC> drawElementsInstancedBaseInstance;
+    EntryPointGL<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC>
+        drawElementsInstancedBaseVertexBaseInstance;
+    EntryPointGL<PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC> drawTransformFeedbackInstanced;
+    EntryPointGL<PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC>
+        drawTransformFeedbackStreamInstanced;
+    EntryPointGL<PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC> getActiveAtomicCounterBufferiv;
+    EntryPointGL<PFNGLGETINTERNALFORMATIVPROC> getInternalformativ;
+    EntryPointGL<PFNGLMEMORYBARRIERPROC> memoryBarrier;
+    EntryPointGL<PFNGLTEXSTORAGE1DPROC> texStorage1D;
+    EntryPointGL<PFNGLTEXSTORAGE2DPROC> texStorage2D;
+    EntryPointGL<PFNGLTEXSTORAGE3DPROC> texStorage3D;
 
     // 4.3
-    PFNGLBINDVERTEXBUFFERPROC bindVertexBuffer;
-    PFNGLCLEARBUFFERDATAPROC clearBufferData;
-    PFNGLCLEARBUFFERSUBDATAPROC clearBufferSubData;
-    PFNGLCOPYIMAGESUBDATAPROC copyImageSubData;
-    PFNGLDEBUGMESSAGECALLBACKPROC debugMessageCallback;
-    PFNGLDEBUGMESSAGECONTROLPROC debugMessageControl;
-    PFNGLDEBUGMESSAGEINSERTPROC debugMessageInsert;
-    PFNGLDISPATCHCOMPUTEPROC dispatchCompute;
-    PFNGLDISPATCHCOMPUTEINDIRECTPROC dispatchComputeIndirect;
-    PFNGLFRAMEBUFFERPARAMETERIPROC framebufferParameteri;
-    PFNGLGETDEBUGMESSAGELOGPROC getDebugMessageLog;
-    PFNGLGETFRAMEBUFFERPARAMETERIVPROC getFramebufferParameteriv;
-    PFNGLGETINTERNALFORMATI64VPROC getInternalformati64v;
-    PFNGLGETPOINTERVPROC getPointerv;
-    PFNGLGETOBJECTLABELPROC getObjectLabel;
-    PFNGLGETOBJECTPTRLABELPROC getObjectPtrLabel;
-    PFNGLGETPROGRAMINTERFACEIVPROC getProgramInterfaceiv;
-    PFNGLGETPROGRAMRESOURCEINDEXPROC getProgramResourceIndex;
-    PFNGLGETPROGRAMRESOURCELOCATIONPROC getProgramResourceLocation;
-    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC getProgramResourceLocationIndex;
-    PFNGLGETPROGRAMRESOURCENAMEPROC getProgramResourceName;
-    PFNGLGETPROGRAMRESOURCEIVPROC getProgramResourceiv;
-    PFNGLINVALIDATEBUFFERDATAPROC invalidateBufferData;
-    PFNGLINVALIDATEBUFFERSUBDATAPROC invalidateBufferSubData;
-    PFNGLINVALIDATEFRAMEBUFFERPROC invalidateFramebuffer;
-    PFNGLINVALIDATESUBFRAMEBUFFERPROC invalidateSubFramebuffer;
-    PFNGLINVALIDATETEXIMAGEPROC invalidateTexImage;
-    PFNGLINVALIDATETEXSUBIMAGEPROC invalidateTexSubImage;
-    PFNGLMULTIDRAWARRAYSINDIRECTPROC multiDrawArraysIndirect;
-    PFNGLMULTIDRAWELEMENTSINDIRECTPROC multiDrawElementsIndirect;
-    PFNGLOBJECTLABELPROC objectLabel;
-    PFNGLOBJECTPTRLABELPROC objectPtrLabel;
-    PFNGLPOPDEBUGGROUPPROC popDebugGroup;
-    PFNGLPUSHDEBUGGROUPPROC pushDebugGroup;
-    PFNGLSHADERSTORAGEBLOCKBINDINGPROC shaderStorageBlockBinding;
-    PFNGLTEXBUFFERRANGEPROC texBufferRange;
-    PFNGLTEXSTORAGE2DMULTISAMPLEPROC texStorage2DMultisample;
-    PFNGLTEXSTORAGE3DMULTISAMPLEPROC texStorage3DMultisample;
-    PFNGLTEXTUREVIEWPROC textureView;
-    PFNGLVERTEXATTRIBBINDINGPROC vertexAttribBinding;
-    PFNGLVERTEXATTRIBFORMATPROC vertexAttribFormat;
-    PFNGLVERTEXATTRIBIFORMATPROC vertexAttribIFormat;
-    PFNGLVERTEXATTRIBLFORMATPROC vertexAttribLFormat;
-    PFNGLVERTEXBINDINGDIVISORPROC vertexBindingDivisor;
-    PFNGLCOVERAGEMODULATIONNVPROC coverageModulationNV;
+    EntryPointGL<PFNGLBINDVERTEXBUFFERPROC> bindVertexBuffer;
+    EntryPointGL<PFNGLCLEARBUFFERDATAPROC> clearBufferData;
+    EntryPointGL<PFNGLCLEARBUFFERSUBDATAPROC> clearBufferSubData;
+    EntryPointGL<PFNGLCOPYIMAGESUBDATAPROC> copyImageSubData;
+    EntryPointGL<PFNGLDEBUGMESSAGECALLBACKPROC> debugMessageCallback;
+    EntryPointGL<PFNGLDEBUGMESSAGECONTROLPROC> debugMessageControl;
+    EntryPointGL<PFNGLDEBUGMESSAGEINSERTPROC> debugMessageInsert;
+    EntryPointGL<PFNGLDISPATCHCOMPUTEPROC> dispatchCompute;
+    EntryPointGL<PFNGLDISPATCHCOMPUTEINDIRECTPROC> dispatchComputeIndirect;
+    EntryPointGL<PFNGLFRAMEBUFFERPARAMETERIPROC> framebufferParameteri;
+    EntryPointGL<PFNGLGETDEBUGMESSAGELOGPROC> getDebugMessageLog;
+    EntryPointGL<PFNGLGETFRAMEBUFFERPARAMETERIVPROC> getFramebufferParameteriv;
+    EntryPointGL<PFNGLGETINTERNALFORMATI64VPROC> getInternalformati64v;
+    EntryPointGL<PFNGLGETPOINTERVPROC> getPointerv;
+    EntryPointGL<PFNGLGETOBJECTLABELPROC> getObjectLabel;
+    EntryPointGL<PFNGLGETOBJECTPTRLABELPROC> getObjectPtrLabel;
+    EntryPointGL<PFNGLGETPROGRAMINTERFACEIVPROC> getProgramInterfaceiv;
+    EntryPointGL<PFNGLGETPROGRAMRESOURCEINDEXPROC> getProgramResourceIndex;
+    EntryPointGL<PFNGLGETPROGRAMRESOURCELOCATIONPROC> getProgramResourceLocation;
+    EntryPointGL<PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC> getProgramResourceLocationIndex;
+    EntryPointGL<PFNGLGETPROGRAMRESOURCENAMEPROC> getProgramResourceName;
+    EntryPointGL<PFNGLGETPROGRAMRESOURCEIVPROC> getProgramResourceiv;
+    EntryPointGL<PFNGLINVALIDATEBUFFERDATAPROC> invalidateBufferData;
+    EntryPointGL<PFNGLINVALIDATEBUFFERSUBDATAPROC> invalidateBufferSubData;
+    EntryPointGL<PFNGLINVALIDATEFRAMEBUFFERPROC> invalidateFramebuffer;
+    EntryPointGL<PFNGLINVALIDATESUBFRAMEBUFFERPROC> invalidateSubFramebuffer;
+    EntryPointGL<PFNGLINVALIDATETEXIMAGEPROC> invalidateTexImage;
+    EntryPointGL<PFNGLINVALIDATETEXSUBIMAGEPROC> invalidateTexSubImage;
+    EntryPointGL<PFNGLMULTIDRAWARRAYSINDIRECTPROC> multiDrawArraysIndirect;
+    EntryPointGL<PFNGLMULTIDRAWELEMENTSINDIRECTPROC> multiDrawElementsIndirect;
+    EntryPointGL<PFNGLOBJECTLABELPROC> objectLabel;
+    EntryPointGL<PFNGLOBJECTPTRLABELPROC> objectPtrLabel;
+    EntryPointGL<PFNGLPOPDEBUGGROUPPROC> popDebugGroup;
+    EntryPointGL<PFNGLPUSHDEBUGGROUPPROC> pushDebugGroup;
+    EntryPointGL<PFNGLSHADERSTORAGEBLOCKBINDINGPROC> shaderStorageBlockBinding;
+    EntryPointGL<PFNGLTEXBUFFERRANGEPROC> texBufferRange;
+    EntryPointGL<PFNGLTEXSTORAGE2DMULTISAMPLEPROC> texStorage2DMultisample;
+    EntryPointGL<PFNGLTEXSTORAGE3DMULTISAMPLEPROC> texStorage3DMultisample;
+    EntryPointGL<PFNGLTEXTUREVIEWPROC> textureView;
+    EntryPointGL<PFNGLVERTEXATTRIBBINDINGPROC> vertexAttribBinding;
+    EntryPointGL<PFNGLVERTEXATTRIBFORMATPROC> vertexAttribFormat;
+    EntryPointGL<PFNGLVERTEXATTRIBIFORMATPROC> vertexAttribIFormat;
+    EntryPointGL<PFNGLVERTEXATTRIBLFORMATPROC> vertexAttribLFormat;
+    EntryPointGL<PFNGLVERTEXBINDINGDIVISORPROC> vertexBindingDivisor;
+    EntryPointGL<PFNGLCOVERAGEMODULATIONNVPROC> coverageModulationNV;
 
     // 4.4
-    PFNGLBINDBUFFERSBASEPROC bindBuffersBase;
-    PFNGLBINDBUFFERSRANGEPROC bindBuffersRange;
-    PFNGLBINDIMAGETEXTURESPROC bindImageTextures;
-    PFNGLBINDSAMPLERSPROC bindSamplers;
-    PFNGLBINDTEXTURESPROC bindTextures;
-    PFNGLBINDVERTEXBUFFERSPROC bindVertexBuffers;
-    PFNGLBUFFERSTORAGEPROC bufferStorage;
-    PFNGLCLEARTEXIMAGEPROC clearTexImage;
-    PFNGLCLEARTEXSUBIMAGEPROC clearTexSubImage;
+    EntryPointGL<PFNGLBINDBUFFERSBASEPROC> bindBuffersBase;
+    EntryPointGL<PFNGLBINDBUFFERSRANGEPROC> bindBuffersRange;
+    EntryPointGL<PFNGLBINDIMAGETEXTURESPROC> bindImageTextures;
+    EntryPointGL<PFNGLBINDSAMPLERSPROC> bindSamplers;
+    EntryPointGL<PFNGLBINDTEXTURESPROC> bindTextures;
+    EntryPointGL<PFNGLBINDVERTEXBUFFERSPROC> bindVertexBuffers;
+    EntryPointGL<PFNGLBUFFERSTORAGEPROC> bufferStorage;
+    EntryPointGL<PFNGLCLEARTEXIMAGEPROC> clearTexImage;
+    EntryPointGL<PFNGLCLEARTEXSUBIMAGEPROC> clearTexSubImage;
 
     // 4.5
-    PFNGLBINDTEXTUREUNITPROC bindTextureUnit;
-    PFNGLBLITNAMEDFRAMEBUFFERPROC blitNamedFramebuffer;
-    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC checkNamedFramebufferStatus;
-    PFNGLCLEARNAMEDBUFFERDATAPROC clearNamedBufferData;
-    PFNGLCLEARNAMEDBUFFERSUBDATAPROC clearNamedBufferSubData;
-    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC clearNamedFramebufferfi;
-    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC clearNamedFramebufferfv;
-    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC clearNamedFramebufferiv;
-    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC clearNamedFramebufferuiv;
-    PFNGLCLIPCONTROLPROC clipControl;
-    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC compressedTextureSubImage1D;
-    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC compressedTextureSubImage2D;
-    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC compressedTextureSubImage3D;
-    PFNGLCOPYNAMEDBUFFERSUBDATAPROC copyNamedBufferSubData;
-    PFNGLCOPYTEXTURESUBIMAGE1DPROC copyTextureSubImage1D;
-    PFNGLCOPYTEXTURESUBIMAGE2DPROC copyTextureSubImage2D;
-    PFNGLCOPYTEXTURESUBIMAGE3DPROC copyTextureSubImage3D;
-    PFNGLCREATEBUFFERSPROC createBuffers;
-    PFNGLCREATEFRAMEBUFFERSPROC createFramebuffers;
-    PFNGLCREATEPROGRAMPIPELINESPROC createProgramPipelines;
-    PFNGLCREATEQUERIESPROC createQueries;
-    PFNGLCREATERENDERBUFFERSPROC createRenderbuffers;
-    PFNGLCREATESAMPLERSPROC createSamplers;
-    PFNGLCREATETEXTURESPROC createTextures;
-    PFNGLCREATETRANSFORMFEEDBACKSPROC createTransformFeedbacks;
-    PFNGLCREATEVERTEXARRAYSPROC createVertexArrays;
-    PFNGLDISABLEVERTEXARRAYATTRIBPROC disableVertexArrayAttrib;
-    PFNGLENABLEVERTEXARRAYATTRIBPROC enableVertexArrayAttrib;
-    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC flushMappedNamedBufferRange;
-    PFNGLGENERATETEXTUREMIPMAPPROC generateTextureMipmap;
-    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC getCompressedTextureImage;
-    PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC getCompressedTextureSubImage;
-    PFNGLGETGRAPHICSRESETSTATUSPROC getGraphicsResetStatus;
-    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC getNamedBufferParameteri64v;
-    PFNGLGETNAMEDBUFFERPARAMETERIVPROC getNamedBufferParameteriv;
-    PFNGLGETNAMEDBUFFERPOINTERVPROC getNamedBufferPointerv;
-    PFNGLGETNAMEDBUFFERSUBDATAPROC getNamedBufferSubData;
-    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC getNamedFramebufferAttachmentParameteriv;
-    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC getNamedFramebufferParameteriv;
-    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC getNamedRenderbufferParameteriv;
-    PFNGLGETQUERYBUFFEROBJECTI64VPROC getQueryBufferObjecti64v;
-    PFNGLGETQUERYBUFFEROBJECTIVPROC getQueryBufferObjectiv;
-    PFNGLGETQUERYBUFFEROBJECTUI64VPROC getQueryBufferObjectui64v;
-    PFNGLGETQUERYBUFFEROBJECTUIVPROC getQueryBufferObjectuiv;
-    PFNGLGETTEXTUREIMAGEPROC getTextureImage;
-    PFNGLGETTEXTURELEVELPARAMETERFVPROC getTextureLevelParameterfv;
-    PFNGLGETTEXTURELEVELPARAMETERIVPROC getTextureLevelParameteriv;
-    PFNGLGETTEXTUREPARAMETERIIVPROC getTextureParameterIiv;
-    PFNGLGETTEXTUREPARAMETERIUIVPROC getTextureParameterIuiv;
-    PFNGLGETTEXTUREPARAMETERFVPROC getTextureParameterfv;
-    PFNGLGETTEXTUREPARAMETERIVPROC getTextureParameteriv;
-    PFNGLGETTEXTURESUBIMAGEPROC getTextureSubImage;
-    PFNGLGETTRANSFORMFEEDBACKI64_VPROC getTransformFeedbacki64_v;
-    PFNGLGETTRANSFORMFEEDBACKI_VPROC getTransformFeedbacki_v;
-    PFNGLGETTRANSFORMFEEDBACKIVPROC getTransformFeedbackiv;
-    PFNGLGETVERTEXARRAYINDEXED64IVPROC getVertexArrayIndexed64iv;
-    PFNGLGETVERTEXARRAYINDEXEDIVPROC getVertexArrayIndexediv;
-    PFNGLGETVERTEXARRAYIVPROC getVertexArrayiv;
-    PFNGLGETNCOMPRESSEDTEXIMAGEPROC getnCompressedTexImage;
-    PFNGLGETNTEXIMAGEPROC getnTexImage;
-    PFNGLGETNUNIFORMDVPROC getnUniformdv;
-    PFNGLGETNUNIFORMFVPROC getnUniformfv;
-    PFNGLGETNUNIFORMIVPROC getnUniformiv;
-    PFNGLGETNUNIFORMUIVPROC getnUniformuiv;
-    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC invalidateNamedFramebufferData;
-    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC invalidateNamedFramebufferSubData;
-    PFNGLMAPNAMEDBUFFERPROC mapNamedBuffer;
-    PFNGLMAPNAMEDBUFFERRANGEPROC mapNamedBufferRange;
-    PFNGLMEMORYBARRIERBYREGIONPROC memoryBarrierByRegion;
-    PFNGLNAMEDBUFFERDATAPROC namedBufferData;
-    PFNGLNAMEDBUFFERSTORAGEPROC namedBufferStorage;
-    PFNGLNAMEDBUFFERSUBDATAPROC namedBufferSubData;
-    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC namedFramebufferDrawBuffer;
-    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC namedFramebufferDrawBuffers;
-    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC namedFramebufferParameteri;
-    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC namedFramebufferReadBuffer;
-    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC namedFramebufferRenderbuffer;
-    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC namedFramebufferTexture;
-    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC namedFramebufferTextureLayer;
-    PFNGLNAMEDRENDERBUFFERSTORAGEPROC namedRenderbufferStorage;
-    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC namedRenderbufferStorageMultisample;
-    PFNGLREADNPIXELSPROC readnPixels;
-    PFNGLTEXTUREBARRIERPROC textureBarrier;
-    PFNGLTEXTUREBUFFERPROC textureBuffer;
-    PFNGLTEXTUREBUFFERRANGEPROC textureBufferRange;
-    PFNGLTEXTUREPARAMETERIIVPROC textureParameterIiv;
-    PFNGLTEXTUREPARAMETERIUIVPROC textureParameterIuiv;
-    PFNGLTEXTUREPARAMETERFPROC textureParameterf;
-    PFNGLTEXTUREPARAMETERFVPROC textureParameterfv;
-    PFNGLTEXTUREPARAMETERIPROC textureParameteri;
-    PFNGLTEXTUREPARAMETERIVPROC textureParameteriv;
-    PFNGLTEXTURESTORAGE1DPROC textureStorage1D;
-    PFNGLTEXTURESTORAGE2DPROC textureStorage2D;
-    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC textureStorage2DMultisample;
-    PFNGLTEXTURESTORAGE3DPROC textureStorage3D;
-    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC textureStorage3DMultisample;
-    PFNGLTEXTURESUBIMAGE1DPROC textureSubImage1D;
-    PFNGLTEXTURESUBIMAGE2DPROC textureSubImage2D;
-    PFNGLTEXTURESUBIMAGE3DPROC textureSubImage3D;
-    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC transformFeedbackBufferBase;
-    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC transformFeedbackBufferRange;
-    PFNGLUNMAPNAMEDBUFFERPROC unmapNamedBuffer;
-    PFNGLVERTEXARRAYATTRIBBINDINGPROC vertexArrayAttribBinding;
-    PFNGLVERTEXARRAYATTRIBFORMATPROC vertexArrayAttribFormat;
-    PFNGLVERTEXARRAYATTRIBIFORMATPROC vertexArrayAttribIFormat;
-    PFNGLVERTEXARRAYATTRIBLFORMATPROC vertexArrayAttribLFormat;
-    PFNGLVERTEXARRAYBINDINGDIVISORPROC vertexArrayBindingDivisor;
-    PFNGLVERTEXARRAYELEMENTBUFFERPROC vertexArrayElementBuffer;
-    PFNGLVERTEXARRAYVERTEXBUFFERPROC vertexArrayVertexBuffer;
-    PFNGLVERTEXARRAYVERTEXBUFFERSPROC vertexArrayVertexBuffers;
+    EntryPointGL<PFNGLBINDTEXTUREUNITPROC> bindTextureUnit;
+    EntryPointGL<PFNGLBLITNAMEDFRAMEBUFFERPROC> blitNamedFramebuffer;
+    EntryPointGL<PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC> checkNamedFramebufferStatus;
+    EntryPointGL<PFNGLCLEARNAMEDBUFFERDATAPROC> clearNamedBufferData;
+    EntryPointGL<PFNGLCLEARNAMEDBUFFERSUBDATAPROC> clearNamedBufferSubData;
+    EntryPointGL<PFNGLCLEARNAMEDFRAMEBUFFERFIPROC> clearNamedFramebufferfi;
+    EntryPointGL<PFNGLCLEARNAMEDFRAMEBUFFERFVPROC> clearNamedFramebufferfv;
+    EntryPointGL<PFNGLCLEARNAMEDFRAMEBUFFERIVPROC> clearNamedFramebufferiv;
+    EntryPointGL<PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC> clearNamedFramebufferuiv;
+    EntryPointGL<PFNGLCLIPCONTROLPROC> clipControl;
+    EntryPointGL<PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC> compressedTextureSubImage1D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC> compressedTextureSubImage2D;
+    EntryPointGL<PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC> compressedTextureSubImage3D;
+    EntryPointGL<PFNGLCOPYNAMEDBUFFERSUBDATAPROC> copyNamedBufferSubData;
+    EntryPointGL<PFNGLCOPYTEXTURESUBIMAGE1DPROC> copyTextureSubImage1D;
+    EntryPointGL<PFNGLCOPYTEXTURESUBIMAGE2DPROC> copyTextureSubImage2D;
+    EntryPointGL<PFNGLCOPYTEXTURESUBIMAGE3DPROC> copyTextureSubImage3D;
+    EntryPointGL<PFNGLCREATEBUFFERSPROC> createBuffers;
+    EntryPointGL<PFNGLCREATEFRAMEBUFFERSPROC> createFramebuffers;
+    EntryPointGL<PFNGLCREATEPROGRAMPIPELINESPROC> createProgramPipelines;
+    EntryPointGL<PFNGLCREATEQUERIESPROC> createQueries;
+    EntryPointGL<PFNGLCREATERENDERBUFFERSPROC> createRenderbuffers;
+    EntryPointGL<PFNGLCREATESAMPLERSPROC> createSamplers;
+    EntryPointGL<PFNGLCREATETEXTURESPROC> createTextures;
+    EntryPointGL<PFNGLCREATETRANSFORMFEEDBACKSPROC> createTransformFeedbacks;
+    EntryPointGL<PFNGLCREATEVERTEXARRAYSPROC> createVertexArrays;
+    EntryPointGL<PFNGLDISABLEVERTEXARRAYATTRIBPROC> disableVertexArrayAttrib;
+    EntryPointGL<PFNGLENABLEVERTEXARRAYATTRIBPROC> enableVertexArrayAttrib;
+    EntryPointGL<PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC> flushMappedNamedBufferRange;
+    EntryPointGL<PFNGLGENERATETEXTUREMIPMAPPROC> generateTextureMipmap;
+    EntryPointGL<PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC> getCompressedTextureImage;
+    EntryPointGL<PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC> getCompressedTextureSubImage;
+    EntryPointGL<PFNGLGETGRAPHICSRESETSTATUSPROC> getGraphicsResetStatus;
+    EntryPointGL<PFNGLGETNAMEDBUFFERPARAMETERI64VPROC> getNamedBufferParameteri64v;
+    EntryPointGL<PFNGLGETNAMEDBUFFERPARAMETERIVPROC> getNamedBufferParameteriv;
+    EntryPointGL<PFNGLGETNAMEDBUFFERPOINTERVPROC> getNamedBufferPointerv;
+    EntryPointGL<PFNGLGETNAMEDBUFFERSUBDATAPROC> getNamedBufferSubData;
+    EntryPointGL<PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC>
+        getNamedFramebufferAttachmentParameteriv;
+    EntryPointGL<PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC> getNamedFramebufferParameteriv;
+    EntryPointGL<PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC> getNamedRenderbufferParameteriv;
+    EntryPointGL<PFNGLGETQUERYBUFFEROBJECTI64VPROC> getQueryBufferObjecti64v;
+    EntryPointGL<PFNGLGETQUERYBUFFEROBJECTIVPROC> getQueryBufferObjectiv;
+    EntryPointGL<PFNGLGETQUERYBUFFEROBJECTUI64VPROC> getQueryBufferObjectui64v;
+    EntryPointGL<PFNGLGETQUERYBUFFEROBJECTUIVPROC> getQueryBufferObjectuiv;
+    EntryPointGL<PFNGLGETTEXTUREIMAGEPROC> getTextureImage;
+    EntryPointGL<PFNGLGETTEXTURELEVELPARAMETERFVPROC> getTextureLevelParameterfv;
+    EntryPointGL<PFNGLGETTEXTURELEVELPARAMETERIVPROC> getTextureLevelParameteriv;
+    EntryPointGL<PFNGLGETTEXTUREPARAMETERIIVPROC> getTextureParameterIiv;
+    EntryPointGL<PFNGLGETTEXTUREPARAMETERIUIVPROC> getTextureParameterIuiv;
+    EntryPointGL<PFNGLGETTEXTUREPARAMETERFVPROC> getTextureParameterfv;
+    EntryPointGL<PFNGLGETTEXTUREPARAMETERIVPROC> getTextureParameteriv;
+    EntryPointGL<PFNGLGETTEXTURESUBIMAGEPROC> getTextureSubImage;
+    EntryPointGL<PFNGLGETTRANSFORMFEEDBACKI64_VPROC> getTransformFeedbacki64_v;
+    EntryPointGL<PFNGLGETTRANSFORMFEEDBACKI_VPROC> getTransformFeedbacki_v;
+    EntryPointGL<PFNGLGETTRANSFORMFEEDBACKIVPROC> getTransformFeedbackiv;
+    EntryPointGL<PFNGLGETVERTEXARRAYINDEXED64IVPROC> getVertexArrayIndexed64iv;
+    EntryPointGL<PFNGLGETVERTEXARRAYINDEXEDIVPROC> getVertexArrayIndexediv;
+    EntryPointGL<PFNGLGETVERTEXARRAYIVPROC> getVertexArrayiv;
+    EntryPointGL<PFNGLGETNCOMPRESSEDTEXIMAGEPROC> getnCompressedTexImage;
+    EntryPointGL<PFNGLGETNTEXIMAGEPROC> getnTexImage;
+    EntryPointGL<PFNGLGETNUNIFORMDVPROC> getnUniformdv;
+    EntryPointGL<PFNGLGETNUNIFORMFVPROC> getnUniformfv;
+    EntryPointGL<PFNGLGETNUNIFORMIVPROC> getnUniformiv;
+    EntryPointGL<PFNGLGETNUNIFORMUIVPROC> getnUniformuiv;
+    EntryPointGL<PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC> invalidateNamedFramebufferData;
+    EntryPointGL<PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC> invalidateNamedFramebufferSubData;
+    EntryPointGL<PFNGLMAPNAMEDBUFFERPROC> mapNamedBuffer;
+    EntryPointGL<PFNGLMAPNAMEDBUFFERRANGEPROC> mapNamedBufferRange;
+    EntryPointGL<PFNGLMEMORYBARRIERBYREGIONPROC> memoryBarrierByRegion;
+    EntryPointGL<PFNGLNAMEDBUFFERDATAPROC> namedBufferData;
+    EntryPointGL<PFNGLNAMEDBUFFERSTORAGEPROC> namedBufferStorage;
+    EntryPointGL<PFNGLNAMEDBUFFERSUBDATAPROC> namedBufferSubData;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC> namedFramebufferDrawBuffer;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC> namedFramebufferDrawBuffers;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC> namedFramebufferParameteri;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC> namedFramebufferReadBuffer;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC> namedFramebufferRenderbuffer;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERTEXTUREPROC> namedFramebufferTexture;
+    EntryPointGL<PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC> namedFramebufferTextureLayer;
+    EntryPointGL<PFNGLNAMEDRENDERBUFFERSTORAGEPROC> namedRenderbufferStorage;
+    EntryPointGL<PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC> namedRenderbufferStorageMultisample;
+    EntryPointGL<PFNGLREADNPIXELSPROC> readnPixels;
+    EntryPointGL<PFNGLTEXTUREBARRIERPROC> textureBarrier;
+    EntryPointGL<PFNGLTEXTUREBUFFERPROC> textureBuffer;
+    EntryPointGL<PFNGLTEXTUREBUFFERRANGEPROC> textureBufferRange;
+    EntryPointGL<PFNGLTEXTUREPARAMETERIIVPROC> textureParameterIiv;
+    EntryPointGL<PFNGLTEXTUREPARAMETERIUIVPROC> textureParameterIuiv;
+    EntryPointGL<PFNGLTEXTUREPARAMETERFPROC> textureParameterf;
+    EntryPointGL<PFNGLTEXTUREPARAMETERFVPROC> textureParameterfv;
+    EntryPointGL<PFNGLTEXTUREPARAMETERIPROC> textureParameteri;
+    EntryPointGL<PFNGLTEXTUREPARAMETERIVPROC> textureParameteriv;
+    EntryPointGL<PFNGLTEXTURESTORAGE1DPROC> textureStorage1D;
+    EntryPointGL<PFNGLTEXTURESTORAGE2DPROC> textureStorage2D;
+    EntryPointGL<PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC> textureStorage2DMultisample;
+    EntryPointGL<PFNGLTEXTURESTORAGE3DPROC> textureStorage3D;
+    EntryPointGL<PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC> textureStorage3DMultisample;
+    EntryPointGL<PFNGLTEXTURESUBIMAGE1DPROC> textureSubImage1D;
+    EntryPointGL<PFNGLTEXTURESUBIMAGE2DPROC> textureSubImage2D;
+    EntryPointGL<PFNGLTEXTURESUBIMAGE3DPROC> textureSubImage3D;
+    EntryPointGL<PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC> transformFeedbackBufferBase;
+    EntryPointGL<PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC> transformFeedbackBufferRange;
+    EntryPointGL<PFNGLUNMAPNAMEDBUFFERPROC> unmapNamedBuffer;
+    EntryPointGL<PFNGLVERTEXARRAYATTRIBBINDINGPROC> vertexArrayAttribBinding;
+    EntryPointGL<PFNGLVERTEXARRAYATTRIBFORMATPROC> vertexArrayAttribFormat;
+    EntryPointGL<PFNGLVERTEXARRAYATTRIBIFORMATPROC> vertexArrayAttribIFormat;
+    EntryPointGL<PFNGLVERTEXARRAYATTRIBLFORMATPROC> vertexArrayAttribLFormat;
+    EntryPointGL<PFNGLVERTEXARRAYBINDINGDIVISORPROC> vertexArrayBindingDivisor;
+    EntryPointGL<PFNGLVERTEXARRAYELEMENTBUFFERPROC> vertexArrayElementBuffer;
+    EntryPointGL<PFNGLVERTEXARRAYVERTEXBUFFERPROC> vertexArrayVertexBuffer;
+    EntryPointGL<PFNGLVERTEXARRAYVERTEXBUFFERSPROC> vertexArrayVertexBuffers;
 
     // ES 3.2
-    PFNGLBLENDBARRIERPROC blendBarrier;
-    PFNGLPRIMITIVEBOUNDINGBOXPROC primitiveBoundingBox;
+    EntryPointGL<PFNGLBLENDBARRIERPROC> blendBarrier;
+    EntryPointGL<PFNGLPRIMITIVEBOUNDINGBOXPROC> primitiveBoundingBox;
 
     // ES extensions
-    PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC eglImageTargetRenderbufferStorageOES;
-    PFNGLEGLIMAGETARGETTEXTURE2DOESPROC eglImageTargetTexture2DOES;
+    EntryPointGL<PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC>
+        eglImageTargetRenderbufferStorageOES;
+    EntryPointGL<PFNGLEGLIMAGETARGETTEXTURE2DOESPROC> eglImageTargetTexture2DOES;
 
   private:
+    template <typename PFN>
+    friend class EntryPointGL;
+
     void initializeProcsDesktopGL();
     void initializeProcsGLES();
 
+    // Only loads the entry point if all the whitespace separated extensions are supported.
+    template <typename PFN>
+    void assignExtensionEntryPoint(const char *requiredExtensionString,
+                                   const char *function,
+                                   EntryPointGL<PFN> *outFunction);
+
     virtual void *loadProcAddress(const std::string &function) = 0;
+
+    // Same contents as extensions, hasExtension is called many times during caps generation.
+    std::unordered_set<std::string> mExtensionSet;
 };
 
+template <typename PFN>
+void EntryPointGL<PFN>::resolve() const
+{
+    mFunction = reinterpret_cast<PFN>(mOwner->loadProcAddress(mName));
+    mName     = nullptr;
+}
+
 }
 
 #endif // LIBANGLE_RENDERER_GL_FUNCTIONSGL_H_
@@ -0,0 +1,61 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FunctionsGL_unittest:
+//   Tests of the lookup of the GL entry points.
+//
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+
+using namespace rx;
+
+namespace
+{
+
+std::vector<GLenum> gEnabled;
+
+void INTERNAL_GL_APIENTRY NativeEnable(GLenum cap)
+{
+    gEnabled.push_back(cap);
+}
+
+class LazyFunctionsGL : public FunctionsGL
+{
+  public:
+    std::vector<std::string> loaded;
+
+  private:
+    void *loadProcAddress(const std::string &function) override
+    {
+        loaded.push_back(function);
+        return function == "glEnable" ? reinterpret_cast<void *>(&NativeEnable) : nullptr;
+    }
+};
+
+// Entry points are looked up once, on their first use, and missing ones convert to null.
+TEST(FunctionsGLTest, LazyEntryPoints)
+{
+    gEnabled.clear();
+
+    LazyFunctionsGL functions;
+    functions.enable.setLazy(&functions, "glEnable");
+    functions.disable.setLazy(&functions, "glDisable");
+    EXPECT_TRUE(functions.loaded.empty());
+
+    functions.enable(GL_BLEND);
+    functions.enable(GL_DEPTH_TEST);
+    EXPECT_EQ(nullptr, functions.disable);
+    EXPECT_EQ(nullptr, functions.disable);
+
+    EXPECT_EQ(std::vector<std::string>({"glEnable", "glDisable"}), functions.loaded);
+    EXPECT_EQ(std::vector<GLenum>({GL_BLEND, GL_DEPTH_TEST}), gEnabled);
+}
+
+}  // anonymous namespace
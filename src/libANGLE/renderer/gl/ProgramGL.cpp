@@ -8,6 +8,9 @@
 
 #include "libANGLE/renderer/gl/ProgramGL.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/string_utils.h"
@@ -22,6 +25,14 @@
 namespace rx
 {
 
+namespace
+{
+
+// Shared by the programs of all the displays, which can be linked on several threads.
+std::atomic<unsigned int> sNextBindingPlanSerial(1);
+
+}  // anonymous namespace
+
 ProgramGL::ProgramGL(const gl::ProgramState &data,
                      const FunctionsGL *functions,
                      const WorkaroundsGL &workarounds,
@@ -37,6 +48,7 @@ ProgramGL::ProgramGL(const gl::ProgramState &data,
     ASSERT(mFunctions);
     ASSERT(mStateManager);
 
+    mBindingPlan.serial = 0;
     mProgramID = mFunctions->createProgram();
 }
 
@@ -208,7 +220,7 @@ void ProgramGL::setUniform1iv(GLint location, GLsizei count, const GLint *v)
         std::vector<GLuint> &boundTextureUnits = mSamplerBindings[samplerIndex].boundTextureUnits;
 
         size_t copyCount =
-            std::max<size_t>(count, boundTextureUnits.size() - locationEntry.element);
+            std::min<size_t>(count, boundTextureUnits.size() - locationEntry.element);
         std::copy(v, v + copyCount, boundTextureUnits.begin() + locationEntry.element);
     }
 }
@@ -335,9 +347,16 @@ GLuint ProgramGL::getProgramID() const
     return mProgramID;
 }
 
-const std::vector<SamplerBindingGL> &ProgramGL::getAppliedSamplerUniforms() const
+void ProgramGL::syncState(const gl::Program::DirtyBits &dirtyBits)
+{
+    // Both sampler and uniform block binding changes are folded into the same plan.
+    ASSERT(dirtyBits.any());
+    updateBindingPlan();
+}
+
+const ProgramBindingPlanGL &ProgramGL::getBindingPlan() const
 {
-    return mSamplerBindings;
+    return mBindingPlan;
 }
 
 bool ProgramGL::getUniformBlockSize(const std::string &blockName, size_t *sizeOut) const
@@ -413,6 +432,9 @@ void ProgramGL::preLink()
     mUniformBlockRealLocationMap.clear();
     mSamplerBindings.clear();
     mUniformIndexToSamplerIndex.clear();
+    mBindingPlan.textureUnits.clear();
+    mBindingPlan.samplerUnits.clear();
+    mBindingPlan.uniformBufferBindings.clear();
     mPathRenderingFragmentInputs.clear();
 }
 
@@ -504,6 +526,8 @@ void ProgramGL::postLink()
         mSamplerBindings.push_back(samplerBinding);
     }
 
+    updateBindingPlan();
+
     // Discover CHROMIUM_path_rendering fragment inputs if enabled.
     if (!mEnablePathRendering)
         return;
@@ -570,4 +594,48 @@ void ProgramGL::postLink()
     }
 }
 
+void ProgramGL::updateBindingPlan()
+{
+    mBindingPlan.textureUnits.clear();
+    mBindingPlan.samplerUnits.clear();
+    mBindingPlan.uniformBufferBindings.clear();
+
+    // Several sampler uniforms may reference the same unit; only bind each one once per draw.
+    for (const SamplerBindingGL &samplerBinding : mSamplerBindings)
+    {
+        for (GLuint textureUnit : samplerBinding.boundTextureUnits)
+        {
+            auto textureIt = std::find_if(
+                mBindingPlan.textureUnits.begin(), mBindingPlan.textureUnits.end(),
+                [&samplerBinding, textureUnit](const ProgramBindingPlanGL::TextureUnit &entry) {
+                    return entry.textureType == samplerBinding.textureType &&
+                           entry.unit == textureUnit;
+                });
+            if (textureIt == mBindingPlan.textureUnits.end())
+            {
+                mBindingPlan.textureUnits.push_back({samplerBinding.textureType, textureUnit});
+            }
+
+            if (std::find(mBindingPlan.samplerUnits.begin(), mBindingPlan.samplerUnits.end(),
+                          textureUnit) == mBindingPlan.samplerUnits.end())
+            {
+                mBindingPlan.samplerUnits.push_back(textureUnit);
+            }
+        }
+    }
+
+    for (size_t blockIndex = 0; blockIndex < mState.getUniformBlocks().size(); blockIndex++)
+    {
+        GLuint binding = mState.getUniformBlockBinding(static_cast<GLuint>(blockIndex));
+        if (std::find(mBindingPlan.uniformBufferBindings.begin(),
+                      mBindingPlan.uniformBufferBindings.end(),
+                      binding) == mBindingPlan.uniformBufferBindings.end())
+        {
+            mBindingPlan.uniformBufferBindings.push_back(binding);
+        }
+    }
+
+    mBindingPlan.serial = sNextBindingPlanSerial.fetch_add(1);
+}
+
 }  // namespace rx
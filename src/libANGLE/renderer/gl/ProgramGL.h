@@ -27,6 +27,23 @@ struct SamplerBindingGL
     std::vector<GLuint> boundTextureUnits;
 };
 
+// Flattened list of the resources a program reads at draw time. It is rebuilt whenever the
+// program's sampler uniforms or uniform block bindings change, and each rebuild gets a new serial
+// so the state manager can tell when it has already applied the current plan.
+struct ProgramBindingPlanGL
+{
+    struct TextureUnit
+    {
+        GLenum textureType;
+        GLuint unit;
+    };
+
+    std::vector<TextureUnit> textureUnits;
+    std::vector<GLuint> samplerUnits;
+    std::vector<GLuint> uniformBufferBindings;
+    unsigned int serial;
+};
+
 class ProgramGL : public ProgramImpl
 {
   public:
@@ -68,6 +85,8 @@ class ProgramGL : public ProgramImpl
 
     void setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding) override;
 
+    void syncState(const gl::Program::DirtyBits &dirtyBits) override;
+
     bool getUniformBlockSize(const std::string &blockName, size_t *sizeOut) const override;
     bool getUniformBlockMemberInfo(const std::string &memberUniformName,
                                    sh::BlockMemberInfo *memberInfoOut) const override;
@@ -78,12 +97,13 @@ class ProgramGL : public ProgramImpl
                                  const GLfloat *coeffs) override;
 
     GLuint getProgramID() const;
-    const std::vector<SamplerBindingGL> &getAppliedSamplerUniforms() const;
+    const ProgramBindingPlanGL &getBindingPlan() const;
 
   private:
     void preLink();
     bool checkLinkStatus(gl::InfoLog &infoLog);
     void postLink();
+    void updateBindingPlan();
 
     // Helper function, makes it simpler to type.
     GLint uniLoc(GLint glLocation) const { return mUniformRealLocationMap[glLocation]; }
@@ -101,6 +121,8 @@ class ProgramGL : public ProgramImpl
     // A map from a mData.getUniforms() index to a mSamplerBindings index.
     std::vector<size_t> mUniformIndexToSamplerIndex;
 
+    ProgramBindingPlanGL mBindingPlan;
+
     struct PathRenderingFragmentInput
     {
         std::string name;
@@ -10,11 +10,17 @@
 
 #include <EGL/eglext.h>
 
+#include <map>
+#include <mutex>
+#include <sstream>
+
 #include "common/debug.h"
+#include "common/version.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Path.h"
 #include "libANGLE/Surface.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/gl/BlitGL.h"
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/CompilerGL.h"
@@ -52,6 +58,52 @@ std::vector<GLuint> GatherPaths(const std::vector<gl::Path *> &paths)
     return ret;
 }
 
+// Everything generated from the native driver's caps, shared by all the renderers of the process
+// that run on the same driver so displays created repeatedly only query it once.
+struct NativeCapsSnapshot
+{
+    gl::Version maxSupportedESVersion;
+    gl::Caps caps;
+    gl::TextureCapsMap textureCaps;
+    gl::Extensions extensions;
+    gl::Limitations limitations;
+};
+
+typedef std::map<std::string, NativeCapsSnapshot> NativeCapsSnapshotMap;
+
+NativeCapsSnapshotMap &GetNativeCapsSnapshots()
+{
+    // Intentionally leaked, snapshots can be used until the process exits.
+    static NativeCapsSnapshotMap *snapshots = new NativeCapsSnapshotMap();
+    return *snapshots;
+}
+
+// Displays can be initialized on several threads at once.
+std::mutex &GetNativeCapsSnapshotsMutex()
+{
+    static std::mutex *snapshotsMutex = new std::mutex();
+    return *snapshotsMutex;
+}
+
+std::string GetNativeCapsSnapshotKey(const rx::FunctionsGL *functions)
+{
+    std::ostringstream key;
+    key << reinterpret_cast<const char *>(functions->getString(GL_VENDOR)) << "\n"
+        << reinterpret_cast<const char *>(functions->getString(GL_RENDERER)) << "\n"
+        << reinterpret_cast<const char *>(functions->getString(GL_VERSION)) << "\n"
+        << ANGLE_COMMIT_HASH << "\n";
+
+    // The same driver can expose different extensions depending on the context that was created.
+    uint64_t extensionsHash = functions->extensions.size();
+    for (const std::string &extension : functions->extensions)
+    {
+        extensionsHash = extensionsHash * 31 + ComputeFastHash64(extension.data(), extension.size());
+    }
+    key << functions->profile << "\n" << extensionsHash;
+
+    return key.str();
+}
+
 }  // namespace
 
 #ifndef NDEBUG
@@ -108,6 +160,7 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
       mBlitter(nullptr),
       mHasDebugOutput(false),
       mSkipDrawCalls(false),
+      mTrackClientArrays(false),
       mCapsInitialized(false)
 {
     ASSERT(mFunctions);
@@ -137,6 +190,9 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
     {
         mSkipDrawCalls = true;
     }
+
+    mTrackClientArrays =
+        (attribMap.get(EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE, EGL_FALSE) == EGL_TRUE);
 }
 
 RendererGL::~RendererGL()
@@ -515,6 +571,7 @@ void RendererGL::generateCaps(gl::Caps *outCaps, gl::TextureCapsMap* outTextureC
                               gl::Extensions *outExtensions,
                               gl::Limitations * /* outLimitations */) const
 {
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.RendererGLGenerateCapsMS");
     nativegl_gl::GenerateCaps(mFunctions, outCaps, outTextureCaps, outExtensions, &mMaxSupportedESVersion);
 }
 
@@ -535,7 +592,41 @@ void RendererGL::ensureCapsInitialized() const
 {
     if (!mCapsInitialized)
     {
+        NativeCapsSnapshotMap &snapshots = GetNativeCapsSnapshots();
+        const std::string key            = GetNativeCapsSnapshotKey(mFunctions);
+
+        {
+            std::lock_guard<std::mutex> lock(GetNativeCapsSnapshotsMutex());
+            auto snapshotIter = snapshots.find(key);
+            if (snapshotIter != snapshots.end())
+            {
+                const NativeCapsSnapshot &snapshot = snapshotIter->second;
+                mMaxSupportedESVersion             = snapshot.maxSupportedESVersion;
+                mNativeCaps                        = snapshot.caps;
+                mNativeTextureCaps                 = snapshot.textureCaps;
+                mNativeExtensions                  = snapshot.extensions;
+                mNativeLimitations                 = snapshot.limitations;
+                mCapsInitialized                   = true;
+                return;
+            }
+        }
+
+        // The driver is queried without the lock, so the other displays aren't blocked on it. When
+        // two displays race on the same driver, the first snapshot is kept.
         generateCaps(&mNativeCaps, &mNativeTextureCaps, &mNativeExtensions, &mNativeLimitations);
+
+        NativeCapsSnapshot snapshot;
+        snapshot.maxSupportedESVersion = mMaxSupportedESVersion;
+        snapshot.caps                  = mNativeCaps;
+        snapshot.textureCaps           = mNativeTextureCaps;
+        snapshot.extensions            = mNativeExtensions;
+        snapshot.limitations           = mNativeLimitations;
+
+        {
+            std::lock_guard<std::mutex> lock(GetNativeCapsSnapshotsMutex());
+            snapshots.insert(std::make_pair(key, std::move(snapshot)));
+        }
+
         mCapsInitialized = true;
     }
 }
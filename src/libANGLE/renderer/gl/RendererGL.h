@@ -159,6 +159,7 @@ class RendererGL : angle::NonCopyable
     StateManagerGL *getStateManager() const { return mStateManager; }
     const WorkaroundsGL &getWorkarounds() const { return mWorkarounds; }
     BlitGL *getBlitter() const { return mBlitter; }
+    bool isClientArrayTrackingEnabled() const { return mTrackClientArrays; }
 
     const gl::Caps &getNativeCaps() const;
     const gl::TextureCapsMap &getNativeTextureCaps() const;
@@ -186,6 +187,9 @@ class RendererGL : angle::NonCopyable
     // For performance debugging
     bool mSkipDrawCalls;
 
+    // Hash streamed client arrays and skip uploading the ones that did not change.
+    bool mTrackClientArrays;
+
     mutable bool mCapsInitialized;
     mutable gl::Caps mNativeCaps;
     mutable gl::TextureCapsMap mNativeTextureCaps;
@@ -24,7 +24,8 @@ class SamplerGL : public SamplerImpl
     SamplerGL(const FunctionsGL *functions, StateManagerGL *stateManager);
     ~SamplerGL() override;
 
-    void syncState(const gl::SamplerState &samplerState) const;
+    void syncState(const gl::SamplerState &samplerState,
+                   const gl::Sampler::DirtyBits &dirtyBits) override;
 
     GLuint getSamplerID() const;
 
@@ -32,7 +33,7 @@ class SamplerGL : public SamplerImpl
     const FunctionsGL *mFunctions;
     StateManagerGL *mStateManager;
 
-    mutable gl::SamplerState mAppliedSamplerState;
+    gl::SamplerState mAppliedSamplerState;
     GLuint mSamplerID;
 };
 }
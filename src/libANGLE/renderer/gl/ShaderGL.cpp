@@ -58,7 +58,9 @@ int ShaderGL::prepareSourceAndReturnOptions(std::stringstream *sourceStream,
     return options;
 }
 
-bool ShaderGL::postTranslateCompile(gl::Compiler *compiler, std::string *infoLog)
+bool ShaderGL::postTranslateCompile(gl::Compiler *compiler,
+                                    ShHandle compilerHandle,
+                                    std::string *infoLog)
 {
     // Translate the ESSL into GLSL
     const char *translatedSourceCString = mData.getTranslatedSource().c_str();
@@ -11,7 +11,6 @@
 #include <limits>
 #include <string.h>
 
-#include "common/BitSetIterator.h"
 #include "common/mathutil.h"
 #include "common/matrix_utils.h"
 #include "libANGLE/ContextState.h"
@@ -50,10 +49,13 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions, const gl::Caps &ren
       mTextureUnitIndex(0),
       mTextures(),
       mSamplers(rendererCaps.maxCombinedTextureImageUnits, 0),
+      mAppliedBindingPlanSerial(0),
+      mProgramResourcesDirty(true),
       mTransformFeedback(0),
       mQueries(),
       mPrevDrawTransformFeedback(nullptr),
       mCurrentQueries(),
+      mBuffersWithStagedUpdates(),
       mPrevDrawContext(0),
       mUnpackAlignment(4),
       mUnpackRowLength(0),
@@ -358,6 +360,7 @@ void StateManagerGL::bindBufferBase(GLenum type, size_t index, GLuint buffer)
         binding.offset = static_cast<size_t>(-1);
         binding.size = static_cast<size_t>(-1);
         mFunctions->bindBufferBase(type, static_cast<GLuint>(index), buffer);
+        mProgramResourcesDirty = true;
     }
 }
 
@@ -374,6 +377,7 @@ void StateManagerGL::bindBufferRange(GLenum type,
         binding.offset = offset;
         binding.size = size;
         mFunctions->bindBufferRange(type, static_cast<GLuint>(index), buffer, offset, size);
+        mProgramResourcesDirty = true;
     }
 }
 
@@ -392,6 +396,7 @@ void StateManagerGL::bindTexture(GLenum type, GLuint texture)
     {
         mTextures[type][mTextureUnitIndex] = texture;
         mFunctions->bindTexture(type, texture);
+        mProgramResourcesDirty = true;
     }
 }
 
@@ -401,6 +406,7 @@ void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
     {
         mSamplers[unit] = sampler;
         mFunctions->bindSampler(static_cast<GLuint>(unit), sampler);
+        mProgramResourcesDirty = true;
     }
 }
 
@@ -609,6 +615,25 @@ void StateManagerGL::onDeleteQueryObject(QueryGL *query)
     mCurrentQueries.erase(query);
 }
 
+void StateManagerGL::onStageBufferUpdates(BufferGL *buffer)
+{
+    mBuffersWithStagedUpdates.insert(buffer);
+}
+
+void StateManagerGL::onDeleteBufferObject(BufferGL *buffer)
+{
+    mBuffersWithStagedUpdates.erase(buffer);
+}
+
+void StateManagerGL::flushStagedBufferUpdates()
+{
+    for (BufferGL *buffer : mBuffersWithStagedUpdates)
+    {
+        buffer->flushStagedUpdates();
+    }
+    mBuffersWithStagedUpdates.clear();
+}
+
 gl::Error StateManagerGL::setDrawArraysState(const gl::ContextState &data,
                                              GLint first,
                                              GLsizei count,
@@ -689,6 +714,9 @@ gl::Error StateManagerGL::onMakeCurrent(const gl::ContextState &data)
     mPrevDrawTransformFeedback = nullptr;
     mPrevDrawContext           = data.getContext();
 
+    // The new context's resource bindings have not been applied yet.
+    mProgramResourcesDirty = true;
+
     // Set the current query state
     for (GLenum queryType : QueryTypes)
     {
@@ -714,68 +742,12 @@ gl::Error StateManagerGL::setGenericDrawState(const gl::ContextState &data)
     const ProgramGL *programGL = GetImplAs<ProgramGL>(program);
     useProgram(programGL->getProgramID());
 
-    for (size_t uniformBlockIndex = 0; uniformBlockIndex < program->getActiveUniformBlockCount();
-         uniformBlockIndex++)
+    // Resource bindings only need to be walked when the program's binding plan or any of the
+    // bindings it reads has changed since the last draw.
+    const ProgramBindingPlanGL &bindingPlan = programGL->getBindingPlan();
+    if (mProgramResourcesDirty || bindingPlan.serial != mAppliedBindingPlanSerial)
     {
-        GLuint binding = program->getUniformBlockBinding(static_cast<GLuint>(uniformBlockIndex));
-        const auto &uniformBuffer = state.getIndexedUniformBuffer(binding);
-
-        if (uniformBuffer.get() != nullptr)
-        {
-            BufferGL *bufferGL = GetImplAs<BufferGL>(uniformBuffer.get());
-
-            if (uniformBuffer.getSize() == 0)
-            {
-                bindBufferBase(GL_UNIFORM_BUFFER, binding, bufferGL->getBufferID());
-            }
-            else
-            {
-                bindBufferRange(GL_UNIFORM_BUFFER, binding, bufferGL->getBufferID(),
-                                uniformBuffer.getOffset(), uniformBuffer.getSize());
-            }
-        }
-    }
-
-    const std::vector<SamplerBindingGL> &appliedSamplerUniforms = programGL->getAppliedSamplerUniforms();
-    for (const SamplerBindingGL &samplerUniform : appliedSamplerUniforms)
-    {
-        GLenum textureType = samplerUniform.textureType;
-        for (GLuint textureUnitIndex : samplerUniform.boundTextureUnits)
-        {
-            const gl::Texture *texture = state.getSamplerTexture(textureUnitIndex, textureType);
-            if (texture != nullptr)
-            {
-                const TextureGL *textureGL = GetImplAs<TextureGL>(texture);
-
-                if (mTextures[textureType][textureUnitIndex] != textureGL->getTextureID())
-                {
-                    activeTexture(textureUnitIndex);
-                    bindTexture(textureType, textureGL->getTextureID());
-                }
-
-                textureGL->syncState(textureUnitIndex);
-            }
-            else
-            {
-                if (mTextures[textureType][textureUnitIndex] != 0)
-                {
-                    activeTexture(textureUnitIndex);
-                    bindTexture(textureType, 0);
-                }
-            }
-
-            const gl::Sampler *sampler = state.getSampler(textureUnitIndex);
-            if (sampler != nullptr)
-            {
-                const SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
-                samplerGL->syncState(sampler->getSamplerState());
-                bindSampler(textureUnitIndex, samplerGL->getSamplerID());
-            }
-            else
-            {
-                bindSampler(textureUnitIndex, 0);
-            }
-        }
+        setProgramResourceBindings(state, bindingPlan);
     }
 
     const gl::Framebuffer *framebuffer = state.getDrawFramebuffer();
@@ -807,6 +779,61 @@ gl::Error StateManagerGL::setGenericDrawState(const gl::ContextState &data)
     return gl::Error(GL_NO_ERROR);
 }
 
+void StateManagerGL::setProgramResourceBindings(const gl::State &state,
+                                                const ProgramBindingPlanGL &bindingPlan)
+{
+    for (GLuint binding : bindingPlan.uniformBufferBindings)
+    {
+        const auto &uniformBuffer = state.getIndexedUniformBuffer(binding);
+
+        if (uniformBuffer.get() != nullptr)
+        {
+            BufferGL *bufferGL = GetImplAs<BufferGL>(uniformBuffer.get());
+
+            if (uniformBuffer.getSize() == 0)
+            {
+                bindBufferBase(GL_UNIFORM_BUFFER, binding, bufferGL->getBufferID());
+            }
+            else
+            {
+                bindBufferRange(GL_UNIFORM_BUFFER, binding, bufferGL->getBufferID(),
+                                uniformBuffer.getOffset(), uniformBuffer.getSize());
+            }
+        }
+    }
+
+    for (const ProgramBindingPlanGL::TextureUnit &textureUnit : bindingPlan.textureUnits)
+    {
+        const gl::Texture *texture =
+            state.getSamplerTexture(textureUnit.unit, textureUnit.textureType);
+        GLuint textureID = (texture != nullptr) ? GetImplAs<TextureGL>(texture)->getTextureID() : 0;
+
+        if (mTextures[textureUnit.textureType][textureUnit.unit] != textureID)
+        {
+            activeTexture(textureUnit.unit);
+            bindTexture(textureUnit.textureType, textureID);
+        }
+    }
+
+    for (GLuint samplerUnit : bindingPlan.samplerUnits)
+    {
+        const gl::Sampler *sampler = state.getSampler(samplerUnit);
+        if (sampler != nullptr)
+        {
+            const SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
+            bindSampler(samplerUnit, samplerGL->getSamplerID());
+        }
+        else
+        {
+            bindSampler(samplerUnit, 0);
+        }
+    }
+
+    // The binds above only bring the native state in line with the plan.
+    mAppliedBindingPlanSerial = bindingPlan.serial;
+    mProgramResourcesDirty    = false;
+}
+
 void StateManagerGL::setAttributeCurrentData(size_t index,
                                              const gl::VertexAttribCurrentValueData &data)
 {
@@ -1316,6 +1343,10 @@ void StateManagerGL::setClearStencil(GLint clearStencil)
 
 void StateManagerGL::syncState(const gl::State &state, const gl::State::DirtyBits &glDirtyBits)
 {
+    // Draws, clears, blits, texture uploads and pixel reads all sync the state first and may use
+    // any buffer.
+    flushStagedBufferUpdates();
+
     const auto &glAndLocalDirtyBits = (glDirtyBits | mLocalDirtyBits);
 
     if (!glAndLocalDirtyBits.any())
@@ -1324,7 +1355,7 @@ void StateManagerGL::syncState(const gl::State &state, const gl::State::DirtyBit
     }
 
     // TODO(jmadill): Investigate only syncing vertex state for active attributes
-    for (auto dirtyBit : angle::IterateBitSet(glAndLocalDirtyBits))
+    for (auto dirtyBit : glAndLocalDirtyBits)
     {
         switch (dirtyBit)
         {
@@ -1536,6 +1567,11 @@ void StateManagerGL::syncState(const gl::State &state, const gl::State::DirtyBit
             case gl::State::DIRTY_BIT_PROGRAM_BINDING:
                 // TODO(jmadill): implement this
                 break;
+            case gl::State::DIRTY_BIT_TEXTURE_BINDINGS:
+            case gl::State::DIRTY_BIT_SAMPLER_BINDINGS:
+            case gl::State::DIRTY_BIT_UNIFORM_BUFFER_BINDINGS:
+                mProgramResourcesDirty = true;
+                break;
             case gl::State::DIRTY_BIT_MULTISAMPLING:
                 setMultisamplingStateEnabled(state.isMultisamplingEnabled());
                 break;
@@ -27,9 +27,11 @@ class State;
 namespace rx
 {
 
+class BufferGL;
 class FunctionsGL;
 class TransformFeedbackGL;
 class QueryGL;
+struct ProgramBindingPlanGL;
 
 class StateManagerGL final : angle::NonCopyable
 {
@@ -135,6 +137,12 @@ class StateManagerGL final : angle::NonCopyable
 
     void onDeleteQueryObject(QueryGL *query);
 
+    // Buffers with staged updates are flushed by syncState, before every operation that can
+    // access them.
+    void onStageBufferUpdates(BufferGL *buffer);
+    void onDeleteBufferObject(BufferGL *buffer);
+    void flushStagedBufferUpdates();
+
     gl::Error setDrawArraysState(const gl::ContextState &data,
                                  GLint first,
                                  GLsizei count,
@@ -155,6 +163,8 @@ class StateManagerGL final : angle::NonCopyable
 
   private:
     gl::Error setGenericDrawState(const gl::ContextState &data);
+    void setProgramResourceBindings(const gl::State &state,
+                                    const ProgramBindingPlanGL &bindingPlan);
 
     void setTextureCubemapSeamlessEnabled(bool enabled);
 
@@ -181,12 +191,19 @@ class StateManagerGL final : angle::NonCopyable
     std::map<GLenum, std::vector<GLuint>> mTextures;
     std::vector<GLuint> mSamplers;
 
+    // Serial of the last applied ProgramBindingPlanGL and whether any texture, sampler or uniform
+    // buffer binding it reads has changed since it was applied.
+    unsigned int mAppliedBindingPlanSerial;
+    bool mProgramResourcesDirty;
+
     GLuint mTransformFeedback;
 
     std::map<GLenum, GLuint> mQueries;
 
     TransformFeedbackGL *mPrevDrawTransformFeedback;
     std::set<QueryGL *> mCurrentQueries;
+
+    std::set<BufferGL *> mBuffersWithStagedUpdates;
     uintptr_t mPrevDrawContext;
 
     GLint mUnpackAlignment;
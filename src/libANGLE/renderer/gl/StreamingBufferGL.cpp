@@ -0,0 +1,283 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.cpp: Implements the class methods for StreamingBufferGL.
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include <limits>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+
+namespace
+{
+const size_t kInitialStreamingBufferSize = 1024 * 1024;
+const size_t kStreamingBufferAlignment   = 16;
+
+// clientWaitSync is called repeatedly with this timeout until the fence is signaled.
+const GLuint64 kFenceWaitTimeout = 1000000000ull;
+}  // anonymous namespace
+
+StreamingBufferGL::StreamingBufferGL(const FunctionsGL *functions,
+                                     StateManagerGL *stateManager,
+                                     GLenum target)
+    : mFunctions(functions),
+      mStateManager(stateManager),
+      mTarget(target),
+      mBufferID(0),
+      mCapacity(0),
+      mHead(0),
+      mUnfencedStart(0),
+      mUseFences(false),
+      mUsePersistentMapping(false),
+      mPersistentPointer(nullptr),
+      mGeneration(0)
+{
+    ASSERT(mFunctions);
+    ASSERT(mStateManager);
+
+    mUseFences = mFunctions->fenceSync != nullptr && mFunctions->clientWaitSync != nullptr &&
+                 mFunctions->mapBufferRange != nullptr;
+    mUsePersistentMapping = mUseFences && mFunctions->bufferStorage != nullptr;
+}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    release();
+}
+
+gl::Error StreamingBufferGL::map(size_t size, uint8_t **ptrOut, size_t *offsetOut)
+{
+    ASSERT(size > 0);
+
+    if (size > mCapacity)
+    {
+        release();
+        gl::Error error = allocate(size);
+        if (error.isError())
+        {
+            return error;
+        }
+        ASSERT(mCapacity >= size);
+    }
+
+    mStateManager->bindBuffer(mTarget, mBufferID);
+
+    // Everything written so far has been consumed by draws issued before this point.
+    fenceWrittenRegion();
+
+    size_t offset = roundUp(mHead, kStreamingBufferAlignment);
+    if (offset + size > mCapacity)
+    {
+        offset = 0;
+        mGeneration++;
+
+        if (!mUseFences)
+        {
+            // Orphan the storage so the driver hands back fresh memory without waiting.
+            mFunctions->bufferData(mTarget, mCapacity, nullptr, GL_STREAM_DRAW);
+        }
+    }
+
+    if (mUseFences)
+    {
+        gl::Error error = waitForRegion(offset, offset + size);
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    if (mUsePersistentMapping)
+    {
+        *ptrOut = mPersistentPointer + offset;
+    }
+    else if (mFunctions->mapBufferRange != nullptr)
+    {
+        *ptrOut = reinterpret_cast<uint8_t *>(mFunctions->mapBufferRange(
+            mTarget, offset, size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+    }
+    else
+    {
+        *ptrOut = MapBufferRangeWithFallback(mFunctions, mTarget, offset, size, GL_MAP_WRITE_BIT);
+    }
+
+    if (*ptrOut == nullptr)
+    {
+        return gl::Error(GL_OUT_OF_MEMORY, "Failed to map the client data streaming buffer.");
+    }
+
+    mUnfencedStart = offset;
+    mHead          = offset + size;
+    *offsetOut     = offset;
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+bool StreamingBufferGL::unmap()
+{
+    if (mUsePersistentMapping)
+    {
+        // The mapping is coherent, writes are visible to the next commands.
+        return true;
+    }
+
+    mStateManager->bindBuffer(mTarget, mBufferID);
+    if (mFunctions->unmapBuffer(mTarget) != GL_TRUE)
+    {
+        // The contents of the whole buffer are undefined now, start over at a new generation.
+        mGeneration++;
+        return false;
+    }
+
+    return true;
+}
+
+void StreamingBufferGL::retainRegion(size_t offset)
+{
+    ASSERT(offset < mHead);
+    if (!mUseFences || offset >= mUnfencedStart)
+    {
+        return;
+    }
+
+    // Regions of the current generation are at the back of the queue, those of the previous one
+    // all start after mHead. Drop the fences of the ones being read again, the fence inserted by
+    // the next call to map covers them instead.
+    while (!mPendingRegions.empty() && mPendingRegions.back().start >= offset &&
+           mPendingRegions.back().start < mUnfencedStart)
+    {
+        mFunctions->deleteSync(mPendingRegions.back().fence);
+        mPendingRegions.pop_back();
+    }
+
+    mUnfencedStart = offset;
+}
+
+gl::Error StreamingBufferGL::allocate(size_t minimumSize)
+{
+    ASSERT(mBufferID == 0);
+
+    // Grow in powers of two, stopping before the size overflows or no longer fits a GLsizeiptr.
+    const size_t maxCapacity = static_cast<size_t>(std::numeric_limits<GLsizeiptr>::max());
+    size_t capacity          = kInitialStreamingBufferSize;
+    while (capacity < minimumSize)
+    {
+        if (capacity > maxCapacity / 2)
+        {
+            return gl::Error(GL_OUT_OF_MEMORY,
+                             "Client data is too large for the client data streaming buffer.");
+        }
+        capacity *= 2;
+    }
+
+    mCapacity      = capacity;
+    mHead          = 0;
+    mUnfencedStart = 0;
+    mGeneration++;
+
+    mFunctions->genBuffers(1, &mBufferID);
+    mStateManager->bindBuffer(mTarget, mBufferID);
+
+    if (mUsePersistentMapping)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        mFunctions->bufferStorage(mTarget, mCapacity, nullptr, flags);
+        mPersistentPointer = reinterpret_cast<uint8_t *>(
+            mFunctions->mapBufferRange(mTarget, 0, mCapacity, flags));
+        if (mPersistentPointer == nullptr)
+        {
+            // Fall back to mapping each region separately, the storage is still mappable.
+            mUsePersistentMapping = false;
+        }
+    }
+    else
+    {
+        mFunctions->bufferData(mTarget, mCapacity, nullptr, GL_STREAM_DRAW);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+void StreamingBufferGL::release()
+{
+    // The old storage stays alive in the driver for as long as pending draws reference it.
+    for (const PendingRegion &region : mPendingRegions)
+    {
+        mFunctions->deleteSync(region.fence);
+    }
+    mPendingRegions.clear();
+
+    if (mBufferID != 0)
+    {
+        mStateManager->deleteBuffer(mBufferID);
+        mBufferID = 0;
+    }
+
+    mPersistentPointer = nullptr;
+    mCapacity          = 0;
+}
+
+void StreamingBufferGL::fenceWrittenRegion()
+{
+    if (!mUseFences || mHead == mUnfencedStart)
+    {
+        return;
+    }
+
+    // map() fences the previous region before handing out a new one, so the unfenced data is
+    // always a single contiguous range.
+    ASSERT(mUnfencedStart < mHead);
+    GLsync fence = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (fence != 0)
+    {
+        mPendingRegions.push_back({mUnfencedStart, mHead, fence});
+    }
+
+    mUnfencedStart = mHead;
+}
+
+gl::Error StreamingBufferGL::waitForRegion(size_t start, size_t end)
+{
+    // Pending regions are ordered the same way they are laid out in the ring, so only the oldest
+    // ones can overlap the range about to be written.
+    while (!mPendingRegions.empty())
+    {
+        const PendingRegion &oldest = mPendingRegions.front();
+        if (oldest.end <= start || oldest.start >= end)
+        {
+            break;
+        }
+
+        GLenum result = GL_TIMEOUT_EXPIRED;
+        while (result == GL_TIMEOUT_EXPIRED)
+        {
+            result = mFunctions->clientWaitSync(oldest.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                kFenceWaitTimeout);
+        }
+
+        mFunctions->deleteSync(oldest.fence);
+        mPendingRegions.pop_front();
+
+        if (result == GL_WAIT_FAILED)
+        {
+            return gl::Error(GL_OUT_OF_MEMORY,
+                             "Failed to wait for the client data streaming buffer.");
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+}  // namespace rx
@@ -0,0 +1,90 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.h: Defines the class interface for StreamingBufferGL, a ring buffer used to
+// upload client-side data without synchronizing with the GPU.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <deque>
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/gl/functionsgl_typedefs.h"
+
+namespace rx
+{
+
+class FunctionsGL;
+class StateManagerGL;
+
+// Data is written sequentially into a large buffer and wraps around once the end is reached.
+// Regions handed out earlier are protected by fences so they are only overwritten once the GPU
+// has finished reading them. When GL_ARB_buffer_storage is available the buffer stays
+// persistently mapped, otherwise each region is mapped with GL_MAP_UNSYNCHRONIZED_BIT. Without
+// sync objects the buffer is orphaned on every wrap instead.
+class StreamingBufferGL final : angle::NonCopyable
+{
+  public:
+    StreamingBufferGL(const FunctionsGL *functions, StateManagerGL *stateManager, GLenum target);
+    ~StreamingBufferGL();
+
+    // Reserves size bytes and returns a pointer to write them to along with their offset in the
+    // buffer. The buffer is left bound to the target. Anything returned by previous calls may be
+    // overwritten from now on once the GPU is done with it.
+    gl::Error map(size_t size, uint8_t **ptrOut, size_t *offsetOut);
+
+    // Returns false if the data written since map was lost and has to be written again.
+    bool unmap();
+
+    // Keeps the data written from offset onwards in the current generation from being overwritten
+    // until the commands issued after this call have completed. Used when earlier data is read
+    // again by a new draw.
+    void retainRegion(size_t offset);
+
+    GLuint getBufferID() const { return mBufferID; }
+
+    // Incremented every time the buffer is reallocated or wraps around. Offsets returned while the
+    // generation is unchanged are guaranteed not to have been reused.
+    unsigned int getGeneration() const { return mGeneration; }
+
+  private:
+    gl::Error allocate(size_t minimumSize);
+    void release();
+
+    void fenceWrittenRegion();
+    gl::Error waitForRegion(size_t start, size_t end);
+
+    const FunctionsGL *mFunctions;
+    StateManagerGL *mStateManager;
+    GLenum mTarget;
+
+    GLuint mBufferID;
+    size_t mCapacity;
+    size_t mHead;
+
+    // Start of the data written since the last fence was inserted.
+    size_t mUnfencedStart;
+
+    bool mUseFences;
+    bool mUsePersistentMapping;
+    uint8_t *mPersistentPointer;
+
+    struct PendingRegion
+    {
+        size_t start;
+        size_t end;
+        GLsync fence;
+    };
+    std::deque<PendingRegion> mPendingRegions;
+
+    unsigned int mGeneration;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
@@ -188,6 +188,7 @@ void TextureGL::setImageHelper(GLenum target,
     }
 
     mLevelInfo[level] = GetLevelInfo(internalFormat, texImageFormat.internalFormat);
+    syncSwizzleState();
 }
 
 void TextureGL::reserveTexImageToBeFilled(GLenum target,
@@ -333,6 +334,7 @@ gl::Error TextureGL::setCompressedImage(GLenum target, size_t level, GLenum inte
 
     mLevelInfo[level] = GetLevelInfo(internalFormat, compressedTexImageFormat.internalFormat);
     ASSERT(!mLevelInfo[level].lumaWorkaround.enabled);
+    syncSwizzleState();
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -409,6 +411,7 @@ gl::Error TextureGL::copyImage(GLenum target, size_t level, const gl::Rectangle
     }
 
     mLevelInfo[level] = levelInfo;
+    syncSwizzleState();
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -596,6 +599,7 @@ gl::Error TextureGL::setStorage(GLenum target, size_t levels, GLenum internalFor
     {
         mLevelInfo[level] = levelInfo;
     }
+    syncSwizzleState();
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -610,8 +614,7 @@ gl::Error TextureGL::setImageExternal(GLenum target,
 
 gl::Error TextureGL::generateMipmap()
 {
-    // Need to sync base level and max level to driver before calling GenerateMipmap.
-    syncState(0);
+    // gl::Texture syncs the base level and max level to the driver before calling this.
     mStateManager->bindTexture(mState.mTarget, mTextureID);
     mFunctions->generateMipmap(mState.mTarget);
 
@@ -636,6 +639,7 @@ void TextureGL::bindTexImage(egl::Surface *surface)
     mStateManager->bindTexture(mState.mTarget, mTextureID);
 
     mLevelInfo[0] = LevelInfoGL();
+    syncSwizzleState();
 }
 
 void TextureGL::releaseTexImage()
@@ -820,7 +824,7 @@ static inline void SyncTextureStateSwizzle(const FunctionsGL *functions,
     }
 }
 
-void TextureGL::syncState(size_t textureUnit) const
+void TextureGL::syncState(const gl::Texture::DirtyBits &dirtyBits)
 {
     // Callback lamdba to bind this texture only if needed.
     bool textureApplied   = false;
@@ -828,29 +832,87 @@ void TextureGL::syncState(size_t textureUnit) const
     {
         if (!textureApplied)
         {
-            mStateManager->activeTexture(textureUnit);
             mStateManager->bindTexture(mState.mTarget, mTextureID);
             textureApplied = true;
         }
     };
 
-    // Sync texture state
-    // Apply the effective base level and max level instead of the base level and max level set from
-    // the API. This can help with buggy drivers.
-    if (mAppliedTextureState.getEffectiveBaseLevel() != mState.getEffectiveBaseLevel())
+    bool swizzleDirty = false;
+    for (auto dirtyBit : dirtyBits)
     {
-        applyTextureFunc();
-        mFunctions->texParameteri(mState.mTarget, GL_TEXTURE_BASE_LEVEL,
-                                  mState.getEffectiveBaseLevel());
+        switch (dirtyBit)
+        {
+            // clang-format off
+            case gl::Texture::DIRTY_BIT_MIN_FILTER:     SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MIN_FILTER, &gl::SamplerState::minFilter); break;
+            case gl::Texture::DIRTY_BIT_MAG_FILTER:     SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MAG_FILTER, &gl::SamplerState::magFilter); break;
+            case gl::Texture::DIRTY_BIT_WRAP_S:         SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_WRAP_S, &gl::SamplerState::wrapS); break;
+            case gl::Texture::DIRTY_BIT_WRAP_T:         SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_WRAP_T, &gl::SamplerState::wrapT); break;
+            case gl::Texture::DIRTY_BIT_WRAP_R:         SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_WRAP_R, &gl::SamplerState::wrapR); break;
+            case gl::Texture::DIRTY_BIT_MAX_ANISOTROPY: SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MAX_ANISOTROPY_EXT, &gl::SamplerState::maxAnisotropy); break;
+            case gl::Texture::DIRTY_BIT_MIN_LOD:        SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MIN_LOD, &gl::SamplerState::minLod); break;
+            case gl::Texture::DIRTY_BIT_MAX_LOD:        SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MAX_LOD, &gl::SamplerState::maxLod); break;
+            case gl::Texture::DIRTY_BIT_COMPARE_MODE:   SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_COMPARE_MODE, &gl::SamplerState::compareMode); break;
+            case gl::Texture::DIRTY_BIT_COMPARE_FUNC:   SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_COMPARE_FUNC, &gl::SamplerState::compareFunc); break;
+            // clang-format on
+
+            case gl::Texture::DIRTY_BIT_SWIZZLE_RED:
+            case gl::Texture::DIRTY_BIT_SWIZZLE_GREEN:
+            case gl::Texture::DIRTY_BIT_SWIZZLE_BLUE:
+            case gl::Texture::DIRTY_BIT_SWIZZLE_ALPHA:
+                swizzleDirty = true;
+                break;
+
+            // Apply the effective base level and max level instead of the base level and max
+            // level set from the API. This can help with buggy drivers.
+            case gl::Texture::DIRTY_BIT_BASE_LEVEL:
+                if (mAppliedTextureState.mBaseLevel != mState.getEffectiveBaseLevel())
+                {
+                    applyTextureFunc();
+                    mAppliedTextureState.mBaseLevel = mState.getEffectiveBaseLevel();
+                    mFunctions->texParameteri(mState.mTarget, GL_TEXTURE_BASE_LEVEL,
+                                              mAppliedTextureState.mBaseLevel);
+                }
+                // The swizzle workarounds depend on the format of the base level.
+                swizzleDirty = true;
+                break;
+            case gl::Texture::DIRTY_BIT_MAX_LEVEL:
+                if (mAppliedTextureState.mMaxLevel != mState.getEffectiveMaxLevel())
+                {
+                    applyTextureFunc();
+                    mAppliedTextureState.mMaxLevel = mState.getEffectiveMaxLevel();
+                    mFunctions->texParameteri(mState.mTarget, GL_TEXTURE_MAX_LEVEL,
+                                              mAppliedTextureState.mMaxLevel);
+                }
+                break;
+
+            case gl::Texture::DIRTY_BIT_USAGE:
+                // Usage is only a hint and has no native equivalent.
+                break;
+
+            default:
+                UNREACHABLE();
+                break;
+        }
     }
-    mAppliedTextureState.mBaseLevel = mState.mBaseLevel;
-    if (mAppliedTextureState.getEffectiveMaxLevel() != mState.getEffectiveMaxLevel())
+
+    if (swizzleDirty)
     {
-        applyTextureFunc();
-        mFunctions->texParameteri(mState.mTarget, GL_TEXTURE_MAX_LEVEL,
-                                  mState.getEffectiveMaxLevel());
+        syncSwizzleState();
     }
-    mAppliedTextureState.mMaxLevel = mState.mMaxLevel;
+}
+
+void TextureGL::syncSwizzleState()
+{
+    // Callback lamdba to bind this texture only if needed.
+    bool textureApplied   = false;
+    auto applyTextureFunc = [&]()
+    {
+        if (!textureApplied)
+        {
+            mStateManager->bindTexture(mState.mTarget, mTextureID);
+            textureApplied = true;
+        }
+    };
 
     // clang-format off
     const LevelInfoGL &levelInfo = mLevelInfo[mState.getEffectiveBaseLevel()];
@@ -858,18 +920,6 @@ void TextureGL::syncState(size_t textureUnit) const
     SyncTextureStateSwizzle(mFunctions, applyTextureFunc, levelInfo, mState.mSwizzleState, mAppliedTextureState.mSwizzleState, mState.mTarget, GL_TEXTURE_SWIZZLE_G, &gl::SwizzleState::swizzleGreen);
     SyncTextureStateSwizzle(mFunctions, applyTextureFunc, levelInfo, mState.mSwizzleState, mAppliedTextureState.mSwizzleState, mState.mTarget, GL_TEXTURE_SWIZZLE_B, &gl::SwizzleState::swizzleBlue);
     SyncTextureStateSwizzle(mFunctions, applyTextureFunc, levelInfo, mState.mSwizzleState, mAppliedTextureState.mSwizzleState, mState.mTarget, GL_TEXTURE_SWIZZLE_A, &gl::SwizzleState::swizzleAlpha);
-
-    // Sync sampler state
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MIN_FILTER, &gl::SamplerState::minFilter);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MAG_FILTER, &gl::SamplerState::magFilter);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_WRAP_S, &gl::SamplerState::wrapS);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_WRAP_T, &gl::SamplerState::wrapT);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_WRAP_R, &gl::SamplerState::wrapR);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MAX_ANISOTROPY_EXT, &gl::SamplerState::maxAnisotropy);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MIN_LOD, &gl::SamplerState::minLod);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_MAX_LOD, &gl::SamplerState::maxLod);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_COMPARE_MODE, &gl::SamplerState::compareMode);
-    SyncSamplerStateMember(mFunctions, applyTextureFunc, mState.mSamplerState, mAppliedTextureState.mSamplerState, mState.mTarget, GL_TEXTURE_COMPARE_FUNC, &gl::SamplerState::compareFunc);
     // clang-format on
 }
 
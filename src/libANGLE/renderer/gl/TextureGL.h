@@ -87,7 +87,7 @@ class TextureGL : public TextureImpl
 
     gl::Error setEGLImageTarget(GLenum target, egl::Image *image) override;
 
-    void syncState(size_t textureUnit) const;
+    void syncState(const gl::Texture::DirtyBits &dirtyBits) override;
     GLuint getTextureID() const;
 
     gl::Error getAttachmentRenderTarget(const gl::FramebufferAttachment::Target &target,
@@ -120,6 +120,10 @@ class TextureGL : public TextureImpl
                                             const gl::PixelUnpackState &unpack,
                                             const uint8_t *pixels);
 
+    // Re-evaluates the swizzle, which the LUMA and depth-stencil workarounds rewrite based on the
+    // format of the base level.
+    void syncSwizzleState();
+
     const FunctionsGL *mFunctions;
     const WorkaroundsGL &mWorkarounds;
     StateManagerGL *mStateManager;
@@ -127,7 +131,7 @@ class TextureGL : public TextureImpl
 
     std::vector<LevelInfoGL> mLevelInfo;
 
-    mutable gl::TextureState mAppliedTextureState;
+    gl::TextureState mAppliedTextureState;
     GLuint mTextureID;
 };
 
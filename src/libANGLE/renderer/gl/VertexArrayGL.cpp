@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
 
+#include <limits>
+
 #include "common/BitSetIterator.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -19,6 +21,8 @@
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+#include "third_party/trace_event/trace_event.h"
 
 using namespace gl;
 
@@ -31,11 +35,33 @@ bool AttributeNeedsStreaming(const VertexAttribute &attribute)
     return (attribute.enabled && attribute.buffer.get() == nullptr);
 }
 
+void ApplyStreamedAttributePointer(const FunctionsGL *functions,
+                                   size_t attribIndex,
+                                   const VertexAttribute &attrib,
+                                   size_t destStride,
+                                   size_t vertexStartOffset)
+{
+    if (attrib.pureInteger)
+    {
+        ASSERT(!attrib.normalized);
+        functions->vertexAttribIPointer(static_cast<GLuint>(attribIndex), attrib.size, attrib.type,
+                                        static_cast<GLsizei>(destStride),
+                                        reinterpret_cast<const GLvoid *>(vertexStartOffset));
+    }
+    else
+    {
+        functions->vertexAttribPointer(static_cast<GLuint>(attribIndex), attrib.size, attrib.type,
+                                       attrib.normalized, static_cast<GLsizei>(destStride),
+                                       reinterpret_cast<const GLvoid *>(vertexStartOffset));
+    }
+}
+
 }  // anonymous namespace
 
 VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
                              const FunctionsGL *functions,
-                             StateManagerGL *stateManager)
+                             StateManagerGL *stateManager,
+                             bool trackClientArrays)
     : VertexArrayImpl(state),
       mFunctions(functions),
       mStateManager(stateManager),
@@ -43,8 +69,10 @@ VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
       mAppliedElementArrayBuffer(),
       mStreamingElementArrayBufferSize(0),
       mStreamingElementArrayBuffer(0),
-      mStreamingArrayBufferSize(0),
-      mStreamingArrayBuffer(0)
+      mStreamingArrayBuffer(nullptr),
+      mTrackClientArrays(trackClientArrays),
+      mStreamedBytesUploaded(0),
+      mStreamedBytesSkipped(0)
 {
     ASSERT(mFunctions);
     ASSERT(mStateManager);
@@ -54,6 +82,24 @@ VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
     GLint maxVertexAttribs = 0;
     mFunctions->getIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxVertexAttribs);
     mAppliedAttributes.resize(maxVertexAttribs);
+
+    if (mTrackClientArrays)
+    {
+        mStreamedAttributes.resize(gl::MAX_VERTEX_ATTRIBS);
+    }
+}
+
+VertexArrayGL::StreamedAttribute::StreamedAttribute()
+    : pointer(nullptr),
+      sourceStride(0),
+      destStride(0),
+      start(0),
+      vertexCount(0),
+      hash(0),
+      vertexStartOffset(0),
+      generation(0),
+      valid(false)
+{
 }
 
 VertexArrayGL::~VertexArrayGL()
@@ -65,9 +111,7 @@ VertexArrayGL::~VertexArrayGL()
     mStreamingElementArrayBufferSize = 0;
     mStreamingElementArrayBuffer = 0;
 
-    mStateManager->deleteBuffer(mStreamingArrayBuffer);
-    mStreamingArrayBufferSize = 0;
-    mStreamingArrayBuffer = 0;
+    SafeDelete(mStreamingArrayBuffer);
 
     mAppliedElementArrayBuffer.set(nullptr);
     for (size_t idx = 0; idx < mAppliedAttributes.size(); idx++)
@@ -221,7 +265,7 @@ Error VertexArrayGL::syncIndexData(GLsizei count,
     return Error(GL_NO_ERROR);
 }
 
-void VertexArrayGL::computeStreamingAttributeSizes(const gl::AttributesMask &activeAttributesMask,
+void VertexArrayGL::computeStreamingAttributeSizes(const gl::AttributesMask &attributesToStream,
                                                    GLsizei instanceCount,
                                                    const gl::IndexRange &indexRange,
                                                    size_t *outStreamingDataSize,
@@ -233,7 +277,7 @@ void VertexArrayGL::computeStreamingAttributeSizes(const gl::AttributesMask &act
     ASSERT(mAttributesNeedStreaming.any());
 
     const auto &attribs = mData.getVertexAttributes();
-    for (auto idx : angle::IterateBitSet(mAttributesNeedStreaming & activeAttributesMask))
+    for (auto idx : angle::IterateBitSet(attributesToStream))
     {
         const auto &attrib = attribs[idx];
         ASSERT(AttributeNeedsStreaming(attrib));
@@ -248,15 +292,58 @@ void VertexArrayGL::computeStreamingAttributeSizes(const gl::AttributesMask &act
     }
 }
 
+gl::AttributesMask VertexArrayGL::findReusableStreamedAttributes(
+    const gl::AttributesMask &streamedAttributes,
+    GLsizei instanceCount,
+    const gl::IndexRange &indexRange,
+    uint64_t *outHashes) const
+{
+    ASSERT(mTrackClientArrays);
+
+    gl::AttributesMask reusableAttributes;
+    const unsigned int generation = mStreamingArrayBuffer->getGeneration();
+
+    const auto &attribs = mData.getVertexAttributes();
+    for (auto idx : angle::IterateBitSet(streamedAttributes))
+    {
+        const auto &attrib = attribs[idx];
+
+        const size_t streamedVertexCount =
+            ComputeVertexAttributeElementCount(attrib, indexRange.vertexCount(), instanceCount);
+        const size_t sourceStride = ComputeVertexAttributeStride(attrib);
+        const size_t destStride   = ComputeVertexAttributeTypeSize(attrib);
+
+        // Only the elements read by this draw are hashed, and not the bytes between them, so that
+        // changing another attribute of an interleaved array does not force a new upload.
+        const uint8_t *inputPointer =
+            reinterpret_cast<const uint8_t *>(attrib.pointer) + sourceStride * indexRange.start;
+        outHashes[idx] =
+            ComputeFastHash64Strided(inputPointer, destStride, sourceStride, streamedVertexCount);
+
+        const StreamedAttribute &previous = mStreamedAttributes[idx];
+        if (previous.valid && previous.generation == generation &&
+            previous.pointer == attrib.pointer && previous.sourceStride == sourceStride &&
+            previous.destStride == destStride && previous.start == indexRange.start &&
+            previous.vertexCount == streamedVertexCount && previous.hash == outHashes[idx])
+        {
+            reusableAttributes.set(idx);
+        }
+    }
+
+    return reusableAttributes;
+}
+
 gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttributesMask,
                                           GLsizei instanceCount,
                                           const gl::IndexRange &indexRange) const
 {
+    const gl::AttributesMask streamedAttributes = mAttributesNeedStreaming & activeAttributesMask;
+
     // Sync the vertex attribute state and track what data needs to be streamed
     size_t streamingDataSize    = 0;
     size_t maxAttributeDataSize = 0;
 
-    computeStreamingAttributeSizes(activeAttributesMask, instanceCount, indexRange,
+    computeStreamingAttributeSizes(streamedAttributes, instanceCount, indexRange,
                                    &streamingDataSize, &maxAttributeDataSize);
 
     if (streamingDataSize == 0)
@@ -264,37 +351,70 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
         return gl::Error(GL_NO_ERROR);
     }
 
-    if (mStreamingArrayBuffer == 0)
+    if (mStreamingArrayBuffer == nullptr)
     {
-        mFunctions->genBuffers(1, &mStreamingArrayBuffer);
-        mStreamingArrayBufferSize = 0;
+        mStreamingArrayBuffer = new StreamingBufferGL(mFunctions, mStateManager, GL_ARRAY_BUFFER);
     }
 
-    // If first is greater than zero, a slack space needs to be left at the beginning of the buffer so that
-    // the same 'first' argument can be passed into the draw call.
-    const size_t bufferEmptySpace = maxAttributeDataSize * indexRange.start;
-    const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
-
-    mStateManager->bindBuffer(GL_ARRAY_BUFFER, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
+    gl::AttributesMask reusedAttributes;
+    uint64_t attributeHashes[gl::MAX_VERTEX_ATTRIBS] = {};
+    if (mTrackClientArrays)
     {
-        mFunctions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr, GL_DYNAMIC_DRAW);
-        mStreamingArrayBufferSize = requiredBufferSize;
+        reusedAttributes = findReusableStreamedAttributes(streamedAttributes, instanceCount,
+                                                          indexRange, attributeHashes);
     }
+    const unsigned int initialGeneration = mStreamingArrayBuffer->getGeneration();
 
     // Unmapping a buffer can return GL_FALSE to indicate that the system has corrupted the data
     // somehow (such as by a screen change), retry writing the data a few times and return OUT_OF_MEMORY
     // if that fails.
-    GLboolean unmapResult = GL_FALSE;
+    bool unmapResult = false;
     size_t unmapRetryAttempts = 5;
-    while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
+    size_t uploadedBytes      = 0;
+    while (!unmapResult && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = MapBufferRangeWithFallback(mFunctions, GL_ARRAY_BUFFER, 0,
-                                                            requiredBufferSize, GL_MAP_WRITE_BIT);
+        const gl::AttributesMask uploadedAttributes = streamedAttributes & ~reusedAttributes;
+        uploadedBytes                               = 0;
+
+        if (uploadedAttributes.none())
+        {
+            // Everything this draw reads is already in the ring buffer.
+            mStateManager->bindBuffer(GL_ARRAY_BUFFER, mStreamingArrayBuffer->getBufferID());
+            unmapResult = true;
+            break;
+        }
+
+        computeStreamingAttributeSizes(uploadedAttributes, instanceCount, indexRange,
+                                       &streamingDataSize, &maxAttributeDataSize);
+
+        // If first is greater than zero, a slack space needs to be left at the beginning of the
+        // region so that the same 'first' argument can be passed into the draw call.
+        const size_t bufferEmptySpace   = maxAttributeDataSize * indexRange.start;
+        const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
+
+        // All attributes are written into one region of the ring buffer, which also leaves it
+        // bound to GL_ARRAY_BUFFER for the attribute pointers below.
+        uint8_t *bufferPointer = nullptr;
+        size_t regionOffset    = 0;
+        Error error = mStreamingArrayBuffer->map(requiredBufferSize, &bufferPointer, &regionOffset);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        const unsigned int generation = mStreamingArrayBuffer->getGeneration();
+        if (reusedAttributes.any() && generation != initialGeneration)
+        {
+            // The ring wrapped around and may overwrite the previous uploads, write everything.
+            reusedAttributes.reset();
+            mStreamingArrayBuffer->unmap();
+            continue;
+        }
+
         size_t curBufferOffset = bufferEmptySpace;
 
         const auto &attribs = mData.getVertexAttributes();
-        for (auto idx : angle::IterateBitSet(mAttributesNeedStreaming & activeAttributesMask))
+        for (auto idx : angle::IterateBitSet(uploadedAttributes))
         {
             const auto &attrib = attribs[idx];
             ASSERT(AttributeNeedsStreaming(attrib));
@@ -329,39 +449,75 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
             }
 
             // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (indexRange.start * destStride);
+            const size_t vertexStartOffset =
+                regionOffset + curBufferOffset - (indexRange.start * destStride);
 
-            if (attrib.pureInteger)
-            {
-                ASSERT(!attrib.normalized);
-                mFunctions->vertexAttribIPointer(
-                    static_cast<GLuint>(idx), attrib.size, attrib.type,
-                    static_cast<GLsizei>(destStride),
-                    reinterpret_cast<const GLvoid *>(vertexStartOffset));
-            }
-            else
+            ApplyStreamedAttributePointer(mFunctions, idx, attrib, destStride, vertexStartOffset);
+
+            if (mTrackClientArrays)
             {
-                mFunctions->vertexAttribPointer(
-                    static_cast<GLuint>(idx), attrib.size, attrib.type, attrib.normalized,
-                    static_cast<GLsizei>(destStride),
-                    reinterpret_cast<const GLvoid *>(vertexStartOffset));
+                StreamedAttribute &streamed = mStreamedAttributes[idx];
+                streamed.pointer            = attrib.pointer;
+                streamed.sourceStride       = sourceStride;
+                streamed.destStride         = destStride;
+                streamed.start              = indexRange.start;
+                streamed.vertexCount        = streamedVertexCount;
+                streamed.hash               = attributeHashes[idx];
+                streamed.vertexStartOffset  = vertexStartOffset;
+                streamed.generation         = generation;
+                streamed.valid              = true;
             }
 
             curBufferOffset += destStride * streamedVertexCount;
-
-            // Mark the applied attribute as dirty by setting an invalid size so that if it doesn't
-            // need to be streamed later, there is no chance that the caching will skip it.
-            mAppliedAttributes[idx].size = static_cast<GLuint>(-1);
+            uploadedBytes += destStride * streamedVertexCount;
         }
 
-        unmapResult = mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+        unmapResult = mStreamingArrayBuffer->unmap();
     }
 
-    if (unmapResult != GL_TRUE)
+    if (!unmapResult)
     {
         return Error(GL_OUT_OF_MEMORY, "Failed to unmap the client data streaming buffer.");
     }
 
+    if (reusedAttributes.any())
+    {
+        size_t retainedOffset = std::numeric_limits<size_t>::max();
+        size_t skippedBytes   = 0;
+
+        const auto &attribs = mData.getVertexAttributes();
+        for (auto idx : angle::IterateBitSet(reusedAttributes))
+        {
+            const StreamedAttribute &streamed = mStreamedAttributes[idx];
+            ApplyStreamedAttributePointer(mFunctions, idx, attribs[idx], streamed.destStride,
+                                          streamed.vertexStartOffset);
+
+            const size_t dataOffset =
+                streamed.vertexStartOffset + streamed.start * streamed.destStride;
+            retainedOffset = std::min(retainedOffset, dataOffset);
+            skippedBytes += streamed.destStride * streamed.vertexCount;
+        }
+
+        // The draw reads data uploaded by previous ones, it must not be overwritten before the GPU
+        // is done with this draw too.
+        mStreamingArrayBuffer->retainRegion(retainedOffset);
+        mStreamedBytesSkipped += skippedBytes;
+    }
+
+    for (auto idx : angle::IterateBitSet(streamedAttributes))
+    {
+        // Mark the applied attribute as dirty by setting an invalid size so that if it doesn't
+        // need to be streamed later, there is no chance that the caching will skip it.
+        mAppliedAttributes[idx].size = static_cast<GLuint>(-1);
+    }
+
+    mStreamedBytesUploaded += uploadedBytes;
+    if (mTrackClientArrays)
+    {
+        TRACE_COUNTER2("gpu.angle", "VertexArrayGL streamed client data", "uploaded",
+                       mStreamedBytesUploaded, "skipped", mStreamedBytesSkipped);
+    }
+
     return Error(GL_NO_ERROR);
 }
 
@@ -457,7 +613,7 @@ void VertexArrayGL::updateAttribPointer(size_t attribIndex)
 
 void VertexArrayGL::syncState(const VertexArray::DirtyBits &dirtyBits)
 {
-    for (unsigned long dirtyBit : angle::IterateBitSet(dirtyBits))
+    for (size_t dirtyBit : dirtyBits)
     {
         if (dirtyBit == VertexArray::DIRTY_BIT_ELEMENT_ARRAY_BUFFER)
         {
@@ -16,13 +16,15 @@ namespace rx
 
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class VertexArrayGL : public VertexArrayImpl
 {
   public:
     VertexArrayGL(const gl::VertexArrayState &data,
                   const FunctionsGL *functions,
-                  StateManagerGL *stateManager);
+                  StateManagerGL *stateManager,
+                  bool trackClientArrays);
     ~VertexArrayGL() override;
 
     gl::Error syncDrawArraysState(const gl::AttributesMask &activeAttributesMask,
@@ -61,9 +63,9 @@ class VertexArrayGL : public VertexArrayImpl
                             gl::IndexRange *outIndexRange,
                             const GLvoid **outIndices) const;
 
-    // Returns the amount of space needed to stream all attributes that need streaming
-    // and the data size of the largest attribute
-    void computeStreamingAttributeSizes(const gl::AttributesMask &activeAttributesMask,
+    // Returns the amount of space needed to stream the given attributes and the data size of the
+    // largest attribute
+    void computeStreamingAttributeSizes(const gl::AttributesMask &attributesToStream,
                                         GLsizei instanceCount,
                                         const gl::IndexRange &indexRange,
                                         size_t *outStreamingDataSize,
@@ -74,6 +76,13 @@ class VertexArrayGL : public VertexArrayImpl
                                GLsizei instanceCount,
                                const gl::IndexRange &indexRange) const;
 
+    // Hashes the client data of the streamed attributes and returns the ones whose last upload
+    // can be drawn from again.
+    gl::AttributesMask findReusableStreamedAttributes(const gl::AttributesMask &streamedAttributes,
+                                                      GLsizei instanceCount,
+                                                      const gl::IndexRange &indexRange,
+                                                      uint64_t *outHashes) const;
+
     void updateNeedsStreaming(size_t attribIndex);
     void updateAttribEnabled(size_t attribIndex);
     void updateAttribPointer(size_t attribIndex);
@@ -89,8 +98,32 @@ class VertexArrayGL : public VertexArrayImpl
     mutable size_t mStreamingElementArrayBufferSize;
     mutable GLuint mStreamingElementArrayBuffer;
 
-    mutable size_t mStreamingArrayBufferSize;
-    mutable GLuint mStreamingArrayBuffer;
+    // Ring buffer shared by all streamed attributes, created on the first client array draw.
+    mutable StreamingBufferGL *mStreamingArrayBuffer;
+
+    // When enabled, the client data of each streamed attribute is hashed and uploaded again only
+    // if it changed since the previous draw.
+    bool mTrackClientArrays;
+
+    struct StreamedAttribute
+    {
+        StreamedAttribute();
+
+        const GLvoid *pointer;
+        size_t sourceStride;
+        size_t destStride;
+        size_t start;
+        size_t vertexCount;
+        uint64_t hash;
+
+        size_t vertexStartOffset;
+        unsigned int generation;
+        bool valid;
+    };
+    mutable std::vector<StreamedAttribute> mStreamedAttributes;
+
+    mutable uint64_t mStreamedBytesUploaded;
+    mutable uint64_t mStreamedBytesSkipped;
 
     gl::AttributesMask mAttributesNeedStreaming;
 };
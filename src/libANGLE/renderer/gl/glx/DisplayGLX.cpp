@@ -17,6 +17,7 @@
 #include "libANGLE/Config.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Surface.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/gl/glx/PbufferSurfaceGLX.h"
 #include "libANGLE/renderer/gl/glx/WindowSurfaceGLX.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
@@ -133,6 +134,8 @@ DisplayGLX::~DisplayGLX()
 
 egl::Error DisplayGLX::initialize(egl::Display *display)
 {
+    SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayGLXInitializeMS");
+
     mEGLDisplay = display;
     mXDisplay             = display->getNativeDisplayId();
     const auto &attribMap = display->getAttributeMap();
@@ -29,7 +29,9 @@ int ShaderVk::prepareSourceAndReturnOptions(std::stringstream *sourceStream,
     return int();
 }
 
-bool ShaderVk::postTranslateCompile(gl::Compiler *compiler, std::string *infoLog)
+bool ShaderVk::postTranslateCompile(gl::Compiler *compiler,
+                                    ShHandle compilerHandle,
+                                    std::string *infoLog)
 {
     UNIMPLEMENTED();
     return bool();
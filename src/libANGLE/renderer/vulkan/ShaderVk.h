@@ -25,7 +25,9 @@ class ShaderVk : public ShaderImpl
     int prepareSourceAndReturnOptions(std::stringstream *sourceStream,
                                       std::string *sourcePath) override;
     // Returns success for compiling on the driver. Returns success.
-    bool postTranslateCompile(gl::Compiler *compiler, std::string *infoLog) override;
+    bool postTranslateCompile(gl::Compiler *compiler,
+                              ShHandle compilerHandle,
+                              std::string *infoLog) override;
 
     std::string getDebugInfo() const override;
 };
@@ -355,6 +355,13 @@ Error ValidateCreateContext(Display *display, Config *configuration, gl::Context
             break;
     }
 
+    // The capture only records the OpenGL ES 2.0 calls.
+    if (clientMajorVersion > 2 &&
+        display->getAttributeMap().get(EGL_PLATFORM_ANGLE_CAPTURE_ANGLE, EGL_FALSE) == EGL_TRUE)
+    {
+        return Error(EGL_BAD_MATCH, "Only OpenGL ES 2.0 contexts can be captured.");
+    }
+
     // Note: EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR does not apply to ES
     const EGLint validContextFlags = (EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR |
                                       EGL_CONTEXT_OPENGL_ROBUST_ACCESS_BIT_KHR);
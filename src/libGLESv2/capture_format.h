@@ -0,0 +1,139 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// capture_format.h: Layout of the GL API traces written by the capture layer and played back by
+// the capture_replay sample.
+//
+// A trace starts with a header made of kCaptureMagic, kCaptureVersion and the size of the surface
+// at the first eglSwapBuffers, each a uint32_t. It is followed by the calls, each one a uint32_t
+// CaptureCall and its parameters in declaration order:
+//  - GLenum, GLint, GLuint, GLsizei, GLbitfield, GLboolean and GLfloat take 32 bits.
+//  - GLintptr and GLsizeiptr take 64 bits.
+//  - Strings are a uint32_t length followed by the characters.
+//  - Memory read by the call is a uint32_t CaptureMemoryKind, followed by a uint64_t size and the
+//    bytes for client memory, or by a uint64_t offset for an offset into a bound buffer.
+// Strings and client memory are padded to a multiple of 4 bytes, so the replay can use the memory in
+// place.
+// Values returned by the call, such as the names of created objects, follow the parameters.
+// All the values are little endian.
+
+#ifndef LIBGLESV2_CAPTURE_FORMAT_H_
+#define LIBGLESV2_CAPTURE_FORMAT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace gl
+{
+
+const uint32_t kCaptureMagic   = 0x54474e41;  // "ANGT"
+const uint32_t kCaptureVersion = 1;
+const size_t kCaptureAlignment = 4;
+
+enum class CaptureMemoryKind : uint32_t
+{
+    Null,
+    Client,
+    BufferOffset,
+};
+
+// Calls that are implemented by forwarding to another entry point, such as glBlendFunc or
+// glUniform1f, are recorded as the call they forward to. All the glVertexAttrib*f calls are
+// recorded as VertexAttrib4f.
+enum class CaptureCall : uint32_t
+{
+    EndFrame,
+
+    ActiveTexture,
+    AttachShader,
+    BindAttribLocation,
+    BindBuffer,
+    BindFramebuffer,
+    BindRenderbuffer,
+    BindTexture,
+    BlendColor,
+    BlendEquationSeparate,
+    BlendFuncSeparate,
+    BufferData,
+    BufferSubData,
+    Clear,
+    ClearColor,
+    ClearDepthf,
+    ClearStencil,
+    ColorMask,
+    CompileShader,
+    CompressedTexImage2D,
+    CompressedTexSubImage2D,
+    CopyTexImage2D,
+    CopyTexSubImage2D,
+    CreateProgram,
+    CreateShader,
+    CullFace,
+    DeleteBuffers,
+    DeleteFramebuffers,
+    DeleteProgram,
+    DeleteRenderbuffers,
+    DeleteShader,
+    DeleteTextures,
+    DepthFunc,
+    DepthMask,
+    DepthRangef,
+    DetachShader,
+    Disable,
+    DisableVertexAttribArray,
+    DrawArrays,
+    DrawElements,
+    Enable,
+    EnableVertexAttribArray,
+    Finish,
+    Flush,
+    FramebufferRenderbuffer,
+    FramebufferTexture2D,
+    FrontFace,
+    GenBuffers,
+    GenerateMipmap,
+    GenFramebuffers,
+    GenRenderbuffers,
+    GenTextures,
+    GetUniformLocation,
+    Hint,
+    LineWidth,
+    LinkProgram,
+    PixelStorei,
+    PolygonOffset,
+    RenderbufferStorage,
+    SampleCoverage,
+    Scissor,
+    ShaderSource,
+    StencilFuncSeparate,
+    StencilMaskSeparate,
+    StencilOpSeparate,
+    TexImage2D,
+    TexParameterf,
+    TexParameteri,
+    TexSubImage2D,
+    Uniform1fv,
+    Uniform1iv,
+    Uniform2fv,
+    Uniform2iv,
+    Uniform3fv,
+    Uniform3iv,
+    Uniform4fv,
+    Uniform4iv,
+    UniformMatrix2fv,
+    UniformMatrix3fv,
+    UniformMatrix4fv,
+    UseProgram,
+    VertexAttrib4f,
+    VertexAttribPointer,
+    Viewport,
+
+    Count,
+};
+
+}  // namespace gl
+
+#endif  // LIBGLESV2_CAPTURE_FORMAT_H_
@@ -0,0 +1,354 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// capture_gles.cpp: Implements the GLES 2.0 call capture.
+
+#include "libGLESv2/capture_gles.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "common/debug.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Surface.h"
+#include "libANGLE/VertexArray.h"
+#include "libANGLE/VertexAttribute.h"
+#include "libANGLE/formatutils.h"
+
+namespace gl
+{
+
+bool gCaptureActive = false;
+
+namespace
+{
+FILE *gCaptureFile = nullptr;
+bool gCaptureHeaderWritten = false;
+
+// Calls of the current frame, written to the file at the end of the frame.
+std::vector<uint8_t> *gCaptureFrameData = nullptr;
+
+template <typename T>
+void WriteValue(T value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    gCaptureFrameData->insert(gCaptureFrameData->end(), bytes, bytes + sizeof(T));
+}
+
+void WriteBytes(const void *data, size_t size)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+    gCaptureFrameData->insert(gCaptureFrameData->end(), bytes, bytes + size);
+
+    // Keeps the following values aligned.
+    gCaptureFrameData->resize(rx::roundUp(gCaptureFrameData->size(), kCaptureAlignment), 0);
+}
+
+void WriteHeader(uint32_t width, uint32_t height)
+{
+    const uint32_t header[] = {kCaptureMagic, kCaptureVersion, width, height};
+    fwrite(header, sizeof(header), 1, gCaptureFile);
+    gCaptureHeaderWritten = true;
+}
+
+void FlushFrameData()
+{
+    if (!gCaptureFrameData->empty())
+    {
+        fwrite(gCaptureFrameData->data(), gCaptureFrameData->size(), 1, gCaptureFile);
+        gCaptureFrameData->clear();
+    }
+    fflush(gCaptureFile);
+}
+
+void CaptureClientArrays(const Context *context, size_t maxVertex)
+{
+    const VertexArray *vertexArray = context->getGLState().getVertexArray();
+    const std::vector<VertexAttribute> &attribs = vertexArray->getVertexAttributes();
+
+    // The replay reads the pointers as offsets while a buffer is bound to GL_ARRAY_BUFFER, so the
+    // client arrays are recorded with it unbound and it is bound again after them.
+    const GLuint arrayBuffer = context->getGLState().getArrayBufferId();
+    bool arrayBufferUnbound  = false;
+
+    for (size_t index = 0; index < vertexArray->getMaxEnabledAttribute(); index++)
+    {
+        const VertexAttribute &attrib = attribs[index];
+        if (!attrib.enabled || attrib.buffer.get() != nullptr || attrib.pointer == nullptr)
+        {
+            continue;
+        }
+
+        if (arrayBuffer != 0 && !arrayBufferUnbound)
+        {
+            Capture(CaptureCall::BindBuffer, static_cast<GLuint>(GL_ARRAY_BUFFER), 0u);
+            arrayBufferUnbound = true;
+        }
+
+        const size_t size =
+            ComputeVertexAttributeStride(attrib) * maxVertex + ComputeVertexAttributeTypeSize(attrib);
+        Capture(CaptureCall::VertexAttribPointer, static_cast<GLuint>(index),
+                static_cast<GLint>(attrib.size), attrib.type,
+                static_cast<GLboolean>(attrib.normalized), static_cast<GLsizei>(attrib.stride),
+                CaptureMemory(CaptureMemoryKind::Client, attrib.pointer, size));
+    }
+
+    if (arrayBufferUnbound)
+    {
+        Capture(CaptureCall::BindBuffer, static_cast<GLuint>(GL_ARRAY_BUFFER), arrayBuffer);
+    }
+}
+
+}  // anonymous namespace
+
+void StartCapture()
+{
+    ASSERT(!gCaptureActive);
+
+    gCaptureFile = fopen(ANGLE_CAPTURE_OUTPUT_FILE, "wb");
+    if (gCaptureFile == nullptr)
+    {
+        ERR("Failed to open the capture file %s.", ANGLE_CAPTURE_OUTPUT_FILE);
+        return;
+    }
+
+    if (gCaptureFrameData == nullptr)
+    {
+        // Intentionally leaked, it is reused by the next capture.
+        gCaptureFrameData = new std::vector<uint8_t>();
+    }
+
+    gCaptureHeaderWritten = false;
+    gCaptureActive        = true;
+}
+
+void StopCapture()
+{
+    if (!gCaptureActive)
+    {
+        return;
+    }
+
+    if (!gCaptureHeaderWritten)
+    {
+        WriteHeader(0, 0);
+    }
+    FlushFrameData();
+
+    fclose(gCaptureFile);
+    gCaptureFile   = nullptr;
+    gCaptureActive = false;
+}
+
+void CaptureUnsupportedCall(const char *name)
+{
+    // Reported even in release builds, the trace is incomplete.
+    fprintf(stderr, "%s can't be captured, the capture stops before it.\n", name);
+    StopCapture();
+}
+
+void CaptureEndFrame(const egl::Surface *surface)
+{
+    ASSERT(gCaptureActive);
+
+    if (!gCaptureHeaderWritten)
+    {
+        WriteHeader(static_cast<uint32_t>(surface->getWidth()),
+                    static_cast<uint32_t>(surface->getHeight()));
+    }
+
+    BeginCaptureCall(CaptureCall::EndFrame);
+    FlushFrameData();
+}
+
+CaptureMemory CaptureBufferOrClientMemory(const Context *context,
+                                          GLenum target,
+                                          const void *data,
+                                          size_t size)
+{
+    if (context->getGLState().getTargetBuffer(target) != nullptr)
+    {
+        return CaptureMemory(CaptureMemoryKind::BufferOffset, nullptr,
+                             reinterpret_cast<uintptr_t>(data));
+    }
+
+    return CaptureArray(static_cast<const uint8_t *>(data), size);
+}
+
+CaptureMemory CapturePixelUnpackMemory(const Context *context,
+                                       GLenum format,
+                                       GLenum type,
+                                       GLsizei width,
+                                       GLsizei height,
+                                       const void *pixels)
+{
+    const PixelUnpackState &unpack = context->getGLState().getUnpackState();
+    if (unpack.pixelBuffer.get() != nullptr)
+    {
+        return CaptureMemory(CaptureMemoryKind::BufferOffset, nullptr,
+                             reinterpret_cast<uintptr_t>(pixels));
+    }
+
+    if (pixels == nullptr || width == 0 || height == 0)
+    {
+        return CaptureArray(static_cast<const uint8_t *>(pixels), 0);
+    }
+
+    const InternalFormat &formatInfo = GetInternalFormatInfo(GetSizedInternalFormat(format, type));
+    auto rowPitch = formatInfo.computeRowPitch(type, width, unpack.alignment, unpack.rowLength);
+    if (rowPitch.isError())
+    {
+        return CaptureArray(static_cast<const uint8_t *>(pixels), 0);
+    }
+    const GLuint rowBytes = rowPitch.getResult();
+
+    auto skipBytes = formatInfo.computeSkipBytes(rowBytes, 0, 0, unpack.skipRows,
+                                                 unpack.skipPixels, false);
+    if (skipBytes.isError())
+    {
+        return CaptureArray(static_cast<const uint8_t *>(pixels), 0);
+    }
+
+    // The last row is not padded to the unpack alignment.
+    const size_t size = skipBytes.getResult() + static_cast<size_t>(rowBytes) * (height - 1) +
+                        static_cast<size_t>(formatInfo.pixelBytes) * width;
+    return CaptureArray(static_cast<const uint8_t *>(pixels), size);
+}
+
+void BeginCaptureCall(CaptureCall call)
+{
+    ASSERT(gCaptureActive);
+    WriteValue(static_cast<uint32_t>(call));
+}
+
+void CaptureParam(GLint value)
+{
+    WriteValue(static_cast<int32_t>(value));
+}
+
+void CaptureParam(GLuint value)
+{
+    WriteValue(static_cast<uint32_t>(value));
+}
+
+void CaptureParam(GLfloat value)
+{
+    WriteValue(value);
+}
+
+void CaptureParam(GLboolean value)
+{
+    WriteValue(static_cast<uint32_t>(value));
+}
+
+void CaptureParam(GLsizeiptr value)
+{
+    WriteValue(static_cast<int64_t>(value));
+}
+
+void CaptureParam(const char *value)
+{
+    const size_t length = strlen(value);
+    WriteValue(static_cast<uint32_t>(length));
+    WriteBytes(value, length);
+}
+
+void CaptureParam(const std::string &value)
+{
+    WriteValue(static_cast<uint32_t>(value.length()));
+    WriteBytes(value.data(), value.length());
+}
+
+void CaptureParam(const CaptureMemory &value)
+{
+    WriteValue(value.kind);
+    switch (value.kind)
+    {
+        case CaptureMemoryKind::Null:
+            break;
+
+        case CaptureMemoryKind::Client:
+            WriteValue(static_cast<uint64_t>(value.size));
+            WriteBytes(value.data, value.size);
+            break;
+
+        case CaptureMemoryKind::BufferOffset:
+            WriteValue(static_cast<uint64_t>(value.size));
+            break;
+
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void CaptureShaderSource(GLuint shader,
+                         GLsizei count,
+                         const GLchar *const *string,
+                         const GLint *length)
+{
+    // The strings are recorded concatenated, the same way the shader sees them.
+    std::string source;
+    for (GLsizei i = 0; i < count; i++)
+    {
+        if (length == nullptr || length[i] < 0)
+        {
+            source.append(string[i]);
+        }
+        else
+        {
+            source.append(string[i], length[i]);
+        }
+    }
+
+    Capture(CaptureCall::ShaderSource, shader, source);
+}
+
+void CaptureDrawArrays(const Context *context, GLenum mode, GLint first, GLsizei count)
+{
+    if (count > 0)
+    {
+        CaptureClientArrays(context, static_cast<size_t>(first + count - 1));
+    }
+    Capture(CaptureCall::DrawArrays, mode, first, count);
+}
+
+void CaptureDrawElements(const Context *context,
+                         GLenum mode,
+                         GLsizei count,
+                         GLenum type,
+                         const GLvoid *indices,
+                         const IndexRange &indexRange)
+{
+    CaptureClientArrays(context, indexRange.end);
+
+    const size_t indicesSize = static_cast<size_t>(count) * GetTypeInfo(type).bytes;
+    Capture(CaptureCall::DrawElements, mode, count, type,
+            CaptureBufferOrClientMemory(context, GL_ELEMENT_ARRAY_BUFFER, indices, indicesSize));
+}
+
+void CaptureVertexAttribPointer(const Context *context,
+                                GLuint index,
+                                GLint size,
+                                GLenum type,
+                                GLboolean normalized,
+                                GLsizei stride,
+                                const GLvoid *ptr)
+{
+    const bool hasBuffer = context->getGLState().getArrayBufferId() != 0;
+    if (!hasBuffer && ptr != nullptr)
+    {
+        // Client arrays are recorded by the draw calls reading them.
+        return;
+    }
+
+    Capture(CaptureCall::VertexAttribPointer, index, size, type, normalized, stride,
+            CaptureMemory(hasBuffer ? CaptureMemoryKind::BufferOffset : CaptureMemoryKind::Null,
+                          nullptr, reinterpret_cast<uintptr_t>(ptr)));
+}
+
+}  // namespace gl
@@ -0,0 +1,150 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// capture_gles.h: Records the GLES 2.0 calls made to a display initialized with the hidden
+// EGL_PLATFORM_ANGLE_CAPTURE_ANGLE attribute, along with the client memory they read, so they can
+// be played back by the capture_replay sample. Only a single OpenGL ES 2.0 context is supported.
+
+#ifndef LIBGLESV2_CAPTURE_GLES_H_
+#define LIBGLESV2_CAPTURE_GLES_H_
+
+#include <string>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+#include "libGLESv2/capture_format.h"
+
+#ifndef ANGLE_CAPTURE_OUTPUT_FILE
+#define ANGLE_CAPTURE_OUTPUT_FILE "angle_capture.trace"
+#endif
+
+namespace egl
+{
+class Surface;
+}
+
+namespace gl
+{
+class Context;
+
+// Only accessed by the thread making the GL calls.
+extern bool gCaptureActive;
+
+void StartCapture();
+void StopCapture();
+void CaptureEndFrame(const egl::Surface *surface);
+
+// Calls the trace format can't record stop the capture, so the trace ends before them instead of
+// replaying differently.
+void CaptureUnsupportedCall(const char *name);
+
+struct CaptureMemory
+{
+    CaptureMemory(CaptureMemoryKind kind, const void *data, size_t size)
+        : kind(kind), data(data), size(size)
+    {
+    }
+
+    CaptureMemoryKind kind;
+    const void *data;
+
+    // The offset for the BufferOffset kind.
+    size_t size;
+};
+
+template <typename T>
+CaptureMemory CaptureArray(const T *data, size_t count)
+{
+    return CaptureMemory(data ? CaptureMemoryKind::Client : CaptureMemoryKind::Null, data,
+                         data ? count * sizeof(T) : 0);
+}
+
+// Memory read from the buffer bound to the target if there is one, from the client otherwise.
+CaptureMemory CaptureBufferOrClientMemory(const Context *context,
+                                          GLenum target,
+                                          const void *data,
+                                          size_t size);
+
+// Memory read by a texture upload, taking the unpack state into account.
+CaptureMemory CapturePixelUnpackMemory(const Context *context,
+                                       GLenum format,
+                                       GLenum type,
+                                       GLsizei width,
+                                       GLsizei height,
+                                       const void *pixels);
+
+void BeginCaptureCall(CaptureCall call);
+void CaptureParam(GLint value);
+void CaptureParam(GLuint value);
+void CaptureParam(GLfloat value);
+void CaptureParam(GLboolean value);
+void CaptureParam(GLsizeiptr value);
+void CaptureParam(const char *value);
+void CaptureParam(const std::string &value);
+void CaptureParam(const CaptureMemory &value);
+
+inline void CaptureParams()
+{
+}
+
+template <typename T, typename... Rest>
+void CaptureParams(const T &param, const Rest &... rest)
+{
+    CaptureParam(param);
+    CaptureParams(rest...);
+}
+
+template <typename... Params>
+void Capture(CaptureCall call, const Params &... params)
+{
+    BeginCaptureCall(call);
+    CaptureParams(params...);
+}
+
+void CaptureShaderSource(GLuint shader,
+                         GLsizei count,
+                         const GLchar *const *string,
+                         const GLint *length);
+
+// Client arrays are recorded at draw time, as glVertexAttribPointer calls reading the vertices up
+// to the last one used by the draw.
+void CaptureDrawArrays(const Context *context, GLenum mode, GLint first, GLsizei count);
+void CaptureDrawElements(const Context *context,
+                         GLenum mode,
+                         GLsizei count,
+                         GLenum type,
+                         const GLvoid *indices,
+                         const IndexRange &indexRange);
+void CaptureVertexAttribPointer(const Context *context,
+                                GLuint index,
+                                GLint size,
+                                GLenum type,
+                                GLboolean normalized,
+                                GLsizei stride,
+                                const GLvoid *ptr);
+
+}  // namespace gl
+
+#define ANGLE_CAPTURE(call, ...)                                 \
+    do                                                           \
+    {                                                            \
+        if (gl::gCaptureActive)                                  \
+        {                                                        \
+            gl::Capture(gl::CaptureCall::call, ##__VA_ARGS__);   \
+        }                                                        \
+    } while (0)
+
+#define ANGLE_CAPTURE_UNSUPPORTED()                   \
+    do                                                \
+    {                                                 \
+        if (gl::gCaptureActive)                       \
+        {                                             \
+            gl::CaptureUnsupportedCall(__FUNCTION__); \
+        }                                             \
+    } while (0)
+
+#endif  // LIBGLESV2_CAPTURE_GLES_H_
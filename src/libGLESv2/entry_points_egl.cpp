@@ -7,6 +7,7 @@
 // entry_points_egl.cpp : Implements the EGL entry points.
 
 #include "libGLESv2/entry_points_egl.h"
+#include "libGLESv2/capture_gles.h"
 #include "libGLESv2/entry_points_egl_ext.h"
 #include "libGLESv2/entry_points_gles_2_0.h"
 #include "libGLESv2/entry_points_gles_2_0_ext.h"
@@ -64,6 +65,12 @@ EGLBoolean EGLAPIENTRY Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
         return EGL_FALSE;
     }
 
+    if (display->getAttributeMap().get(EGL_PLATFORM_ANGLE_CAPTURE_ANGLE, EGL_FALSE) == EGL_TRUE &&
+        !gl::gCaptureActive)
+    {
+        gl::StartCapture();
+    }
+
     if (major) *major = 1;
     if (minor) *minor = 4;
 
@@ -90,6 +97,11 @@ EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
         SetGlobalDisplay(NULL);
     }
 
+    if (display->getAttributeMap().get(EGL_PLATFORM_ANGLE_CAPTURE_ANGLE, EGL_FALSE) == EGL_TRUE)
+    {
+        gl::StopCapture();
+    }
+
     display->terminate();
 
     SetGlobalError(Error(EGL_SUCCESS));
@@ -823,6 +835,11 @@ EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
         return EGL_FALSE;
     }
 
+    if (gl::gCaptureActive)
+    {
+        gl::CaptureEndFrame(eglSurface);
+    }
+
     SetGlobalError(Error(EGL_SUCCESS));
     return EGL_TRUE;
 }
@@ -7,6 +7,10 @@
 // entry_points_ext.cpp : Implements the EGL extension entry points.
 
 #include "libGLESv2/entry_points_egl_ext.h"
+
+#include <algorithm>
+#include <initializer_list>
+
 #include "libGLESv2/global_state.h"
 
 #include "libANGLE/Context.h"
@@ -21,6 +25,48 @@
 namespace egl
 {
 
+namespace
+{
+
+// Validates one of the hidden boolean options of EGL_ANGLE_platform_angle. Enabling it requires
+// one of |acceptedPlatformTypes|, or any back-end when the list is empty. The default platform
+// type is always accepted, since it may resolve to any of them.
+Error ValidateHiddenPlatformOption(const AttributeMap &attribMap,
+                                   EGLAttrib attribute,
+                                   const char *attributeName,
+                                   EGLAttrib platformType,
+                                   std::initializer_list<EGLAttrib> acceptedPlatformTypes)
+{
+    if (!attribMap.contains(attribute))
+    {
+        return Error(EGL_SUCCESS);
+    }
+
+    switch (attribMap.get(attribute, EGL_FALSE))
+    {
+        case EGL_FALSE:
+            return Error(EGL_SUCCESS);
+
+        case EGL_TRUE:
+            break;
+
+        default:
+            return Error(EGL_BAD_ATTRIBUTE, "Invalid value for %s attrib", attributeName);
+    }
+
+    if (acceptedPlatformTypes.size() == 0 || platformType == EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE ||
+        std::find(acceptedPlatformTypes.begin(), acceptedPlatformTypes.end(), platformType) !=
+            acceptedPlatformTypes.end())
+    {
+        return Error(EGL_SUCCESS);
+    }
+
+    return Error(EGL_BAD_ATTRIBUTE, "%s is not supported by the requested platform type",
+                 attributeName);
+}
+
+}  // anonymous namespace
+
 // EGL_ANGLE_query_surface_pointer
 EGLBoolean EGLAPIENTRY QuerySurfacePointerANGLE(EGLDisplay dpy, EGLSurface surface, EGLint attribute, void **value)
 {
@@ -266,7 +312,7 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplayEXT(EGLenum platform, void *native_disp
                                 break;
 
                             case EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE:
-                                // This is a hidden option, accepted by the OpenGL back-end.
+                                // This is a hidden option, accepted by every back-end.
                                 break;
 
                             default:
@@ -349,6 +395,27 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplayEXT(EGLenum platform, void *native_disp
 
         AttributeMap attribMap = AttributeMap::CreateFromIntArray(attrib_list);
 
+        // Hidden options, validated once the platform type is known.
+        const Error hiddenOptionErrors[] = {
+            ValidateHiddenPlatformOption(
+                attribMap, EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE,
+                "EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE", platformType,
+                {EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE, EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE}),
+            ValidateHiddenPlatformOption(attribMap, EGL_PLATFORM_ANGLE_ENTRY_POINT_COUNTERS_ANGLE,
+                                         "EGL_PLATFORM_ANGLE_ENTRY_POINT_COUNTERS_ANGLE",
+                                         platformType, {}),
+            ValidateHiddenPlatformOption(attribMap, EGL_PLATFORM_ANGLE_CAPTURE_ANGLE,
+                                         "EGL_PLATFORM_ANGLE_CAPTURE_ANGLE", platformType, {}),
+        };
+        for (const Error &error : hiddenOptionErrors)
+        {
+            if (error.isError())
+            {
+                SetGlobalError(error);
+                return EGL_NO_DISPLAY;
+            }
+        }
+
         if (requestedAllowRenderToBackBuffer)
         {
             // Redirect EGL_ANGLE_DISPLAY_ALLOW_RENDER_TO_BACK_BUFFER to
@@ -8,6 +8,7 @@
 
 #include "libGLESv2/entry_points_gles_2_0.h"
 
+#include "libGLESv2/capture_gles.h"
 #include "libGLESv2/global_state.h"
 
 #include "libANGLE/formatutils.h"
@@ -50,6 +51,8 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
         }
 
         context->activeTexture(texture);
+
+        ANGLE_CAPTURE(ActiveTexture, texture);
     }
 }
 
@@ -77,6 +80,8 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
             context->handleError(Error(GL_INVALID_OPERATION));
             return;
         }
+
+        ANGLE_CAPTURE(AttachShader, program, shader);
     }
 }
 
@@ -107,6 +112,8 @@ void GL_APIENTRY BindAttribLocation(GLuint program, GLuint index, const GLchar*
         }
 
         programObject->bindAttributeLocation(index, name);
+
+        ANGLE_CAPTURE(BindAttribLocation, program, index, name);
     }
 }
 
@@ -123,6 +130,8 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
             return;
         }
 
+        ANGLE_CAPTURE(BindBuffer, target, buffer);
+
         switch (target)
         {
           case GL_ARRAY_BUFFER:
@@ -179,6 +188,8 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
         {
             context->bindDrawFramebuffer(framebuffer);
         }
+
+        ANGLE_CAPTURE(BindFramebuffer, target, framebuffer);
     }
 }
 
@@ -196,6 +207,8 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
         }
 
         context->bindRenderbuffer(renderbuffer);
+
+        ANGLE_CAPTURE(BindRenderbuffer, target, renderbuffer);
     }
 }
 
@@ -212,6 +225,8 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
         }
 
         context->bindTexture(target, texture);
+
+        ANGLE_CAPTURE(BindTexture, target, texture);
     }
 }
 
@@ -224,6 +239,8 @@ void GL_APIENTRY BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclamp
     if (context)
     {
         context->blendColor(red, green, blue, alpha);
+
+        ANGLE_CAPTURE(BlendColor, red, green, blue, alpha);
     }
 }
 
@@ -268,6 +285,8 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
         }
 
         context->blendEquationSeparate(modeRGB, modeAlpha);
+
+        ANGLE_CAPTURE(BlendEquationSeparate, modeRGB, modeAlpha);
     }
 }
 
@@ -416,6 +435,8 @@ void GL_APIENTRY BlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha
         }
 
         context->blendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+
+        ANGLE_CAPTURE(BlendFuncSeparate, srcRGB, dstRGB, srcAlpha, dstAlpha);
     }
 }
 
@@ -478,6 +499,9 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const GLvoid* data,
             context->handleError(error);
             return;
         }
+
+        ANGLE_CAPTURE(BufferData, target, size,
+                      CaptureArray(static_cast<const uint8_t *>(data), size), usage);
     }
 }
 
@@ -541,6 +565,9 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
             context->handleError(error);
             return;
         }
+
+        ANGLE_CAPTURE(BufferSubData, target, offset, size,
+                      CaptureArray(static_cast<const uint8_t *>(data), size));
     }
 }
 
@@ -579,6 +606,8 @@ void GL_APIENTRY Clear(GLbitfield mask)
         }
 
         context->clear(mask);
+
+        ANGLE_CAPTURE(Clear, mask);
     }
 }
 
@@ -591,6 +620,8 @@ void GL_APIENTRY ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclamp
     if (context)
     {
         context->clearColor(red, green, blue, alpha);
+
+        ANGLE_CAPTURE(ClearColor, red, green, blue, alpha);
     }
 }
 
@@ -602,6 +633,8 @@ void GL_APIENTRY ClearDepthf(GLclampf depth)
     if (context)
     {
         context->clearDepthf(depth);
+
+        ANGLE_CAPTURE(ClearDepthf, depth);
     }
 }
 
@@ -613,6 +646,8 @@ void GL_APIENTRY ClearStencil(GLint s)
     if (context)
     {
         context->clearStencil(s);
+
+        ANGLE_CAPTURE(ClearStencil, s);
     }
 }
 
@@ -625,6 +660,8 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     if (context)
     {
         context->colorMask(red, green, blue, alpha);
+
+        ANGLE_CAPTURE(ColorMask, red, green, blue, alpha);
     }
 }
 
@@ -641,6 +678,8 @@ void GL_APIENTRY CompileShader(GLuint shader)
             return;
         }
         shaderObject->compile(context->getCompiler());
+
+        ANGLE_CAPTURE(CompileShader, shader);
     }
 }
 
@@ -663,6 +702,10 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target, GLint level, GLenum interna
 
         context->compressedTexImage2D(target, level, internalformat, width, height, border,
                                       imageSize, data);
+
+        ANGLE_CAPTURE(CompressedTexImage2D, target, level, internalformat, width, height, border,
+                      imageSize,
+                      CaptureBufferOrClientMemory(context, GL_PIXEL_UNPACK_BUFFER, data, imageSize));
     }
 }
 
@@ -686,6 +729,10 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffs
 
         context->compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
                                          imageSize, data);
+
+        ANGLE_CAPTURE(CompressedTexSubImage2D, target, level, xoffset, yoffset, width, height,
+                      format, imageSize,
+                      CaptureBufferOrClientMemory(context, GL_PIXEL_UNPACK_BUFFER, data, imageSize));
     }
 }
 
@@ -705,6 +752,8 @@ void GL_APIENTRY CopyTexImage2D(GLenum target, GLint level, GLenum internalforma
             return;
         }
         context->copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+
+        ANGLE_CAPTURE(CopyTexImage2D, target, level, internalformat, x, y, width, height, border);
     }
 }
 
@@ -725,6 +774,8 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GL
         }
 
         context->copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+
+        ANGLE_CAPTURE(CopyTexSubImage2D, target, level, xoffset, yoffset, x, y, width, height);
     }
 }
 
@@ -735,7 +786,10 @@ GLuint GL_APIENTRY CreateProgram(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        return context->createProgram();
+        GLuint program = context->createProgram();
+
+        ANGLE_CAPTURE(CreateProgram, program);
+        return program;
     }
 
     return 0;
@@ -752,7 +806,12 @@ GLuint GL_APIENTRY CreateShader(GLenum type)
         {
           case GL_FRAGMENT_SHADER:
           case GL_VERTEX_SHADER:
-            return context->createShader(type);
+            {
+                GLuint shader = context->createShader(type);
+
+                ANGLE_CAPTURE(CreateShader, type, shader);
+                return shader;
+            }
 
           default:
               context->handleError(Error(GL_INVALID_ENUM));
@@ -783,6 +842,8 @@ void GL_APIENTRY CullFace(GLenum mode)
         }
 
         context->cullFace(mode);
+
+        ANGLE_CAPTURE(CullFace, mode);
     }
 }
 
@@ -802,6 +863,8 @@ void GL_APIENTRY DeleteBuffers(GLsizei n, const GLuint* buffers)
         {
             context->deleteBuffer(buffers[i]);
         }
+
+        ANGLE_CAPTURE(DeleteBuffers, n, CaptureArray(buffers, n));
     }
 }
 
@@ -824,6 +887,8 @@ void GL_APIENTRY DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
                 context->deleteFramebuffer(framebuffers[i]);
             }
         }
+
+        ANGLE_CAPTURE(DeleteFramebuffers, n, CaptureArray(framebuffers, n));
     }
 }
 
@@ -854,6 +919,8 @@ void GL_APIENTRY DeleteProgram(GLuint program)
         }
 
         context->deleteProgram(program);
+
+        ANGLE_CAPTURE(DeleteProgram, program);
     }
 }
 
@@ -873,6 +940,8 @@ void GL_APIENTRY DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
         {
             context->deleteRenderbuffer(renderbuffers[i]);
         }
+
+        ANGLE_CAPTURE(DeleteRenderbuffers, n, CaptureArray(renderbuffers, n));
     }
 }
 
@@ -903,6 +972,8 @@ void GL_APIENTRY DeleteShader(GLuint shader)
         }
 
         context->deleteShader(shader);
+
+        ANGLE_CAPTURE(DeleteShader, shader);
     }
 }
 
@@ -925,6 +996,8 @@ void GL_APIENTRY DeleteTextures(GLsizei n, const GLuint* textures)
                 context->deleteTexture(textures[i]);
             }
         }
+
+        ANGLE_CAPTURE(DeleteTextures, n, CaptureArray(textures, n));
     }
 }
 
@@ -953,6 +1026,8 @@ void GL_APIENTRY DepthFunc(GLenum func)
         }
 
         context->depthFunc(func);
+
+        ANGLE_CAPTURE(DepthFunc, func);
     }
 }
 
@@ -964,6 +1039,8 @@ void GL_APIENTRY DepthMask(GLboolean flag)
     if (context)
     {
         context->depthMask(flag);
+
+        ANGLE_CAPTURE(DepthMask, flag);
     }
 }
 
@@ -975,6 +1052,8 @@ void GL_APIENTRY DepthRangef(GLclampf zNear, GLclampf zFar)
     if (context)
     {
         context->depthRangef(zNear, zFar);
+
+        ANGLE_CAPTURE(DepthRangef, zNear, zFar);
     }
 }
 
@@ -1002,6 +1081,8 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
             context->handleError(Error(GL_INVALID_OPERATION));
             return;
         }
+
+        ANGLE_CAPTURE(DetachShader, program, shader);
     }
 }
 
@@ -1019,6 +1100,8 @@ void GL_APIENTRY Disable(GLenum cap)
         }
 
         context->disable(cap);
+
+        ANGLE_CAPTURE(Disable, cap);
     }
 }
 
@@ -1036,6 +1119,8 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
         }
 
         context->disableVertexAttribArray(index);
+
+        ANGLE_CAPTURE(DisableVertexAttribArray, index);
     }
 }
 
@@ -1057,6 +1142,11 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
             context->handleError(error);
             return;
         }
+
+        if (gCaptureActive)
+        {
+            CaptureDrawArrays(context, mode, first, count);
+        }
     }
 }
 
@@ -1080,6 +1170,11 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const GLv
             context->handleError(error);
             return;
         }
+
+        if (gCaptureActive)
+        {
+            CaptureDrawElements(context, mode, count, type, indices, indexRange);
+        }
     }
 }
 
@@ -1111,6 +1206,8 @@ void GL_APIENTRY Enable(GLenum cap)
         }
 
         context->enable(cap);
+
+        ANGLE_CAPTURE(Enable, cap);
     }
 }
 
@@ -1128,6 +1225,8 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
         }
 
         context->enableVertexAttribArray(index);
+
+        ANGLE_CAPTURE(EnableVertexAttribArray, index);
     }
 }
 
@@ -1144,6 +1243,8 @@ void GL_APIENTRY Finish(void)
             context->handleError(error);
             return;
         }
+
+        ANGLE_CAPTURE(Finish);
     }
 }
 
@@ -1160,6 +1261,8 @@ void GL_APIENTRY Flush(void)
             context->handleError(error);
             return;
         }
+
+        ANGLE_CAPTURE(Flush);
     }
 }
 
@@ -1179,6 +1282,9 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenu
         }
 
         context->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+
+        ANGLE_CAPTURE(FramebufferRenderbuffer, target, attachment, renderbuffertarget,
+                      renderbuffer);
     }
 }
 
@@ -1197,6 +1303,8 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target, GLenum attachment, GLenum t
         }
 
         context->framebufferTexture2D(target, attachment, textarget, texture, level);
+
+        ANGLE_CAPTURE(FramebufferTexture2D, target, attachment, textarget, texture, level);
     }
 }
 
@@ -1218,6 +1326,8 @@ void GL_APIENTRY FrontFace(GLenum mode)
         }
 
         context->frontFace(mode);
+
+        ANGLE_CAPTURE(FrontFace, mode);
     }
 }
 
@@ -1237,6 +1347,8 @@ void GL_APIENTRY GenBuffers(GLsizei n, GLuint* buffers)
         {
             buffers[i] = context->createBuffer();
         }
+
+        ANGLE_CAPTURE(GenBuffers, n, CaptureArray(buffers, n));
     }
 }
 
@@ -1253,6 +1365,8 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
         }
 
         context->generateMipmap(target);
+
+        ANGLE_CAPTURE(GenerateMipmap, target);
     }
 }
 
@@ -1272,6 +1386,8 @@ void GL_APIENTRY GenFramebuffers(GLsizei n, GLuint* framebuffers)
         {
             framebuffers[i] = context->createFramebuffer();
         }
+
+        ANGLE_CAPTURE(GenFramebuffers, n, CaptureArray(framebuffers, n));
     }
 }
 
@@ -1291,6 +1407,8 @@ void GL_APIENTRY GenRenderbuffers(GLsizei n, GLuint* renderbuffers)
         {
             renderbuffers[i] = context->createRenderbuffer();
         }
+
+        ANGLE_CAPTURE(GenRenderbuffers, n, CaptureArray(renderbuffers, n));
     }
 }
 
@@ -1310,6 +1428,8 @@ void GL_APIENTRY GenTextures(GLsizei n, GLuint* textures)
         {
             textures[i] = context->createTexture();
         }
+
+        ANGLE_CAPTURE(GenTextures, n, CaptureArray(textures, n));
     }
 }
 
@@ -2611,7 +2731,10 @@ GLint GL_APIENTRY GetUniformLocation(GLuint program, const GLchar* name)
             return -1;
         }
 
-        return programObject->getUniformLocation(name);
+        GLint location = programObject->getUniformLocation(name);
+
+        ANGLE_CAPTURE(GetUniformLocation, program, name, location);
+        return location;
     }
 
     return -1;
@@ -2744,6 +2867,8 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
         }
 
         context->hint(target, mode);
+
+        ANGLE_CAPTURE(Hint, target, mode);
     }
 }
 
@@ -2888,6 +3013,8 @@ void GL_APIENTRY LineWidth(GLfloat width)
         }
 
         context->lineWidth(width);
+
+        ANGLE_CAPTURE(LineWidth, width);
     }
 }
 
@@ -2915,6 +3042,8 @@ void GL_APIENTRY LinkProgram(GLuint program)
             context->handleError(error);
             return;
         }
+
+        ANGLE_CAPTURE(LinkProgram, program);
     }
 }
 
@@ -2998,6 +3127,8 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
         }
 
         context->pixelStorei(pname, param);
+
+        ANGLE_CAPTURE(PixelStorei, pname, param);
     }
 }
 
@@ -3009,6 +3140,8 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
     if (context)
     {
         context->polygonOffset(factor, units);
+
+        ANGLE_CAPTURE(PolygonOffset, factor, units);
     }
 }
 
@@ -3041,7 +3174,7 @@ void GL_APIENTRY ReleaseShaderCompiler(void)
     if (context)
     {
         Compiler *compiler = context->getCompiler();
-        Error error = compiler->release();
+        Error error = compiler->releaseHandles();
         if (error.isError())
         {
             context->handleError(error);
@@ -3071,6 +3204,8 @@ void GL_APIENTRY RenderbufferStorage(GLenum target, GLenum internalformat, GLsiz
             context->handleError(error);
             return;
         }
+
+        ANGLE_CAPTURE(RenderbufferStorage, target, internalformat, width, height);
     }
 }
 
@@ -3083,6 +3218,8 @@ void GL_APIENTRY SampleCoverage(GLclampf value, GLboolean invert)
     if (context)
     {
         context->sampleCoverage(value, invert);
+
+        ANGLE_CAPTURE(SampleCoverage, value, invert);
     }
 }
 
@@ -3100,6 +3237,8 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
         }
 
         context->scissor(x, y, width, height);
+
+        ANGLE_CAPTURE(Scissor, x, y, width, height);
     }
 }
 
@@ -3144,6 +3283,11 @@ void GL_APIENTRY ShaderSource(GLuint shader, GLsizei count, const GLchar* const*
             return;
         }
         shaderObject->setSource(count, string, length);
+
+        if (gCaptureActive)
+        {
+            CaptureShaderSource(shader, count, string, length);
+        }
     }
 }
 
@@ -3189,6 +3333,8 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
         }
 
         context->stencilFuncSeparate(face, func, ref, mask);
+
+        ANGLE_CAPTURE(StencilFuncSeparate, face, func, ref, mask);
     }
 }
 
@@ -3217,6 +3363,8 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
         }
 
         context->stencilMaskSeparate(face, mask);
+
+        ANGLE_CAPTURE(StencilMaskSeparate, face, mask);
     }
 }
 
@@ -3297,6 +3445,8 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenu
         }
 
         context->stencilOpSeparate(face, fail, zfail, zpass);
+
+        ANGLE_CAPTURE(StencilOpSeparate, face, fail, zfail, zpass);
     }
 }
 
@@ -3319,6 +3469,9 @@ void GL_APIENTRY TexImage2D(GLenum target, GLint level, GLint internalformat, GL
 
         context->texImage2D(target, level, internalformat, width, height, border, format, type,
                             pixels);
+
+        ANGLE_CAPTURE(TexImage2D, target, level, internalformat, width, height, border, format,
+                      type, CapturePixelUnpackMemory(context, format, type, width, height, pixels));
     }
 }
 
@@ -3340,37 +3493,15 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
             return;
         }
 
-        Texture *texture = context->getTargetTexture(target);
-
-        if (!texture)
+        if (!context->getTargetTexture(target))
         {
             context->handleError(Error(GL_INVALID_ENUM));
             return;
         }
 
-        // clang-format off
-        switch (pname)
-        {
-          case GL_TEXTURE_WRAP_S:               texture->setWrapS(uiround<GLenum>(param));        break;
-          case GL_TEXTURE_WRAP_T:               texture->setWrapT(uiround<GLenum>(param));        break;
-          case GL_TEXTURE_WRAP_R:               texture->setWrapR(uiround<GLenum>(param));        break;
-          case GL_TEXTURE_MIN_FILTER:           texture->setMinFilter(uiround<GLenum>(param));    break;
-          case GL_TEXTURE_MAG_FILTER:           texture->setMagFilter(uiround<GLenum>(param));    break;
-          case GL_TEXTURE_USAGE_ANGLE:          texture->setUsage(uiround<GLenum>(param));        break;
-          case GL_TEXTURE_MAX_ANISOTROPY_EXT:   texture->setMaxAnisotropy(std::min(param, context->getExtensions().maxTextureAnisotropy)); break;
-          case GL_TEXTURE_COMPARE_MODE:         texture->setCompareMode(uiround<GLenum>(param));  break;
-          case GL_TEXTURE_COMPARE_FUNC:         texture->setCompareFunc(uiround<GLenum>(param));  break;
-          case GL_TEXTURE_SWIZZLE_R:            texture->setSwizzleRed(uiround<GLenum>(param));   break;
-          case GL_TEXTURE_SWIZZLE_G:            texture->setSwizzleGreen(uiround<GLenum>(param)); break;
-          case GL_TEXTURE_SWIZZLE_B:            texture->setSwizzleBlue(uiround<GLenum>(param));  break;
-          case GL_TEXTURE_SWIZZLE_A:            texture->setSwizzleAlpha(uiround<GLenum>(param)); break;
-          case GL_TEXTURE_BASE_LEVEL:           texture->setBaseLevel(uiround<GLuint>(param));    break;
-          case GL_TEXTURE_MAX_LEVEL:            texture->setMaxLevel(uiround<GLuint>(param));     break;
-          case GL_TEXTURE_MIN_LOD:              texture->setMinLod(param);                        break;
-          case GL_TEXTURE_MAX_LOD:              texture->setMaxLod(param);                        break;
-          default: UNREACHABLE(); break;
-        }
-        // clang-format on
+        context->texParameterf(target, pname, param);
+
+        ANGLE_CAPTURE(TexParameterf, target, pname, param);
     }
 }
 
@@ -3397,37 +3528,15 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
             return;
         }
 
-        Texture *texture = context->getTargetTexture(target);
-
-        if (!texture)
+        if (!context->getTargetTexture(target))
         {
             context->handleError(Error(GL_INVALID_ENUM));
             return;
         }
 
-        // clang-format off
-        switch (pname)
-        {
-          case GL_TEXTURE_WRAP_S:               texture->setWrapS(static_cast<GLenum>(param));        break;
-          case GL_TEXTURE_WRAP_T:               texture->setWrapT(static_cast<GLenum>(param));        break;
-          case GL_TEXTURE_WRAP_R:               texture->setWrapR(static_cast<GLenum>(param));        break;
-          case GL_TEXTURE_MIN_FILTER:           texture->setMinFilter(static_cast<GLenum>(param));    break;
-          case GL_TEXTURE_MAG_FILTER:           texture->setMagFilter(static_cast<GLenum>(param));    break;
-          case GL_TEXTURE_USAGE_ANGLE:          texture->setUsage(static_cast<GLenum>(param));        break;
-          case GL_TEXTURE_MAX_ANISOTROPY_EXT:   texture->setMaxAnisotropy(std::min(static_cast<GLfloat>(param), context->getExtensions().maxTextureAnisotropy)); break;
-          case GL_TEXTURE_COMPARE_MODE:         texture->setCompareMode(static_cast<GLenum>(param));  break;
-          case GL_TEXTURE_COMPARE_FUNC:         texture->setCompareFunc(static_cast<GLenum>(param));  break;
-          case GL_TEXTURE_SWIZZLE_R:            texture->setSwizzleRed(static_cast<GLenum>(param));   break;
-          case GL_TEXTURE_SWIZZLE_G:            texture->setSwizzleGreen(static_cast<GLenum>(param)); break;
-          case GL_TEXTURE_SWIZZLE_B:            texture->setSwizzleBlue(static_cast<GLenum>(param));  break;
-          case GL_TEXTURE_SWIZZLE_A:            texture->setSwizzleAlpha(static_cast<GLenum>(param)); break;
-          case GL_TEXTURE_BASE_LEVEL:           texture->setBaseLevel(static_cast<GLuint>(param));    break;
-          case GL_TEXTURE_MAX_LEVEL:            texture->setMaxLevel(static_cast<GLuint>(param));     break;
-          case GL_TEXTURE_MIN_LOD:              texture->setMinLod(static_cast<GLfloat>(param));      break;
-          case GL_TEXTURE_MAX_LOD:              texture->setMaxLod(static_cast<GLfloat>(param));      break;
-          default: UNREACHABLE(); break;
-        }
-        // clang-format on
+        context->texParameteri(target, pname, param);
+
+        ANGLE_CAPTURE(TexParameteri, target, pname, param);
     }
 }
 
@@ -3456,6 +3565,9 @@ void GL_APIENTRY TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint
 
         context->texSubImage2D(target, level, xoffset, yoffset, width, height, format, type,
                                pixels);
+
+        ANGLE_CAPTURE(TexSubImage2D, target, level, xoffset, yoffset, width, height, format, type,
+                      CapturePixelUnpackMemory(context, format, type, width, height, pixels));
     }
 }
 
@@ -3478,6 +3590,8 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform1fv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform1fv, location, count, CaptureArray(v, count));
     }
 }
 
@@ -3498,8 +3612,9 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint* v)
             return;
         }
 
-        Program *program = context->getGLState().getProgram();
-        program->setUniform1iv(location, count, v);
+        context->uniform1iv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform1iv, location, count, CaptureArray(v, count));
     }
 }
 
@@ -3524,6 +3639,8 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform2fv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform2fv, location, count, CaptureArray(v, static_cast<size_t>(count) * 2));
     }
 }
 
@@ -3548,6 +3665,8 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform2iv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform2iv, location, count, CaptureArray(v, static_cast<size_t>(count) * 2));
     }
 }
 
@@ -3572,6 +3691,8 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform3fv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform3fv, location, count, CaptureArray(v, static_cast<size_t>(count) * 3));
     }
 }
 
@@ -3596,6 +3717,8 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform3iv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform3iv, location, count, CaptureArray(v, static_cast<size_t>(count) * 3));
     }
 }
 
@@ -3620,6 +3743,8 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform4fv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform4fv, location, count, CaptureArray(v, static_cast<size_t>(count) * 4));
     }
 }
 
@@ -3644,6 +3769,8 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint* v)
 
         Program *program = context->getGLState().getProgram();
         program->setUniform4iv(location, count, v);
+
+        ANGLE_CAPTURE(Uniform4iv, location, count, CaptureArray(v, static_cast<size_t>(count) * 4));
     }
 }
 
@@ -3662,6 +3789,9 @@ void GL_APIENTRY UniformMatrix2fv(GLint location, GLsizei count, GLboolean trans
 
         Program *program = context->getGLState().getProgram();
         program->setUniformMatrix2fv(location, count, transpose, value);
+
+        ANGLE_CAPTURE(UniformMatrix2fv, location, count, transpose,
+                      CaptureArray(value, static_cast<size_t>(count) * 4));
     }
 }
 
@@ -3680,6 +3810,9 @@ void GL_APIENTRY UniformMatrix3fv(GLint location, GLsizei count, GLboolean trans
 
         Program *program = context->getGLState().getProgram();
         program->setUniformMatrix3fv(location, count, transpose, value);
+
+        ANGLE_CAPTURE(UniformMatrix3fv, location, count, transpose,
+                      CaptureArray(value, static_cast<size_t>(count) * 9));
     }
 }
 
@@ -3698,6 +3831,9 @@ void GL_APIENTRY UniformMatrix4fv(GLint location, GLsizei count, GLboolean trans
 
         Program *program = context->getGLState().getProgram();
         program->setUniformMatrix4fv(location, count, transpose, value);
+
+        ANGLE_CAPTURE(UniformMatrix4fv, location, count, transpose,
+                      CaptureArray(value, static_cast<size_t>(count) * 16));
     }
 }
 
@@ -3714,6 +3850,8 @@ void GL_APIENTRY UseProgram(GLuint program)
         }
 
         context->useProgram(program);
+
+        ANGLE_CAPTURE(UseProgram, program);
     }
 }
 
@@ -3749,6 +3887,8 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
         }
 
         context->vertexAttrib1f(index, x);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, x, 0.0f, 0.0f, 1.0f);
     }
 }
 
@@ -3766,6 +3906,8 @@ void GL_APIENTRY VertexAttrib1fv(GLuint index, const GLfloat* values)
         }
 
         context->vertexAttrib1fv(index, values);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, values[0], 0.0f, 0.0f, 1.0f);
     }
 }
 
@@ -3783,6 +3925,8 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
         }
 
         context->vertexAttrib2f(index, x, y);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, x, y, 0.0f, 1.0f);
     }
 }
 
@@ -3800,6 +3944,8 @@ void GL_APIENTRY VertexAttrib2fv(GLuint index, const GLfloat* values)
         }
 
         context->vertexAttrib2fv(index, values);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, values[0], values[1], 0.0f, 1.0f);
     }
 }
 
@@ -3817,6 +3963,8 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
         }
 
         context->vertexAttrib3f(index, x, y, z);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, x, y, z, 1.0f);
     }
 }
 
@@ -3834,6 +3982,8 @@ void GL_APIENTRY VertexAttrib3fv(GLuint index, const GLfloat* values)
         }
 
         context->vertexAttrib3fv(index, values);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, values[0], values[1], values[2], 1.0f);
     }
 }
 
@@ -3851,6 +4001,8 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
         }
 
         context->vertexAttrib4f(index, x, y, z, w);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, x, y, z, w);
     }
 }
 
@@ -3868,6 +4020,8 @@ void GL_APIENTRY VertexAttrib4fv(GLuint index, const GLfloat* values)
         }
 
         context->vertexAttrib4fv(index, values);
+
+        ANGLE_CAPTURE(VertexAttrib4f, index, values[0], values[1], values[2], values[3]);
     }
 }
 
@@ -3943,6 +4097,11 @@ void GL_APIENTRY VertexAttribPointer(GLuint index, GLint size, GLenum type, GLbo
         }
 
         context->vertexAttribPointer(index, size, type, normalized, stride, ptr);
+
+        if (gCaptureActive)
+        {
+            CaptureVertexAttribPointer(context, index, size, type, normalized, stride, ptr);
+        }
     }
 }
 
@@ -3960,6 +4119,8 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
         }
 
         context->viewport(x, y, width, height);
+
+        ANGLE_CAPTURE(Viewport, x, y, width, height);
     }
 }
 
@@ -7,6 +7,7 @@
 // entry_points_gles_2_0_ext.cpp : Implements the GLES 2.0 extension entry points.
 
 #include "libGLESv2/entry_points_gles_2_0_ext.h"
+#include "libGLESv2/capture_gles.h"
 #include "libGLESv2/global_state.h"
 
 #include "libANGLE/Buffer.h"
@@ -273,6 +274,8 @@ void GL_APIENTRY DrawArraysInstancedANGLE(GLenum mode,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
         {
             return;
@@ -301,6 +304,8 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         IndexRange indexRange;
         if (!ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount,
                                                 &indexRange))
@@ -551,6 +556,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target, GLsizei samp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateRenderbufferStorageParametersANGLE(context, target, samples, internalformat,
             width, height))
         {
@@ -640,6 +647,8 @@ void GL_APIENTRY TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalf
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->getExtensions().textureStorage)
         {
             context->handleError(Error(GL_INVALID_OPERATION));
@@ -678,6 +687,8 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->handleError(Error(GL_INVALID_VALUE));
@@ -714,6 +725,8 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0, GLint srcY0, GLint srcX1, GLi
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateBlitFramebufferANGLE(context, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
                                           dstY1, mask, filter))
@@ -733,6 +746,8 @@ void GL_APIENTRY DiscardFramebufferEXT(GLenum target, GLsizei numAttachments, co
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateDiscardFramebufferEXT(context, target, numAttachments, attachments))
         {
@@ -787,6 +802,8 @@ void GL_APIENTRY ProgramBinaryOES(GLuint program, GLenum binaryFormat, const voi
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateProgramBinaryOES(context, program, binaryFormat, binary, length))
         {
             return;
@@ -811,6 +828,8 @@ void GL_APIENTRY DrawBuffersEXT(GLsizei n, const GLenum *bufs)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateDrawBuffersEXT(context, n, bufs))
         {
             return;
@@ -844,6 +863,8 @@ void *GL_APIENTRY MapBufferOES(GLenum target, GLenum access)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateMapBufferOES(context, target, access))
         {
             return nullptr;
@@ -862,6 +883,8 @@ GLboolean GL_APIENTRY UnmapBufferOES(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateUnmapBufferOES(context, target))
         {
             return GL_FALSE;
@@ -881,6 +904,8 @@ void *GL_APIENTRY MapBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr l
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateMapBufferRangeEXT(context, target, offset, length, access))
         {
@@ -900,6 +925,8 @@ void GL_APIENTRY FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsiz
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateFlushMappedBufferRangeEXT(context, target, offset, length))
         {
@@ -996,6 +1023,8 @@ ANGLE_EXPORT void GL_APIENTRY EGLImageTargetTexture2DOES(GLenum target, GLeglIma
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         egl::Display *display   = egl::GetGlobalDisplay();
         egl::Image *imageObject = reinterpret_cast<egl::Image *>(image);
         if (!ValidateEGLImageTargetTexture2DOES(context, display, target, imageObject))
@@ -1021,6 +1050,8 @@ ANGLE_EXPORT void GL_APIENTRY EGLImageTargetRenderbufferStorageOES(GLenum target
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         egl::Display *display   = egl::GetGlobalDisplay();
         egl::Image *imageObject = reinterpret_cast<egl::Image *>(image);
         if (!ValidateEGLImageTargetRenderbufferStorageOES(context, display, target, imageObject))
@@ -1045,6 +1076,8 @@ void GL_APIENTRY BindVertexArrayOES(GLuint array)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateBindVertexArrayOES(context, array))
         {
             return;
@@ -1061,6 +1094,8 @@ void GL_APIENTRY DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateDeleteVertexArraysOES(context, n))
         {
             return;
@@ -1083,6 +1118,8 @@ void GL_APIENTRY GenVertexArraysOES(GLsizei n, GLuint *arrays)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateGenVertexArraysOES(context, n))
         {
             return;
@@ -1356,6 +1393,8 @@ ANGLE_EXPORT void GL_APIENTRY BindUniformLocationCHROMIUM(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateBindUniformLocationCHROMIUM(context, program, location, name))
         {
             return;
@@ -1372,6 +1411,8 @@ ANGLE_EXPORT void GL_APIENTRY CoverageModulationCHROMIUM(GLenum components)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!ValidateCoverageModulationCHROMIUM(context, components))
         {
             return;
@@ -1388,6 +1429,8 @@ ANGLE_EXPORT void GL_APIENTRY MatrixLoadfCHROMIUM(GLenum matrixMode, const GLflo
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateMatrix(context, matrixMode, matrix))
         {
             return;
@@ -1403,6 +1446,8 @@ ANGLE_EXPORT void GL_APIENTRY MatrixLoadIdentityCHROMIUM(GLenum matrixMode)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateMatrixMode(context, matrixMode))
         {
             return;
@@ -1418,6 +1463,8 @@ ANGLE_EXPORT GLuint GL_APIENTRY GenPathsCHROMIUM(GLsizei range)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateGenPaths(context, range))
         {
             return 0;
@@ -1434,6 +1481,8 @@ ANGLE_EXPORT void GL_APIENTRY DeletePathsCHROMIUM(GLuint first, GLsizei range)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateDeletePaths(context, first, range))
         {
             return;
@@ -1473,6 +1522,8 @@ ANGLE_EXPORT void GL_APIENTRY PathCommandsCHROMIUM(GLuint path,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation())
         {
             if (!ValidatePathCommands(context, path, numCommands, commands, numCoords, coordType,
@@ -1492,6 +1543,8 @@ ANGLE_EXPORT void GL_APIENTRY PathParameterfCHROMIUM(GLuint path, GLenum pname,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateSetPathParameter(context, path, pname, value))
         {
             return;
@@ -1535,6 +1588,8 @@ ANGLE_EXPORT void GL_APIENTRY PathStencilFuncCHROMIUM(GLenum func, GLint ref, GL
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidatePathStencilFunc(context, func, ref, mask))
         {
             return;
@@ -1550,6 +1605,8 @@ ANGLE_EXPORT void GL_APIENTRY StencilFillPathCHROMIUM(GLuint path, GLenum fillMo
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateStencilFillPath(context, path, fillMode, mask))
         {
             return;
@@ -1565,6 +1622,8 @@ ANGLE_EXPORT void GL_APIENTRY StencilStrokePathCHROMIUM(GLuint path, GLint refer
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilStrokePath(context, path, reference, mask))
         {
@@ -1581,6 +1640,8 @@ ANGLE_EXPORT void GL_APIENTRY CoverFillPathCHROMIUM(GLuint path, GLenum coverMod
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateCoverPath(context, path, coverMode))
         {
             return;
@@ -1596,6 +1657,8 @@ ANGLE_EXPORT void GL_APIENTRY CoverStrokePathCHROMIUM(GLuint path, GLenum coverM
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() && !ValidateCoverPath(context, path, coverMode))
         {
             return;
@@ -1615,6 +1678,8 @@ ANGLE_EXPORT void GL_APIENTRY StencilThenCoverFillPathCHROMIUM(GLuint path,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilThenCoverFillPath(context, path, fillMode, mask, coverMode))
         {
@@ -1635,6 +1700,8 @@ ANGLE_EXPORT void GL_APIENTRY StencilThenCoverStrokePathCHROMIUM(GLuint path,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilThenCoverStrokePath(context, path, reference, mask, coverMode))
         {
@@ -1661,6 +1728,8 @@ ANGLE_EXPORT void GL_APIENTRY CoverFillPathInstancedCHROMIUM(GLsizei numPaths,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateCoverFillPathInstanced(context, numPaths, pathNameType, paths, pathBase,
                                             coverMode, transformType, transformValues))
@@ -1689,6 +1758,8 @@ ANGLE_EXPORT void GL_APIENTRY CoverStrokePathInstancedCHROMIUM(GLsizei numPaths,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateCoverStrokePathInstanced(context, numPaths, pathNameType, paths, pathBase,
                                               coverMode, transformType, transformValues))
@@ -1718,6 +1789,8 @@ ANGLE_EXPORT void GL_APIENTRY StencilStrokePathInstancedCHROMIUM(GLsizei numPath
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilStrokePathInstanced(context, numPaths, pathNameType, paths, pathBase,
                                                 reference, mask, transformType, transformValues))
@@ -1747,6 +1820,8 @@ ANGLE_EXPORT void GL_APIENTRY StencilFillPathInstancedCHROMIUM(GLsizei numPaths,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilFillPathInstanced(context, numPaths, pathNameType, paths, pathBase,
                                               fillMode, mask, transformType, transformValues))
@@ -1778,6 +1853,8 @@ StencilThenCoverFillPathInstancedCHROMIUM(GLsizei numPaths,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilThenCoverFillPathInstanced(context, numPaths, pathNameType, paths,
                                                        pathBase, fillMode, mask, coverMode,
@@ -1813,6 +1890,8 @@ StencilThenCoverStrokePathInstancedCHROMIUM(GLsizei numPaths,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateStencilThenCoverStrokePathInstanced(context, numPaths, pathNameType, paths,
                                                          pathBase, reference, mask, coverMode,
@@ -1836,6 +1915,8 @@ ANGLE_EXPORT void GL_APIENTRY BindFragmentInputLocationCHROMIUM(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateBindFragmentInputLocation(context, program, location, name))
         {
@@ -1859,6 +1940,8 @@ ANGLE_EXPORT void GL_APIENTRY ProgramPathFragmentInputGenCHROMIUM(GLuint program
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateProgramPathFragmentInputGen(context, program, location, genMode, components,
                                                  coeffs))
@@ -1887,6 +1970,8 @@ ANGLE_EXPORT void GL_APIENTRY CopyTextureCHROMIUM(GLuint sourceId,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateCopyTextureCHROMIUM(context, sourceId, destId, internalFormat, destType,
                                          unpackFlipY, unpackPremultiplyAlpha,
@@ -1922,6 +2007,8 @@ ANGLE_EXPORT void GL_APIENTRY CopySubTextureCHROMIUM(GLuint sourceId,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE_UNSUPPORTED();
+
         if (!context->skipValidation() &&
             !ValidateCopySubTextureCHROMIUM(context, sourceId, destId, xoffset, yoffset, x, y,
                                             width, height, unpackFlipY, unpackPremultiplyAlpha,
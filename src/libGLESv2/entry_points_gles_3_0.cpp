@@ -1769,7 +1769,7 @@ void GL_APIENTRY UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, G
             return;
         }
 
-        programObject->bindUniformBlock(uniformBlockIndex, uniformBlockBinding);
+        context->uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
     }
 }
 
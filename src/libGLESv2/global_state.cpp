@@ -12,6 +12,7 @@
 #include "libANGLE/Error.h"
 
 #include "common/debug.h"
+#include "common/entry_point_counters.h"
 #include "common/platform.h"
 #include "common/tls.h"
 
@@ -20,6 +21,12 @@ namespace
 
 static TLSIndex currentTLS = TLS_INVALID_INDEX;
 
+#if defined(ANGLE_THREAD_LOCAL)
+// Copy of the context in the current data of the thread, so that the GL entry points don't have to
+// look up the TLS index.
+static ANGLE_THREAD_LOCAL gl::Context *currentContext = nullptr;
+#endif
+
 struct Current
 {
     EGLint error;
@@ -77,6 +84,10 @@ void DeallocateCurrent()
     Current *current = reinterpret_cast<Current*>(GetTLSValue(currentTLS));
     SafeDelete(current);
     SetTLSValue(currentTLS, NULL);
+
+#if defined(ANGLE_THREAD_LOCAL)
+    currentContext = nullptr;
+#endif
 }
 
 extern "C" BOOL WINAPI DllMain(HINSTANCE, DWORD reason, LPVOID)
@@ -98,6 +109,7 @@ extern "C" BOOL WINAPI DllMain(HINSTANCE, DWORD reason, LPVOID)
 
       case DLL_THREAD_DETACH:
         DeallocateCurrent();
+        angle::ReleaseCurrentThreadEntryPointCounters();
         break;
 
       case DLL_PROCESS_DETACH:
@@ -121,9 +133,13 @@ namespace gl
 
 Context *GetGlobalContext()
 {
+#if defined(ANGLE_THREAD_LOCAL)
+    return currentContext;
+#else
     Current *current = GetCurrentData();
 
     return current->context;
+#endif
 }
 
 Context *GetValidGlobalContext()
@@ -224,13 +240,15 @@ void SetGlobalContext(gl::Context *context)
     Current *current = GetCurrentData();
 
     current->context = context;
+
+#if defined(ANGLE_THREAD_LOCAL)
+    currentContext = context;
+#endif
 }
 
 gl::Context *GetGlobalContext()
 {
-    Current *current = GetCurrentData();
-
-    return current->context;
+    return gl::GetGlobalContext();
 }
 
 }
@@ -9,9 +9,12 @@
 
 #include <gtest/gtest.h>
 
+#include "perf_tests/ANGLEPerfTest.h"
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
+    ANGLEProcessPerfTestArgs(&argc, argv);
     testing::AddGlobalTestEnvironment(new testing::Environment());
     int rt = RUN_ALL_TESTS();
     return rt;
@@ -572,13 +572,13 @@ TEST_F(DebugShaderPrecisionTest, BinaryMathRounding)
     ASSERT_TRUE(foundInAllGLSLCode("v2 = angle_frm((angle_frm(u2) - angle_frm(u3)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v3 = angle_frm((angle_frm(u3) * angle_frm(u4)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v4 = angle_frm((angle_frm(u4) / angle_frm(u5)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v6 = angle_frm((v5 = angle_frm(u5)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v6 = (v5 = angle_frm(u5))"));
 
     ASSERT_TRUE(foundInHLSLCode("v1 = angle_frm((angle_frm(_u1) + angle_frm(_u2)))"));
     ASSERT_TRUE(foundInHLSLCode("v2 = angle_frm((angle_frm(_u2) - angle_frm(_u3)))"));
     ASSERT_TRUE(foundInHLSLCode("v3 = angle_frm((angle_frm(_u3) * angle_frm(_u4)))"));
     ASSERT_TRUE(foundInHLSLCode("v4 = angle_frm((angle_frm(_u4) / angle_frm(_u5)))"));
-    ASSERT_TRUE(foundInHLSLCode("v6 = angle_frm((_v5 = angle_frm(_u5)))"));
+    ASSERT_TRUE(foundInHLSLCode("v6 = (_v5 = angle_frm(_u5))"));
 }
 
 TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
@@ -664,21 +664,19 @@ TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
     ASSERT_TRUE(foundInAllGLSLCode("v14 = angle_frm(log2(angle_frm(u1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v15 = angle_frm(sqrt(angle_frm(u1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v16 = angle_frm(inversesqrt(angle_frm(u1)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v17 = angle_frm(abs(angle_frm(u1)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v17 = abs(angle_frm(u1))"));
     ASSERT_TRUE(foundInAllGLSLCode("v18 = angle_frm(sign(angle_frm(u1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v19 = angle_frm(floor(angle_frm(u1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v20 = angle_frm(ceil(angle_frm(u1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v21 = angle_frm(fract(angle_frm(u1)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v22 = angle_frm(mod(angle_frm(u1), angle_frm(uf)))"));
     ASSERT_TRUE(foundInAllGLSLCode("v23 = angle_frm(mod(angle_frm(u1), angle_frm(u2)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v24 = angle_frm(min(angle_frm(u1), angle_frm(uf)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v25 = angle_frm(min(angle_frm(u1), angle_frm(u2)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v26 = angle_frm(max(angle_frm(u1), angle_frm(uf)))"));
-    ASSERT_TRUE(foundInAllGLSLCode("v27 = angle_frm(max(angle_frm(u1), angle_frm(u2)))"));
-    ASSERT_TRUE(
-        foundInAllGLSLCode("v28 = angle_frm(clamp(angle_frm(u1), angle_frm(u2), angle_frm(u3)))"));
-    ASSERT_TRUE(
-        foundInAllGLSLCode("v29 = angle_frm(clamp(angle_frm(u1), angle_frm(uf), angle_frm(uf2)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v24 = min(angle_frm(u1), angle_frm(uf))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v25 = min(angle_frm(u1), angle_frm(u2))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v26 = max(angle_frm(u1), angle_frm(uf))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v27 = max(angle_frm(u1), angle_frm(u2))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v28 = clamp(angle_frm(u1), angle_frm(u2), angle_frm(u3))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v29 = clamp(angle_frm(u1), angle_frm(uf), angle_frm(uf2))"));
     ASSERT_TRUE(
         foundInAllGLSLCode("v30 = angle_frm(mix(angle_frm(u1), angle_frm(u2), angle_frm(u3)))"));
     ASSERT_TRUE(
@@ -719,21 +717,19 @@ TEST_F(DebugShaderPrecisionTest, BuiltInMathFunctionRounding)
     ASSERT_TRUE(foundInHLSLCode("v14 = angle_frm(log2(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v15 = angle_frm(sqrt(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v16 = angle_frm(rsqrt(angle_frm(_u1)))"));
-    ASSERT_TRUE(foundInHLSLCode("v17 = angle_frm(abs(angle_frm(_u1)))"));
+    ASSERT_TRUE(foundInHLSLCode("v17 = abs(angle_frm(_u1))"));
     ASSERT_TRUE(foundInHLSLCode("v18 = angle_frm(sign(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v19 = angle_frm(floor(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v20 = angle_frm(ceil(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v21 = angle_frm(frac(angle_frm(_u1)))"));
     ASSERT_TRUE(foundInHLSLCode("v22 = angle_frm(webgl_mod_emu(angle_frm(_u1), angle_frm(_uf)))"));
     ASSERT_TRUE(foundInHLSLCode("v23 = angle_frm(webgl_mod_emu(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(foundInHLSLCode("v24 = angle_frm(min(angle_frm(_u1), angle_frm(_uf)))"));
-    ASSERT_TRUE(foundInHLSLCode("v25 = angle_frm(min(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(foundInHLSLCode("v26 = angle_frm(max(angle_frm(_u1), angle_frm(_uf)))"));
-    ASSERT_TRUE(foundInHLSLCode("v27 = angle_frm(max(angle_frm(_u1), angle_frm(_u2)))"));
-    ASSERT_TRUE(
-        foundInHLSLCode("v28 = angle_frm(clamp(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3)))"));
-    ASSERT_TRUE(
-        foundInHLSLCode("v29 = angle_frm(clamp(angle_frm(_u1), angle_frm(_uf), angle_frm(_uf2)))"));
+    ASSERT_TRUE(foundInHLSLCode("v24 = min(angle_frm(_u1), angle_frm(_uf))"));
+    ASSERT_TRUE(foundInHLSLCode("v25 = min(angle_frm(_u1), angle_frm(_u2))"));
+    ASSERT_TRUE(foundInHLSLCode("v26 = max(angle_frm(_u1), angle_frm(_uf))"));
+    ASSERT_TRUE(foundInHLSLCode("v27 = max(angle_frm(_u1), angle_frm(_u2))"));
+    ASSERT_TRUE(foundInHLSLCode("v28 = clamp(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3))"));
+    ASSERT_TRUE(foundInHLSLCode("v29 = clamp(angle_frm(_u1), angle_frm(_uf), angle_frm(_uf2))"));
     ASSERT_TRUE(
         foundInHLSLCode("v30 = angle_frm(lerp(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3)))"));
     ASSERT_TRUE(
@@ -805,13 +801,13 @@ TEST_F(DebugShaderPrecisionTest, ConstructorRounding)
         "   gl_FragColor = v1 + v2;\n"
         "}\n";
     compile(shaderString);
-    // Note: this is suboptimal for the case taking four floats, but optimizing would be tricky.
+    // The floats are rounded already, the converted ints are not.
     ASSERT_TRUE(foundInAllGLSLCode(
-        "v1 = angle_frm(vec4(angle_frm(u1), angle_frm(u2), angle_frm(u3), angle_frm(u4)))"));
+        "v1 = vec4(angle_frm(u1), angle_frm(u2), angle_frm(u3), angle_frm(u4))"));
     ASSERT_TRUE(foundInAllGLSLCode("v2 = angle_frm(vec4(uiv))"));
 
     ASSERT_TRUE(foundInHLSLCode(
-        "v1 = angle_frm(vec4(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3), angle_frm(_u4)))"));
+        "v1 = vec4(angle_frm(_u1), angle_frm(_u2), angle_frm(_u3), angle_frm(_u4))"));
     ASSERT_TRUE(foundInHLSLCode("v2 = angle_frm(vec4(_uiv))"));
 }
 
@@ -1023,3 +1019,66 @@ TEST_F(DebugShaderPrecisionTest, ModfOutParameter)
     ASSERT_TRUE(foundInAllGLSLCode("modf(angle_frm(u), o)"));
     ASSERT_TRUE(foundInHLSLCode("modf(angle_frm(_u), _o)"));
 }
+
+// Test that local variables only ever assigned rounded values are read without rounding them again.
+TEST_F(DebugShaderPrecisionTest, RoundedVariableReadNotRounded)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u1;\n"
+        "uniform vec4 u2;\n"
+        "void main() {\n"
+        "   vec4 v1 = u1 + u2;\n"
+        "   vec4 v2 = vec4(0.5, 1.0, 0.0, -2.0);\n"
+        "   v2 *= v1;\n"
+        "   gl_FragColor = v1 + v2;\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInAllGLSLCode("v1 = angle_frm((angle_frm(u1) + angle_frm(u2)))"));
+    ASSERT_TRUE(foundInAllGLSLCode("v2 = vec4(0.5, 1.0, 0.0, -2.0)"));
+    ASSERT_TRUE(foundInAllGLSLCode("angle_compound_mul_frm(v2, v1)"));
+    ASSERT_TRUE(foundInAllGLSLCode("gl_FragColor = angle_frm((v1 + v2))"));
+
+    ASSERT_TRUE(foundInHLSLCode("v2 = {0.5, 1.0, 0.0, -2.0}"));
+    ASSERT_TRUE(foundInHLSLCode("angle_compound_mul_frm(_v2, _v1)"));
+    ASSERT_TRUE(foundInHLSLCode("gl_Color[0] = angle_frm((_v1 + _v2))"));
+}
+
+// Test that variables written without rounding are still rounded when read.
+TEST_F(DebugShaderPrecisionTest, UnroundedVariableReadRounded)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u1;\n"
+        "void foo(out vec4 f) { f = vec4(0.1); }\n"
+        "void main() {\n"
+        "   vec4 v1 = u1;\n"
+        "   v1.x++;\n"
+        "   vec4 v2;\n"
+        "   foo(v2);\n"
+        "   gl_FragColor = v1 + v2;\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInAllGLSLCode("gl_FragColor = angle_frm((angle_frm(v1) + angle_frm(v2)))"));
+    ASSERT_TRUE(foundInHLSLCode("gl_Color[0] = angle_frm((angle_frm(_v1) + angle_frm(_v2)))"));
+}
+
+// Test that constructors are rounded unless all their arguments are rounded values.
+TEST_F(DebugShaderPrecisionTest, ConstructorOfConstantsRounding)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "void main() {\n"
+        "   vec4 v1 = vec4(u, 0.25, 0.0, 1.0);\n"
+        "   vec4 v2 = vec4(u, 0.1, 0.0, 1.0);\n"
+        "   gl_FragColor = v1 + v2;\n"
+        "}\n";
+    compile(shaderString);
+    ASSERT_TRUE(foundInAllGLSLCode("v1 = vec4(angle_frm(u), 0.25, 0.0, 1.0)"));
+    ASSERT_TRUE(foundInAllGLSLCode("v2 = angle_frm(vec4(angle_frm(u), 0.1, 0.0, 1.0))"));
+    ASSERT_TRUE(foundInAllGLSLCode("gl_FragColor = angle_frm((v1 + v2))"));
+
+    ASSERT_TRUE(foundInHLSLCode("v1 = vec4(angle_frm(_u), 0.25, 0.0, 1.0)"));
+    ASSERT_TRUE(foundInHLSLCode("v2 = angle_frm(vec4(angle_frm(_u), 0.1, 0.0, 1.0))"));
+}
@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HelperFunctionCacheHLSL_test.cpp:
+//   Tests that the HLSL helper functions shared through the process-wide cache are written the
+//   same way in all the shaders using them.
+//   This test can only be enabled when HLSL support is enabled.
+//
+
+#include "angle_gl.h"
+#include "compiler/translator/HelperFunctionCacheHLSL.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "tests/test_utils/compiler_test.h"
+
+namespace
+{
+
+class HelperFunctionCacheHLSLTest : public testing::Test
+{
+  public:
+    HelperFunctionCacheHLSLTest() {}
+
+  protected:
+    std::string compile(const std::string &shaderString, ShShaderOutput output)
+    {
+        std::string translatedCode;
+        std::string infoLog;
+        bool compilationSuccess =
+            compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, output, shaderString,
+                              SH_VARIABLES, &translatedCode, &infoLog);
+        EXPECT_TRUE(compilationSuccess) << infoLog;
+        return translatedCode;
+    }
+};
+
+// Translating a shader again writes the same code without generating any helper.
+TEST_F(HelperFunctionCacheHLSLTest, SameCodeFromCachedHelpers)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "uniform vec4 u[2];\n"
+        "in vec2 v;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "   vec4 a[2] = u;\n"
+        "   vec4 b[2];\n"
+        "   b = a;\n"
+        "   vec4 c[2] = vec4[2](u[1], u[0]);\n"
+        "   mat2 m = mat2(u[0]);\n"
+        "   color = textureLod(s, v, 1.0) + textureProj(s, vec3(v, 2.0)) + vec4(m * v, v);\n"
+        "   if (a == c) {\n"
+        "       color += vec4(v.x, u[0].yzw) + b[1];\n"
+        "   }\n"
+        "}\n";
+    const std::string &translatedCode = compile(shaderString, SH_HLSL_4_1_OUTPUT);
+    const size_t cacheSize            = sh::HelperFunctionCacheHLSL::size();
+
+    EXPECT_NE(std::string::npos, translatedCode.find("gl_texture2DLod("));
+    EXPECT_NE(std::string::npos, translatedCode.find("gl_texture2DProj("));
+    EXPECT_NE(std::string::npos, translatedCode.find("void angle_assign_2_float4("));
+    EXPECT_NE(std::string::npos, translatedCode.find("void angle_construct_into_2_float4("));
+    EXPECT_NE(std::string::npos, translatedCode.find("bool angle_eq_2_float4("));
+    EXPECT_NE(std::string::npos, translatedCode.find("float2x2 mat2_float4(float4 x0)"));
+
+    EXPECT_EQ(translatedCode, compile(shaderString, SH_HLSL_4_1_OUTPUT));
+    EXPECT_EQ(cacheSize, sh::HelperFunctionCacheHLSL::size());
+}
+
+// The texture functions depend on the output type.
+TEST_F(HelperFunctionCacheHLSLTest, TextureFunctionsPerOutputType)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "varying vec2 v;\n"
+        "void main() {\n"
+        "   gl_FragColor = texture2D(s, v);\n"
+        "}\n";
+    const std::string &hlsl4Code = compile(shaderString, SH_HLSL_4_1_OUTPUT);
+    const std::string &hlsl3Code = compile(shaderString, SH_HLSL_3_0_OUTPUT);
+
+    EXPECT_NE(std::string::npos, hlsl4Code.find(".Sample("));
+    EXPECT_EQ(std::string::npos, hlsl3Code.find(".Sample("));
+    EXPECT_NE(std::string::npos, hlsl3Code.find("tex2D("));
+}
+
+// Overloads of a texture function sharing its name are cached separately.
+TEST_F(HelperFunctionCacheHLSLTest, TextureFunctionOverloads)
+{
+    const std::string &vec3ShaderString =
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "varying vec3 v;\n"
+        "void main() {\n"
+        "   gl_FragColor = texture2DProj(s, v);\n"
+        "}\n";
+    const std::string &vec4ShaderString =
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "varying vec4 v;\n"
+        "void main() {\n"
+        "   gl_FragColor = texture2DProj(s, v);\n"
+        "}\n";
+    const std::string &vec3Code = compile(vec3ShaderString, SH_HLSL_4_1_OUTPUT);
+    const std::string &vec4Code = compile(vec4ShaderString, SH_HLSL_4_1_OUTPUT);
+
+    const std::string vec3Header = "gl_texture2DProj(const uint samplerIndex, float3 t)";
+    const std::string vec4Header = "gl_texture2DProj(const uint samplerIndex, float4 t)";
+    EXPECT_NE(std::string::npos, vec3Code.find(vec3Header));
+    EXPECT_EQ(std::string::npos, vec3Code.find(vec4Header));
+    EXPECT_NE(std::string::npos, vec4Code.find(vec4Header));
+    EXPECT_EQ(std::string::npos, vec4Code.find(vec3Header));
+}
+
+// The array helpers of structs are written by each shader, along with the struct helpers they
+// use.
+TEST_F(HelperFunctionCacheHLSLTest, StructArrayHelpersNotCached)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "struct S { vec4 f; };\n"
+        "uniform S u[2];\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "   S a[2] = u;\n"
+        "   color = (a == u) ? a[0].f : a[1].f;\n"
+        "}\n";
+    const std::string &translatedCode = compile(shaderString, SH_HLSL_4_1_OUTPUT);
+    EXPECT_NE(std::string::npos, translatedCode.find("bool angle_eq_2__S("));
+    EXPECT_NE(std::string::npos, translatedCode.find("bool angle_eq__S("));
+
+    EXPECT_EQ(translatedCode, compile(shaderString, SH_HLSL_4_1_OUTPUT));
+}
+
+}  // anonymous namespace
@@ -10,6 +10,11 @@
 #include "angle_gl.h"
 #include "gtest/gtest.h"
 #include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/Cache.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
 
 class ShCompileTest : public testing::Test
 {
@@ -41,6 +46,47 @@ class ShCompileTest : public testing::Test
         EXPECT_EQ(expectation, success) << compileLog;
     }
 
+    // Compiles a batch of shaders and checks the results against compiling them one by one.
+    void testCompileShaders(size_t numThreads)
+    {
+        std::vector<std::string> sources;
+        for (int i = 0; i < 16; ++i)
+        {
+            std::stringstream source;
+            source << "precision mediump float;\n"
+                   << "uniform vec4 u" << i << ";\n"
+                   << "void main() {\n"
+                   << "    gl_FragColor = u" << i << " * " << i << ".0;\n"
+                   << "}\n";
+            sources.push_back(source.str());
+        }
+        sources[5] = "void main() { undefined(); }\n";
+
+        std::vector<const char *> shaderSources;
+        for (const std::string &source : sources)
+        {
+            shaderSources.push_back(source.c_str());
+        }
+
+        std::vector<ShCompileResult> results;
+        bool success = ShCompileShaders(mCompiler, shaderSources.data(), shaderSources.size(),
+                                        SH_OBJECT_CODE | SH_VARIABLES, numThreads, &results);
+        EXPECT_FALSE(success);
+        ASSERT_EQ(sources.size(), results.size());
+
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            const char *shaderStrings[] = {shaderSources[i]};
+            bool expectedSuccess =
+                ShCompile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES);
+            EXPECT_EQ(i != 5, expectedSuccess);
+            EXPECT_EQ(expectedSuccess, results[i].success);
+            EXPECT_EQ(ShGetInfoLog(mCompiler), results[i].infoLog);
+            EXPECT_EQ(ShGetObjectCode(mCompiler), results[i].objectCode);
+            EXPECT_EQ(*ShGetUniforms(mCompiler), results[i].uniforms);
+        }
+    }
+
   private:
     ShBuiltInResources mResources;
     ShHandle mCompiler;
@@ -81,3 +127,50 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
 
     testCompile(shaderStrings, 3, true);
 }
+
+// Test compiling a batch of shaders with ShCompileShaders on the calling thread.
+TEST_F(ShCompileTest, CompileShaders)
+{
+    testCompileShaders(1);
+}
+
+// Test compiling a batch of shaders with ShCompileShaders on several threads, twice to reuse the
+// cloned compilers.
+TEST_F(ShCompileTest, CompileShadersOnThreads)
+{
+    testCompileShaders(4);
+    testCompileShaders(4);
+}
+
+// Test that the types cached while compiling on several threads are shared by all the threads,
+// including the types first needed during the compiles.
+TEST_F(ShCompileTest, TypeCacheOnThreads)
+{
+    ASSERT_TRUE(ShInitialize());
+
+    const unsigned int kThreadCount = 4;
+    std::vector<std::vector<const TType *>> threadTypes(kThreadCount);
+    std::vector<std::thread> threads;
+    for (unsigned int threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.push_back(std::thread([&threadTypes, threadIndex]() {
+            for (unsigned char primarySize = 1; primarySize <= 4; ++primarySize)
+            {
+                for (unsigned char secondarySize = 1; secondarySize <= 4; ++secondarySize)
+                {
+                    threadTypes[threadIndex].push_back(TCache::getType(
+                        EbtFloat, EbpLow, EvqConst, primarySize, secondarySize));
+                }
+            }
+        }));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int threadIndex = 1; threadIndex < kThreadCount; ++threadIndex)
+    {
+        EXPECT_EQ(threadTypes[0], threadTypes[threadIndex]);
+    }
+}
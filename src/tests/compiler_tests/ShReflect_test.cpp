@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShReflect_test.cpp
+//   Test the reflection-only ShReflect and ShReflectShaders interfaces.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+const char kVertexShader[] =
+    "#version 300 es\n"
+    "in vec4 position;\n"
+    "in vec2 texCoord;\n"
+    "out vec2 vTexCoord;\n"
+    "struct Light { vec3 direction; float intensity; };\n"
+    "layout(std140) uniform Lights {\n"
+    "    mat4 transform;\n"
+    "    Light lights[2];\n"
+    "    vec3 ambient;\n"
+    "    float exposure;\n"
+    "};\n"
+    "uniform mat4 mvp;\n"
+    "void main() {\n"
+    "    vTexCoord = texCoord * lights[1].intensity * exposure;\n"
+    "    gl_Position = transform * mvp * position;\n"
+    "}\n";
+
+const char kFragmentShader[] =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "in vec2 vTexCoord;\n"
+    "uniform sampler2D tex;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    color = texture(tex, vTexCoord);\n"
+    "}\n";
+
+class ShReflectTest : public testing::Test
+{
+  public:
+    ShReflectTest() : mCompiler(nullptr) {}
+
+  protected:
+    void SetUp() override { ShInitBuiltInResources(&mResources); }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            ShDestruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    void constructCompiler(sh::GLenum shaderType)
+    {
+        mCompiler = ShConstructCompiler(shaderType, SH_GLES3_SPEC, SH_ESSL_OUTPUT, &mResources);
+        ASSERT_TRUE(mCompiler != nullptr) << "Compiler could not be constructed.";
+    }
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler;
+};
+
+// Reflection returns the same variables as a full compile, without producing object code.
+TEST_F(ShReflectTest, MatchesCompile)
+{
+    constructCompiler(GL_VERTEX_SHADER);
+
+    const char *shaderStrings[] = {kVertexShader};
+    ShReflection reflection;
+    ASSERT_TRUE(ShReflect(mCompiler, shaderStrings, 1, SH_VARIABLES, &reflection))
+        << reflection.infoLog;
+    EXPECT_TRUE(ShGetObjectCode(mCompiler).empty());
+    EXPECT_EQ(300, reflection.shaderVersion);
+
+    ASSERT_TRUE(ShCompile(mCompiler, shaderStrings, 1, SH_VARIABLES | SH_OBJECT_CODE));
+    EXPECT_EQ(*ShGetUniforms(mCompiler), reflection.uniforms);
+    EXPECT_EQ(*ShGetVaryings(mCompiler), reflection.varyings);
+    EXPECT_EQ(*ShGetAttributes(mCompiler), reflection.attributes);
+    ASSERT_EQ(ShGetInterfaceBlocks(mCompiler)->size(), reflection.interfaceBlocks.size());
+    EXPECT_TRUE((*ShGetInterfaceBlocks(mCompiler))[0].isSameInterfaceBlockAtLinkTime(
+        reflection.interfaceBlocks[0]));
+}
+
+// Reflection broadcasts gl_FragColor to all the draw buffers like a full compile, so that the
+// output variables match.
+TEST_F(ShReflectTest, FragColorBroadcastMatchesCompile)
+{
+    mResources.EXT_draw_buffers = 1;
+    mResources.MaxDrawBuffers   = 4;
+    mCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &mResources);
+    ASSERT_TRUE(mCompiler != nullptr) << "Compiler could not be constructed.";
+
+    const char *shaderStrings[] = {
+        "#extension GL_EXT_draw_buffers : require\n"
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(1.0);\n"
+        "}\n"};
+    ShReflection reflection;
+    ASSERT_TRUE(ShReflect(mCompiler, shaderStrings, 1, SH_VARIABLES, &reflection))
+        << reflection.infoLog;
+    ASSERT_EQ(1u, reflection.outputVariables.size());
+    EXPECT_EQ("gl_FragData", reflection.outputVariables[0].name);
+    EXPECT_EQ(4u, reflection.outputVariables[0].arraySize);
+
+    ASSERT_TRUE(ShCompile(mCompiler, shaderStrings, 1, SH_VARIABLES | SH_OBJECT_CODE));
+    EXPECT_EQ(*ShGetOutputVariables(mCompiler), reflection.outputVariables);
+}
+
+// The std140 layout of uniform blocks is returned along with the variables.
+TEST_F(ShReflectTest, Std140Layout)
+{
+    constructCompiler(GL_VERTEX_SHADER);
+
+    const char *shaderStrings[] = {kVertexShader};
+    ShReflection reflection;
+    ASSERT_TRUE(ShReflect(mCompiler, shaderStrings, 1, SH_VARIABLES, &reflection))
+        << reflection.infoLog;
+
+    ASSERT_EQ(1u, reflection.interfaceBlocks.size());
+    ASSERT_EQ(1u, reflection.interfaceBlockLayouts.size());
+    ASSERT_EQ(1u, reflection.interfaceBlockDataSizes.size());
+
+    const auto &layout = reflection.interfaceBlockLayouts[0];
+    ASSERT_EQ(7u, layout.size());
+    EXPECT_EQ(0, layout.at("transform").offset);
+    EXPECT_EQ(16, layout.at("transform").matrixStride);
+    EXPECT_EQ(64, layout.at("lights[0].direction").offset);
+    EXPECT_EQ(76, layout.at("lights[0].intensity").offset);
+    EXPECT_EQ(80, layout.at("lights[1].direction").offset);
+    EXPECT_EQ(92, layout.at("lights[1].intensity").offset);
+    EXPECT_EQ(96, layout.at("ambient").offset);
+    EXPECT_EQ(108, layout.at("exposure").offset);
+    EXPECT_EQ(112u, reflection.interfaceBlockDataSizes[0]);
+}
+
+// Shaders that fail to compile report their errors in the info log.
+TEST_F(ShReflectTest, CompileError)
+{
+    constructCompiler(GL_FRAGMENT_SHADER);
+
+    const char *shaderStrings[] = {"#version 300 es\nvoid main() { undefined(); }\n"};
+    ShReflection reflection;
+    EXPECT_FALSE(ShReflect(mCompiler, shaderStrings, 1, SH_VARIABLES, &reflection));
+    EXPECT_FALSE(reflection.success);
+    EXPECT_NE(std::string::npos, reflection.infoLog.find("ERROR"));
+}
+
+// Many shaders can be reflected with one compiler, with one result per shader.
+TEST_F(ShReflectTest, ReflectShaders)
+{
+    constructCompiler(GL_FRAGMENT_SHADER);
+
+    const char *invalidShader       = "#version 300 es\nvoid main() { undefined(); }\n";
+    const char *shaderSources[]     = {kFragmentShader, invalidShader, kFragmentShader};
+    std::vector<ShReflection> reflections;
+    EXPECT_FALSE(ShReflectShaders(mCompiler, shaderSources, 3, SH_VARIABLES, &reflections));
+
+    ASSERT_EQ(3u, reflections.size());
+    EXPECT_TRUE(reflections[0].success);
+    EXPECT_FALSE(reflections[1].success);
+    EXPECT_TRUE(reflections[2].success);
+
+    for (size_t index : {0u, 2u})
+    {
+        ASSERT_EQ(1u, reflections[index].uniforms.size());
+        EXPECT_EQ("tex", reflections[index].uniforms[0].name);
+        EXPECT_EQ(static_cast<GLenum>(GL_SAMPLER_2D), reflections[index].uniforms[0].type);
+        ASSERT_EQ(1u, reflections[index].outputVariables.size());
+        EXPECT_EQ("color", reflections[index].outputVariables[0].name);
+    }
+}
+
+}  // anonymous namespace
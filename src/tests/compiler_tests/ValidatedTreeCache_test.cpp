@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ValidatedTreeCache_test.cpp:
+//   Test that compiling with SH_CACHE_VALIDATED_TREE produces the same results as compiling
+//   from scratch, both when the cached tree is reused and when it needs to be invalidated.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+const char kShaderA[] =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "struct S { vec4 v[4]; int i; };\n"
+    "uniform S u;\n"
+    "uniform int idx;\n"
+    "out vec4 color;\n"
+    "vec4 f(S s) { return s.v[s.i]; }\n"
+    "void main() {\n"
+    "    vec4 acc = vec4(0.0);\n"
+    "    for (int i = 0; i < 4; ++i) {\n"
+    "        if (i == idx) { break; }\n"
+    "        acc += u.v[i];\n"
+    "    }\n"
+    "    do { acc += f(u); } while (acc.x < 0.0);\n"
+    "    switch (idx) { case 0: acc.y = 1.0; break; default: acc.y = 2.0; }\n"
+    "    color = acc + pow(acc, vec4(2.0)) + u.v[idx];\n"
+    "}\n";
+
+const char kShaderB[] =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "uniform vec4 u[2];\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    color = u[0] * u[1];\n"
+    "}\n";
+
+const int kBackendOptions[] = {
+    0,
+    SH_CLAMP_INDIRECT_ARRAY_BOUNDS,
+    SH_INIT_OUTPUT_VARIABLES | SH_VARIABLES,
+    SH_REWRITE_DO_WHILE_LOOPS | SH_UNFOLD_SHORT_CIRCUIT | SH_REMOVE_POW_WITH_CONSTANT_EXPONENT,
+};
+
+class ValidatedTreeCacheTest : public testing::Test
+{
+  public:
+    ValidatedTreeCacheTest() {}
+
+  protected:
+    void SetUp() override
+    {
+        ShInitBuiltInResources(&mResources);
+        mCachingCompiler =
+            ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT, &mResources);
+        mReferenceCompiler =
+            ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT, &mResources);
+        ASSERT_TRUE(mCachingCompiler != nullptr) << "Compiler could not be constructed.";
+        ASSERT_TRUE(mReferenceCompiler != nullptr) << "Compiler could not be constructed.";
+    }
+
+    void TearDown() override
+    {
+        ShDestruct(mCachingCompiler);
+        ShDestruct(mReferenceCompiler);
+    }
+
+    // Compiles the shader with and without the cache and checks that the results agree.
+    void compileAndCompare(const char *shader, int compileOptions)
+    {
+        const char *shaderStrings[] = {shader};
+        int options                 = compileOptions | SH_OBJECT_CODE;
+
+        bool referenceResult = ShCompile(mReferenceCompiler, shaderStrings, 1, options);
+        bool cachedResult =
+            ShCompile(mCachingCompiler, shaderStrings, 1, options | SH_CACHE_VALIDATED_TREE);
+
+        EXPECT_EQ(referenceResult, cachedResult);
+        EXPECT_EQ(ShGetInfoLog(mReferenceCompiler), ShGetInfoLog(mCachingCompiler));
+        EXPECT_EQ(ShGetObjectCode(mReferenceCompiler), ShGetObjectCode(mCachingCompiler));
+    }
+
+    ShBuiltInResources mResources;
+    ShHandle mCachingCompiler;
+    ShHandle mReferenceCompiler;
+};
+
+// Recompiling the same source with different back-end options reuses the cached tree.
+TEST_F(ValidatedTreeCacheTest, DifferentBackendOptions)
+{
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int options : kBackendOptions)
+        {
+            compileAndCompare(kShaderA, options);
+        }
+    }
+}
+
+// Changing the source invalidates the cached tree.
+TEST_F(ValidatedTreeCacheTest, SourceChange)
+{
+    compileAndCompare(kShaderA, 0);
+    compileAndCompare(kShaderB, 0);
+    compileAndCompare(kShaderA, SH_CLAMP_INDIRECT_ARRAY_BOUNDS);
+    compileAndCompare(kShaderB, SH_CLAMP_INDIRECT_ARRAY_BOUNDS);
+}
+
+// Changing an option that affects validation invalidates the cached tree.
+TEST_F(ValidatedTreeCacheTest, ValidationOptionChange)
+{
+    compileAndCompare(kShaderA, 0);
+    compileAndCompare(kShaderA, SH_VALIDATE_LOOP_INDEXING);
+    compileAndCompare(kShaderA, 0);
+}
+
+// A shader that fails to compile is not cached, and the same errors are reported each time.
+TEST_F(ValidatedTreeCacheTest, CompileError)
+{
+    const char kInvalidShader[] =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "    color = undefinedVariable;\n"
+        "}\n";
+
+    compileAndCompare(kInvalidShader, 0);
+    compileAndCompare(kInvalidShader, 0);
+    compileAndCompare(kShaderB, 0);
+}
+
+}  // anonymous namespace
@@ -33,14 +33,22 @@ EGLBoolean SafeDestroyContext(EGLDisplay display, EGLContext &context)
 class EGLContextSharingTest : public ANGLETest
 {
   public:
-    EGLContextSharingTest() : mContexts{EGL_NO_CONTEXT, EGL_NO_CONTEXT}, mTexture(0) {}
+    EGLContextSharingTest() : mContexts{EGL_NO_CONTEXT, EGL_NO_CONTEXT}, mTexture(0), mProgram(0) {}
 
     void TearDown() override
     {
-        glDeleteTextures(1, &mTexture);
-
         EGLDisplay display = getEGLWindow()->getDisplay();
 
+        // A test may end with one of its own contexts current.
+        if (display != EGL_NO_DISPLAY)
+        {
+            EGLSurface surface = getEGLWindow()->getSurface();
+            eglMakeCurrent(display, surface, surface, getEGLWindow()->getContext());
+        }
+
+        glDeleteTextures(1, &mTexture);
+        glDeleteProgram(mProgram);
+
         if (display != EGL_NO_DISPLAY)
         {
             for (auto &context : mContexts)
@@ -52,8 +60,62 @@ class EGLContextSharingTest : public ANGLETest
         ANGLETest::TearDown();
     }
 
+  protected:
+    // Creates a context sharing with the test's window context.
+    EGLContext createShareContext()
+    {
+        EGLDisplay display = getEGLWindow()->getDisplay();
+        EGLConfig config   = getEGLWindow()->getConfig();
+
+        const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                         getEGLWindow()->getClientMajorVersion(), EGL_NONE};
+        return eglCreateContext(display, config, getEGLWindow()->getContext(), contextAttribs);
+    }
+
+    void makeCurrent(EGLContext context)
+    {
+        EGLSurface surface = getEGLWindow()->getSurface();
+        EXPECT_EGL_TRUE(eglMakeCurrent(getEGLWindow()->getDisplay(), surface, surface, context));
+    }
+
+    // Draws the texture bound to the texture unit of the "tex" sampler.
+    void compileTextureProgram()
+    {
+        const std::string vs =
+            "attribute vec4 position;\n"
+            "varying vec2 texcoord;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_Position = position;\n"
+            "    texcoord = position.xy * 0.5 + 0.5;\n"
+            "}\n";
+
+        const std::string fs =
+            "precision mediump float;\n"
+            "uniform sampler2D tex;\n"
+            "varying vec2 texcoord;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_FragColor = texture2D(tex, texcoord);\n"
+            "}\n";
+
+        mProgram = CompileProgram(vs, fs);
+        ASSERT_NE(0u, mProgram);
+    }
+
+    GLuint createColorTexture(const GLColor &color)
+    {
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &color);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        return texture;
+    }
+
     EGLContext mContexts[2];
     GLuint mTexture;
+    GLuint mProgram;
 };
 
 // Tests that creating resources works after freeing the share context.
@@ -82,6 +144,77 @@ TEST_P(EGLContextSharingTest, BindTextureAfterShareContextFree)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that a texture parameter change made in a share context is seen by the next draw of a
+// context that already drew with the texture.
+TEST_P(EGLContextSharingTest, TextureParameterChangeInShareContext)
+{
+    mContexts[0] = createShareContext();
+    ASSERT_EGL_SUCCESS();
+    ASSERT_TRUE(mContexts[0] != EGL_NO_CONTEXT);
+
+    compileTextureProgram();
+
+    // Without mipmaps, the default minification filter leaves the texture incomplete.
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    makeCurrent(mContexts[0]);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glUseProgram(mProgram);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+
+    makeCurrent(getEGLWindow()->getContext());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    makeCurrent(mContexts[0]);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a sampler uniform change made in a share context is seen by the next draw of a
+// context using the program.
+TEST_P(EGLContextSharingTest, SamplerUniformChangeInShareContext)
+{
+    mContexts[0] = createShareContext();
+    ASSERT_EGL_SUCCESS();
+    ASSERT_TRUE(mContexts[0] != EGL_NO_CONTEXT);
+
+    compileTextureProgram();
+    GLint samplerLocation = glGetUniformLocation(mProgram, "tex");
+    ASSERT_NE(-1, samplerLocation);
+
+    GLuint redTexture   = createColorTexture(GLColor::red);
+    GLuint greenTexture = createColorTexture(GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    makeCurrent(mContexts[0]);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, redTexture);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, greenTexture);
+    glUseProgram(mProgram);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    makeCurrent(getEGLWindow()->getContext());
+    glUseProgram(mProgram);
+    glUniform1i(samplerLocation, 1);
+    ASSERT_GL_NO_ERROR();
+
+    makeCurrent(mContexts[0]);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    glDeleteTextures(1, &redTexture);
+    glDeleteTextures(1, &greenTexture);
+}
+
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST(EGLContextSharingTest, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL());
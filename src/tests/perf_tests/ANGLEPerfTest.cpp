@@ -10,10 +10,122 @@
 #include "ANGLEPerfTest.h"
 
 #include "third_party/perf/perf_test.h"
+#include "system_utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace
+{
+
+struct PerfTestOptions
+{
+    unsigned int trials  = 5;
+    double warmupSeconds = 1.0;
+    std::string resultsFile;
+};
+
+PerfTestOptions gOptions;
+
+bool ParseArg(const char *arg, const char *name, const char **value)
+{
+    size_t nameLength = strlen(name);
+    if (strncmp(arg, name, nameLength) != 0)
+    {
+        return false;
+    }
+    *value = arg + nameLength;
+    return true;
+}
+
+// Linear interpolation between the closest ranks of |sortedValues|.
+double Percentile(const std::vector<double> &sortedValues, double percentile)
+{
+    double rank       = percentile / 100.0 * static_cast<double>(sortedValues.size() - 1);
+    size_t lowerIndex = static_cast<size_t>(std::floor(rank));
+    size_t upperIndex = std::min(lowerIndex + 1, sortedValues.size() - 1);
+    double fraction   = rank - static_cast<double>(lowerIndex);
+    return sortedValues[lowerIndex] +
+           (sortedValues[upperIndex] - sortedValues[lowerIndex]) * fraction;
+}
+
+// Sample standard deviation.
+double StandardDeviation(const std::vector<double> &values)
+{
+    if (values.size() < 2)
+    {
+        return 0.0;
+    }
+
+    double mean = 0.0;
+    for (double value : values)
+    {
+        mean += value;
+    }
+    mean /= static_cast<double>(values.size());
+
+    double sumOfSquares = 0.0;
+    for (double value : values)
+    {
+        sumOfSquares += (value - mean) * (value - mean);
+    }
+    return std::sqrt(sumOfSquares / static_cast<double>(values.size() - 1));
+}
+
+std::string ValueList(const std::vector<double> &values)
+{
+    std::ostringstream stream;
+    stream.precision(10);
+    for (size_t index = 0; index < values.size(); ++index)
+    {
+        stream << (index > 0 ? "," : "") << values[index];
+    }
+    return stream.str();
+}
+
+}  // anonymous namespace
+
+void ANGLEProcessPerfTestArgs(int *argc, char **argv)
+{
+    int argcOut = 1;
+    for (int argIndex = 1; argIndex < *argc; ++argIndex)
+    {
+        const char *value = nullptr;
+        if (ParseArg(argv[argIndex], "--trials=", &value))
+        {
+            gOptions.trials = static_cast<unsigned int>(std::max(1, atoi(value)));
+        }
+        else if (ParseArg(argv[argIndex], "--warmup-seconds=", &value))
+        {
+            gOptions.warmupSeconds = std::max(0.0, atof(value));
+        }
+        else if (ParseArg(argv[argIndex], "--pin-core=", &value))
+        {
+            unsigned int core = static_cast<unsigned int>(atoi(value));
+            if (!angle::SetCurrentThreadAffinity(core))
+            {
+                std::cerr << "Failed to pin the tests to core " << core << std::endl;
+            }
+        }
+        else if (ParseArg(argv[argIndex], "--results-file=", &value))
+        {
+            gOptions.resultsFile = value;
+        }
+        else
+        {
+            argv[argcOut++] = argv[argIndex];
+        }
+    }
+    *argc = argcOut;
+}
 
 ANGLEPerfTest::ANGLEPerfTest(const std::string &name, const std::string &suffix)
     : mName(name),
@@ -21,7 +133,9 @@ ANGLEPerfTest::ANGLEPerfTest(const std::string &name, const std::string &suffix)
       mTimer(nullptr),
       mRunTimeSeconds(5.0),
       mNumStepsPerformed(0),
-      mRunning(true)
+      mRunning(true),
+      mNumTrialStepsPerformed(0),
+      mTrialsWallTimeSeconds(0.0)
 {
     mTimer = CreateTimer();
 }
@@ -34,30 +148,122 @@ ANGLEPerfTest::~ANGLEPerfTest()
 void ANGLEPerfTest::run()
 {
     mTimer->start();
-    while (mRunning)
+
+    // The warmup lets the caches and the driver settle, and tells how fast the steps are.
+    unsigned int warmupSteps =
+        runSteps(std::numeric_limits<unsigned int>::max(), gOptions.warmupSeconds);
+    finishTest();
+    double warmupSeconds = mTimer->getElapsedTime();
+
+    // The trials run a fixed number of steps, so that all of them measure the same work.
+    double trialSeconds        = mRunTimeSeconds / static_cast<double>(gOptions.trials);
+    double stepsPerTrialDouble = 1.0;
+    if (warmupSteps > 0 && warmupSeconds > 0.0)
+    {
+        stepsPerTrialDouble = std::round(warmupSteps * trialSeconds / warmupSeconds);
+    }
+    unsigned int stepsPerTrial = static_cast<unsigned int>(std::min(
+        std::max(stepsPerTrialDouble, 1.0),
+        static_cast<double>(std::numeric_limits<unsigned int>::max())));
+
+    for (unsigned int trial = 0; trial < gOptions.trials && mRunning; ++trial)
+    {
+        double wallStartTime = mTimer->getElapsedTime();
+        double cpuStartTime  = angle::GetCurrentProcessCpuTime();
+
+        unsigned int steps = runSteps(stepsPerTrial, std::numeric_limits<double>::infinity());
+        finishTest();
+
+        double wallSeconds = mTimer->getElapsedTime() - wallStartTime;
+        double cpuSeconds  = angle::GetCurrentProcessCpuTime() - cpuStartTime;
+        if (steps == 0)
+        {
+            break;
+        }
+
+        mNumTrialStepsPerformed += steps;
+        mTrialsWallTimeSeconds += wallSeconds;
+        mTrialWallTimes.push_back(wallSeconds * 1.0e9 / static_cast<double>(steps));
+        mTrialCpuTimes.push_back(cpuSeconds * 1.0e9 / static_cast<double>(steps));
+    }
+
+    mTimer->stop();
+}
+
+unsigned int ANGLEPerfTest::runSteps(unsigned int maxSteps, double maxSeconds)
+{
+    double startTime   = mTimer->getElapsedTime();
+    bool checkTime     = std::isfinite(maxSeconds);
+    unsigned int steps = 0;
+    while (mRunning && steps < maxSteps)
     {
         step();
-        if (mRunning)
+        if (!mRunning)
         {
-            ++mNumStepsPerformed;
+            break;
         }
-        if (mTimer->getElapsedTime() > mRunTimeSeconds)
+
+        ++mNumStepsPerformed;
+        ++steps;
+
+        if (checkTime && mTimer->getElapsedTime() - startTime > maxSeconds)
         {
-            mRunning = false;
+            break;
         }
     }
-    finishTest();
-    mTimer->stop();
+    return steps;
 }
 
 void ANGLEPerfTest::printResult(const std::string &trace, double value, const std::string &units, bool important) const
 {
-    perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
+    std::string result;
+    perf_test::AppendResult(result, mName, mSuffix, trace, value, units, important);
+    writeResult(result);
 }
 
 void ANGLEPerfTest::printResult(const std::string &trace, size_t value, const std::string &units, bool important) const
 {
-    perf_test::PrintResult(mName, mSuffix, trace, value, units, important);
+    std::string result;
+    perf_test::AppendResult(result, mName, mSuffix, trace, value, units, important);
+    writeResult(result);
+}
+
+void ANGLEPerfTest::printStatistics(const std::string &trace,
+                                    const std::vector<double> &values,
+                                    const std::string &units) const
+{
+    if (values.empty())
+    {
+        return;
+    }
+
+    std::vector<double> sortedValues(values);
+    std::sort(sortedValues.begin(), sortedValues.end());
+
+    printResult(trace, Percentile(sortedValues, 50.0), units, true);
+    printResult(trace + "_p10", Percentile(sortedValues, 10.0), units, false);
+    printResult(trace + "_p90", Percentile(sortedValues, 90.0), units, false);
+    printResult(trace + "_stddev", StandardDeviation(values), units, false);
+
+    // The list of all the trials is what scripts/perf_test_compare.py tests the significance of
+    // the differences with.
+    std::string result;
+    perf_test::AppendResultList(result, mName, mSuffix, trace + "_trials", ValueList(values),
+                                units, false);
+    writeResult(result);
+}
+
+void ANGLEPerfTest::writeResult(const std::string &result) const
+{
+    fflush(stdout);
+    printf("%s", result.c_str());
+    fflush(stdout);
+
+    if (!gOptions.resultsFile.empty())
+    {
+        std::ofstream resultsFile(gOptions.resultsFile, std::ios::app);
+        resultsFile << result;
+    }
 }
 
 void ANGLEPerfTest::SetUp()
@@ -66,8 +272,27 @@ void ANGLEPerfTest::SetUp()
 
 void ANGLEPerfTest::TearDown()
 {
-    double relativeScore = static_cast<double>(mNumStepsPerformed) / mTimer->getElapsedTime();
+    double relativeScore = getStepsPerSecond();
+    if (relativeScore == 0.0)
+    {
+        return;
+    }
+
     printResult("score", static_cast<size_t>(std::round(relativeScore)), "score", true);
+
+    // Per step times, as the wall time includes the waits on the GPU and on other processes,
+    // while the CPU time tells how much work was done on the CPU by all the threads.
+    printStatistics("wall_time", mTrialWallTimes, "ns");
+    printStatistics("cpu_time", mTrialCpuTimes, "ns");
+}
+
+double ANGLEPerfTest::getStepsPerSecond() const
+{
+    if (mNumTrialStepsPerformed == 0 || mTrialsWallTimeSeconds <= 0.0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(mNumTrialStepsPerformed) / mTrialsWallTimeSeconds;
 }
 
 double ANGLEPerfTest::normalizedTime(size_t value) const
@@ -192,3 +417,8 @@ OSWindow *ANGLERenderTest::getWindow()
 {
     return mOSWindow;
 }
+
+EGLWindow *ANGLERenderTest::getEGLWindow()
+{
+    return mEGLWindow;
+}
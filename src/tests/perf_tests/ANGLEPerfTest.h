@@ -31,6 +31,15 @@ class Event;
 #define ASSERT_GL_NO_ERROR() ASSERT_EQ(static_cast<GLenum>(GL_NO_ERROR), glGetError())
 #endif
 
+// Parses and removes the perf test options from the command line:
+//   --trials=N              Number of measured trials, run after the warmup. Defaults to 5.
+//   --warmup-seconds=S      Time spent running the test before the trials, also used to calibrate
+//                           the number of steps of each trial. Defaults to 1.
+//   --pin-core=K            Runs the tests on core K only, to reduce the variance of the results.
+//   --results-file=PATH     Appends the results to PATH too, e.g. to compare them later using
+//                           scripts/perf_test_compare.py.
+void ANGLEProcessPerfTestArgs(int *argc, char **argv);
+
 class ANGLEPerfTest : public testing::Test, angle::NonCopyable
 {
   public:
@@ -43,13 +52,21 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     virtual void finishTest() {}
 
   protected:
+    // Runs steps for the warmup time to find how many steps fit in a trial, then runs the trials
+    // with this fixed number of steps each. The trials share mRunTimeSeconds.
     void run();
     void printResult(const std::string &trace, double value, const std::string &units, bool important) const;
     void printResult(const std::string &trace, size_t value, const std::string &units, bool important) const;
+    // Prints the median, the 10th and 90th percentiles, the standard deviation and the list of
+    // |values|.
+    void printStatistics(const std::string &trace,
+                         const std::vector<double> &values,
+                         const std::string &units) const;
     void SetUp() override;
     void TearDown() override;
 
-    // Normalize a time value according to the number of test loop iterations (mFrameCount)
+    // Normalize a time value according to the number of test loop iterations, including the
+    // warmup.
     double normalizedTime(size_t value) const;
 
     // Call if the test step was aborted and the test should stop running.
@@ -57,14 +74,28 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
 
     unsigned int getNumStepsPerformed() const { return mNumStepsPerformed; }
 
+    // Steps per second over all the trials, or 0 if no trial ran.
+    double getStepsPerSecond() const;
+
     std::string mName;
     std::string mSuffix;
     Timer *mTimer;
     double mRunTimeSeconds;
 
   private:
+    // Runs up to |maxSteps| steps or for up to |maxSeconds|, whichever ends first, and returns the
+    // number of steps performed.
+    unsigned int runSteps(unsigned int maxSteps, double maxSeconds);
+    void writeResult(const std::string &result) const;
+
     unsigned int mNumStepsPerformed;
     bool mRunning;
+
+    // Wall and CPU time per step of each trial, in nanoseconds.
+    unsigned int mNumTrialStepsPerformed;
+    double mTrialsWallTimeSeconds;
+    std::vector<double> mTrialWallTimes;
+    std::vector<double> mTrialCpuTimes;
 };
 
 struct RenderTestParams : public angle::PlatformParameters
@@ -89,13 +120,15 @@ class ANGLERenderTest : public ANGLEPerfTest
     bool popEvent(Event *event);
 
     OSWindow *getWindow();
+    EGLWindow *getEGLWindow();
 
   protected:
+    void SetUp() override;
+    void TearDown() override;
+
     const RenderTestParams &mTestParams;
 
   private:
-    void SetUp() override;
-    void TearDown() override;
 
     void step() override;
     void finishTest() override;
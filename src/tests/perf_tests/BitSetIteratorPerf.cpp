@@ -0,0 +1,130 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BitSetIteratorPerf:
+//   Performance test for iterating dirty bits with std::bitset and the word-based bitsets.
+//
+
+#include <bitset>
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "common/BitSetIterator.h"
+#include "common/bitset_utils.h"
+
+namespace
+{
+
+// Number of dirty bit syncs simulated by a step.
+const unsigned int kIterationsPerStep = 1000;
+
+template <size_t N>
+std::string BitSetSuffix(const std::bitset<N> *)
+{
+    std::stringstream strstr;
+    strstr << "_std_bitset_" << N;
+    return strstr.str();
+}
+
+template <size_t N, typename BitsT>
+std::string BitSetSuffix(const angle::BitSetT<N, BitsT> *)
+{
+    std::stringstream strstr;
+    strstr << "_bitset" << sizeof(BitsT) * 8 << "_" << N;
+    return strstr.str();
+}
+
+template <size_t N>
+std::string BitSetSuffix(const angle::BitSetArray<N> *)
+{
+    std::stringstream strstr;
+    strstr << "_bitset_array_" << N;
+    return strstr.str();
+}
+
+template <size_t N>
+size_t SumSetBits(const std::bitset<N> &bits)
+{
+    size_t sum = 0;
+    for (size_t bit : angle::IterateBitSet(bits))
+    {
+        sum += bit;
+    }
+    return sum;
+}
+
+template <typename T>
+size_t SumSetBits(const T &bits)
+{
+    size_t sum = 0;
+    for (size_t bit : bits)
+    {
+        sum += bit;
+    }
+    return sum;
+}
+
+// Mimics the dirty bits of a draw: a few bits are set, masked, visited once and cleared.
+template <typename T>
+class BitSetIteratorPerfTest : public ANGLEPerfTest
+{
+  public:
+    BitSetIteratorPerfTest();
+
+    void step() override;
+
+  private:
+    T mBits;
+    T mMask;
+    size_t mSum;
+};
+
+template <typename T>
+BitSetIteratorPerfTest<T>::BitSetIteratorPerfTest()
+    : ANGLEPerfTest("BitSetIteratorPerf", BitSetSuffix(static_cast<const T *>(nullptr))),
+      mBits(),
+      mMask(),
+      mSum(0)
+{
+    mMask.set();
+    mMask.reset(1);
+}
+
+template <typename T>
+void BitSetIteratorPerfTest<T>::step()
+{
+    const size_t size = mBits.size();
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; iteration++)
+    {
+        for (size_t bit = 0; bit < 6; bit++)
+        {
+            mBits.set((iteration + bit * 13) % size);
+        }
+
+        const T dirtyBits = mBits & mMask;
+        if (dirtyBits.any())
+        {
+            mSum += SumSetBits(dirtyBits);
+        }
+        mBits.reset();
+    }
+}
+
+// The sizes of gl::State::DirtyBits and gl::VertexArray::DirtyBits.
+typedef testing::Types<std::bitset<79>,
+                       angle::BitSetArray<79>,
+                       std::bitset<49>,
+                       angle::BitSet64<49>,
+                       std::bitset<12>,
+                       angle::BitSet32<12>>
+    BitSetTypes;
+TYPED_TEST_CASE(BitSetIteratorPerfTest, BitSetTypes);
+
+TYPED_TEST(BitSetIteratorPerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
@@ -30,6 +30,7 @@ struct BufferSubDataParams final : public RenderTestParams
         bufferSize = 40000000;
         iterations   = 4;
         updateRate = 1;
+        updateCount  = 1;
     }
 
     std::string suffix() const override;
@@ -39,6 +40,10 @@ struct BufferSubDataParams final : public RenderTestParams
     GLint vertexComponentCount;
     unsigned int updateRate;
 
+    // Number of glBufferSubData calls the update is split into, each one writing the data of the
+    // next few triangles.
+    unsigned int updateCount;
+
     // static parameters
     GLsizeiptr updateSize;
     GLsizeiptr bufferSize;
@@ -250,6 +255,11 @@ std::string BufferSubDataParams::suffix() const
     strstr << vertexComponentCount;
     strstr << "_every" << updateRate;
 
+    if (updateCount > 1)
+    {
+        strstr << "_" << updateCount << "updates";
+    }
+
     return strstr.str();
 }
 
@@ -268,6 +278,7 @@ void BufferSubDataBenchmark::initializeBenchmark()
 
     ASSERT_LT(1, params.vertexComponentCount);
     ASSERT_LT(0u, params.iterations);
+    ASSERT_LT(0u, params.updateCount);
 
     const std::string vs = SHADER_SOURCE
     (
@@ -367,7 +378,14 @@ void BufferSubDataBenchmark::drawBenchmark()
     {
         if (params.updateSize > 0 && ((getNumStepsPerformed() % params.updateRate) == 0))
         {
-            glBufferSubData(GL_ARRAY_BUFFER, 0, params.updateSize, mUpdateData);
+            const GLsizeiptr chunkSize = params.updateSize / params.updateCount;
+            for (unsigned int update = 0; update < params.updateCount; update++)
+            {
+                const GLintptr offset = chunkSize * update;
+                const GLsizeiptr size =
+                    (update + 1 == params.updateCount) ? params.updateSize - offset : chunkSize;
+                glBufferSubData(GL_ARRAY_BUFFER, offset, size, mUpdateData + offset);
+            }
         }
 
         glDrawArrays(GL_TRIANGLES, 0, 3 * mNumTris);
@@ -406,6 +424,19 @@ BufferSubDataParams BufferUpdateOpenGLParams()
     return params;
 }
 
+// Thousands of small updates, one for each triangle.
+BufferSubDataParams BufferUpdateManySmallParams(const EGLPlatformParameters &eglParameters)
+{
+    BufferSubDataParams params;
+    params.eglParameters        = eglParameters;
+    params.vertexType           = GL_FLOAT;
+    params.vertexComponentCount = 4;
+    params.vertexNormalized     = GL_FALSE;
+    params.updateCount          = 2000;
+    params.updateSize           = params.updateCount * 3 * 4 * sizeof(GLfloat);
+    return params;
+}
+
 TEST_P(BufferSubDataBenchmark, Run)
 {
     run();
@@ -413,6 +444,8 @@ TEST_P(BufferSubDataBenchmark, Run)
 
 ANGLE_INSTANTIATE_TEST(BufferSubDataBenchmark,
                        BufferUpdateD3D11Params(), BufferUpdateD3D9Params(),
-                       BufferUpdateOpenGLParams());
+                       BufferUpdateOpenGLParams(),
+                       BufferUpdateManySmallParams(egl_platform::D3D11()),
+                       BufferUpdateManySmallParams(egl_platform::OPENGL()));
 
 } // namespace
@@ -0,0 +1,251 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ClientArrayUploadPerf:
+//   Performance test for draws sourcing their attribute data from client memory.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+struct ClientArrayUploadParams final : public RenderTestParams
+{
+    ClientArrayUploadParams()
+    {
+        // Common default values
+        majorVersion  = 2;
+        minorVersion  = 0;
+        windowWidth   = 512;
+        windowHeight  = 512;
+        numSprites    = 3000;
+        animateColors = false;
+    }
+
+    std::string suffix() const override;
+
+    // static parameters
+    unsigned int numSprites;
+
+    // Rewrite the colors before every draw. They are interleaved with the positions in the same
+    // client array, so this measures whether the unchanged positions are still reused.
+    bool animateColors;
+};
+
+std::string ClientArrayUploadParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+
+    if (eglParameters.clientArrayTracking == EGL_TRUE)
+    {
+        strstr << "_tracking";
+    }
+
+    if (animateColors)
+    {
+        strstr << "_animated_colors";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const ClientArrayUploadParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class ClientArrayUploadBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<ClientArrayUploadParams>
+{
+  public:
+    ClientArrayUploadBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mPointSpriteProgram;
+    GLint mPositionLocation;
+    GLint mColorLocation;
+
+    // Two sets of sprites, each with two floats and 3 unsigned bytes per point sprite
+    std::vector<uint8_t> mPositionColorData[2];
+    const size_t mBytesPerSprite = 2 * sizeof(float) + 3;
+
+    unsigned int mFrame;
+};
+
+ClientArrayUploadBenchmark::ClientArrayUploadBenchmark()
+    : ANGLERenderTest("ClientArrayUpload", GetParam()),
+      mPointSpriteProgram(0),
+      mPositionLocation(-1),
+      mColorLocation(-1),
+      mFrame(0)
+{
+}
+
+void ClientArrayUploadBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    // Compile point sprite shaders
+    const std::string vs =
+        "attribute vec4 aPosition;"
+        "attribute vec4 aColor;"
+        "varying vec4 vColor;"
+        "void main()"
+        "{"
+        "    gl_PointSize = 25.0;"
+        "    gl_Position  = aPosition;"
+        "    vColor = aColor;"
+        "}";
+
+    const std::string fs =
+        "precision mediump float;"
+        "varying vec4 vColor;"
+        "void main()"
+        "{"
+        "    gl_FragColor = vColor;"
+        "}";
+
+    mPointSpriteProgram = CompileProgram(vs, fs);
+    ASSERT_NE(0u, mPointSpriteProgram);
+
+    mPositionLocation = glGetAttribLocation(mPointSpriteProgram, "aPosition");
+    ASSERT_NE(-1, mPositionLocation);
+    mColorLocation = glGetAttribLocation(mPointSpriteProgram, "aColor");
+    ASSERT_NE(-1, mColorLocation);
+
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+
+    for (size_t i = 0; i < ArraySize(mPositionColorData); i++)
+    {
+        // Set up initial data for pointsprite positions and colors
+        std::vector<uint8_t> &positionColorData = mPositionColorData[i];
+        positionColorData.resize(mBytesPerSprite * params.numSprites);
+        for (unsigned int j = 0; j < params.numSprites; j++)
+        {
+            float pointSpriteX =
+                (static_cast<float>(rand() % getWindow()->getWidth()) / getWindow()->getWidth()) *
+                    2.0f - 1.0f;
+            float pointSpriteY =
+                (static_cast<float>(rand() % getWindow()->getHeight()) / getWindow()->getHeight()) *
+                    2.0f - 1.0f;
+
+            // Add position data for the pointsprite
+            *reinterpret_cast<float *>(
+                &(positionColorData[j * mBytesPerSprite + 0 * sizeof(float) + 0])) =
+                pointSpriteX;  // X
+            *reinterpret_cast<float *>(
+                &(positionColorData[j * mBytesPerSprite + 1 * sizeof(float) + 0])) =
+                pointSpriteY;  // Y
+
+            // Add color data for the pointsprite
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                positionColorData[j * mBytesPerSprite + 2 * sizeof(float) + channel] =
+                    static_cast<uint8_t>(rand() % 255);
+            }
+        }
+    }
+
+    glUseProgram(mPointSpriteProgram);
+    glEnableVertexAttribArray(mPositionLocation);
+    glEnableVertexAttribArray(mColorLocation);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ClientArrayUploadBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mPointSpriteProgram);
+}
+
+void ClientArrayUploadBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    for (size_t k = 0; k < 20; k++)
+    {
+        for (size_t i = 0; i < ArraySize(mPositionColorData); i++)
+        {
+            std::vector<uint8_t> &positionColorData = mPositionColorData[i];
+
+            if (params.animateColors)
+            {
+                for (unsigned int j = 0; j < params.numSprites; j++)
+                {
+                    positionColorData[j * mBytesPerSprite + 2 * sizeof(float)] =
+                        static_cast<uint8_t>(mFrame + k);
+                }
+            }
+
+            // Both attributes are sourced from the same interleaved client array
+            glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE,
+                                  static_cast<GLsizei>(mBytesPerSprite), &positionColorData[0]);
+            glVertexAttribPointer(mColorLocation, 3, GL_UNSIGNED_BYTE, GL_TRUE,
+                                  static_cast<GLsizei>(mBytesPerSprite),
+                                  &positionColorData[2 * sizeof(float)]);
+
+            // Then draw the colored pointsprites
+            glDrawArrays(GL_POINTS, 0, params.numSprites);
+            glFlush();
+        }
+    }
+
+    mFrame++;
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(ClientArrayUploadBenchmark, Run)
+{
+    run();
+}
+
+ClientArrayUploadParams D3D11Params()
+{
+    ClientArrayUploadParams params;
+    params.eglParameters = egl_platform::D3D11();
+    return params;
+}
+
+ClientArrayUploadParams D3D9Params()
+{
+    ClientArrayUploadParams params;
+    params.eglParameters = egl_platform::D3D9();
+    return params;
+}
+
+ClientArrayUploadParams OpenGLParams(bool trackClientArrays, bool animateColors)
+{
+    ClientArrayUploadParams params;
+    params.eglParameters = egl_platform::OPENGL();
+    params.eglParameters.clientArrayTracking = trackClientArrays ? EGL_TRUE : EGL_FALSE;
+    params.animateColors = animateColors;
+    return params;
+}
+
+ANGLE_INSTANTIATE_TEST(ClientArrayUploadBenchmark,
+                       D3D11Params(),
+                       D3D9Params(),
+                       OpenGLParams(false, false),
+                       OpenGLParams(true, false),
+                       OpenGLParams(false, true),
+                       OpenGLParams(true, true));
+
+}  // anonymous namespace
@@ -7,6 +7,8 @@
 //   Performance test for device creation.
 //
 
+#include <sstream>
+
 #include "ANGLEPerfTest.h"
 #include "Timer.h"
 #include "test_utils/angle_test_configs.h"
@@ -18,7 +20,7 @@ using namespace testing;
 namespace
 {
 
-// Only applies to D3D11
+// Captures the initialization histograms of the D3D11 and OpenGL back-ends
 class CapturePlatform : public angle::Platform
 {
   public:
@@ -26,7 +28,10 @@ class CapturePlatform : public angle::Platform
         : mTimer(CreateTimer()),
           mLoadDLLsMS(0),
           mCreateDeviceMS(0),
-          mInitResourcesMS(0)
+          mInitResourcesMS(0),
+          mDisplayGLXInitializeMS(0),
+          mFunctionsGLInitializeMS(0),
+          mGenerateCapsMS(0)
     {
         mTimer->start();
     }
@@ -38,12 +43,18 @@ class CapturePlatform : public angle::Platform
     size_t getLoadDLLsMS() const { return mLoadDLLsMS; }
     size_t getCreateDeviceMS() const { return mCreateDeviceMS; }
     size_t getInitResourcesMS() const { return mInitResourcesMS; }
+    size_t getDisplayGLXInitializeMS() const { return mDisplayGLXInitializeMS; }
+    size_t getFunctionsGLInitializeMS() const { return mFunctionsGLInitializeMS; }
+    size_t getGenerateCapsMS() const { return mGenerateCapsMS; }
 
   private:
     Timer *mTimer;
     size_t mLoadDLLsMS;
     size_t mCreateDeviceMS;
     size_t mInitResourcesMS;
+    size_t mDisplayGLXInitializeMS;
+    size_t mFunctionsGLInitializeMS;
+    size_t mGenerateCapsMS;
 };
 
 double CapturePlatform::currentTime()
@@ -68,6 +79,25 @@ void CapturePlatform::histogramCustomCounts(
     {
         mInitResourcesMS += static_cast<size_t>(sample);
     }
+    else if (strcmp(name, "GPU.ANGLE.DisplayGLXInitializeMS") == 0)
+    {
+        mDisplayGLXInitializeMS += static_cast<size_t>(sample);
+    }
+    else if (strcmp(name, "GPU.ANGLE.FunctionsGLInitializeMS") == 0)
+    {
+        mFunctionsGLInitializeMS += static_cast<size_t>(sample);
+    }
+    else if (strcmp(name, "GPU.ANGLE.RendererGLGenerateCapsMS") == 0)
+    {
+        mGenerateCapsMS += static_cast<size_t>(sample);
+    }
+}
+
+std::string RunSuffix(const angle::PlatformParameters &params)
+{
+    std::stringstream strstr;
+    strstr << "_run_" << params;
+    return strstr.str();
 }
 
 class EGLInitializePerfTest : public ANGLEPerfTest,
@@ -87,7 +117,7 @@ class EGLInitializePerfTest : public ANGLEPerfTest,
 };
 
 EGLInitializePerfTest::EGLInitializePerfTest()
-    : ANGLEPerfTest("EGLInitialize", "_run"),
+    : ANGLEPerfTest("EGLInitialize", RunSuffix(GetParam())),
       mOSWindow(nullptr),
       mDisplay(EGL_NO_DISPLAY)
 {
@@ -144,9 +174,24 @@ void EGLInitializePerfTest::step()
 void EGLInitializePerfTest::TearDown()
 {
     ANGLEPerfTest::TearDown();
-    printResult("LoadDLLs", normalizedTime(mCapturePlatform.getLoadDLLsMS()), "ms", true);
-    printResult("D3D11CreateDevice", normalizedTime(mCapturePlatform.getCreateDeviceMS()), "ms", true);
-    printResult("InitResources", normalizedTime(mCapturePlatform.getInitResourcesMS()), "ms", true);
+
+    if (GetParam().getRenderer() == EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE)
+    {
+        printResult("DisplayGLXInitialize",
+                    normalizedTime(mCapturePlatform.getDisplayGLXInitializeMS()), "ms", true);
+        printResult("FunctionsGLInitialize",
+                    normalizedTime(mCapturePlatform.getFunctionsGLInitializeMS()), "ms", true);
+        printResult("GenerateCaps", normalizedTime(mCapturePlatform.getGenerateCapsMS()), "ms",
+                    true);
+    }
+    else
+    {
+        printResult("LoadDLLs", normalizedTime(mCapturePlatform.getLoadDLLsMS()), "ms", true);
+        printResult("D3D11CreateDevice", normalizedTime(mCapturePlatform.getCreateDeviceMS()),
+                    "ms", true);
+        printResult("InitResources", normalizedTime(mCapturePlatform.getInitResourcesMS()), "ms",
+                    true);
+    }
 
     ANGLEPlatformShutdown();
 }
@@ -156,6 +201,6 @@ TEST_P(EGLInitializePerfTest, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest, angle::ES2_D3D11());
+ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest, angle::ES2_D3D11(), angle::ES2_OPENGL());
 
 } // namespace
@@ -0,0 +1,105 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ETCTranscodePerf:
+//   Performance test for the decoding of ETC2 and EAC textures and their transcoding to BC.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+
+namespace
+{
+
+typedef void (*LoadFunction)(size_t,
+                             size_t,
+                             size_t,
+                             const uint8_t *,
+                             size_t,
+                             size_t,
+                             uint8_t *,
+                             size_t,
+                             size_t);
+
+struct ETCTranscodeParams
+{
+    const char *name;
+    LoadFunction loadFunction;
+    // Size of a 4x4 block of the ETC input
+    size_t inputBlockSize;
+    // Rows of pixels for decoded outputs, rows of blocks for transcoded ones
+    size_t outputRowPitch;
+    size_t outputRowCount;
+};
+
+const size_t kTextureSize = 1024;
+
+std::ostream &operator<<(std::ostream &os, const ETCTranscodeParams &params)
+{
+    return os << params.name;
+}
+
+class ETCTranscodePerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<ETCTranscodeParams>
+{
+  public:
+    ETCTranscodePerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+ETCTranscodePerfTest::ETCTranscodePerfTest()
+    : ANGLEPerfTest("ETCTranscodePerf", std::string("_") + GetParam().name)
+{
+    const size_t blockCount = (kTextureSize / 4) * (kTextureSize / 4);
+
+    // Random blocks use all of the ETC2 modes
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    mInput.resize(blockCount * GetParam().inputBlockSize);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(byteDistribution(generator));
+    }
+
+    mOutput.resize(GetParam().outputRowPitch * GetParam().outputRowCount);
+}
+
+void ETCTranscodePerfTest::step()
+{
+    const ETCTranscodeParams &params = GetParam();
+    const size_t inputRowPitch       = (kTextureSize / 4) * params.inputBlockSize;
+    params.loadFunction(kTextureSize, kTextureSize, 1, mInput.data(), inputRowPitch, 0,
+                        mOutput.data(), params.outputRowPitch, 0);
+}
+
+TEST_P(ETCTranscodePerfTest, Run)
+{
+    run();
+}
+
+// The full decode and the transcode of each format.
+const ETCTranscodeParams kETCTranscodeParams[] = {
+    {"eac_r11_to_r8", angle::LoadEACR11ToR8, 8, kTextureSize, kTextureSize},
+    {"eac_r11_to_bc4", angle::LoadEACR11ToBC4, 8, kTextureSize * 2, kTextureSize / 4},
+    {"eac_rg11_to_rg8", angle::LoadEACRG11ToRG8, 16, kTextureSize * 2, kTextureSize},
+    {"eac_rg11_to_bc5", angle::LoadEACRG11ToBC5, 16, kTextureSize * 4, kTextureSize / 4},
+    {"etc2_rgb8_to_rgba8", angle::LoadETC2RGB8ToRGBA8, 8, kTextureSize * 4, kTextureSize},
+    {"etc2_rgb8_to_bc1", angle::LoadETC2RGB8ToBC1, 8, kTextureSize * 2, kTextureSize / 4},
+    {"etc2_rgba8_to_rgba8", angle::LoadETC2RGBA8ToRGBA8, 16, kTextureSize * 4, kTextureSize},
+    {"etc2_rgba8_to_bc3", angle::LoadETC2RGBA8ToBC3, 16, kTextureSize * 4, kTextureSize / 4},
+};
+
+INSTANTIATE_TEST_CASE_P(, ETCTranscodePerfTest, ::testing::ValuesIn(kETCTranscodeParams));
+
+}  // anonymous namespace
@@ -0,0 +1,202 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointOverheadPerf:
+//   Performance tests for the overhead of trivial GL entry points, dominated by the current
+//   context lookup and the validation.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+enum class EntryPoint
+{
+    GetError,
+    Uniform1f,
+};
+
+struct EntryPointOverheadParams final : public RenderTestParams
+{
+    EntryPointOverheadParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+
+        strstr << RenderTestParams::suffix();
+
+        if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+        {
+            strstr << "_null";
+        }
+
+        switch (entryPoint)
+        {
+            case EntryPoint::GetError:
+                strstr << "_get_error";
+                break;
+            case EntryPoint::Uniform1f:
+                strstr << "_uniform1f";
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        return strstr.str();
+    }
+
+    EntryPoint entryPoint   = EntryPoint::GetError;
+    unsigned int iterations = 10000;
+};
+
+std::ostream &operator<<(std::ostream &os, const EntryPointOverheadParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class EntryPointOverheadBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<EntryPointOverheadParams>
+{
+  public:
+    EntryPointOverheadBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  protected:
+    void TearDown() override;
+
+  private:
+    GLuint mProgram        = 0;
+    GLint mUniformLocation = -1;
+};
+
+EntryPointOverheadBenchmark::EntryPointOverheadBenchmark()
+    : ANGLERenderTest("EntryPointOverhead", GetParam())
+{
+}
+
+void EntryPointOverheadBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_LT(0u, params.iterations);
+
+    const std::string vs = SHADER_SOURCE
+    (
+        attribute vec2 vPosition;
+        void main()
+        {
+            gl_Position = vec4(vPosition, 0, 1);
+        }
+    );
+
+    const std::string fs = SHADER_SOURCE
+    (
+        precision mediump float;
+        uniform float uValue;
+        void main()
+        {
+            gl_FragColor = vec4(uValue, 0.0, 0.0, 1.0);
+        }
+    );
+
+    mProgram = CompileProgram(vs, fs);
+    ASSERT_NE(0u, mProgram);
+
+    glUseProgram(mProgram);
+
+    mUniformLocation = glGetUniformLocation(mProgram, "uValue");
+    ASSERT_NE(-1, mUniformLocation);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void EntryPointOverheadBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void EntryPointOverheadBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    switch (params.entryPoint)
+    {
+        case EntryPoint::GetError:
+            for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+            {
+                glGetError();
+            }
+            break;
+
+        case EntryPoint::Uniform1f:
+            for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+            {
+                glUniform1f(mUniformLocation, static_cast<float>(iteration & 1));
+            }
+            break;
+
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void EntryPointOverheadBenchmark::TearDown()
+{
+    double callsPerSecond = getStepsPerSecond() * GetParam().iterations;
+    if (callsPerSecond > 0.0)
+    {
+        printResult("ns_per_call", 1.0e9 / callsPerSecond, "ns", true);
+    }
+
+    ANGLERenderTest::TearDown();
+}
+
+using namespace egl_platform;
+
+EntryPointOverheadParams EntryPointOverheadParamsFor(const EGLPlatformParameters &eglParameters,
+                                                     EntryPoint entryPoint)
+{
+    EntryPointOverheadParams params;
+    params.eglParameters = eglParameters;
+    params.entryPoint    = entryPoint;
+    return params;
+}
+
+TEST_P(EntryPointOverheadBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(EntryPointOverheadBenchmark,
+                       EntryPointOverheadParamsFor(D3D11_NULL(), EntryPoint::GetError),
+                       EntryPointOverheadParamsFor(D3D11_NULL(), EntryPoint::Uniform1f),
+                       EntryPointOverheadParamsFor(D3D9_NULL(), EntryPoint::GetError),
+                       EntryPointOverheadParamsFor(D3D9_NULL(), EntryPoint::Uniform1f),
+                       EntryPointOverheadParamsFor(OPENGL_NULL(), EntryPoint::GetError),
+                       EntryPointOverheadParamsFor(OPENGL_NULL(), EntryPoint::Uniform1f));
+
+}  // anonymous namespace
@@ -0,0 +1,176 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HalfFloatConversionPerf:
+//   Performance test for the conversions to and from half floats and packed floats, one value at
+//   a time or with the bulk functions.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <vector>
+
+#include "common/mathutil.h"
+
+namespace
+{
+
+enum class Conversion
+{
+    Float32ToFloat16,
+    Float16ToFloat32,
+    AverageHalfFloats,
+    RGBFloatsToR11G11B10F,
+};
+
+struct HalfFloatConversionParams
+{
+    const char *name;
+    Conversion conversion;
+    bool bulk;
+};
+
+// Values converted by each step, and pixels for the packed formats.
+const size_t kValueCount = 1024 * 1024;
+
+std::ostream &operator<<(std::ostream &os, const HalfFloatConversionParams &params)
+{
+    return os << params.name << (params.bulk ? "_bulk" : "_single");
+}
+
+class HalfFloatConversionPerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<HalfFloatConversionParams>
+{
+  public:
+    HalfFloatConversionPerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<float> mFloats;
+    std::vector<unsigned short> mHalfFloats;
+    std::vector<unsigned short> mOtherHalfFloats;
+    std::vector<float> mFloatOutput;
+    std::vector<unsigned short> mHalfFloatOutput;
+    std::vector<unsigned int> mPackedOutput;
+};
+
+HalfFloatConversionPerfTest::HalfFloatConversionPerfTest()
+    : ANGLEPerfTest("HalfFloatConversionPerf",
+                    std::string("_") + GetParam().name + (GetParam().bulk ? "_bulk" : "_single"))
+{
+    // Color values in the range of the half floats, like the ones of most textures
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> floatDistribution(-2.0f, 2.0f);
+    mFloats.resize(kValueCount * 3);
+    for (float &value : mFloats)
+    {
+        value = floatDistribution(generator);
+    }
+
+    mHalfFloats.resize(kValueCount);
+    mOtherHalfFloats.resize(kValueCount);
+    for (size_t i = 0; i < kValueCount; i++)
+    {
+        mHalfFloats[i]      = gl::float32ToFloat16(mFloats[i]);
+        mOtherHalfFloats[i] = gl::float32ToFloat16(mFloats[i + kValueCount]);
+    }
+
+    mFloatOutput.resize(kValueCount);
+    mHalfFloatOutput.resize(kValueCount);
+    mPackedOutput.resize(kValueCount);
+}
+
+void HalfFloatConversionPerfTest::step()
+{
+    const HalfFloatConversionParams &params = GetParam();
+    switch (params.conversion)
+    {
+        case Conversion::Float32ToFloat16:
+            if (params.bulk)
+            {
+                gl::float32ToFloat16(mFloats.data(), mHalfFloatOutput.data(), kValueCount);
+            }
+            else
+            {
+                for (size_t i = 0; i < kValueCount; i++)
+                {
+                    mHalfFloatOutput[i] = gl::float32ToFloat16(mFloats[i]);
+                }
+            }
+            break;
+
+        case Conversion::Float16ToFloat32:
+            if (params.bulk)
+            {
+                gl::float16ToFloat32(mHalfFloats.data(), mFloatOutput.data(), kValueCount);
+            }
+            else
+            {
+                for (size_t i = 0; i < kValueCount; i++)
+                {
+                    mFloatOutput[i] = gl::float16ToFloat32(mHalfFloats[i]);
+                }
+            }
+            break;
+
+        case Conversion::AverageHalfFloats:
+            if (params.bulk)
+            {
+                gl::averageHalfFloats(mHalfFloats.data(), mOtherHalfFloats.data(),
+                                      mHalfFloatOutput.data(), kValueCount);
+            }
+            else
+            {
+                for (size_t i = 0; i < kValueCount; i++)
+                {
+                    mHalfFloatOutput[i] = gl::averageHalfFloat(mHalfFloats[i], mOtherHalfFloats[i]);
+                }
+            }
+            break;
+
+        case Conversion::RGBFloatsToR11G11B10F:
+            if (params.bulk)
+            {
+                gl::convertRGBFloatsToR11G11B10F(mFloats.data(), mPackedOutput.data(),
+                                                 kValueCount);
+            }
+            else
+            {
+                for (size_t i = 0; i < kValueCount; i++)
+                {
+                    const float *pixel = &mFloats[i * 3];
+                    mPackedOutput[i] = gl::float32ToFloat11(pixel[0]) |
+                                       gl::float32ToFloat11(pixel[1]) << 11 |
+                                       gl::float32ToFloat10(pixel[2]) << 22;
+                }
+            }
+            break;
+    }
+}
+
+TEST_P(HalfFloatConversionPerfTest, Run)
+{
+    run();
+}
+
+const HalfFloatConversionParams kHalfFloatConversionParams[] = {
+    {"float32_to_float16", Conversion::Float32ToFloat16, false},
+    {"float32_to_float16", Conversion::Float32ToFloat16, true},
+    {"float16_to_float32", Conversion::Float16ToFloat32, false},
+    {"float16_to_float32", Conversion::Float16ToFloat32, true},
+    {"average_float16", Conversion::AverageHalfFloats, false},
+    {"average_float16", Conversion::AverageHalfFloats, true},
+    {"rgb_float32_to_r11g11b10f", Conversion::RGBFloatsToR11G11B10F, false},
+    {"rgb_float32_to_r11g11b10f", Conversion::RGBFloatsToR11G11B10F, true},
+};
+
+INSTANTIATE_TEST_CASE_P(,
+                        HalfFloatConversionPerfTest,
+                        ::testing::ValuesIn(kHalfFloatConversionParams));
+
+}  // anonymous namespace
@@ -0,0 +1,181 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImageParallelPerf:
+//   Performance test for the heaviest image loads, run on the calling thread or split across the
+//   load worker threads.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+#include "image_util/loadimage_parallel.h"
+
+namespace
+{
+
+struct LoadImageParallelParams
+{
+    const char *name;
+    angle::LoadImageFunction loadFunction;
+    bool parallel;
+
+    size_t width;
+    size_t height;
+    size_t depth;
+
+    // Rows of pixels for uncompressed formats, rows of 4x4 blocks for compressed ones
+    size_t inputBlockHeight;
+    size_t inputRowPitch;
+    size_t outputBlockHeight;
+    size_t outputRowPitch;
+};
+
+std::ostream &operator<<(std::ostream &os, const LoadImageParallelParams &params)
+{
+    return os << params.name << (params.parallel ? "_parallel" : "_serial");
+}
+
+class LoadImageParallelPerfTest : public ANGLEPerfTest,
+                                  public ::testing::WithParamInterface<LoadImageParallelParams>
+{
+  public:
+    LoadImageParallelPerfTest();
+
+    void step() override;
+
+  private:
+    size_t getInputDepthPitch() const;
+    size_t getOutputDepthPitch() const;
+
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImageParallelPerfTest::LoadImageParallelPerfTest()
+    : ANGLEPerfTest("LoadImageParallelPerf",
+                    std::string("_") + GetParam().name +
+                        (GetParam().parallel ? "_parallel" : "_serial"))
+{
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    mInput.resize(getInputDepthPitch() * GetParam().depth);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(byteDistribution(generator));
+    }
+
+    mOutput.resize(getOutputDepthPitch() * GetParam().depth);
+}
+
+size_t LoadImageParallelPerfTest::getInputDepthPitch() const
+{
+    const LoadImageParallelParams &params = GetParam();
+    return params.inputRowPitch * (params.height / params.inputBlockHeight);
+}
+
+size_t LoadImageParallelPerfTest::getOutputDepthPitch() const
+{
+    const LoadImageParallelParams &params = GetParam();
+    return params.outputRowPitch * (params.height / params.outputBlockHeight);
+}
+
+void LoadImageParallelPerfTest::step()
+{
+    const LoadImageParallelParams &params = GetParam();
+    if (params.parallel)
+    {
+        angle::LoadImageParallel(params.loadFunction, params.inputBlockHeight,
+                                 params.outputBlockHeight, params.width, params.height,
+                                 params.depth, mInput.data(), params.inputRowPitch,
+                                 getInputDepthPitch(), mOutput.data(), params.outputRowPitch,
+                                 getOutputDepthPitch());
+    }
+    else
+    {
+        params.loadFunction(params.width, params.height, params.depth, mInput.data(),
+                            params.inputRowPitch, getInputDepthPitch(), mOutput.data(),
+                            params.outputRowPitch, getOutputDepthPitch());
+    }
+}
+
+TEST_P(LoadImageParallelPerfTest, Run)
+{
+    run();
+}
+
+LoadImageParallelParams ETC2D(const char *name,
+                              angle::LoadImageFunction loadFunction,
+                              bool parallel,
+                              size_t inputBlockSize,
+                              size_t outputPixelSize,
+                              size_t outputBlockSize)
+{
+    const size_t size = 2048;
+
+    LoadImageParallelParams params;
+    params.name             = name;
+    params.loadFunction     = loadFunction;
+    params.parallel         = parallel;
+    params.width            = size;
+    params.height           = size;
+    params.depth            = 1;
+    params.inputBlockHeight = 4;
+    params.inputRowPitch    = (size / 4) * inputBlockSize;
+    if (outputBlockSize > 0)
+    {
+        params.outputBlockHeight = 4;
+        params.outputRowPitch    = (size / 4) * outputBlockSize;
+    }
+    else
+    {
+        params.outputBlockHeight = 1;
+        params.outputRowPitch    = size * outputPixelSize;
+    }
+    return params;
+}
+
+LoadImageParallelParams Uncompressed3D(const char *name,
+                                       angle::LoadImageFunction loadFunction,
+                                       bool parallel,
+                                       size_t inputPixelSize,
+                                       size_t outputPixelSize)
+{
+    const size_t size = 256;
+
+    LoadImageParallelParams params;
+    params.name              = name;
+    params.loadFunction      = loadFunction;
+    params.parallel          = parallel;
+    params.width             = size;
+    params.height            = size;
+    params.depth             = 64;
+    params.inputBlockHeight  = 1;
+    params.inputRowPitch     = size * inputPixelSize;
+    params.outputBlockHeight = 1;
+    params.outputRowPitch    = size * outputPixelSize;
+    return params;
+}
+
+// The ETC2 decoders are the heaviest loads, followed by the repacking of large 3D textures.
+const LoadImageParallelParams kLoadImageParallelParams[] = {
+    ETC2D("etc2_rgba8_to_rgba8", angle::LoadETC2RGBA8ToRGBA8, false, 16, 4, 0),
+    ETC2D("etc2_rgba8_to_rgba8", angle::LoadETC2RGBA8ToRGBA8, true, 16, 4, 0),
+    ETC2D("etc2_rgb8_to_bc1", angle::LoadETC2RGB8ToBC1, false, 8, 0, 8),
+    ETC2D("etc2_rgb8_to_bc1", angle::LoadETC2RGB8ToBC1, true, 8, 0, 8),
+    ETC2D("eac_rg11_to_rg8", angle::LoadEACRG11ToRG8, false, 16, 2, 0),
+    ETC2D("eac_rg11_to_rg8", angle::LoadEACRG11ToRG8, true, 16, 2, 0),
+    Uncompressed3D("rgb8_to_bgrx8_3d", angle::LoadRGB8ToBGRX8, false, 3, 4),
+    Uncompressed3D("rgb8_to_bgrx8_3d", angle::LoadRGB8ToBGRX8, true, 3, 4),
+};
+
+INSTANTIATE_TEST_CASE_P(,
+                        LoadImageParallelPerfTest,
+                        ::testing::ValuesIn(kLoadImageParallelParams));
+
+}  // anonymous namespace
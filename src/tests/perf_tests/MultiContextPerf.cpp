@@ -0,0 +1,518 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiContextPerf:
+//   Performance tests driving one context per thread, the contexts being in the same share group
+//   or not. Measures the overhead of eglMakeCurrent, of the current context lookups, of switching
+//   the renderer between contexts and of the shared resource managers, and how the throughput of
+//   draws, uploads and shader compiles scales with the number of threads.
+//
+//   The ANGLE front-end isn't thread-safe, so like any application using contexts on several
+//   threads, the threads take turns using their contexts: each turn makes the context current
+//   under a lock, does a few operations and releases the context.
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ANGLEPerfTest.h"
+#include "shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+enum class MultiContextWorkload
+{
+    Draw,
+    Upload,
+    Compile,
+};
+
+const char *WorkloadName(MultiContextWorkload workload)
+{
+    switch (workload)
+    {
+        case MultiContextWorkload::Draw:
+            return "draw";
+        case MultiContextWorkload::Upload:
+            return "upload";
+        case MultiContextWorkload::Compile:
+            return "compile";
+        default:
+            UNREACHABLE();
+            return "unknown";
+    }
+}
+
+const GLsizei kTextureSize = 64;
+
+struct MultiContextPerfParams final : public RenderTestParams
+{
+    MultiContextPerfParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    // The tests with the same configuration but the number of threads.
+    std::string configSuffix() const
+    {
+        std::stringstream strstr;
+
+        strstr << RenderTestParams::suffix();
+
+        if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+        {
+            strstr << "_null";
+        }
+
+        strstr << "_" << WorkloadName(workload) << (shareGroup ? "_shared" : "_unshared");
+
+        return strstr.str();
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+        strstr << configSuffix() << "_" << threadCount << "_threads";
+        return strstr.str();
+    }
+
+    MultiContextWorkload workload = MultiContextWorkload::Draw;
+    bool shareGroup               = false;
+    unsigned int threadCount      = 1;
+    unsigned int turnsPerStep     = 4;
+    unsigned int opsPerTurn       = 16;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultiContextPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+// Throughput of the single thread runs, to print the scaling of the runs with more threads.
+std::map<std::string, double> gSingleThreadOpsPerSecond;
+
+struct WorkerContext
+{
+    EGLContext context        = EGL_NO_CONTEXT;
+    EGLSurface surface        = EGL_NO_SURFACE;
+    GLuint program            = 0;
+    GLuint buffer             = 0;
+    GLuint texture            = 0;
+    unsigned int compileCount = 0;
+    std::thread thread;
+};
+
+class MultiContextPerfBenchmark : public ANGLERenderTest,
+                                  public ::testing::WithParamInterface<MultiContextPerfParams>
+{
+  public:
+    MultiContextPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+    void TearDown() override;
+
+  private:
+    void workerMain(WorkerContext *worker);
+    bool initializeWorker(WorkerContext *worker);
+    void destroyWorker(WorkerContext *worker);
+    bool runTurn(WorkerContext *worker);
+    bool makeCurrent(WorkerContext *worker);
+    void releaseCurrent();
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    std::vector<WorkerContext> mWorkers;
+    std::vector<GLubyte> mUploadData;
+
+    // Serializes the EGL and GL calls of the workers.
+    std::mutex mGLMutex;
+
+    // Signals the workers to run the turns of a step, and the main thread once they are done.
+    std::mutex mStepMutex;
+    std::condition_variable mStepStartCondition;
+    std::condition_variable mStepDoneCondition;
+    unsigned int mStepIndex      = 0;
+    unsigned int mPendingWorkers = 0;
+    bool mQuit                   = false;
+
+    std::atomic<bool> mWorkerFailed;
+};
+
+MultiContextPerfBenchmark::MultiContextPerfBenchmark()
+    : ANGLERenderTest("MultiContextPerf", GetParam()), mWorkerFailed(false)
+{
+}
+
+void MultiContextPerfBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_LT(0u, params.threadCount);
+    ASSERT_LT(0u, params.turnsPerStep);
+    ASSERT_LT(0u, params.opsPerTurn);
+
+    EGLWindow *eglWindow = getEGLWindow();
+    mDisplay             = eglWindow->getDisplay();
+
+    mUploadData.resize(kTextureSize * kTextureSize * 4, 0x7f);
+
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_CLIENT_VERSION, params.majorVersion, EGL_NONE,
+    };
+    const EGLint surfaceAttributes[] = {
+        EGL_WIDTH, kTextureSize, EGL_HEIGHT, kTextureSize, EGL_NONE,
+    };
+    EGLContext shareContext = params.shareGroup ? eglWindow->getContext() : EGL_NO_CONTEXT;
+
+    mWorkers.resize(params.threadCount);
+    for (WorkerContext &worker : mWorkers)
+    {
+        worker.context = eglCreateContext(mDisplay, eglWindow->getConfig(), shareContext,
+                                          contextAttributes);
+        ASSERT_NE(EGL_NO_CONTEXT, worker.context);
+
+        worker.surface =
+            eglCreatePbufferSurface(mDisplay, eglWindow->getConfig(), surfaceAttributes);
+        ASSERT_NE(EGL_NO_SURFACE, worker.surface);
+    }
+
+    for (WorkerContext &worker : mWorkers)
+    {
+        worker.thread = std::thread(&MultiContextPerfBenchmark::workerMain, this, &worker);
+    }
+}
+
+void MultiContextPerfBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mStepMutex);
+        mQuit = true;
+    }
+    mStepStartCondition.notify_all();
+
+    for (WorkerContext &worker : mWorkers)
+    {
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+    }
+
+    // The workers switched the renderer to their contexts.
+    EGLWindow *eglWindow = getEGLWindow();
+    eglMakeCurrent(mDisplay, eglWindow->getSurface(), eglWindow->getSurface(),
+                   eglWindow->getContext());
+
+    for (WorkerContext &worker : mWorkers)
+    {
+        if (worker.surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(mDisplay, worker.surface);
+        }
+        if (worker.context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(mDisplay, worker.context);
+        }
+    }
+    mWorkers.clear();
+}
+
+void MultiContextPerfBenchmark::drawBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mStepMutex);
+        mPendingWorkers = static_cast<unsigned int>(mWorkers.size());
+        ++mStepIndex;
+    }
+    mStepStartCondition.notify_all();
+
+    {
+        std::unique_lock<std::mutex> lock(mStepMutex);
+        mStepDoneCondition.wait(lock, [this]() { return mPendingWorkers == 0; });
+    }
+
+    if (mWorkerFailed)
+    {
+        abortTest();
+        FAIL() << "A worker thread failed";
+    }
+}
+
+void MultiContextPerfBenchmark::TearDown()
+{
+    const auto &params = GetParam();
+
+    double opsPerStep =
+        static_cast<double>(params.threadCount * params.turnsPerStep * params.opsPerTurn);
+    double opsPerSecond = getStepsPerSecond() * opsPerStep;
+    if (opsPerSecond > 0.0)
+    {
+        printResult("ops_per_second", opsPerSecond, "ops", true);
+        printResult("ops_per_second_per_thread", opsPerSecond / params.threadCount, "ops", false);
+
+        // The single thread runs are instantiated first.
+        const std::string &config = params.configSuffix();
+        if (params.threadCount == 1)
+        {
+            gSingleThreadOpsPerSecond[config] = opsPerSecond;
+        }
+        else if (gSingleThreadOpsPerSecond.count(config) > 0)
+        {
+            printResult("scaling", opsPerSecond / gSingleThreadOpsPerSecond[config], "x", true);
+        }
+    }
+
+    ANGLERenderTest::TearDown();
+}
+
+void MultiContextPerfBenchmark::workerMain(WorkerContext *worker)
+{
+    if (!initializeWorker(worker))
+    {
+        mWorkerFailed = true;
+    }
+
+    unsigned int lastStepIndex = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mStepMutex);
+            mStepStartCondition.wait(
+                lock, [this, lastStepIndex]() { return mQuit || mStepIndex != lastStepIndex; });
+            if (mQuit)
+            {
+                break;
+            }
+            lastStepIndex = mStepIndex;
+        }
+
+        for (unsigned int turn = 0; turn < GetParam().turnsPerStep && !mWorkerFailed; ++turn)
+        {
+            if (!runTurn(worker))
+            {
+                mWorkerFailed = true;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mStepMutex);
+            --mPendingWorkers;
+        }
+        mStepDoneCondition.notify_one();
+    }
+
+    destroyWorker(worker);
+}
+
+bool MultiContextPerfBenchmark::initializeWorker(WorkerContext *worker)
+{
+    const std::string vs = SHADER_SOURCE
+    (
+        attribute vec2 vPosition;
+        void main()
+        {
+            gl_Position = vec4(vPosition, 0, 1);
+        }
+    );
+
+    const std::string fs = SHADER_SOURCE
+    (
+        precision mediump float;
+        uniform sampler2D uTexture;
+        void main()
+        {
+            gl_FragColor = texture2D(uTexture, vec2(0.5, 0.5));
+        }
+    );
+
+    const GLfloat vertices[] = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+
+    std::lock_guard<std::mutex> lock(mGLMutex);
+    if (!makeCurrent(worker))
+    {
+        return false;
+    }
+
+    worker->program = CompileProgram(vs, fs);
+
+    glGenBuffers(1, &worker->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, worker->buffer);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(mUploadData.size()), nullptr,
+                 GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+
+    glGenTextures(1, &worker->texture);
+    glBindTexture(GL_TEXTURE_2D, worker->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, mUploadData.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glUseProgram(worker->program);
+    GLint positionLocation = glGetAttribLocation(worker->program, "vPosition");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+    glViewport(0, 0, kTextureSize, kTextureSize);
+
+    bool success = (worker->program != 0 && glGetError() == GL_NO_ERROR);
+    releaseCurrent();
+    return success;
+}
+
+void MultiContextPerfBenchmark::destroyWorker(WorkerContext *worker)
+{
+    std::lock_guard<std::mutex> lock(mGLMutex);
+    if (!makeCurrent(worker))
+    {
+        return;
+    }
+
+    glDeleteProgram(worker->program);
+    glDeleteBuffers(1, &worker->buffer);
+    glDeleteTextures(1, &worker->texture);
+
+    releaseCurrent();
+}
+
+bool MultiContextPerfBenchmark::runTurn(WorkerContext *worker)
+{
+    const auto &params = GetParam();
+
+    std::lock_guard<std::mutex> lock(mGLMutex);
+    if (!makeCurrent(worker))
+    {
+        return false;
+    }
+
+    switch (params.workload)
+    {
+        case MultiContextWorkload::Draw:
+            for (unsigned int op = 0; op < params.opsPerTurn; ++op)
+            {
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            break;
+
+        case MultiContextWorkload::Upload:
+            // The vertices are at the start of the buffer.
+            for (unsigned int op = 0; op < params.opsPerTurn; ++op)
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, 1024, 1024, mUploadData.data());
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTextureSize, kTextureSize, GL_RGBA,
+                                GL_UNSIGNED_BYTE, mUploadData.data());
+            }
+            break;
+
+        case MultiContextWorkload::Compile:
+            for (unsigned int op = 0; op < params.opsPerTurn; ++op)
+            {
+                // Unique sources, in case the implementation caches the compiled shaders.
+                std::stringstream fs;
+                fs << "precision mediump float;\n"
+                   << "uniform sampler2D uTexture;\n"
+                   << "void main()\n"
+                   << "{\n"
+                   << "    gl_FragColor = texture2D(uTexture, vec2(0.5)) * "
+                   << (worker->compileCount++ % 100000) << ".0;\n"
+                   << "}\n";
+                GLuint shader = CompileShader(GL_FRAGMENT_SHADER, fs.str());
+                if (shader == 0)
+                {
+                    releaseCurrent();
+                    return false;
+                }
+                glDeleteShader(shader);
+            }
+            break;
+
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    // Flush so that the GPU driver occasionally sends its internal command queue to the GPU. The
+    // null device benchmarks are only testing CPU overhead, so they don't need to flush.
+    if (params.eglParameters.deviceType != EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+    {
+        glFlush();
+    }
+
+    bool success = (glGetError() == GL_NO_ERROR);
+    releaseCurrent();
+    return success;
+}
+
+bool MultiContextPerfBenchmark::makeCurrent(WorkerContext *worker)
+{
+    return eglMakeCurrent(mDisplay, worker->surface, worker->surface, worker->context) ==
+           EGL_TRUE;
+}
+
+void MultiContextPerfBenchmark::releaseCurrent()
+{
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+using namespace egl_platform;
+
+// The GL back-ends use a single native context, which can't be made current on several threads.
+std::vector<MultiContextPerfParams> MultiContextPerfD3D11Params()
+{
+    const MultiContextWorkload workloads[] = {
+        MultiContextWorkload::Draw, MultiContextWorkload::Upload, MultiContextWorkload::Compile,
+    };
+    const unsigned int threadCounts[] = {1, 2, 4, 8};
+
+    std::vector<MultiContextPerfParams> allParams;
+    for (bool useNullDevice : {true, false})
+    {
+        for (MultiContextWorkload workload : workloads)
+        {
+            for (bool shareGroup : {true, false})
+            {
+                for (unsigned int threadCount : threadCounts)
+                {
+                    MultiContextPerfParams params;
+                    params.eglParameters = useNullDevice ? D3D11_NULL() : D3D11();
+                    params.workload      = workload;
+                    params.shareGroup    = shareGroup;
+                    params.threadCount   = threadCount;
+                    params.opsPerTurn    = (workload == MultiContextWorkload::Compile ? 1 : 16);
+                    allParams.push_back(params);
+                }
+            }
+        }
+    }
+    return allParams;
+}
+
+TEST_P(MultiContextPerfBenchmark, Run)
+{
+    run();
+}
+
+const std::vector<MultiContextPerfParams> kMultiContextPerfParams = MultiContextPerfD3D11Params();
+
+INSTANTIATE_TEST_CASE_P(,
+                        MultiContextPerfBenchmark,
+                        ::testing::ValuesIn(FilterTestParams(kMultiContextPerfParams.data(),
+                                                             kMultiContextPerfParams.size())),
+                        ::testing::PrintToStringParamName());
+
+}  // anonymous namespace
@@ -0,0 +1,226 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ProgramLinkPerf:
+//   Performance test for linking programs with growing numbers of uniforms and varyings.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+struct ProgramLinkParams final : public RenderTestParams
+{
+    ProgramLinkParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+        iterations   = 4;
+
+        interfaceSize = 64;
+    }
+
+    std::string suffix() const override;
+
+    // Uniforms of each shader, half of them shared, and varyings declared by both shaders. Only a
+    // few of the varyings are used, to stay within the varying vectors of all the backends.
+    size_t interfaceSize;
+
+    // static parameters
+    size_t iterations;
+};
+
+std::ostream &operator<<(std::ostream &os, const ProgramLinkParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string ProgramLinkParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+    strstr << "_" << interfaceSize << "_interface_variables";
+
+    return strstr.str();
+}
+
+class ProgramLinkBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<ProgramLinkParams>
+{
+  public:
+    ProgramLinkBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram;
+};
+
+ProgramLinkBenchmark::ProgramLinkBenchmark()
+    : ANGLERenderTest("ProgramLink", GetParam()), mProgram(0u)
+{
+}
+
+// The first half of the uniforms of each shader are shared by both shaders.
+std::string GetUniformName(size_t idx, size_t interfaceSize, bool vertexShader)
+{
+    std::stringstream strstr;
+    if (idx < interfaceSize / 2)
+    {
+        strstr << "u_shared_" << idx;
+    }
+    else
+    {
+        strstr << (vertexShader ? "vs" : "fs") << "_u_" << idx;
+    }
+    return strstr.str();
+}
+
+std::string GetShaderSource(size_t interfaceSize, bool vertexShader)
+{
+    const size_t usedVaryings = std::min<size_t>(interfaceSize, 4);
+    const char *output        = (vertexShader ? "gl_Position" : "gl_FragColor");
+
+    std::stringstream strstr;
+    strstr << "precision mediump float;\n";
+    for (size_t i = 0; i < interfaceSize; i++)
+    {
+        strstr << "uniform vec4 " << GetUniformName(i, interfaceSize, vertexShader) << ";\n";
+        strstr << "varying vec4 v_" << i << ";\n";
+    }
+    strstr << "void main()\n"
+              "{\n"
+              "    "
+           << output << " = vec4(0, 0, 0, 0);\n";
+    for (size_t i = 0; i < interfaceSize; i++)
+    {
+        strstr << "    " << output << " += " << GetUniformName(i, interfaceSize, vertexShader)
+               << ";\n";
+    }
+    for (size_t i = 0; i < usedVaryings; i++)
+    {
+        if (vertexShader)
+        {
+            strstr << "    v_" << i << " = gl_Position;\n";
+        }
+        else
+        {
+            strstr << "    gl_FragColor += v_" << i << ";\n";
+        }
+    }
+    strstr << "}";
+    return strstr.str();
+}
+
+void ProgramLinkBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_GT(params.iterations, 0u);
+
+    GLint maxVertexUniforms, maxFragmentUniforms;
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_VECTORS, &maxVertexUniforms);
+    glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_VECTORS, &maxFragmentUniforms);
+    if (params.interfaceSize >
+        static_cast<size_t>(std::min(maxVertexUniforms, maxFragmentUniforms)))
+    {
+        FAIL() << "Uniform count (" << params.interfaceSize << ") exceeds the maximum uniform "
+               << "counts: " << maxVertexUniforms << ", " << maxFragmentUniforms << std::endl;
+    }
+
+    // The shaders stay attached, so that each iteration links the program again.
+    GLuint vertexShader =
+        CompileShader(GL_VERTEX_SHADER, GetShaderSource(params.interfaceSize, true));
+    GLuint fragmentShader =
+        CompileShader(GL_FRAGMENT_SHADER, GetShaderSource(params.interfaceSize, false));
+    ASSERT_NE(0u, vertexShader);
+    ASSERT_NE(0u, fragmentShader);
+
+    mProgram = glCreateProgram();
+    glAttachShader(mProgram, vertexShader);
+    glAttachShader(mProgram, fragmentShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glLinkProgram(mProgram);
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(mProgram, GL_LINK_STATUS, &linkStatus);
+    ASSERT_EQ(GL_TRUE, linkStatus);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ProgramLinkBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void ProgramLinkBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (size_t it = 0; it < params.iterations; ++it)
+    {
+        glLinkProgram(mProgram);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+ProgramLinkParams D3D11Params(size_t interfaceSize)
+{
+    ProgramLinkParams params;
+    params.eglParameters = egl_platform::D3D11();
+    params.interfaceSize = interfaceSize;
+    return params;
+}
+
+ProgramLinkParams D3D9Params(size_t interfaceSize)
+{
+    ProgramLinkParams params;
+    params.eglParameters = egl_platform::D3D9();
+    params.interfaceSize = interfaceSize;
+    return params;
+}
+
+ProgramLinkParams OpenGLParams(size_t interfaceSize)
+{
+    ProgramLinkParams params;
+    params.eglParameters = egl_platform::OPENGL();
+    params.interfaceSize = interfaceSize;
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(ProgramLinkBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(ProgramLinkBenchmark,
+                       D3D11Params(16),
+                       D3D11Params(64),
+                       D3D11Params(200),
+                       D3D9Params(16),
+                       D3D9Params(64),
+                       D3D9Params(200),
+                       OpenGLParams(16),
+                       OpenGLParams(64),
+                       OpenGLParams(200));
@@ -278,6 +278,19 @@ TextureSamplingParams OpenGLParams()
     return params;
 }
 
+// Many small, unchanging textures and a trivial kernel, so that the per-draw CPU cost of
+// validating and syncing the bound textures dominates.
+TextureSamplingParams ManyTexturesParams(const EGLPlatformParameters &eglParameters)
+{
+    TextureSamplingParams params;
+    params.eglParameters = eglParameters;
+    params.iterations    = 100;
+    params.numSamplers   = 8;
+    params.textureSize   = 4;
+    params.kernelSize    = 1;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(TextureSamplingBenchmark, Run)
@@ -285,4 +298,9 @@ TEST_P(TextureSamplingBenchmark, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(TextureSamplingBenchmark, D3D11Params(), D3D9Params(), OpenGLParams());
+ANGLE_INSTANTIATE_TEST(TextureSamplingBenchmark,
+                       D3D11Params(),
+                       D3D9Params(),
+                       OpenGLParams(),
+                       ManyTexturesParams(egl_platform::D3D11()),
+                       ManyTexturesParams(egl_platform::OPENGL()));
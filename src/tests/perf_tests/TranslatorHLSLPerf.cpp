@@ -0,0 +1,136 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslatorHLSLPerf:
+//   Performance test for translating shaders using many HLSL helper functions, like texture
+//   functions, constructors, array helpers and emulated built-ins.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "angle_gl.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+const char *kESSL100Shader =
+    "precision mediump float;\n"
+    "uniform sampler2D s2D;\n"
+    "uniform samplerCube sCube;\n"
+    "uniform vec4 u;\n"
+    "uniform mat2 m;\n"
+    "varying vec2 v;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 c = texture2D(s2D, v) + texture2D(s2D, v, 0.5) +\n"
+    "             texture2DProj(s2D, vec3(v, 2.0)) + texture2DProj(s2D, vec4(v, 0.0, 2.0)) +\n"
+    "             textureCube(sCube, vec3(v, 1.0)) + textureCube(sCube, vec3(v, 1.0), 0.5);\n"
+    "    mat2 m2 = mat2(u);\n"
+    "    mat3 m3 = mat3(m);\n"
+    "    vec3 a = vec3(u.x, u.yz);\n"
+    "    vec4 b = vec4(a, 1.0) + vec4(u.xy, v);\n"
+    "    float f = mod(u.x, 2.0) + atan(u.y, u.z) + distance(u.xy, v);\n"
+    "    vec2 g = mod(v, vec2(3.0)) + faceforward(v, u.xy, u.zw) + reflect(v, u.xy);\n"
+    "    gl_FragColor = c + b + vec4(m2[0], m3[1].xy) + vec4(f) + vec4(g, m2 * v);\n"
+    "}\n";
+
+const char *kESSL300Shader =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "uniform sampler2D s2D;\n"
+    "uniform highp sampler3D s3D;\n"
+    "uniform highp isampler2D si2D;\n"
+    "uniform highp sampler2DArray s2DArray;\n"
+    "uniform vec4 u[4];\n"
+    "in vec2 v;\n"
+    "out vec4 color;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 a[4] = u;\n"
+    "    vec4 b[4];\n"
+    "    b = a;\n"
+    "    vec4 d[2] = vec4[2](u[0], u[1]);\n"
+    "    bool same = (a == u);\n"
+    "    vec4 c = texture(s2D, v) + textureLod(s2D, v, 1.0) + textureOffset(s2D, v, ivec2(1)) +\n"
+    "             texelFetch(s2D, ivec2(v), 0) + vec4(textureSize(s2D, 0), 0, 0) +\n"
+    "             texture(s3D, vec3(v, 0.5)) + vec4(texture(si2D, v)) +\n"
+    "             texture(s2DArray, vec3(v, 1.0)) + textureGrad(s2D, v, dFdx(v), dFdy(v)) +\n"
+    "             textureProj(s2D, vec3(v, 2.0)) + textureProjLod(s2D, vec4(v, 0.0, 2.0), 1.0);\n"
+    "    mat2x3 m = mat2x3(u[0].xyz, u[1].xyz);\n"
+    "    color = (same ? c + b[1] : d[1]) + vec4(m * v, 1.0) + vec4(mod(v, vec2(2.0)), v);\n"
+    "}\n";
+
+struct TranslatorHLSLParams
+{
+    const char *name;
+    ShShaderSpec spec;
+    ShShaderOutput output;
+    const char *shader;
+};
+
+std::ostream &operator<<(std::ostream &os, const TranslatorHLSLParams &params)
+{
+    return os << params.name;
+}
+
+class TranslatorHLSLPerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<TranslatorHLSLParams>
+{
+  public:
+    TranslatorHLSLPerfTest();
+    ~TranslatorHLSLPerfTest();
+
+    void step() override;
+
+  private:
+    ShHandle mCompiler;
+};
+
+TranslatorHLSLPerfTest::TranslatorHLSLPerfTest()
+    : ANGLEPerfTest("TranslatorHLSLPerf", std::string("_") + GetParam().name), mCompiler(nullptr)
+{
+    const TranslatorHLSLParams &params = GetParam();
+
+    ShInitialize();
+
+    ShBuiltInResources resources;
+    ShInitBuiltInResources(&resources);
+    mCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, params.spec, params.output, &resources);
+}
+
+TranslatorHLSLPerfTest::~TranslatorHLSLPerfTest()
+{
+    if (mCompiler)
+    {
+        ShDestruct(mCompiler);
+    }
+}
+
+void TranslatorHLSLPerfTest::step()
+{
+    const char *shaderStrings[] = {GetParam().shader};
+    if (!ShCompile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE))
+    {
+        FAIL() << "Shader translation failed: " << ShGetInfoLog(mCompiler);
+    }
+}
+
+TEST_P(TranslatorHLSLPerfTest, Run)
+{
+    run();
+}
+
+const TranslatorHLSLParams kTranslatorHLSLParams[] = {
+    {"essl100_hlsl3", SH_GLES2_SPEC, SH_HLSL_3_0_OUTPUT, kESSL100Shader},
+    {"essl100_hlsl4", SH_GLES2_SPEC, SH_HLSL_4_1_OUTPUT, kESSL100Shader},
+    {"essl300_hlsl4", SH_GLES3_SPEC, SH_HLSL_4_1_OUTPUT, kESSL300Shader},
+};
+
+INSTANTIATE_TEST_CASE_P(,
+                        TranslatorHLSLPerfTest,
+                        ::testing::ValuesIn(kTranslatorHLSLParams));
+
+}  // anonymous namespace
@@ -17,7 +17,8 @@ EGLPlatformParameters::EGLPlatformParameters()
       majorVersion(EGL_DONT_CARE),
       minorVersion(EGL_DONT_CARE),
       deviceType(EGL_DONT_CARE),
-      presentPath(EGL_DONT_CARE)
+      presentPath(EGL_DONT_CARE),
+      clientArrayTracking(EGL_DONT_CARE)
 {
 }
 
@@ -26,7 +27,8 @@ EGLPlatformParameters::EGLPlatformParameters(EGLint renderer)
       majorVersion(EGL_DONT_CARE),
       minorVersion(EGL_DONT_CARE),
       deviceType(EGL_DONT_CARE),
-      presentPath(EGL_DONT_CARE)
+      presentPath(EGL_DONT_CARE),
+      clientArrayTracking(EGL_DONT_CARE)
 {
     if (renderer == EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE ||
         renderer == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
@@ -43,7 +45,8 @@ EGLPlatformParameters::EGLPlatformParameters(EGLint renderer,
       majorVersion(majorVersion),
       minorVersion(minorVersion),
       deviceType(useWarp),
-      presentPath(EGL_DONT_CARE)
+      presentPath(EGL_DONT_CARE),
+      clientArrayTracking(EGL_DONT_CARE)
 {
 }
 
@@ -56,7 +59,8 @@ EGLPlatformParameters::EGLPlatformParameters(EGLint renderer,
       majorVersion(majorVersion),
       minorVersion(minorVersion),
       deviceType(useWarp),
-      presentPath(presentPath)
+      presentPath(presentPath),
+      clientArrayTracking(EGL_DONT_CARE)
 {
 }
 
@@ -82,14 +86,19 @@ bool operator<(const EGLPlatformParameters &a, const EGLPlatformParameters &b)
         return a.deviceType < b.deviceType;
     }
 
-    return a.presentPath < b.presentPath;
+    if (a.presentPath != b.presentPath)
+    {
+        return a.presentPath < b.presentPath;
+    }
+
+    return a.clientArrayTracking < b.clientArrayTracking;
 }
 
 bool operator==(const EGLPlatformParameters &a, const EGLPlatformParameters &b)
 {
     return (a.renderer == b.renderer) && (a.majorVersion == b.majorVersion) &&
            (a.minorVersion == b.minorVersion) && (a.deviceType == b.deviceType) &&
-           (a.presentPath == b.presentPath);
+           (a.presentPath == b.presentPath) && (a.clientArrayTracking == b.clientArrayTracking);
 }
 
 EGLWindow::EGLWindow(EGLint glesMajorVersion,
@@ -179,6 +188,12 @@ bool EGLWindow::initializeGL(OSWindow *osWindow)
         displayAttributes.push_back(EGL_EXPERIMENTAL_PRESENT_PATH_ANGLE);
         displayAttributes.push_back(mPlatform.presentPath);
     }
+
+    if (mPlatform.clientArrayTracking != EGL_DONT_CARE)
+    {
+        displayAttributes.push_back(EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE);
+        displayAttributes.push_back(mPlatform.clientArrayTracking);
+    }
     displayAttributes.push_back(EGL_NONE);
 
     mDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
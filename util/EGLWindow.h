@@ -28,6 +28,12 @@ class OSWindow;
 #define EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE 0x6AC0
 #endif
 
+// A hidden display attribute of the OpenGL renderer that skips re-uploading client arrays that
+// did not change since the previous draw.
+#ifndef EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE
+#define EGL_PLATFORM_ANGLE_CLIENT_ARRAY_TRACKING_ANGLE 0x6AC1
+#endif
+
 struct EGLPlatformParameters
 {
     EGLint renderer;
@@ -35,6 +41,7 @@ struct EGLPlatformParameters
     EGLint minorVersion;
     EGLint deviceType;
     EGLint presentPath;
+    EGLint clientArrayTracking;
 
     EGLPlatformParameters();
     explicit EGLPlatformParameters(EGLint renderer);
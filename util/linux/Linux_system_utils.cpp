@@ -8,6 +8,7 @@
 
 #include "system_utils.h"
 
+#include <sched.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -44,4 +45,17 @@ std::string GetSharedLibraryExtension()
     return "so";
 }
 
+bool SetCurrentThreadAffinity(unsigned int core)
+{
+    if (core >= CPU_SETSIZE)
+    {
+        return false;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    return sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+}
+
 } // namespace angle
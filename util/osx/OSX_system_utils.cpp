@@ -47,4 +47,10 @@ std::string GetSharedLibraryExtension()
     return "dylib";
 }
 
+bool SetCurrentThreadAffinity(unsigned int core)
+{
+    // OSX only supports affinity hints between threads, not binding a thread to a core.
+    return false;
+}
+
 } // namespace angle
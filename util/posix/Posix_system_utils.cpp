@@ -42,6 +42,19 @@ void SetLowPriorityProcess()
     setpriority(PRIO_PROCESS, getpid(), 10);
 }
 
+double GetCurrentProcessCpuTime()
+{
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0.0;
+    }
+
+    double userSeconds   = usage.ru_utime.tv_sec + (1.0 / 1000000) * usage.ru_utime.tv_usec;
+    double systemSeconds = usage.ru_stime.tv_sec + (1.0 / 1000000) * usage.ru_stime.tv_usec;
+    return userSeconds + systemSeconds;
+}
+
 void WriteDebugMessage(const char *format, ...)
 {
     // TODO(jmadill): Implement this
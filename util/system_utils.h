@@ -25,6 +25,12 @@ void Sleep(unsigned int milliseconds);
 
 void SetLowPriorityProcess();
 
+// Returns the CPU time spent by all the threads of the process so far, in seconds.
+double GetCurrentProcessCpuTime();
+
+// Restricts the calling thread to run on the given core. Returns false if it isn't supported.
+bool SetCurrentThreadAffinity(unsigned int core);
+
 // Write a debug message, either to a standard output or Debug window.
 void WriteDebugMessage(const char *format, ...);
 
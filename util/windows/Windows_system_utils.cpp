@@ -41,6 +41,27 @@ void Sleep(unsigned int milliseconds)
     ::Sleep(static_cast<DWORD>(milliseconds));
 }
 
+double GetCurrentProcessCpuTime()
+{
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0.0;
+    }
+
+    // FILETIMEs count 100 nanosecond intervals.
+    ULARGE_INTEGER kernelTicks;
+    kernelTicks.LowPart  = kernelTime.dwLowDateTime;
+    kernelTicks.HighPart = kernelTime.dwHighDateTime;
+    ULARGE_INTEGER userTicks;
+    userTicks.LowPart  = userTime.dwLowDateTime;
+    userTicks.HighPart = userTime.dwHighDateTime;
+    return static_cast<double>(kernelTicks.QuadPart + userTicks.QuadPart) * 1.0e-7;
+}
+
 void WriteDebugMessage(const char *format, ...)
 {
     va_list args;
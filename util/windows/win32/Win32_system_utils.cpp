@@ -19,6 +19,15 @@ void SetLowPriorityProcess()
     SetPriorityClass(GetCurrentProcess(), BELOW_NORMAL_PRIORITY_CLASS);
 }
 
+bool SetCurrentThreadAffinity(unsigned int core)
+{
+    if (core >= sizeof(DWORD_PTR) * 8)
+    {
+        return false;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << core) != 0;
+}
+
 class Win32Library : public Library
 {
   public:
@@ -19,6 +19,12 @@ void SetLowPriorityProcess()
     // No equivalent to this in WinRT
 }
 
+bool SetCurrentThreadAffinity(unsigned int core)
+{
+    // No equivalent to this in WinRT
+    return false;
+}
+
 Library *loadLibrary(const std::string &libraryName)
 {
     // WinRT cannot load code dynamically.